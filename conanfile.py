@@ -5,7 +5,8 @@ import os
 
 class SupercellWxConan(ConanFile):
     settings   = ("os", "compiler", "build_type", "arch")
-    requires   = ("boost/1.86.0",
+    requires   = ("benchmark/1.9.1",
+                  "boost/1.86.0",
                   "cpr/1.11.1",
                   "fontconfig/2.15.0",
                   "freetype/2.13.2",
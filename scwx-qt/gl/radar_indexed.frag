@@ -0,0 +1,30 @@
+#version 330 core
+
+// Lower the default precision to medium
+precision mediump float;
+
+uniform sampler1D uTexture;
+uniform uint uDataMomentOffset;
+uniform float uDataMomentScale;
+
+uniform bool uCFPEnabled;
+uniform bool uInterpolateMoments;
+
+in float      dataMoment;
+flat in float flatDataMoment;
+flat in float cfpMoment;
+
+layout (location = 0) out vec4 fragColor;
+
+void main()
+{
+   float moment   = uInterpolateMoments ? dataMoment : flatDataMoment;
+   float texCoord = (moment - float(uDataMomentOffset)) / uDataMomentScale;
+
+   if (uCFPEnabled && cfpMoment > 8u)
+   {
+      texCoord = texCoord - float(cfpMoment - 8u) / 2.0f;
+   }
+
+   fragColor = texture(uTexture, texCoord);
+}
@@ -0,0 +1,101 @@
+#version 330 core
+
+#define DEGREES_MAX   360.0f
+#define LATITUDE_MAX  85.051128779806604f
+#define LONGITUDE_MAX 180.0f
+#define PI            3.1415926535897932384626433f
+#define RAD2DEG       57.295779513082320876798156332941f
+
+// Start and end radial edge, near and far gate edge of each cell
+layout (location = 0) in uvec4 aCell;
+layout (location = 1) in uvec4 aDataMoment;
+layout (location = 2) in uint aCfpMoment;
+
+uniform mat4 uMVPMatrix;
+uniform vec2 uMapScreenCoord;
+
+uniform vec2  uRadarLatLong;
+uniform float uGateSize;
+uniform float uGateRangeOffset;
+uniform vec2  uGeodesicInterval;
+uniform bool  uInterpolateMoments;
+
+uniform sampler1D uRadialAngles;
+uniform sampler2D uGeodesicTable;
+
+out float dataMoment;
+out float cfpMoment;
+
+// Two triangles are drawn per cell, matching the vertex layout
+//
+// 2 +---+ 4
+//   |  /|
+//   | / |
+//   |/  |
+// 1 +---+ 3
+//
+// Each corner is a (radial edge, gate edge) pair
+const ivec2 kCorners[6] = ivec2[6](ivec2(0, 0),
+                                   ivec2(0, 1),
+                                   ivec2(1, 1),
+                                   ivec2(0, 0),
+                                   ivec2(1, 0),
+                                   ivec2(1, 1));
+
+vec2 latLngToScreenCoordinate(in vec2 latLng)
+{
+   vec2 p;
+   latLng.x = clamp(latLng.x, -LATITUDE_MAX, LATITUDE_MAX);
+   p.xy     = vec2(LONGITUDE_MAX + latLng.y,
+                   -(LONGITUDE_MAX - RAD2DEG * log(tan(PI / 4 + latLng.x * PI / DEGREES_MAX))));
+   return p;
+}
+
+void main()
+{
+   ivec2 corner = kCorners[gl_VertexID];
+
+   uint radialEdge = (corner.x == 0) ? aCell.x : aCell.y;
+   uint gateEdge   = (corner.y == 0) ? aCell.z : aCell.w;
+
+   // Gate edge 0 is the radar site
+   float azimuth = texelFetch(uRadialAngles, int(radialEdge), 0).r;
+   float range   = (gateEdge == 0u) ?
+                      0.0f :
+                      (float(gateEdge) - 1.0f + uGateRangeOffset) * uGateSize;
+
+   // Interpolate the geodesic offset from the radar site. Samples are fetched
+   // and weighted in full precision, as the weights of hardware filtering are
+   // only 8-bit. Azimuth wraps, and range is clamped to the last sample.
+   ivec2 tableSize   = textureSize(uGeodesicTable, 0);
+   vec2  sampleCoord = vec2(azimuth, range) / uGeodesicInterval;
+   sampleCoord.y     = clamp(sampleCoord.y, 0.0f, float(tableSize.y - 1));
+
+   vec2 sample0 = floor(sampleCoord);
+   sample0.y    = min(sample0.y, float(tableSize.y - 2));
+   vec2 weight  = sampleCoord - sample0;
+
+   int column0 = (int(sample0.x) % tableSize.x + tableSize.x) % tableSize.x;
+   int column1 = (column0 + 1) % tableSize.x;
+   int row0    = int(sample0.y);
+   int row1    = row0 + 1;
+
+   vec2 offset0 = mix(texelFetch(uGeodesicTable, ivec2(column0, row0), 0).rg,
+                      texelFetch(uGeodesicTable, ivec2(column1, row0), 0).rg,
+                      weight.x);
+   vec2 offset1 = mix(texelFetch(uGeodesicTable, ivec2(column0, row1), 0).rg,
+                      texelFetch(uGeodesicTable, ivec2(column1, row1), 0).rg,
+                      weight.x);
+   vec2 latLong = uRadarLatLong + mix(offset0, offset1, weight.y);
+
+   // Pass the coded data moment to the fragment shader. When smoothing, each
+   // corner has its own data moment.
+   dataMoment = uInterpolateMoments ? aDataMoment[corner.x * 2 + corner.y] :
+                                      aDataMoment.x;
+   cfpMoment  = aCfpMoment;
+
+   vec2 p = latLngToScreenCoordinate(latLong) - uMapScreenCoord;
+
+   // Transform the position to screen coordinates
+   gl_Position = uMVPMatrix * vec4(p, 0.0f, 1.0f);
+}
@@ -388,14 +388,16 @@ set(HDR_VIEW source/scwx/qt/view/level2_product_view.hpp
              source/scwx/qt/view/level3_raster_view.hpp
              source/scwx/qt/view/overlay_product_view.hpp
              source/scwx/qt/view/radar_product_view.hpp
-             source/scwx/qt/view/radar_product_view_factory.hpp)
+             source/scwx/qt/view/radar_product_view_factory.hpp
+             source/scwx/qt/view/sweep_geometry.hpp)
 set(SRC_VIEW source/scwx/qt/view/level2_product_view.cpp
              source/scwx/qt/view/level3_product_view.cpp
              source/scwx/qt/view/level3_radial_view.cpp
              source/scwx/qt/view/level3_raster_view.cpp
              source/scwx/qt/view/overlay_product_view.cpp
              source/scwx/qt/view/radar_product_view.cpp
-             source/scwx/qt/view/radar_product_view_factory.cpp)
+             source/scwx/qt/view/radar_product_view_factory.cpp
+             source/scwx/qt/view/sweep_geometry.cpp)
 
 set(RESOURCE_FILES scwx-qt.qrc)
 
@@ -406,6 +408,9 @@ set(SHADER_FILES gl/color.frag
                  gl/map_color.vert
                  gl/radar.frag
                  gl/radar.vert
+                 gl/radar_indexed.frag
+                 gl/radar_indexed.vert
+                 gl/radar_polar.vert
                  gl/texture1d.frag
                  gl/texture1d.vert
                  gl/texture2d.frag
@@ -39,12 +39,12 @@
 #include <scwx/common/products.hpp>
 #include <scwx/common/vcp.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/scheduler.hpp>
 #include <scwx/util/time.hpp>
 
 #include <set>
 
 #include <boost/asio/post.hpp>
-#include <boost/asio/thread_pool.hpp>
 #include <QDesktopServices>
 #include <QKeyEvent>
 #include <QFileDialog>
@@ -150,7 +150,7 @@ public:
          customStyleDrawLayerChangedCallbackUuid_);
 
       clockTimer_.stop();
-      threadPool_.join();
+      taskQueue_.join();
    }
 
    void AddRadarSitePreset(const std::string& id);
@@ -180,7 +180,7 @@ public:
    void UpdateRadarSite();
    void UpdateVcp();
 
-   boost::asio::thread_pool threadPool_ {1u};
+   scwx::util::TaskQueue taskQueue_ {scwx::util::TaskPriority::Network};
 
    MainWindow*         mainWindow_;
    QMapLibre::Settings settings_;
@@ -667,7 +667,7 @@ void MainWindow::on_actionGitHubRepository_triggered()
 void MainWindow::on_actionCheckForUpdates_triggered()
 {
    boost::asio::post(
-      p->threadPool_,
+      p->taskQueue_.get_executor(),
       [this]()
       {
          try
@@ -725,7 +725,7 @@ void MainWindowImpl::AsyncSetup()
    // Check for updates
    if (generalSettings.update_notifications_enabled().GetValue())
    {
-      boost::asio::post(threadPool_,
+      boost::asio::post(taskQueue_.get_executor(),
                         [this]()
                         {
                            try
@@ -1016,6 +1016,16 @@ void MainWindowImpl::ConnectAnimationSignals()
               }
            });
 
+   connect(timelineManager_.get(),
+           &manager::TimelineManager::AnimationLoopStarted,
+           [this](std::chrono::system_clock::time_point startTime,
+                  std::chrono::system_clock::time_point endTime)
+           {
+              for (auto map : maps_)
+              {
+                 map->CacheSweeps(startTime, endTime);
+              }
+           });
    connect(timelineManager_.get(),
            &manager::TimelineManager::AnimationStateUpdated,
            animationDockWidget_,
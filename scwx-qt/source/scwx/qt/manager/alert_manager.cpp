@@ -6,11 +6,11 @@
 #include <scwx/qt/types/location_types.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/scheduler.hpp>
 #include <scwx/qt/config/radar_site.hpp>
 #include <scwx/qt/settings/general_settings.hpp>
 
 #include <boost/asio/post.hpp>
-#include <boost/asio/thread_pool.hpp>
 #include <boost/uuid/random_generator.hpp>
 #include <QGeoPositionInfo>
 
@@ -43,7 +43,7 @@ public:
          self_,
          [this](const types::TextEventKey& key, size_t messageIndex)
          {
-            boost::asio::post(threadPool_,
+            boost::asio::post(taskQueue_.get_executor(),
                               [=, this]()
                               {
                                  try
@@ -58,14 +58,14 @@ public:
          });
    }
 
-   ~Impl() { threadPool_.join(); }
+   ~Impl() { taskQueue_.join(); }
 
    common::Coordinate
         CurrentCoordinate(types::LocationMethod locationMethod) const;
    void HandleAlert(const types::TextEventKey& key, size_t messageIndex) const;
    void UpdateLocationTracking(const std::string& value) const;
 
-   boost::asio::thread_pool threadPool_ {1u};
+   scwx::util::TaskQueue taskQueue_ {scwx::util::TaskPriority::Background};
 
    AlertManager* self_;
 
@@ -1,11 +1,11 @@
 #include <scwx/qt/manager/download_manager.hpp>
 #include <scwx/util/digest.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/scheduler.hpp>
 
 #include <fstream>
 
 #include <boost/asio/post.hpp>
-#include <boost/asio/thread_pool.hpp>
 #include <cpr/cpr.h>
 
 namespace scwx
@@ -23,11 +23,11 @@ class DownloadManager::Impl
 public:
    explicit Impl(DownloadManager* self) : self_ {self} {}
 
-   ~Impl() { threadPool_.join(); }
+   ~Impl() { taskQueue_.join(); }
 
    void DownloadSync(const std::shared_ptr<request::DownloadRequest>& request);
 
-   boost::asio::thread_pool threadPool_ {1u};
+   scwx::util::TaskQueue taskQueue_ {scwx::util::TaskPriority::Network};
 
    DownloadManager* self_;
 };
@@ -38,7 +38,7 @@ DownloadManager::~DownloadManager() = default;
 void DownloadManager::Download(
    const std::shared_ptr<request::DownloadRequest>& request)
 {
-   boost::asio::post(p->threadPool_,
+   boost::asio::post(p->taskQueue_.get_executor(),
                      [=, this]()
                      {
                         try
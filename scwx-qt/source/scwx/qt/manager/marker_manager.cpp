@@ -6,6 +6,7 @@
 #include <scwx/qt/main/application.hpp>
 #include <scwx/qt/manager/resource_manager.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/scheduler.hpp>
 
 #include <filesystem>
 #include <shared_mutex>
@@ -16,7 +17,6 @@
 #include <QStandardPaths>
 #include <boost/json.hpp>
 #include <boost/asio/post.hpp>
-#include <boost/asio/thread_pool.hpp>
 
 namespace scwx
 {
@@ -42,7 +42,7 @@ public:
    class MarkerRecord;
 
    explicit Impl(MarkerManager* self) : self_ {self} {}
-   ~Impl() { threadPool_.join(); }
+   ~Impl() { taskQueue_.join(); }
 
    std::string                                 markerSettingsPath_ {""};
    std::vector<std::shared_ptr<MarkerRecord>>  markerRecords_ {};
@@ -51,7 +51,7 @@ public:
 
    MarkerManager* self_;
 
-   boost::asio::thread_pool threadPool_ {1u};
+   scwx::util::TaskQueue taskQueue_ {scwx::util::TaskPriority::Background};
    std::shared_mutex        markerRecordLock_ {};
    std::shared_mutex        markerIconsLock_ {};
 
@@ -260,7 +260,7 @@ MarkerManager::MarkerManager() : p(std::make_unique<Impl>(this))
 
    p->InitializeMarkerSettings();
 
-   boost::asio::post(p->threadPool_,
+   boost::asio::post(p->taskQueue_.get_executor(),
                      [this]()
                      {
                         try
@@ -7,6 +7,7 @@
 #include <scwx/gr/placefile.hpp>
 #include <scwx/network/cpr.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/scheduler.hpp>
 
 #include <shared_mutex>
 #include <vector>
@@ -19,7 +20,6 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/asio/post.hpp>
 #include <boost/asio/steady_timer.hpp>
-#include <boost/asio/thread_pool.hpp>
 #include <boost/json.hpp>
 #include <boost/tokenizer.hpp>
 #include <cpr/cpr.h>
@@ -46,7 +46,7 @@ public:
    class PlacefileRecord;
 
    explicit Impl(PlacefileManager* self) : self_ {self} {}
-   ~Impl() { threadPool_.join(); }
+   ~Impl() { taskQueue_.join(); }
 
    void InitializePlacefileSettings();
    void ReadPlacefileSettings();
@@ -58,7 +58,7 @@ public:
    static std::vector<std::shared_ptr<boost::gil::rgba8_image_t>>
    LoadImageResources(const std::shared_ptr<gr::Placefile>& placefile);
 
-   boost::asio::thread_pool threadPool_ {1u};
+   scwx::util::TaskQueue taskQueue_ {scwx::util::TaskPriority::Network};
 
    PlacefileManager* self_;
 
@@ -100,7 +100,7 @@ public:
       timerLock.unlock();
       refreshLock.unlock();
 
-      threadPool_.join();
+      taskQueue_.join();
    }
 
    bool                 refresh_enabled() const;
@@ -142,8 +142,9 @@ public:
    std::shared_ptr<gr::Placefile> placefile_;
    bool                           enabled_;
    bool                           thresholded_;
-   boost::asio::thread_pool       threadPool_ {1u};
-   boost::asio::steady_timer      refreshTimer_ {threadPool_};
+   scwx::util::TaskQueue          taskQueue_ {
+      scwx::util::TaskPriority::Network};
+   boost::asio::steady_timer      refreshTimer_ {taskQueue_.get_executor()};
    std::mutex                     refreshMutex_ {};
    std::mutex                     timerMutex_ {};
 
@@ -161,7 +162,7 @@ public:
 
 PlacefileManager::PlacefileManager() : p(std::make_unique<Impl>(this))
 {
-   boost::asio::post(p->threadPool_,
+   boost::asio::post(p->taskQueue_.get_executor(),
                      [this]()
                      {
                         try
@@ -742,7 +743,7 @@ void PlacefileManager::Impl::PlacefileRecord::CancelRefresh()
 
 void PlacefileManager::Impl::PlacefileRecord::UpdateAsync()
 {
-   boost::asio::post(threadPool_,
+   boost::asio::post(taskQueue_.get_executor(),
                      [this]()
                      {
                         try
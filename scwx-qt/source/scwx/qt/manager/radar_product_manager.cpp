@@ -3,14 +3,19 @@
 #include <scwx/qt/settings/general_settings.hpp>
 #include <scwx/qt/types/time_types.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/qt/view/sweep_geometry.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/provider/nexrad_data_provider_factory.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/map.hpp>
+#include <scwx/util/scheduler.hpp>
 #include <scwx/util/threads.hpp>
+#include <scwx/wsr88d/ar2v_file.hpp>
 #include <scwx/wsr88d/nexrad_file_factory.hpp>
 
 #include <execution>
+#include <filesystem>
+#include <fstream>
 #include <mutex>
 #include <shared_mutex>
 #include <unordered_set>
@@ -21,13 +26,13 @@
 
 #include <boost/asio/post.hpp>
 #include <boost/asio/steady_timer.hpp>
-#include <boost/asio/thread_pool.hpp>
 #include <boost/container_hash/hash.hpp>
 #include <boost/range/irange.hpp>
 #include <boost/timer/timer.hpp>
 #include <fmt/chrono.h>
 #include <qmaplibre.hpp>
 #include <units/angle.h>
+#include <QStandardPaths>
 
 #if defined(_MSC_VER)
 #   pragma warning(pop)
@@ -54,20 +59,32 @@ typedef std::list<std::shared_ptr<types::RadarProductRecord>>
 
 static constexpr uint32_t NUM_RADIAL_GATES_0_5_DEGREE =
    common::MAX_0_5_DEGREE_RADIALS * common::MAX_DATA_MOMENT_GATES;
-static constexpr uint32_t NUM_RADIAL_GATES_1_DEGREE =
-   common::MAX_1_DEGREE_RADIALS * common::MAX_DATA_MOMENT_GATES;
-static constexpr uint32_t NUM_COORIDNATES_0_5_DEGREE =
-   NUM_RADIAL_GATES_0_5_DEGREE * 2;
-static constexpr uint32_t NUM_COORIDNATES_1_DEGREE =
-   NUM_RADIAL_GATES_1_DEGREE * 2;
+
+// Level 2 radial coordinates are followed by the radar site
+static constexpr std::size_t kNumLevel2Coordinates_ =
+   (NUM_RADIAL_GATES_0_5_DEGREE + 1u) * 2u;
+
+// Each set of Level 2 coordinates is approximately 10 MB
+static constexpr std::size_t kLevel2CoordinateCacheLimit_ {6u};
 
 static const std::string kDefaultLevel3Product_ {"N0B"};
 
 static constexpr std::size_t kTimerPlaces_ {6u};
 
+// Geodesic table resolution. Bilinear interpolation between samples is within
+// 6 meters of the geodesic to the maximum range.
+static constexpr float kGeodesicTableAzimuthInterval_ {0.5f};  // Degrees
+static constexpr float kGeodesicTableRangeInterval_ {1000.0f}; // Meters
+
 static constexpr std::chrono::seconds kFastRetryInterval_ {15};
 static constexpr std::chrono::seconds kSlowRetryInterval_ {120};
 
+// Decoded Level 2 volume scans are persisted to disk, and the least recently
+// used volume scans are removed when the size limit is exceeded
+static const std::string        kLevel2CacheExtension_ {".l2c"};
+static constexpr std::uintmax_t kLevel2CacheSizeLimit_ {2ull * 1024 * 1024 *
+                                                        1024};
+
 static std::unordered_map<std::string, std::weak_ptr<RadarProductManager>>
                          instanceMap_;
 static std::shared_mutex instanceMutex_;
@@ -79,6 +96,8 @@ static std::shared_mutex fileIndexMutex_;
 
 static std::mutex fileLoadMutex_;
 
+static std::mutex level2CacheMutex_;
+
 class ProviderManager : public QObject
 {
    Q_OBJECT
@@ -100,19 +119,20 @@ public:
               self,
               &RadarProductManager::NewDataAvailable);
    }
-   ~ProviderManager() { threadPool_.join(); };
+   ~ProviderManager() { taskQueue_.join(); };
 
    std::string name() const;
 
    void Disable();
 
-   boost::asio::thread_pool threadPool_ {1u};
+   scwx::util::TaskQueue taskQueue_ {scwx::util::TaskPriority::Network};
 
    const std::string                             radarId_;
    const common::RadarProductGroup               group_;
    const std::string                             product_;
    bool                                          refreshEnabled_ {false};
-   boost::asio::steady_timer                     refreshTimer_ {threadPool_};
+   boost::asio::steady_timer                     refreshTimer_ {
+      taskQueue_.get_executor()};
    std::mutex                                    refreshTimerMutex_ {};
    std::shared_ptr<provider::NexradDataProvider> provider_ {nullptr};
 
@@ -141,8 +161,12 @@ public:
          radarSite_ = std::make_shared<config::RadarSite>();
       }
 
+      const std::string level2ChunkPath =
+         settings::GeneralSettings::Instance().level2_chunk_path().GetValue();
+
       level2ProviderManager_->provider_ =
-         provider::NexradDataProviderFactory::CreateLevel2DataProvider(radarId);
+         provider::NexradDataProviderFactory::CreateLevel2DataProvider(
+            radarId, level2ChunkPath);
    }
    ~RadarProductManagerImpl()
    {
@@ -162,12 +186,12 @@ public:
       std::unique_lock loadLevel2DataLock {loadLevel2DataMutex_};
       std::unique_lock loadLevel3DataLock {loadLevel3DataMutex_};
 
-      threadPool_.join();
+      taskGroup_.join();
    }
 
    RadarProductManager* self_;
 
-   boost::asio::thread_pool threadPool_ {4u};
+   scwx::util::TaskGroup taskGroup_ {scwx::util::TaskPriority::Decode};
 
    std::shared_ptr<ProviderManager>
    GetLevel3ProviderManager(const std::string& product);
@@ -208,12 +232,18 @@ public:
 
    void UpdateAvailableProductsSync();
 
-   void
-   CalculateCoordinates(const boost::integer_range<std::uint32_t>& radialGates,
-                        const units::angle::degrees<float>         radialAngle,
-                        const units::angle::degrees<float>         angleOffset,
-                        const float         gateRangeOffset,
-                        std::vector<float>& outputCoordinates);
+   struct UniformCoordinates;
+
+   void CalculateCoordinates(std::uint32_t                      numRadials,
+                             const units::angle::degrees<float> radialAngle,
+                             const units::angle::degrees<float> angleOffset,
+                             const float                        gateRangeOffset,
+                             std::vector<float>& outputCoordinates);
+   const std::vector<float>&
+   GetUniformCoordinates(UniformCoordinates&                uniformCoordinates,
+                         std::uint32_t                      numRadials,
+                         const units::angle::degrees<float> radialAngle,
+                         bool                               smoothingEnabled);
 
    static void
    PopulateProductTimes(std::shared_ptr<ProviderManager> providerManager,
@@ -221,11 +251,19 @@ public:
                         std::shared_mutex&               productRecordMutex,
                         std::chrono::system_clock::time_point time);
 
+   std::filesystem::path Level2CachePath(const std::string& key) const;
+   std::shared_ptr<wsr88d::NexradFile> LoadLevel2Cache(const std::string& key);
+   void SaveLevel2CacheAsync(const std::string&                  key,
+                             std::shared_ptr<wsr88d::NexradFile> nexradFile);
+   static void PruneLevel2Cache(const std::filesystem::path& cachePath);
+
    static void
    LoadNexradFile(CreateNexradFileFunction                           load,
                   const std::shared_ptr<request::NexradFileRequest>& request,
                   std::mutex&                                        mutex,
                   std::chrono::system_clock::time_point              time = {});
+   static std::shared_ptr<types::RadarProductRecord>
+   FindRadarProductRecord(const wsr88d::NexradFileMetadata& metadata);
 
    const std::string radarId_;
    bool              initialized_;
@@ -234,10 +272,25 @@ public:
    std::shared_ptr<config::RadarSite> radarSite_;
    std::size_t                        cacheLimit_ {6u};
 
-   std::vector<float> coordinates0_5Degree_ {};
-   std::vector<float> coordinates0_5DegreeSmooth_ {};
-   std::vector<float> coordinates1Degree_ {};
-   std::vector<float> coordinates1DegreeSmooth_ {};
+   // Coordinates of radials of uniform width, used by Level 3 radial
+   // products. Level 2 coordinates follow the azimuth of each radial.
+   struct UniformCoordinates
+   {
+      std::once_flag     calculated_ {};
+      std::vector<float> coordinates_ {};
+   };
+
+   UniformCoordinates coordinates0_5Degree_ {};
+   UniformCoordinates coordinates0_5DegreeSmooth_ {};
+   UniformCoordinates coordinates1Degree_ {};
+   UniformCoordinates coordinates1DegreeSmooth_ {};
+
+   std::shared_ptr<const view::GeodesicTable> geodesicTable_ {};
+
+   // Coordinates of the most recently used radial geometries
+   view::Level2CoordinateCache level2CoordinateCache_ {
+      kLevel2CoordinateCacheLimit_};
+   std::mutex level2CoordinateCacheMutex_ {};
 
    RadarProductRecordMap  level2ProductRecords_ {};
    RadarProductRecordList level2ProductRecentRecords_ {};
@@ -375,30 +428,36 @@ const std::vector<float>&
 RadarProductManager::coordinates(common::RadialSize radialSize,
                                  bool               smoothingEnabled) const
 {
+   // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers): Values are given
+   // descriptions
    switch (radialSize)
    {
    case common::RadialSize::_0_5Degree:
-      if (smoothingEnabled)
-      {
-         return p->coordinates0_5DegreeSmooth_;
-      }
-      else
-      {
-         return p->coordinates0_5Degree_;
-      }
+      return p->GetUniformCoordinates(
+         smoothingEnabled ? p->coordinates0_5DegreeSmooth_ :
+                            p->coordinates0_5Degree_,
+         common::MAX_0_5_DEGREE_RADIALS,
+         units::angle::degrees<float> {0.5f}, // Radial angle
+         smoothingEnabled);
    case common::RadialSize::_1Degree:
-      if (smoothingEnabled)
-      {
-         return p->coordinates1DegreeSmooth_;
-      }
-      else
-      {
-         return p->coordinates1Degree_;
-      }
+      return p->GetUniformCoordinates(
+         smoothingEnabled ? p->coordinates1DegreeSmooth_ :
+                            p->coordinates1Degree_,
+         common::MAX_1_DEGREE_RADIALS,
+         units::angle::degrees<float> {1.0f}, // Radial angle
+         smoothingEnabled);
    default:
       throw std::invalid_argument("Invalid radial size");
    }
+   // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
 }
+
+std::shared_ptr<const view::GeodesicTable>
+RadarProductManager::geodesic_table() const
+{
+   return p->geodesicTable_;
+}
+
 const scwx::util::time_zone* RadarProductManager::default_time_zone() const
 {
    types::DefaultTimeZone defaultTimeZone = types::GetDefaultTimeZone(
@@ -456,141 +515,92 @@ void RadarProductManager::Initialize()
 
    boost::timer::cpu_timer timer;
 
-   // Calculate half degree azimuth coordinates
-   timer.start();
-   std::vector<float>& coordinates0_5Degree = p->coordinates0_5Degree_;
-
-   coordinates0_5Degree.resize(NUM_COORIDNATES_0_5_DEGREE);
-
-   const auto radialGates0_5Degree =
-      boost::irange<uint32_t>(0, NUM_RADIAL_GATES_0_5_DEGREE);
-
-   // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers): Values are given
-   // descriptions
-   p->CalculateCoordinates(
-      radialGates0_5Degree,
-      units::angle::degrees<float> {0.5f}, // Radial angle
-      units::angle::degrees<float> {0.0f}, // Angle offset
-      // Far end of the first gate is the gate size distance from the radar site
-      1.0f,
-      coordinates0_5Degree);
-   // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
-
-   timer.stop();
-   logger_->debug("Coordinates (0.5 degree) calculated in {}",
-                  timer.format(kTimerPlaces_, "%ws"));
-
-   // Calculate half degree smooth azimuth coordinates
+   // Calculate the geodesic table used to project sweeps on the GPU
    timer.start();
-   std::vector<float>& coordinates0_5DegreeSmooth =
-      p->coordinates0_5DegreeSmooth_;
+   auto geodesicTable = std::make_shared<view::GeodesicTable>();
 
-   coordinates0_5DegreeSmooth.resize(NUM_COORIDNATES_0_5_DEGREE);
+   view::SweepParameters parameters {};
+   parameters.radarLatitude_  = p->radarSite_->latitude();
+   parameters.radarLongitude_ = p->radarSite_->longitude();
 
-   // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers): Values are given
-   // descriptions
-   p->CalculateCoordinates(radialGates0_5Degree,
-                           units::angle::degrees<float> {0.5f},  // Radial angle
-                           units::angle::degrees<float> {0.25f}, // Angle offset
-                           // Center of the first gate is half the gate size
-                           // distance from the radar site
-                           0.5f,
-                           coordinates0_5DegreeSmooth);
-   // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
-
-   timer.stop();
-   logger_->debug("Coordinates (0.5 degree smooth) calculated in {}",
-                  timer.format(kTimerPlaces_, "%ws"));
-
-   // Calculate 1 degree azimuth coordinates
-   timer.start();
-   std::vector<float>& coordinates1Degree = p->coordinates1Degree_;
-
-   coordinates1Degree.resize(NUM_COORIDNATES_1_DEGREE);
-
-   const auto radialGates1Degree =
-      boost::irange<uint32_t>(0, NUM_RADIAL_GATES_1_DEGREE);
-
-   // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers): Values are given
-   // descriptions
-   p->CalculateCoordinates(
-      radialGates1Degree,
-      units::angle::degrees<float> {1.0f}, // Radial angle
-      units::angle::degrees<float> {0.0f}, // Angle offset
-      // Far end of the first gate is the gate size distance from the radar site
-      1.0f,
-      coordinates1Degree);
-   // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
+   view::ComputeGeodesicTable(parameters,
+                              kGeodesicTableAzimuthInterval_,
+                              kGeodesicTableRangeInterval_,
+                              common::MAX_DATA_MOMENT_GATES * gate_size(),
+                              *geodesicTable);
+   p->geodesicTable_ = std::move(geodesicTable);
 
    timer.stop();
-   logger_->debug("Coordinates (1 degree) calculated in {}",
-                  timer.format(kTimerPlaces_, "%ws"));
-
-   // Calculate 1 degree smooth azimuth coordinates
-   timer.start();
-   std::vector<float>& coordinates1DegreeSmooth = p->coordinates1DegreeSmooth_;
-
-   coordinates1DegreeSmooth.resize(NUM_COORIDNATES_1_DEGREE);
-
-   // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers): Values are given
-   // descriptions
-   p->CalculateCoordinates(radialGates1Degree,
-                           units::angle::degrees<float> {1.0f}, // Radial angle
-                           units::angle::degrees<float> {0.5f}, // Angle offset
-                           // Center of the first gate is half the gate size
-                           // distance from the radar site
-                           0.5f,
-                           coordinates1DegreeSmooth);
-   // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
-
-   timer.stop();
-   logger_->debug("Coordinates (1 degree smooth) calculated in {}",
+   logger_->debug("Geodesic table calculated in {}",
                   timer.format(kTimerPlaces_, "%ws"));
 
    p->initialized_ = true;
 }
 
 void RadarProductManagerImpl::CalculateCoordinates(
-   const boost::integer_range<std::uint32_t>& radialGates,
-   const units::angle::degrees<float>         radialAngle,
-   const units::angle::degrees<float>         angleOffset,
-   const float                                gateRangeOffset,
-   std::vector<float>&                        outputCoordinates)
+   std::uint32_t                      numRadials,
+   const units::angle::degrees<float> radialAngle,
+   const units::angle::degrees<float> angleOffset,
+   const float                        gateRangeOffset,
+   std::vector<float>&                outputCoordinates)
 {
-   const GeographicLib::Geodesic& geodesic(
-      util::GeographicLib::DefaultGeodesic());
-
-   const QMapLibre::Coordinate radar(radarSite_->latitude(),
-                                     radarSite_->longitude());
-
-   const float gateSize = self_->gate_size();
+   view::SweepParameters parameters {};
+   parameters.radarLatitude_  = radarSite_->latitude();
+   parameters.radarLongitude_ = radarSite_->longitude();
+   parameters.gateSize_       = self_->gate_size();
+
+   view::ComputeUniformRadialCoordinates(numRadials,
+                                         radialAngle.value(),
+                                         angleOffset.value(),
+                                         gateRangeOffset,
+                                         parameters,
+                                         outputCoordinates);
+}
 
-   std::for_each(
-      std::execution::par_unseq,
-      radialGates.begin(),
-      radialGates.end(),
-      [&](uint32_t radialGate)
+const std::vector<float>& RadarProductManagerImpl::GetUniformCoordinates(
+   UniformCoordinates&                uniformCoordinates,
+   std::uint32_t                      numRadials,
+   const units::angle::degrees<float> radialAngle,
+   bool                               smoothingEnabled)
+{
+   // Coordinates are calculated on first use, as only Level 3 radial products
+   // use them
+   std::call_once(
+      uniformCoordinates.calculated_,
+      [&]()
       {
-         const auto gate = static_cast<std::uint16_t>(
-            radialGate % common::MAX_DATA_MOMENT_GATES);
-         const auto radial = static_cast<std::uint16_t>(
-            radialGate / common::MAX_DATA_MOMENT_GATES);
+         boost::timer::cpu_timer timer;
 
-         const float angle = static_cast<float>(radial) * radialAngle.value() +
-                             angleOffset.value();
-         const float range =
-            (static_cast<float>(gate) + gateRangeOffset) * gateSize;
-         const std::size_t offset = static_cast<std::size_t>(radialGate) * 2;
+         std::vector<float>& coordinates = uniformCoordinates.coordinates_;
+         coordinates.resize(static_cast<std::size_t>(numRadials) *
+                            common::MAX_DATA_MOMENT_GATES * 2u);
 
-         double latitude  = 0.0;
-         double longitude = 0.0;
-
-         geodesic.Direct(
-            radar.first, radar.second, angle, range, latitude, longitude);
+         if (smoothingEnabled)
+         {
+            // Center of each radial, and center of the first gate is half the
+            // gate size distance from the radar site
+            CalculateCoordinates(
+               numRadials, radialAngle, radialAngle / 2.0f, 0.5f, coordinates);
+         }
+         else
+         {
+            // Far end of the first gate is the gate size distance from the
+            // radar site
+            CalculateCoordinates(numRadials,
+                                 radialAngle,
+                                 units::angle::degrees<float> {0.0f},
+                                 1.0f,
+                                 coordinates);
+         }
 
-         outputCoordinates[offset]     = static_cast<float>(latitude);
-         outputCoordinates[offset + 1] = static_cast<float>(longitude);
+         timer.stop();
+         logger_->debug("Coordinates ({} degree{}) calculated in {}",
+                        radialAngle.value(),
+                        smoothingEnabled ? " smooth" : "",
+                        timer.format(kTimerPlaces_, "%ws"));
       });
+
+   return uniformCoordinates.coordinates_;
 }
 
 std::shared_ptr<ProviderManager>
@@ -632,7 +642,7 @@ void RadarProductManager::EnableRefresh(common::RadarProductGroup group,
 
       // Only enable refresh on available products
       boost::asio::post(
-         p->threadPool_,
+         p->taskGroup_.get_executor(),
          [=, this]()
          {
             try
@@ -730,7 +740,7 @@ void RadarProductManagerImpl::RefreshData(
       providerManager->refreshTimer_.cancel();
    }
 
-   boost::asio::post(threadPool_,
+   boost::asio::post(taskGroup_.get_executor(),
                      [=, this]()
                      {
                         try
@@ -914,7 +924,8 @@ void RadarProductManagerImpl::LoadProviderData(
                   scwx::util::TimeString(time));
 
    LoadNexradFileAsync(
-      [=, &recordMap, &recordMutex]() -> std::shared_ptr<wsr88d::NexradFile>
+      [=, this, &recordMap, &recordMutex]()
+         -> std::shared_ptr<wsr88d::NexradFile>
       {
          std::shared_ptr<types::RadarProductRecord> existingRecord = nullptr;
          std::shared_ptr<wsr88d::NexradFile>        nexradFile     = nullptr;
@@ -939,9 +950,24 @@ void RadarProductManagerImpl::LoadProviderData(
          {
             std::string key = providerManager->provider_->FindKey(time);
 
-            if (!key.empty())
+            const bool level2 = (providerManager->group_ ==
+                                 common::RadarProductGroup::Level2);
+
+            if (!key.empty() && level2)
+            {
+               nexradFile = LoadLevel2Cache(key);
+            }
+
+            if (!key.empty() && nexradFile == nullptr)
             {
                nexradFile = providerManager->provider_->LoadObjectByKey(key);
+
+               // Volume scans still being received are not persisted
+               if (level2 && nexradFile != nullptr &&
+                   providerManager->provider_->IsObjectComplete(key))
+               {
+                  SaveLevel2CacheAsync(key, nexradFile);
+               }
             }
             else
             {
@@ -961,6 +987,138 @@ void RadarProductManagerImpl::LoadProviderData(
       time);
 }
 
+std::filesystem::path
+RadarProductManagerImpl::Level2CachePath(const std::string& key) const
+{
+   // Object keys are paths, flatten them into a single filename
+   std::string filename {key};
+   std::replace_if(
+      filename.begin(),
+      filename.end(),
+      [](char c) { return c == '/' || c == '\\' || c == ':'; },
+      '_');
+
+   return std::filesystem::path {
+             QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+                .toStdString()} /
+          "level2" / radarId_ / (filename + kLevel2CacheExtension_);
+}
+
+std::shared_ptr<wsr88d::NexradFile>
+RadarProductManagerImpl::LoadLevel2Cache(const std::string& key)
+{
+   const std::filesystem::path cacheFile = Level2CachePath(key);
+
+   std::unique_lock lock {level2CacheMutex_};
+
+   std::error_code ec;
+   if (!std::filesystem::exists(cacheFile, ec))
+   {
+      return nullptr;
+   }
+
+   logger_->debug("Loading volume scan from disk cache: {}", key);
+
+   auto ar2vFile = std::make_shared<wsr88d::Ar2vFile>();
+   if (!ar2vFile->LoadCacheFile(cacheFile.string()))
+   {
+      // Remove a cache file which cannot be read, it will be recreated
+      std::filesystem::remove(cacheFile, ec);
+      return nullptr;
+   }
+
+   // Mark the cache file as recently used
+   std::filesystem::last_write_time(
+      cacheFile, std::filesystem::file_time_type::clock::now(), ec);
+
+   return ar2vFile;
+}
+
+void RadarProductManagerImpl::SaveLevel2CacheAsync(
+   const std::string& key, std::shared_ptr<wsr88d::NexradFile> nexradFile)
+{
+   auto ar2vFile = std::dynamic_pointer_cast<wsr88d::Ar2vFile>(nexradFile);
+   if (ar2vFile == nullptr)
+   {
+      return;
+   }
+
+   const std::filesystem::path cacheFile = Level2CachePath(key);
+
+   boost::asio::post(
+      taskGroup_.get_executor(),
+      [=]()
+      {
+         std::error_code ec;
+         std::filesystem::create_directories(cacheFile.parent_path(), ec);
+         if (ec)
+         {
+            logger_->warn("Could not create cache directory: {}",
+                          cacheFile.parent_path().string());
+            return;
+         }
+
+         // The cache is written to a temporary file unique to this save, so
+         // that it is written without holding the cache lock
+         if (!ar2vFile->SaveCacheFile(cacheFile.string(), true))
+         {
+            logger_->warn("Could not write cache file: {}",
+                          cacheFile.string());
+            return;
+         }
+
+         std::unique_lock lock {level2CacheMutex_};
+
+         PruneLevel2Cache(cacheFile.parent_path().parent_path());
+      });
+}
+
+void RadarProductManagerImpl::PruneLevel2Cache(
+   const std::filesystem::path& cachePath)
+{
+   std::vector<std::pair<std::filesystem::file_time_type,
+                         std::filesystem::directory_entry>>
+                  cacheFiles {};
+   std::uintmax_t cacheSize = 0u;
+
+   std::error_code ec;
+   for (auto& entry :
+        std::filesystem::recursive_directory_iterator(cachePath, ec))
+   {
+      if (entry.is_regular_file(ec) &&
+          entry.path().extension() == kLevel2CacheExtension_)
+      {
+         cacheSize += entry.file_size(ec);
+         cacheFiles.emplace_back(entry.last_write_time(ec), entry);
+      }
+   }
+
+   if (cacheSize <= kLevel2CacheSizeLimit_)
+   {
+      return;
+   }
+
+   // Remove least recently used files first
+   std::sort(cacheFiles.begin(),
+             cacheFiles.end(),
+             [](auto& a, auto& b) { return a.first < b.first; });
+
+   for (auto& [lastWriteTime, entry] : cacheFiles)
+   {
+      if (cacheSize <= kLevel2CacheSizeLimit_)
+      {
+         break;
+      }
+
+      const std::uintmax_t fileSize = entry.file_size(ec);
+      if (std::filesystem::remove(entry.path(), ec))
+      {
+         logger_->trace("Removed cache file: {}", entry.path().string());
+         cacheSize -= fileSize;
+      }
+   }
+}
+
 void RadarProductManager::LoadLevel2Data(
    std::chrono::system_clock::time_point              time,
    const std::shared_ptr<request::NexradFileRequest>& request)
@@ -1060,6 +1218,26 @@ void RadarProductManager::LoadFile(
       scwx::util::async(
          [=]()
          {
+            // Scan the file metadata, so a product already loaded (e.g., from
+            // the archive) is reused without decoding the file
+            auto metadata = wsr88d::NexradFileFactory::ScanMetadata(filename);
+            auto record   = (metadata.has_value()) ?
+                               RadarProductManagerImpl::FindRadarProductRecord(
+                                  metadata.value()) :
+                               nullptr;
+
+            if (record != nullptr)
+            {
+               logger_->debug("Product previously loaded, loading from cache");
+
+               if (request != nullptr)
+               {
+                  request->set_radar_product_record(record);
+                  Q_EMIT request->RequestComplete(request);
+               }
+               return;
+            }
+
             RadarProductManagerImpl::LoadNexradFile(
                [=]() -> std::shared_ptr<wsr88d::NexradFile>
                { return wsr88d::NexradFileFactory::Create(filename); },
@@ -1080,7 +1258,7 @@ void RadarProductManagerImpl::LoadNexradFileAsync(
    std::mutex&                                        mutex,
    std::chrono::system_clock::time_point              time)
 {
-   boost::asio::post(threadPool_,
+   boost::asio::post(taskGroup_.get_executor(),
                      [=, &mutex]()
                      {
                         try
@@ -1142,6 +1320,73 @@ void RadarProductManagerImpl::LoadNexradFile(
    }
 }
 
+std::shared_ptr<types::RadarProductRecord>
+RadarProductManagerImpl::FindRadarProductRecord(
+   const wsr88d::NexradFileMetadata& metadata)
+{
+   const std::string radarId =
+      (metadata.group_ == common::RadarProductGroup::Level3) ?
+         config::GetRadarIdFromSiteId(metadata.siteId_) :
+         metadata.icao_;
+
+   std::shared_ptr<RadarProductManager> manager = nullptr;
+
+   {
+      std::shared_lock lock {instanceMutex_};
+      auto             it = instanceMap_.find(radarId);
+      if (it != instanceMap_.cend())
+      {
+         manager = it->second.lock();
+      }
+   }
+
+   if (manager == nullptr)
+   {
+      return nullptr;
+   }
+
+   auto timeInSeconds =
+      std::chrono::time_point_cast<std::chrono::seconds,
+                                   std::chrono::system_clock>(
+         metadata.startTime_);
+
+   std::shared_ptr<types::RadarProductRecord> record = nullptr;
+
+   if (metadata.group_ == common::RadarProductGroup::Level2)
+   {
+      std::shared_lock lock {manager->p->level2ProductRecordMutex_};
+
+      auto it = manager->p->level2ProductRecords_.find(timeInSeconds);
+      if (it != manager->p->level2ProductRecords_.cend())
+      {
+         record = it->second.lock();
+      }
+   }
+   else if (metadata.group_ == common::RadarProductGroup::Level3)
+   {
+      std::shared_lock lock {manager->p->level3ProductRecordMutex_};
+
+      auto productMap =
+         manager->p->level3ProductRecordsMap_.find(metadata.product_);
+      if (productMap != manager->p->level3ProductRecordsMap_.cend())
+      {
+         auto it = productMap->second.find(timeInSeconds);
+         if (it != productMap->second.cend())
+         {
+            record = it->second.lock();
+         }
+      }
+   }
+
+   if (record != nullptr)
+   {
+      // Mark the record as recently used
+      record = manager->p->StoreRadarProductRecord(record);
+   }
+
+   return record;
+}
+
 void RadarProductManagerImpl::PopulateLevel2ProductTimes(
    std::chrono::system_clock::time_point time)
 {
@@ -1476,7 +1721,7 @@ void RadarProductManagerImpl::UpdateRecentRecords(
    }
 }
 
-std::tuple<std::shared_ptr<wsr88d::rda::ElevationScan>,
+std::tuple<std::shared_ptr<const wsr88d::rda::PackedElevationScan>,
            float,
            std::vector<float>,
            std::chrono::system_clock::time_point>
@@ -1484,10 +1729,11 @@ RadarProductManager::GetLevel2Data(wsr88d::rda::DataBlockType dataBlockType,
                                    float                      elevation,
                                    std::chrono::system_clock::time_point time)
 {
-   std::shared_ptr<wsr88d::rda::ElevationScan> radarData    = nullptr;
-   float                                       elevationCut = 0.0f;
-   std::vector<float>                          elevationCuts {};
-   std::chrono::system_clock::time_point       foundTime {};
+   std::shared_ptr<const wsr88d::rda::PackedElevationScan> radarData = nullptr;
+
+   float                                 elevationCut = 0.0f;
+   std::vector<float>                    elevationCuts {};
+   std::chrono::system_clock::time_point foundTime {};
 
    auto records = p->GetLevel2ProductRecords(time);
 
@@ -1497,20 +1743,22 @@ RadarProductManager::GetLevel2Data(wsr88d::rda::DataBlockType dataBlockType,
 
       if (record != nullptr)
       {
-         std::shared_ptr<wsr88d::rda::ElevationScan> recordRadarData = nullptr;
-         float                                       recordElevationCut = 0.0f;
-         std::vector<float>                          recordElevationCuts;
+         std::shared_ptr<const wsr88d::rda::PackedElevationScan>
+                            recordRadarData    = nullptr;
+         float              recordElevationCut = 0.0f;
+         std::vector<float> recordElevationCuts;
 
          std::tie(recordRadarData, recordElevationCut, recordElevationCuts) =
-            record->level2_file()->GetElevationScan(
+            record->level2_file()->GetPackedElevationScan(
                dataBlockType, elevation, time);
 
-         if (recordRadarData != nullptr)
+         if (recordRadarData != nullptr &&
+             recordRadarData->first_radial_header() != nullptr)
          {
-            auto& radarData0     = (*recordRadarData)[0];
+            auto& radarData0     = *recordRadarData->first_radial_header();
             auto  collectionTime = std::chrono::floor<std::chrono::seconds>(
-               scwx::util::TimePoint(radarData0->modified_julian_date(),
-                                     radarData0->collection_time()));
+               scwx::util::TimePoint(radarData0.modifiedJulianDate,
+                                     radarData0.collectionTime));
 
             // Find the newest radar data, not newer than the selected time
             if (radarData == nullptr ||
@@ -1528,6 +1776,84 @@ RadarProductManager::GetLevel2Data(wsr88d::rda::DataBlockType dataBlockType,
    return {radarData, elevationCut, elevationCuts, foundTime};
 }
 
+std::shared_ptr<const std::vector<float>>
+RadarProductManager::GetLevel2Coordinates(
+   const wsr88d::rda::PackedElevationScan& radarData,
+   bool                                    smoothingEnabled,
+   std::function<bool()>                   cancelled)
+{
+   view::SweepParameters parameters {};
+   parameters.radarLatitude_    = p->radarSite_->latitude();
+   parameters.radarLongitude_   = p->radarSite_->longitude();
+   parameters.gateSize_         = gate_size();
+   parameters.smoothingEnabled_ = smoothingEnabled;
+   parameters.cancelled_        = std::move(cancelled);
+
+   view::Level2CoordinateKey key =
+      view::ComputeLevel2CoordinateKey(radarData, parameters);
+
+   auto findCoordinates = [this, &key]()
+   {
+      // Finding the coordinates marks them as the most recently used
+      auto* coordinates = p->level2CoordinateCache_.Find(key);
+
+      return (coordinates != nullptr) ?
+                *coordinates :
+                std::shared_ptr<const std::vector<float>> {nullptr};
+   };
+
+   {
+      std::unique_lock lock {p->level2CoordinateCacheMutex_};
+
+      auto coordinates = findCoordinates();
+      if (coordinates != nullptr)
+      {
+         return coordinates;
+      }
+   }
+
+   // Compute coordinates without holding the lock
+   auto coordinates =
+      std::make_shared<std::vector<float>>(kNumLevel2Coordinates_);
+
+   boost::timer::cpu_timer timer {};
+
+   view::ComputeLevel2Coordinates(radarData, parameters, 0u, *coordinates);
+
+   timer.stop();
+
+   // Incomplete coordinates are not cached
+   if (view::IsSweepCancelled(parameters))
+   {
+      logger_->debug("Level 2 coordinates abandoned");
+      return nullptr;
+   }
+
+   logger_->debug("Level 2 coordinates calculated in {}",
+                  timer.format(kTimerPlaces_, "%ws"));
+
+   // The radial geometry of an elevation scan in progress changes as radials
+   // are appended, so its coordinates would not be reused
+   if (view::IsLevel2SweepIncomplete(radarData))
+   {
+      return coordinates;
+   }
+
+   std::unique_lock lock {p->level2CoordinateCacheMutex_};
+
+   // Another view may have computed the same coordinates
+   auto cachedCoordinates = findCoordinates();
+   if (cachedCoordinates != nullptr)
+   {
+      return cachedCoordinates;
+   }
+
+   // The least recently used coordinates are removed beyond the limit
+   p->level2CoordinateCache_.Insert(key, coordinates);
+
+   return coordinates;
+}
+
 std::tuple<std::shared_ptr<wsr88d::rpg::Level3Message>,
            std::chrono::system_clock::time_point>
 RadarProductManager::GetLevel3Data(const std::string& product,
@@ -1581,7 +1907,7 @@ void RadarProductManager::UpdateAvailableProducts()
 
    logger_->debug("UpdateAvailableProducts()");
 
-   boost::asio::post(p->threadPool_,
+   boost::asio::post(p->taskGroup_.get_executor(),
                      [this]()
                      {
                         try
@@ -9,6 +9,7 @@
 #include <scwx/wsr88d/ar2v_file.hpp>
 #include <scwx/wsr88d/level3_file.hpp>
 
+#include <functional>
 #include <memory>
 #include <set>
 #include <unordered_map>
@@ -21,6 +22,13 @@ namespace scwx
 {
 namespace qt
 {
+namespace view
+{
+
+struct GeodesicTable;
+
+} // namespace view
+
 namespace manager
 {
 
@@ -45,6 +53,8 @@ public:
    coordinates(common::RadialSize radialSize, bool smoothingEnabled) const;
    [[nodiscard]] const scwx::util::time_zone*       default_time_zone() const;
    [[nodiscard]] float                              gate_size() const;
+   [[nodiscard]] std::shared_ptr<const view::GeodesicTable>
+                                                    geodesic_table() const;
    [[nodiscard]] std::string                        radar_id() const;
    [[nodiscard]] std::shared_ptr<config::RadarSite> radar_site() const;
 
@@ -89,7 +99,7 @@ public:
     * @return Level 2 radar data, selected elevation cut, available elevation
     * cuts and selected time
     */
-   std::tuple<std::shared_ptr<wsr88d::rda::ElevationScan>,
+   std::tuple<std::shared_ptr<const wsr88d::rda::PackedElevationScan>,
               float,
               std::vector<float>,
               std::chrono::system_clock::time_point>
@@ -97,6 +107,25 @@ public:
                  float                                 elevation,
                  std::chrono::system_clock::time_point time = {});
 
+   /**
+    * @brief Get level 2 radial coordinates for an elevation scan. Coordinates
+    * of complete elevation scans are cached by radial geometry, and are shared
+    * by each view of the radar site. Coordinates are computed for the maximum
+    * number of gates, and are shared by each moment.
+    *
+    * @param [in] radarData Elevation scan
+    * @param [in] smoothingEnabled Whether smoothing is enabled
+    * @param [in] cancelled Returns true once the coordinates are no longer
+    * required, and their computation may be abandoned
+    *
+    * @return Latitude and longitude of each radial gate, followed by the radar
+    * site. Returns nullptr if the computation was abandoned.
+    */
+   std::shared_ptr<const std::vector<float>> GetLevel2Coordinates(
+      const wsr88d::rda::PackedElevationScan& radarData,
+      bool                                    smoothingEnabled,
+      std::function<bool()>                   cancelled = nullptr);
+
    /**
     * @brief Get level 3 message data for a product and time.
     *
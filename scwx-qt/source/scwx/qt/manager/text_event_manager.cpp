@@ -4,13 +4,13 @@
 #include <scwx/awips/text_product_file.hpp>
 #include <scwx/provider/warnings_provider.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/scheduler.hpp>
 
 #include <shared_mutex>
 #include <unordered_map>
 
 #include <boost/asio/post.hpp>
 #include <boost/asio/steady_timer.hpp>
-#include <boost/asio/thread_pool.hpp>
 
 namespace scwx
 {
@@ -30,7 +30,7 @@ class TextEventManager::Impl
 public:
    explicit Impl(TextEventManager* self) :
        self_ {self},
-       refreshTimer_ {threadPool_},
+       refreshTimer_ {taskQueue_.get_executor()},
        refreshMutex_ {},
        textEventMap_ {},
        textEventMutex_ {}
@@ -47,7 +47,7 @@ public:
                   std::make_shared<provider::WarningsProvider>(value);
             });
 
-      boost::asio::post(threadPool_,
+      boost::asio::post(taskQueue_.get_executor(),
                         [this]()
                         {
                            try
@@ -73,14 +73,14 @@ public:
       refreshTimer_.cancel();
       lock.unlock();
 
-      threadPool_.join();
+      taskQueue_.join();
    }
 
    void HandleMessage(std::shared_ptr<awips::TextProductMessage> message);
    void RefreshAsync();
    void Refresh();
 
-   boost::asio::thread_pool threadPool_ {1u};
+   scwx::util::TaskQueue taskQueue_ {scwx::util::TaskPriority::Network};
 
    TextEventManager* self_;
 
@@ -136,7 +136,7 @@ void TextEventManager::LoadFile(const std::string& filename)
 {
    logger_->debug("LoadFile: {}", filename);
 
-   boost::asio::post(p->threadPool_,
+   boost::asio::post(p->taskQueue_.get_executor(),
                      [=, this]()
                      {
                         try
@@ -229,7 +229,7 @@ void TextEventManager::Impl::HandleMessage(
 
 void TextEventManager::Impl::RefreshAsync()
 {
-   boost::asio::post(threadPool_,
+   boost::asio::post(taskQueue_.get_executor(),
                      [this]()
                      {
                         try
@@ -411,6 +411,10 @@ void TimelineManager::Impl::Play()
    {
       animationState_ = types::AnimationState::Play;
       Q_EMIT self_->AnimationStateUpdated(animationState_);
+
+      // Sweeps of the loop may be computed ahead of playback
+      auto [startTime, endTime] = GetLoopStartAndEndTimes();
+      Q_EMIT self_->AnimationLoopStarted(startTime, endTime);
    }
 
    {
@@ -448,6 +452,9 @@ void TimelineManager::Impl::PlaySync()
       // If the currently selected time is out of the loop, select the
       // start time
       newTime = startTime;
+
+      // The loop may have advanced since it was last started
+      Q_EMIT self_->AnimationLoopStarted(startTime, endTime);
    }
    else
    {
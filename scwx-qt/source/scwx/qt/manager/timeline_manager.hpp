@@ -52,6 +52,8 @@ signals:
    void VolumeTimeUpdated(std::chrono::system_clock::time_point dateTime);
 
    void AnimationStateUpdated(types::AnimationState state);
+   void AnimationLoopStarted(std::chrono::system_clock::time_point startTime,
+                             std::chrono::system_clock::time_point endTime);
    void LiveStateUpdated(bool isLive);
    void ViewTypeUpdated(types::MapTime viewType);
 
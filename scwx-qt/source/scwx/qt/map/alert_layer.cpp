@@ -6,6 +6,7 @@
 #include <scwx/qt/util/color.hpp>
 #include <scwx/qt/util/tooltip.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/scheduler.hpp>
 
 #include <chrono>
 #include <mutex>
@@ -15,7 +16,6 @@
 
 #include <boost/algorithm/string/join.hpp>
 #include <boost/asio/system_timer.hpp>
-#include <boost/asio/thread_pool.hpp>
 #include <boost/container/stable_vector.hpp>
 #include <boost/container_hash/hash.hpp>
 #include <QEvent>
@@ -144,7 +144,7 @@ public:
       refreshTimer_.cancel();
       refreshLock.unlock();
 
-      threadPool_.join();
+      taskQueue_.join();
 
       receiver_ = nullptr;
 
@@ -189,11 +189,11 @@ public:
 
    static LineData CreateLineData(const settings::LineSettings& lineSettings);
 
-   boost::asio::thread_pool threadPool_ {1u};
+   scwx::util::TaskQueue taskQueue_ {scwx::util::TaskPriority::Background};
 
    AlertLayer* self_;
 
-   boost::asio::system_timer refreshTimer_ {threadPool_};
+   boost::asio::system_timer refreshTimer_ {taskQueue_.get_executor()};
    std::mutex                refreshMutex_;
 
    const awips::Phenomenon                   phenomenon_;
@@ -28,6 +28,7 @@
 #include <scwx/qt/view/overlay_product_view.hpp>
 #include <scwx/qt/view/radar_product_view_factory.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/scheduler.hpp>
 #include <scwx/util/time.hpp>
 
 #include <set>
@@ -37,7 +38,6 @@
 #include <boost/algorithm/string/erase.hpp>
 #include <boost/algorithm/string/trim.hpp>
 #include <boost/asio/post.hpp>
-#include <boost/asio/thread_pool.hpp>
 #include <boost/range/join.hpp>
 #include <boost/uuid/random_generator.hpp>
 #include <fmt/format.h>
@@ -147,7 +147,7 @@ public:
       // Destroy ImGui Context
       model::ImGuiContextModel::Instance().DestroyContext(imGuiContextName_);
 
-      threadPool_.join();
+      taskQueue_.join();
    }
 
    void AddLayer(types::LayerType        type,
@@ -187,7 +187,7 @@ public:
 
    static std::string GetPlacefileLayerName(const std::string& placefileName);
 
-   boost::asio::thread_pool threadPool_ {1u};
+   scwx::util::TaskQueue taskQueue_ {scwx::util::TaskPriority::Decode};
 
    std::size_t        id_;
    boost::uuids::uuid uuid_;
@@ -778,6 +778,17 @@ void MapWidget::SetSmoothingEnabled(bool smoothingEnabled)
    }
 }
 
+void MapWidget::CacheSweeps(std::chrono::system_clock::time_point startTime,
+                            std::chrono::system_clock::time_point endTime)
+{
+   auto radarProductView = p->context_->radar_product_view();
+
+   if (radarProductView != nullptr)
+   {
+      radarProductView->CacheSweeps(startTime, endTime);
+   }
+}
+
 void MapWidget::SelectElevation(float elevation)
 {
    auto radarProductView = p->context_->radar_product_view();
@@ -1824,7 +1835,7 @@ void MapWidgetImpl::RadarProductManagerConnect()
 
                // Load file
                boost::asio::post(
-                  threadPool_,
+                  taskQueue_.get_executor(),
                   [=, this]()
                   {
                      try
@@ -1865,7 +1876,7 @@ void MapWidgetImpl::RadarProductManagerDisconnect()
 void MapWidgetImpl::InitializeNewRadarProductView(
    const std::string& colorPalette)
 {
-   boost::asio::post(threadPool_,
+   boost::asio::post(taskQueue_.get_executor(),
                      [=, this]()
                      {
                         try
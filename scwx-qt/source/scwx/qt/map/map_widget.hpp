@@ -53,6 +53,16 @@ public:
    [[nodiscard]] bool          GetSmoothingEnabled() const;
    [[nodiscard]] std::uint16_t GetVcp() const;
 
+   /**
+    * @brief Computes the sweeps of the active radar product for each volume
+    * scan in an animation loop, ahead of playback.
+    *
+    * @param [in] startTime Loop start time
+    * @param [in] endTime Loop end time
+    */
+   void CacheSweeps(std::chrono::system_clock::time_point startTime,
+                    std::chrono::system_clock::time_point endTime);
+
    void SelectElevation(float elevation);
 
    /**
@@ -8,9 +8,9 @@
 #include <scwx/qt/manager/placefile_manager.hpp>
 #include <scwx/qt/manager/timeline_manager.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/scheduler.hpp>
 
 #include <boost/asio/post.hpp>
-#include <boost/asio/thread_pool.hpp>
 
 namespace scwx
 {
@@ -42,12 +42,12 @@ public:
    {
       ConnectSignals();
    }
-   ~Impl() { threadPool_.join(); }
+   ~Impl() { taskQueue_.join(); }
 
    void ConnectSignals();
    void ReloadDataSync();
 
-   boost::asio::thread_pool threadPool_ {1};
+   scwx::util::TaskQueue taskQueue_ {scwx::util::TaskPriority::Decode};
 
    PlacefileLayer* self_;
 
@@ -168,7 +168,7 @@ void PlacefileLayer::Deinitialize()
 
 void PlacefileLayer::ReloadData()
 {
-   boost::asio::post(p->threadPool_,
+   boost::asio::post(p->taskQueue_.get_executor(),
                      [this]()
                      {
                         try
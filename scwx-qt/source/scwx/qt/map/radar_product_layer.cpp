@@ -4,8 +4,14 @@
 #include <scwx/qt/util/maplibre.hpp>
 #include <scwx/qt/util/tooltip.hpp>
 #include <scwx/qt/view/radar_product_view.hpp>
+#include <scwx/qt/view/sweep_geometry.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <list>
+
 #if defined(_MSC_VER)
 #   pragma warning(push, 0)
 #endif
@@ -18,6 +24,7 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <mbgl/util/constants.hpp>
 #include <QGuiApplication>
+#include <QMapLibre/Utils>
 
 #if defined(_MSC_VER)
 #   pragma warning(pop)
@@ -33,20 +40,71 @@ namespace map
 static const std::string logPrefix_ = "scwx::qt::map::radar_product_layer";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+// Texture units used by the radar shader programs
+static constexpr GLint kColorTableTextureUnit_    = 0;
+static constexpr GLint kRadialAngleTextureUnit_   = 1;
+static constexpr GLint kGeodesicTableTextureUnit_ = 2;
+
+static constexpr GLsizei kVerticesPerCell_ = 6;
+static constexpr GLint   kEdgesPerCell_    = 4;
+
+// Buffer objects are grown geometrically, and are not shrunk between sweeps
+static constexpr GLsizeiptr kBufferGrowthFactor_ = 2;
+
+// Up to this many culled sectors between visible sectors are drawn, rather
+// than splitting the draw
+static constexpr std::size_t kMaxDrawnCulledSectors_ = 2u;
+
+static const view::SweepLevel kEmptyLevel_ {};
+
+// Size of the buffers of cached sweeps across all layers, which share the
+// animation cache budget
+static std::atomic<GLsizeiptr> sweepBuffersSize_ {0};
+
+// Uniform locations common to the radar shader programs
+struct RadarShaderProgram
+{
+   std::shared_ptr<gl::ShaderProgram> shaderProgram_ {nullptr};
+
+   GLint uMVPMatrixLocation_ {-1};
+   GLint uMapScreenCoordLocation_ {-1};
+   GLint uDataMomentOffsetLocation_ {-1};
+   GLint uDataMomentScaleLocation_ {-1};
+   GLint uCFPEnabledLocation_ {-1};
+
+   void Load(std::shared_ptr<gl::ShaderProgram> shaderProgram)
+   {
+      shaderProgram_ = std::move(shaderProgram);
+
+      uMVPMatrixLocation_ = shaderProgram_->GetUniformLocation("uMVPMatrix");
+      uMapScreenCoordLocation_ =
+         shaderProgram_->GetUniformLocation("uMapScreenCoord");
+      uDataMomentOffsetLocation_ =
+         shaderProgram_->GetUniformLocation("uDataMomentOffset");
+      uDataMomentScaleLocation_ =
+         shaderProgram_->GetUniformLocation("uDataMomentScale");
+      uCFPEnabledLocation_ = shaderProgram_->GetUniformLocation("uCFPEnabled");
+   }
+};
+
+// Buffers of a sweep retained by the animation cache, which remain resident
+// while the sweep is cached, so animation only binds them
+struct SweepBuffers
+{
+   std::weak_ptr<const void> sweep_ {};
+   GLuint                    vao_ {GL_INVALID_INDEX};
+   std::array<GLuint, 4>     vbo_ {};
+   GLuint                    radialAngleTexture_ {GL_INVALID_INDEX};
+   GLsizeiptr                size_ {0};
+};
+
 class RadarProductLayerImpl
 {
 public:
    explicit RadarProductLayerImpl() :
-       shaderProgram_(nullptr),
-       uMVPMatrixLocation_(GL_INVALID_INDEX),
-       uMapScreenCoordLocation_(GL_INVALID_INDEX),
-       uDataMomentOffsetLocation_(GL_INVALID_INDEX),
-       uDataMomentScaleLocation_(GL_INVALID_INDEX),
-       uCFPEnabledLocation_(GL_INVALID_INDEX),
        vbo_ {GL_INVALID_INDEX},
        vao_ {GL_INVALID_INDEX},
        texture_ {GL_INVALID_INDEX},
-       numVertices_ {0},
        cfpEnabled_ {false},
        colorTableNeedsUpdate_ {false},
        sweepNeedsUpdate_ {false}
@@ -54,18 +112,79 @@ public:
    }
    ~RadarProductLayerImpl() = default;
 
-   std::shared_ptr<gl::ShaderProgram> shaderProgram_;
-
-   GLint                 uMVPMatrixLocation_;
-   GLint                 uMapScreenCoordLocation_;
-   GLint                 uDataMomentOffsetLocation_;
-   GLint                 uDataMomentScaleLocation_;
-   GLint                 uCFPEnabledLocation_;
-   std::array<GLuint, 3> vbo_;
-   GLuint                vao_;
-   GLuint                texture_;
-
-   GLsizeiptr numVertices_;
+   void          BufferData(gl::OpenGLFunctions& gl,
+                            GLenum               target,
+                            std::size_t          buffer,
+                            GLsizeiptr           size,
+                            const void*          data,
+                            SweepBuffers*        sweepBuffers);
+   SweepBuffers& CreateSweepBuffers(gl::OpenGLFunctions&        gl,
+                                    std::shared_ptr<const void> sweep);
+   void          DeleteSweepBuffers(gl::OpenGLFunctions& gl,
+                                    SweepBuffers&        sweepBuffers);
+   SweepBuffers* FindSweepBuffers(const std::shared_ptr<const void>& sweep);
+   void BindPolarCells(gl::OpenGLFunctions& gl, GLint firstCell);
+   void CullSectors(const view::SweepLevel&                       level,
+                    const QMapLibre::CustomLayerRenderParameters& params);
+   const view::SweepLevel&
+   SelectLevel(const QMapLibre::CustomLayerRenderParameters& params) const;
+   void TrimSweepBuffers(gl::OpenGLFunctions& gl, GLsizeiptr cacheLimit);
+   void UpdateGeodesicTable(gl::OpenGLFunctions& gl,
+                            std::shared_ptr<const view::GeodesicTable> table);
+
+   RadarShaderProgram vertexShader_ {};
+   RadarShaderProgram indexedShader_ {};
+   RadarShaderProgram polarShader_ {};
+
+   // Indexed shader program uniform locations
+   GLint uIndexedInterpolateMomentsLocation_ {-1};
+
+   // Polar shader program uniform locations
+   GLint uRadarLatLongLocation_ {-1};
+   GLint uGateSizeLocation_ {-1};
+   GLint uGateRangeOffsetLocation_ {-1};
+   GLint uGeodesicIntervalLocation_ {-1};
+   GLint uInterpolateMomentsLocation_ {-1};
+
+   std::array<GLuint, 4>     vbo_;
+   std::array<GLsizeiptr, 4> vboCapacity_ {};
+   GLuint                    vao_;
+   GLuint                    texture_;
+   GLuint                    radialAngleTexture_ {GL_INVALID_INDEX};
+   GLuint                    geodesicTableTexture_ {GL_INVALID_INDEX};
+
+   // Sweeps retained by the animation cache have their own buffers, most
+   // recently used first. Other sweeps are streamed into the buffers above.
+   std::list<SweepBuffers> sweepBuffers_ {};
+
+   // Vertex array object, buffers and radial angle texture of the drawn sweep
+   GLuint                activeVao_ {GL_INVALID_INDEX};
+   std::array<GLuint, 4> activeVbo_ {};
+   GLuint                activeRadialAngleTexture_ {GL_INVALID_INDEX};
+
+   // When the sweep is drawn in the indexed layout, vertices are shared between
+   // gates. When the sweep is drawn in the polar layout, each cell is an
+   // instance.
+   view::SweepLayout layout_ {view::SweepLayout::Vertices};
+
+   // Levels of detail of the sweep, in indices, cells or vertices according to
+   // the layout
+   std::vector<view::SweepLevel> levels_ {};
+
+   // Ranges of the drawn level covering the sectors within the viewport, in
+   // indices, cells or vertices, and the byte offset of each range of indices
+   std::vector<std::pair<std::size_t, std::size_t>> drawRanges_ {};
+   std::vector<GLint>                               drawFirsts_ {};
+   std::vector<GLsizei>                             drawCounts_ {};
+   std::vector<const void*>                         drawIndices_ {};
+
+   // Data moment attributes of the polar layout, which are offset to the first
+   // cell of the drawn level. The CFP moment type is GL_NONE without CFP data.
+   GLenum momentType_ {GL_UNSIGNED_BYTE};
+   GLint  momentsPerCell_ {1};
+   GLenum cfpMomentType_ {GL_NONE};
+
+   std::shared_ptr<const view::GeodesicTable> geodesicTable_ {nullptr};
 
    bool cfpEnabled_;
 
@@ -94,52 +213,54 @@ void RadarProductLayer::Initialize()
 
    gl::OpenGLFunctions& gl = context()->gl();
 
-   // Load and configure radar shader
-   p->shaderProgram_ =
-      context()->GetShaderProgram(":/gl/radar.vert", ":/gl/radar.frag");
-
-   p->uMVPMatrixLocation_ =
-      gl.glGetUniformLocation(p->shaderProgram_->id(), "uMVPMatrix");
-   if (p->uMVPMatrixLocation_ == -1)
-   {
-      logger_->warn("Could not find uMVPMatrix");
-   }
-
-   p->uMapScreenCoordLocation_ =
-      gl.glGetUniformLocation(p->shaderProgram_->id(), "uMapScreenCoord");
-   if (p->uMapScreenCoordLocation_ == -1)
-   {
-      logger_->warn("Could not find uMapScreenCoord");
-   }
-
-   p->uDataMomentOffsetLocation_ =
-      gl.glGetUniformLocation(p->shaderProgram_->id(), "uDataMomentOffset");
-   if (p->uDataMomentOffsetLocation_ == -1)
-   {
-      logger_->warn("Could not find uDataMomentOffset");
-   }
-
-   p->uDataMomentScaleLocation_ =
-      gl.glGetUniformLocation(p->shaderProgram_->id(), "uDataMomentScale");
-   if (p->uDataMomentScaleLocation_ == -1)
-   {
-      logger_->warn("Could not find uDataMomentScale");
-   }
-
-   p->uCFPEnabledLocation_ =
-      gl.glGetUniformLocation(p->shaderProgram_->id(), "uCFPEnabled");
-   if (p->uCFPEnabledLocation_ == -1)
-   {
-      logger_->warn("Could not find uCFPEnabled");
-   }
-
-   p->shaderProgram_->Use();
+   // Load and configure radar shaders
+   p->vertexShader_.Load(
+      context()->GetShaderProgram(":/gl/radar.vert", ":/gl/radar.frag"));
+   p->indexedShader_.Load(context()->GetShaderProgram(
+      ":/gl/radar_indexed.vert", ":/gl/radar_indexed.frag"));
+   p->polarShader_.Load(
+      context()->GetShaderProgram(":/gl/radar_polar.vert", ":/gl/radar.frag"));
+
+   p->uIndexedInterpolateMomentsLocation_ =
+      p->indexedShader_.shaderProgram_->GetUniformLocation(
+         "uInterpolateMoments");
+
+   auto& polarShaderProgram = p->polarShader_.shaderProgram_;
+
+   p->uRadarLatLongLocation_ =
+      polarShaderProgram->GetUniformLocation("uRadarLatLong");
+   p->uGateSizeLocation_ = polarShaderProgram->GetUniformLocation("uGateSize");
+   p->uGateRangeOffsetLocation_ =
+      polarShaderProgram->GetUniformLocation("uGateRangeOffset");
+   p->uGeodesicIntervalLocation_ =
+      polarShaderProgram->GetUniformLocation("uGeodesicInterval");
+   p->uInterpolateMomentsLocation_ =
+      polarShaderProgram->GetUniformLocation("uInterpolateMoments");
+
+   polarShaderProgram->Use();
+   gl.glUniform1i(polarShaderProgram->GetUniformLocation("uRadialAngles"),
+                  kRadialAngleTextureUnit_);
+   gl.glUniform1i(polarShaderProgram->GetUniformLocation("uGeodesicTable"),
+                  kGeodesicTableTextureUnit_);
+
+   p->vertexShader_.shaderProgram_->Use();
 
    // Generate a vertex array object
    gl.glGenVertexArrays(1, &p->vao_);
 
    // Generate vertex buffer objects
-   gl.glGenBuffers(3, p->vbo_.data());
+   gl.glGenBuffers(static_cast<GLsizei>(p->vbo_.size()), p->vbo_.data());
+
+   // Generate polar layout textures
+   gl.glGenTextures(1, &p->radialAngleTexture_);
+   gl.glBindTexture(GL_TEXTURE_1D, p->radialAngleTexture_);
+   gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+   gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+   gl.glGenTextures(1, &p->geodesicTableTexture_);
+   gl.glBindTexture(GL_TEXTURE_2D, p->geodesicTableTexture_);
+   gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+   gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 
    // Update radar sweep
    p->sweepNeedsUpdate_ = true;
@@ -175,25 +296,181 @@ void RadarProductLayer::UpdateSweep()
 
    p->sweepNeedsUpdate_ = false;
 
-   const std::vector<float>& vertices = radarProductView->vertices();
+   const view::PolarSweepGeometry* polarGeometry =
+      radarProductView->polar_geometry();
+   const GLuint divisor = (polarGeometry != nullptr) ? 1u : 0u;
+
+   const std::shared_ptr<const void> cachedSweep =
+      radarProductView->cached_sweep();
+   const auto cacheLimit =
+      static_cast<GLsizeiptr>(radarProductView->animation_cache_size());
+
+   // A sweep retained by the animation cache is buffered once, and its buffers
+   // are bound each time it is selected
+   SweepBuffers* sweepBuffers = nullptr;
+   bool          bufferSweep  = true;
+
+   if (cachedSweep != nullptr && cacheLimit > 0)
+   {
+      sweepBuffers = p->FindSweepBuffers(cachedSweep);
+
+      if (sweepBuffers != nullptr)
+      {
+         logger_->debug("Sweep buffers are resident");
+         bufferSweep = false;
+      }
+      else
+      {
+         sweepBuffers = &p->CreateSweepBuffers(gl, cachedSweep);
+      }
+   }
+
+   if (sweepBuffers != nullptr)
+   {
+      p->activeVao_                = sweepBuffers->vao_;
+      p->activeVbo_                = sweepBuffers->vbo_;
+      p->activeRadialAngleTexture_ = sweepBuffers->radialAngleTexture_;
+   }
+   else
+   {
+      p->activeVao_                = p->vao_;
+      p->activeVbo_                = p->vbo_;
+      p->activeRadialAngleTexture_ = p->radialAngleTexture_;
+   }
+
+   // Size of the full resolution sweep, in indices, cells or vertices
+   std::size_t sweepSize = 0u;
 
    // Bind a vertex array object
-   gl.glBindVertexArray(p->vao_);
+   gl.glBindVertexArray(p->activeVao_);
 
-   // Buffer vertices
-   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[0]);
-   timer.start();
-   gl.glBufferData(GL_ARRAY_BUFFER,
-                   vertices.size() * sizeof(GLfloat),
-                   vertices.data(),
-                   GL_STATIC_DRAW);
-   timer.stop();
-   logger_->debug("Vertices buffered in {}", timer.format(6, "%ws"));
+   if (polarGeometry != nullptr)
+   {
+      const std::vector<std::uint16_t>& cells = polarGeometry->cells_;
+      const std::vector<float>& radialAngles  = polarGeometry->radialAngles_;
+
+      if (bufferSweep)
+      {
+         // Buffer cells
+         timer.start();
+         p->BufferData(gl,
+                       GL_ARRAY_BUFFER,
+                       0,
+                       cells.size() * sizeof(GLushort),
+                       cells.data(),
+                       sweepBuffers);
+         timer.stop();
+         logger_->debug("Cells buffered in {}", timer.format(6, "%ws"));
+
+         gl.glVertexAttribIPointer(
+            0, kEdgesPerCell_, GL_UNSIGNED_SHORT, 0, static_cast<void*>(0));
+         gl.glEnableVertexAttribArray(0);
+
+         // Buffer radial angles
+         gl.glActiveTexture(GL_TEXTURE0 + kRadialAngleTextureUnit_);
+         gl.glBindTexture(GL_TEXTURE_1D, p->activeRadialAngleTexture_);
+         gl.glTexImage1D(GL_TEXTURE_1D,
+                         0,
+                         GL_R32F,
+                         static_cast<GLsizei>(radialAngles.size()),
+                         0,
+                         GL_RED,
+                         GL_FLOAT,
+                         radialAngles.data());
+
+         if (sweepBuffers != nullptr)
+         {
+            sweepBuffers->size_ += static_cast<GLsizeiptr>(
+               radialAngles.size() * sizeof(GLfloat));
+         }
+      }
 
-   gl.glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, static_cast<void*>(0));
-   gl.glEnableVertexAttribArray(0);
+      // The geodesic table is specific to the radar site
+      p->UpdateGeodesicTable(
+         gl, radarProductView->radar_product_manager()->geodesic_table());
 
-   // Buffer data moments
+      gl.glActiveTexture(GL_TEXTURE0);
+
+      p->polarShader_.shaderProgram_->Use();
+      gl.glUniform1f(p->uGateSizeLocation_, polarGeometry->gateSize_);
+      gl.glUniform1f(p->uGateRangeOffsetLocation_,
+                     polarGeometry->gateRangeOffset_);
+      gl.glUniform1i(p->uInterpolateMomentsLocation_,
+                     polarGeometry->momentsPerCell_ > 1 ? 1 : 0);
+
+      p->layout_ = view::SweepLayout::Polar;
+      sweepSize  = cells.size() / kEdgesPerCell_;
+   }
+   else
+   {
+      const std::vector<float>& vertices = radarProductView->vertices();
+      const std::vector<std::uint32_t>* vertexIndices =
+         radarProductView->vertex_indices();
+
+      if (bufferSweep)
+      {
+         // Buffer vertices
+         timer.start();
+         p->BufferData(gl,
+                       GL_ARRAY_BUFFER,
+                       0,
+                       vertices.size() * sizeof(GLfloat),
+                       vertices.data(),
+                       sweepBuffers);
+         timer.stop();
+         logger_->debug("Vertices buffered in {}", timer.format(6, "%ws"));
+
+         gl.glVertexAttribPointer(
+            0, 2, GL_FLOAT, GL_FALSE, 0, static_cast<void*>(0));
+         gl.glEnableVertexAttribArray(0);
+      }
+
+      if (vertexIndices != nullptr)
+      {
+         if (bufferSweep)
+         {
+            // Buffer vertex indices, bound to the vertex array object
+            timer.start();
+            p->BufferData(gl,
+                          GL_ELEMENT_ARRAY_BUFFER,
+                          3,
+                          vertexIndices->size() * sizeof(GLuint),
+                          vertexIndices->data(),
+                          sweepBuffers);
+            timer.stop();
+            logger_->debug("Vertex indices buffered in {}",
+                           timer.format(6, "%ws"));
+         }
+
+         // The sweep is recomputed when smoothing is changed
+         p->indexedShader_.shaderProgram_->Use();
+         gl.glUniform1i(p->uIndexedInterpolateMomentsLocation_,
+                        radarProductView->smoothing_enabled() ? 1 : 0);
+
+         p->layout_ = view::SweepLayout::Indexed;
+         sweepSize  = vertexIndices->size();
+      }
+      else
+      {
+         p->layout_ = view::SweepLayout::Vertices;
+         sweepSize  = vertices.size() / 2;
+      }
+   }
+
+   // Decimated levels of detail follow the full resolution sweep
+   const std::vector<view::SweepLevel>* levels =
+      radarProductView->sweep_levels();
+
+   if (levels != nullptr && !levels->empty())
+   {
+      p->levels_ = *levels;
+   }
+   else
+   {
+      p->levels_.assign(1u, {0.0f, 0u, sweepSize});
+   }
+
+   // Data moments
    const GLvoid* data;
    GLsizeiptr    dataSize;
    size_t        componentSize;
@@ -210,16 +487,13 @@ void RadarProductLayer::UpdateSweep()
       type = GL_UNSIGNED_SHORT;
    }
 
-   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[1]);
-   timer.start();
-   gl.glBufferData(GL_ARRAY_BUFFER, dataSize, data, GL_STATIC_DRAW);
-   timer.stop();
-   logger_->debug("Data moments buffered in {}", timer.format(6, "%ws"));
+   // The polar layout has one data moment per corner when smoothing
+   const GLint momentsPerVertex =
+      (polarGeometry != nullptr) ?
+         static_cast<GLint>(polarGeometry->momentsPerCell_) :
+         1;
 
-   gl.glVertexAttribIPointer(1, 1, type, 0, static_cast<void*>(0));
-   gl.glEnableVertexAttribArray(1);
-
-   // Buffer CFP data
+   // CFP data
    const GLvoid* cfpData;
    GLsizeiptr    cfpDataSize;
    size_t        cfpComponentSize;
@@ -228,24 +502,51 @@ void RadarProductLayer::UpdateSweep()
    std::tie(cfpData, cfpDataSize, cfpComponentSize) =
       radarProductView->GetCfpMomentData();
 
-   if (cfpData != nullptr)
+   if (cfpComponentSize == 1)
    {
-      if (cfpComponentSize == 1)
-      {
-         cfpType = GL_UNSIGNED_BYTE;
-      }
-      else
-      {
-         cfpType = GL_UNSIGNED_SHORT;
-      }
+      cfpType = GL_UNSIGNED_BYTE;
+   }
+   else
+   {
+      cfpType = GL_UNSIGNED_SHORT;
+   }
+
+   p->momentType_     = type;
+   p->momentsPerCell_ = momentsPerVertex;
+   p->cfpMomentType_  = (cfpData != nullptr) ? cfpType : GL_NONE;
+
+   if (!bufferSweep)
+   {
+      // The buffers of the sweep are resident, and bound to its vertex array
+      // object
+      p->TrimSweepBuffers(gl, cacheLimit);
+      return;
+   }
+
+   gl.glVertexAttribDivisor(0, divisor);
+
+   // Buffer data moments
+   timer.start();
+   p->BufferData(gl, GL_ARRAY_BUFFER, 1, dataSize, data, sweepBuffers);
+   timer.stop();
+   logger_->debug("Data moments buffered in {}", timer.format(6, "%ws"));
+
+   gl.glVertexAttribIPointer(
+      1, momentsPerVertex, type, 0, static_cast<void*>(0));
+   gl.glVertexAttribDivisor(1, divisor);
+   gl.glEnableVertexAttribArray(1);
 
-      gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[2]);
+   // Buffer CFP data
+   if (cfpData != nullptr)
+   {
       timer.start();
-      gl.glBufferData(GL_ARRAY_BUFFER, cfpDataSize, cfpData, GL_STATIC_DRAW);
+      p->BufferData(
+         gl, GL_ARRAY_BUFFER, 2, cfpDataSize, cfpData, sweepBuffers);
       timer.stop();
       logger_->debug("CFP moments buffered in {}", timer.format(6, "%ws"));
 
       gl.glVertexAttribIPointer(2, 1, cfpType, 0, static_cast<void*>(0));
+      gl.glVertexAttribDivisor(2, divisor);
       gl.glEnableVertexAttribArray(2);
    }
    else
@@ -253,7 +554,249 @@ void RadarProductLayer::UpdateSweep()
       gl.glDisableVertexAttribArray(2);
    }
 
-   p->numVertices_ = vertices.size() / 2;
+   if (sweepBuffers != nullptr)
+   {
+      sweepBuffersSize_ += sweepBuffers->size_;
+   }
+
+   p->TrimSweepBuffers(gl, cacheLimit);
+}
+
+void RadarProductLayerImpl::BufferData(gl::OpenGLFunctions& gl,
+                                       GLenum               target,
+                                       std::size_t          buffer,
+                                       GLsizeiptr           size,
+                                       const void*          data,
+                                       SweepBuffers*        sweepBuffers)
+{
+   if (sweepBuffers != nullptr)
+   {
+      // Buffers of a cached sweep are written once, and are sized exactly
+      gl.glBindBuffer(target, sweepBuffers->vbo_[buffer]);
+      gl.glBufferData(target, size, data, GL_STATIC_DRAW);
+      sweepBuffers->size_ += size;
+      return;
+   }
+
+   GLsizeiptr& capacity = vboCapacity_[buffer];
+
+   gl.glBindBuffer(target, vbo_[buffer]);
+
+   if (size > capacity)
+   {
+      // Allocate storage once, growing geometrically to avoid reallocating for
+      // each sweep while animating
+      capacity = std::max(size, capacity * kBufferGrowthFactor_);
+      gl.glBufferData(target, capacity, nullptr, GL_DYNAMIC_DRAW);
+   }
+
+   if (size == 0)
+   {
+      return;
+   }
+
+   // Invalidating the buffer lets the driver orphan storage still in use by
+   // the previous sweep, rather than waiting for it
+   void* bufferData = gl.glMapBufferRange(target,
+                                          0,
+                                          size,
+                                          GL_MAP_WRITE_BIT |
+                                             GL_MAP_INVALIDATE_BUFFER_BIT |
+                                             GL_MAP_UNSYNCHRONIZED_BIT);
+
+   if (bufferData != nullptr)
+   {
+      std::memcpy(bufferData, data, static_cast<std::size_t>(size));
+
+      if (gl.glUnmapBuffer(target) == GL_TRUE)
+      {
+         return;
+      }
+   }
+
+   // The buffer could not be mapped, or its contents were lost
+   logger_->debug("Buffer {} could not be mapped, copying data", buffer);
+   gl.glBufferSubData(target, 0, size, data);
+}
+
+SweepBuffers&
+RadarProductLayerImpl::CreateSweepBuffers(gl::OpenGLFunctions&        gl,
+                                          std::shared_ptr<const void> sweep)
+{
+   SweepBuffers& sweepBuffers = sweepBuffers_.emplace_front();
+   sweepBuffers.sweep_        = sweep;
+
+   gl.glGenVertexArrays(1, &sweepBuffers.vao_);
+   gl.glGenBuffers(static_cast<GLsizei>(sweepBuffers.vbo_.size()),
+                   sweepBuffers.vbo_.data());
+
+   gl.glActiveTexture(GL_TEXTURE0 + kRadialAngleTextureUnit_);
+   gl.glGenTextures(1, &sweepBuffers.radialAngleTexture_);
+   gl.glBindTexture(GL_TEXTURE_1D, sweepBuffers.radialAngleTexture_);
+   gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+   gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+   gl.glActiveTexture(GL_TEXTURE0);
+
+   return sweepBuffers;
+}
+
+void RadarProductLayerImpl::DeleteSweepBuffers(gl::OpenGLFunctions& gl,
+                                               SweepBuffers& sweepBuffers)
+{
+   gl.glDeleteVertexArrays(1, &sweepBuffers.vao_);
+   gl.glDeleteBuffers(static_cast<GLsizei>(sweepBuffers.vbo_.size()),
+                      sweepBuffers.vbo_.data());
+   gl.glDeleteTextures(1, &sweepBuffers.radialAngleTexture_);
+
+   sweepBuffersSize_ -= sweepBuffers.size_;
+}
+
+SweepBuffers* RadarProductLayerImpl::FindSweepBuffers(
+   const std::shared_ptr<const void>& sweep)
+{
+   auto it = std::find_if(sweepBuffers_.begin(),
+                          sweepBuffers_.end(),
+                          [&sweep](const SweepBuffers& sweepBuffers)
+                          { return sweepBuffers.sweep_.lock() == sweep; });
+
+   if (it == sweepBuffers_.end())
+   {
+      return nullptr;
+   }
+
+   // Move the buffers to the front of the cache
+   sweepBuffers_.splice(sweepBuffers_.begin(), sweepBuffers_, it);
+   return &sweepBuffers_.front();
+}
+
+void RadarProductLayerImpl::BindPolarCells(gl::OpenGLFunctions& gl,
+                                           GLint                firstCell)
+{
+   // Cells are drawn as instances, which cannot be offset by the draw call, so
+   // the instanced attributes are offset to the first cell drawn
+   auto attributeOffset = [firstCell](GLsizeiptr size)
+   { return reinterpret_cast<void*>(firstCell * size); };
+
+   auto componentSize = [](GLenum type) -> GLsizeiptr
+   { return (type == GL_UNSIGNED_BYTE) ? sizeof(GLubyte) : sizeof(GLushort); };
+
+   gl.glBindBuffer(GL_ARRAY_BUFFER, activeVbo_[0]);
+   gl.glVertexAttribIPointer(
+      0,
+      kEdgesPerCell_,
+      GL_UNSIGNED_SHORT,
+      0,
+      attributeOffset(kEdgesPerCell_ * componentSize(GL_UNSIGNED_SHORT)));
+
+   gl.glBindBuffer(GL_ARRAY_BUFFER, activeVbo_[1]);
+   gl.glVertexAttribIPointer(
+      1,
+      momentsPerCell_,
+      momentType_,
+      0,
+      attributeOffset(momentsPerCell_ * componentSize(momentType_)));
+
+   if (cfpMomentType_ != GL_NONE)
+   {
+      gl.glBindBuffer(GL_ARRAY_BUFFER, activeVbo_[2]);
+      gl.glVertexAttribIPointer(2,
+                                1,
+                                cfpMomentType_,
+                                0,
+                                attributeOffset(componentSize(cfpMomentType_)));
+   }
+}
+
+void RadarProductLayerImpl::CullSectors(
+   const view::SweepLevel&                       level,
+   const QMapLibre::CustomLayerRenderParameters& params)
+{
+   const auto [southWest, northEast] = util::maplibre::GetMapBounds(params);
+
+   view::CullSweepSectors(
+      level, southWest, northEast, kMaxDrawnCulledSectors_, drawRanges_);
+
+   drawFirsts_.resize(drawRanges_.size());
+   drawCounts_.resize(drawRanges_.size());
+
+   for (std::size_t i = 0; i < drawRanges_.size(); ++i)
+   {
+      drawFirsts_[i] = static_cast<GLint>(drawRanges_[i].first);
+      drawCounts_[i] = static_cast<GLsizei>(drawRanges_[i].second);
+   }
+}
+
+const view::SweepLevel& RadarProductLayerImpl::SelectLevel(
+   const QMapLibre::CustomLayerRenderParameters& params) const
+{
+   if (levels_.empty())
+   {
+      // The sweep has not been buffered
+      return kEmptyLevel_;
+   }
+
+   const double metersPerPixel =
+      QMapLibre::metersPerPixelAtLatitude(params.latitude, params.zoom);
+
+   return view::SelectSweepLevel(levels_, metersPerPixel);
+}
+
+void RadarProductLayerImpl::TrimSweepBuffers(gl::OpenGLFunctions& gl,
+                                             GLsizeiptr           cacheLimit)
+{
+   // Delete the buffers of sweeps no longer retained by the animation cache
+   for (auto it = sweepBuffers_.begin(); it != sweepBuffers_.end();)
+   {
+      if (it->sweep_.expired())
+      {
+         DeleteSweepBuffers(gl, *it);
+         it = sweepBuffers_.erase(it);
+      }
+      else
+      {
+         ++it;
+      }
+   }
+
+   // Delete the least recently used buffers until the cache of all layers is
+   // within its limit. The most recently used buffers may still be drawn.
+   while (sweepBuffersSize_ > cacheLimit && sweepBuffers_.size() > 1u)
+   {
+      DeleteSweepBuffers(gl, sweepBuffers_.back());
+      sweepBuffers_.pop_back();
+   }
+}
+
+void RadarProductLayerImpl::UpdateGeodesicTable(
+   gl::OpenGLFunctions& gl, std::shared_ptr<const view::GeodesicTable> table)
+{
+   if (table == nullptr || table == geodesicTable_)
+   {
+      // The geodesic table is unchanged
+      return;
+   }
+
+   gl.glActiveTexture(GL_TEXTURE0 + kGeodesicTableTextureUnit_);
+   gl.glBindTexture(GL_TEXTURE_2D, geodesicTableTexture_);
+   gl.glTexImage2D(GL_TEXTURE_2D,
+                   0,
+                   GL_RG32F,
+                   static_cast<GLsizei>(table->azimuths_),
+                   static_cast<GLsizei>(table->ranges_),
+                   0,
+                   GL_RG,
+                   GL_FLOAT,
+                   table->offsets_.data());
+
+   polarShader_.shaderProgram_->Use();
+   gl.glUniform2f(uRadarLatLongLocation_,
+                  static_cast<float>(table->radarLatitude_),
+                  static_cast<float>(table->radarLongitude_));
+   gl.glUniform2f(uGeodesicIntervalLocation_,
+                  table->azimuthInterval_,
+                  table->rangeInterval_);
+
+   geodesicTable_ = std::move(table);
 }
 
 void RadarProductLayer::Render(
@@ -261,8 +804,6 @@ void RadarProductLayer::Render(
 {
    gl::OpenGLFunctions& gl = context()->gl();
 
-   p->shaderProgram_->Use();
-
    // Set OpenGL blend mode for transparency
    gl.glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
@@ -283,6 +824,13 @@ void RadarProductLayer::Render(
       UpdateSweep();
    }
 
+   const RadarShaderProgram& shader =
+      (p->layout_ == view::SweepLayout::Polar)   ? p->polarShader_ :
+      (p->layout_ == view::SweepLayout::Indexed) ? p->indexedShader_ :
+                                                   p->vertexShader_;
+
+   shader.shaderProgram_->Use();
+
    const float scale = std::pow(2.0, params.zoom) * 2.0f *
                        mbgl::util::tileSize_D / mbgl::util::DEGREES_MAX;
    const float xScale = scale / params.width;
@@ -294,20 +842,69 @@ void RadarProductLayer::Render(
                             glm::radians<float>(params.bearing),
                             glm::vec3(0.0f, 0.0f, 1.0f));
 
-   gl.glUniform2fv(p->uMapScreenCoordLocation_,
+   gl.glUniform2fv(shader.uMapScreenCoordLocation_,
                    1,
                    glm::value_ptr(util::maplibre::LatLongToScreenCoordinate(
                       {params.latitude, params.longitude})));
 
    gl.glUniformMatrix4fv(
-      p->uMVPMatrixLocation_, 1, GL_FALSE, glm::value_ptr(uMVPMatrix));
+      shader.uMVPMatrixLocation_, 1, GL_FALSE, glm::value_ptr(uMVPMatrix));
 
-   gl.glUniform1i(p->uCFPEnabledLocation_, p->cfpEnabled_ ? 1 : 0);
+   gl.glUniform1i(shader.uCFPEnabledLocation_, p->cfpEnabled_ ? 1 : 0);
 
-   gl.glActiveTexture(GL_TEXTURE0);
+   gl.glActiveTexture(GL_TEXTURE0 + kColorTableTextureUnit_);
    gl.glBindTexture(GL_TEXTURE_1D, p->texture_);
-   gl.glBindVertexArray(p->vao_);
-   gl.glDrawArrays(GL_TRIANGLES, 0, p->numVertices_);
+   gl.glBindVertexArray(p->activeVao_);
+
+   // Sweeps are drawn at a level of detail matching the zoom, and sectors
+   // outside of the viewport are culled
+   p->CullSectors(p->SelectLevel(params), params);
+
+   const auto drawCount = static_cast<GLsizei>(p->drawCounts_.size());
+
+   if (p->layout_ == view::SweepLayout::Polar)
+   {
+      gl.glActiveTexture(GL_TEXTURE0 + kRadialAngleTextureUnit_);
+      gl.glBindTexture(GL_TEXTURE_1D, p->activeRadialAngleTexture_);
+      gl.glActiveTexture(GL_TEXTURE0 + kGeodesicTableTextureUnit_);
+      gl.glBindTexture(GL_TEXTURE_2D, p->geodesicTableTexture_);
+
+      // Each cell is drawn as an instance of two triangles. Instanced draws
+      // cannot be combined, so each range is drawn separately.
+      for (std::size_t i = 0; i < p->drawCounts_.size(); ++i)
+      {
+         p->BindPolarCells(gl, p->drawFirsts_[i]);
+         gl.glDrawArraysInstanced(
+            GL_TRIANGLES, 0, kVerticesPerCell_, p->drawCounts_[i]);
+      }
+
+      gl.glActiveTexture(GL_TEXTURE0);
+   }
+   else if (p->layout_ == view::SweepLayout::Indexed)
+   {
+      p->drawIndices_.resize(p->drawFirsts_.size());
+      std::transform(p->drawFirsts_.cbegin(),
+                     p->drawFirsts_.cend(),
+                     p->drawIndices_.begin(),
+                     [](GLint first)
+                     {
+                        return reinterpret_cast<const void*>(
+                           static_cast<std::size_t>(first) * sizeof(GLuint));
+                     });
+
+      gl.glMultiDrawElements(GL_TRIANGLES,
+                             p->drawCounts_.data(),
+                             GL_UNSIGNED_INT,
+                             p->drawIndices_.data(),
+                             drawCount);
+   }
+   else
+   {
+      gl.glMultiDrawArrays(GL_TRIANGLES,
+                           p->drawFirsts_.data(),
+                           p->drawCounts_.data(),
+                           drawCount);
+   }
 
    if (wireframeEnabled)
    {
@@ -325,16 +922,30 @@ void RadarProductLayer::Deinitialize()
    gl::OpenGLFunctions& gl = context()->gl();
 
    gl.glDeleteVertexArrays(1, &p->vao_);
-   gl.glDeleteBuffers(3, p->vbo_.data());
-
-   p->uMVPMatrixLocation_        = GL_INVALID_INDEX;
-   p->uMapScreenCoordLocation_   = GL_INVALID_INDEX;
-   p->uDataMomentOffsetLocation_ = GL_INVALID_INDEX;
-   p->uDataMomentScaleLocation_  = GL_INVALID_INDEX;
-   p->uCFPEnabledLocation_       = GL_INVALID_INDEX;
-   p->vao_                       = GL_INVALID_INDEX;
-   p->vbo_                       = {GL_INVALID_INDEX};
-   p->texture_                   = GL_INVALID_INDEX;
+   gl.glDeleteBuffers(static_cast<GLsizei>(p->vbo_.size()), p->vbo_.data());
+   gl.glDeleteTextures(1, &p->radialAngleTexture_);
+   gl.glDeleteTextures(1, &p->geodesicTableTexture_);
+
+   for (SweepBuffers& sweepBuffers : p->sweepBuffers_)
+   {
+      p->DeleteSweepBuffers(gl, sweepBuffers);
+   }
+   p->sweepBuffers_.clear();
+
+   p->vertexShader_             = {};
+   p->indexedShader_            = {};
+   p->polarShader_              = {};
+   p->vao_                      = GL_INVALID_INDEX;
+   p->vbo_                      = {GL_INVALID_INDEX};
+   p->vboCapacity_              = {};
+   p->texture_                  = GL_INVALID_INDEX;
+   p->radialAngleTexture_       = GL_INVALID_INDEX;
+   p->geodesicTableTexture_     = GL_INVALID_INDEX;
+   p->geodesicTable_            = nullptr;
+   p->activeVao_                = GL_INVALID_INDEX;
+   p->activeVbo_                = {};
+   p->activeRadialAngleTexture_ = GL_INVALID_INDEX;
+   p->levels_.clear();
 }
 
 bool RadarProductLayer::RunMousePicking(
@@ -492,8 +1103,13 @@ void RadarProductLayer::UpdateColorTable()
                    colorTable.data());
    gl.glGenerateMipmap(GL_TEXTURE_1D);
 
-   gl.glUniform1ui(p->uDataMomentOffsetLocation_, rangeMin);
-   gl.glUniform1f(p->uDataMomentScaleLocation_, scale);
+   for (const RadarShaderProgram* shader :
+        {&p->vertexShader_, &p->indexedShader_, &p->polarShader_})
+   {
+      shader->shaderProgram_->Use();
+      gl.glUniform1ui(shader->uDataMomentOffsetLocation_, rangeMin);
+      gl.glUniform1f(shader->uDataMomentScaleLocation_, scale);
+   }
 }
 
 } // namespace map
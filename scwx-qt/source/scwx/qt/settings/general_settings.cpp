@@ -59,6 +59,7 @@ public:
       loopTime_.SetDefault(30);
       gridWidth_.SetDefault(1);
       gridHeight_.SetDefault(1);
+      level2ChunkPath_.SetDefault("");
       mapProvider_.SetDefault(defaultMapProviderValue);
       mapboxApiKey_.SetDefault("?");
       maptilerApiKey_.SetDefault("?");
@@ -156,6 +157,8 @@ public:
    SettingsContainer<std::vector<std::int64_t>> fontSizes_ {"font_sizes"};
    SettingsVariable<std::int64_t>               gridWidth_ {"grid_width"};
    SettingsVariable<std::int64_t>               gridHeight_ {"grid_height"};
+   SettingsVariable<std::string>                level2ChunkPath_ {
+      "level2_chunk_path"};
    SettingsVariable<std::int64_t>               loopDelay_ {"loop_delay"};
    SettingsVariable<double>                     loopSpeed_ {"loop_speed"};
    SettingsVariable<std::int64_t>               loopTime_ {"loop_time"};
@@ -195,6 +198,7 @@ GeneralSettings::GeneralSettings() :
                       &p->fontSizes_,
                       &p->gridWidth_,
                       &p->gridHeight_,
+                      &p->level2ChunkPath_,
                       &p->loopDelay_,
                       &p->loopSpeed_,
                       &p->loopTime_,
@@ -280,6 +284,11 @@ SettingsVariable<std::int64_t>& GeneralSettings::grid_width() const
    return p->gridWidth_;
 }
 
+SettingsVariable<std::string>& GeneralSettings::level2_chunk_path() const
+{
+   return p->level2ChunkPath_;
+}
+
 SettingsVariable<std::int64_t>& GeneralSettings::loop_delay() const
 {
    return p->loopDelay_;
@@ -419,6 +428,7 @@ bool operator==(const GeneralSettings& lhs, const GeneralSettings& rhs)
            lhs.p->fontSizes_ == rhs.p->fontSizes_ &&
            lhs.p->gridWidth_ == rhs.p->gridWidth_ &&
            lhs.p->gridHeight_ == rhs.p->gridHeight_ &&
+           lhs.p->level2ChunkPath_ == rhs.p->level2ChunkPath_ &&
            lhs.p->loopDelay_ == rhs.p->loopDelay_ &&
            lhs.p->loopSpeed_ == rhs.p->loopSpeed_ &&
            lhs.p->loopTime_ == rhs.p->loopTime_ &&
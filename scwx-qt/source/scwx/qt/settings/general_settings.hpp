@@ -33,6 +33,7 @@ public:
                                                  font_sizes() const;
    [[nodiscard]] SettingsVariable<std::int64_t>& grid_height() const;
    [[nodiscard]] SettingsVariable<std::int64_t>& grid_width() const;
+   [[nodiscard]] SettingsVariable<std::string>&  level2_chunk_path() const;
    [[nodiscard]] SettingsVariable<std::int64_t>& loop_delay() const;
    [[nodiscard]] SettingsVariable<double>&       loop_speed() const;
    [[nodiscard]] SettingsVariable<std::int64_t>& loop_time() const;
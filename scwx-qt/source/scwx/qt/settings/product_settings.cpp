@@ -15,9 +15,14 @@ public:
    {
       // SetDefault, SetMinimum and SetMaximum are descriptive
       // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+      animationCacheSize_.SetDefault(256);
+      gpuProjectionEnabled_.SetDefault(false);
       showSmoothedRangeFolding_.SetDefault(false);
       stiForecastEnabled_.SetDefault(true);
       stiPastEnabled_.SetDefault(true);
+
+      animationCacheSize_.SetMinimum(0);
+      animationCacheSize_.SetMaximum(16384);
       // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
    }
 
@@ -27,7 +32,10 @@ public:
    Impl(const Impl&&)            = delete;
    Impl& operator=(const Impl&&) = delete;
 
-   SettingsVariable<bool> showSmoothedRangeFolding_ {
+   SettingsVariable<std::int64_t> animationCacheSize_ {"animation_cache_size"};
+   SettingsVariable<bool>         gpuProjectionEnabled_ {
+      "gpu_projection_enabled"};
+   SettingsVariable<bool>         showSmoothedRangeFolding_ {
       "show_smoothed_range_folding"};
    SettingsVariable<bool> stiForecastEnabled_ {"sti_forecast_enabled"};
    SettingsVariable<bool> stiPastEnabled_ {"sti_past_enabled"};
@@ -36,7 +44,9 @@ public:
 ProductSettings::ProductSettings() :
     SettingsCategory("product"), p(std::make_unique<Impl>())
 {
-   RegisterVariables({&p->showSmoothedRangeFolding_,
+   RegisterVariables({&p->animationCacheSize_,
+                      &p->gpuProjectionEnabled_,
+                      &p->showSmoothedRangeFolding_,
                       &p->stiForecastEnabled_,
                       &p->stiPastEnabled_});
    SetDefaults();
@@ -47,6 +57,16 @@ ProductSettings::ProductSettings(ProductSettings&&) noexcept = default;
 ProductSettings&
 ProductSettings::operator=(ProductSettings&&) noexcept = default;
 
+SettingsVariable<std::int64_t>& ProductSettings::animation_cache_size()
+{
+   return p->animationCacheSize_;
+}
+
+SettingsVariable<bool>& ProductSettings::gpu_projection_enabled()
+{
+   return p->gpuProjectionEnabled_;
+}
+
 SettingsVariable<bool>& ProductSettings::show_smoothed_range_folding()
 {
    return p->showSmoothedRangeFolding_;
@@ -81,7 +101,9 @@ ProductSettings& ProductSettings::Instance()
 
 bool operator==(const ProductSettings& lhs, const ProductSettings& rhs)
 {
-   return (lhs.p->showSmoothedRangeFolding_ ==
+   return (lhs.p->animationCacheSize_ == rhs.p->animationCacheSize_ &&
+           lhs.p->gpuProjectionEnabled_ == rhs.p->gpuProjectionEnabled_ &&
+           lhs.p->showSmoothedRangeFolding_ ==
               rhs.p->showSmoothedRangeFolding_ &&
            lhs.p->stiForecastEnabled_ == rhs.p->stiForecastEnabled_ &&
            lhs.p->stiPastEnabled_ == rhs.p->stiPastEnabled_);
@@ -3,6 +3,7 @@
 #include <scwx/qt/settings/settings_category.hpp>
 #include <scwx/qt/settings/settings_variable.hpp>
 
+#include <cstdint>
 #include <memory>
 
 namespace scwx::qt::settings
@@ -20,9 +21,11 @@ public:
    ProductSettings(ProductSettings&&) noexcept;
    ProductSettings& operator=(ProductSettings&&) noexcept;
 
-   SettingsVariable<bool>& show_smoothed_range_folding();
-   SettingsVariable<bool>& sti_forecast_enabled();
-   SettingsVariable<bool>& sti_past_enabled();
+   SettingsVariable<std::int64_t>& animation_cache_size();
+   SettingsVariable<bool>&         gpu_projection_enabled();
+   SettingsVariable<bool>&         show_smoothed_range_folding();
+   SettingsVariable<bool>&         sti_forecast_enabled();
+   SettingsVariable<bool>&         sti_past_enabled();
 
    static ProductSettings& Instance();
 
@@ -133,12 +133,15 @@ public:
           &nmeaBaudRate_,
           &nmeaSource_,
           &warningsProvider_,
+          &level2ChunkPath_,
           &radarSiteThreshold_,
+          &animationCacheSize_,
           &antiAliasingEnabled_,
           &showMapAttribution_,
           &showMapCenter_,
           &showMapLogo_,
           &showSmoothedRangeFolding_,
+          &gpuProjectionEnabled_,
           &updateNotificationsEnabled_,
           &cursorIconAlwaysOn_,
           &debugEnabled_,
@@ -250,12 +253,15 @@ public:
    settings::SettingsInterface<std::string>  theme_ {};
    settings::SettingsInterface<std::string>  themeFile_ {};
    settings::SettingsInterface<std::string>  warningsProvider_ {};
+   settings::SettingsInterface<std::string>  level2ChunkPath_ {};
    settings::SettingsInterface<double>       radarSiteThreshold_ {};
+   settings::SettingsInterface<std::int64_t> animationCacheSize_ {};
    settings::SettingsInterface<bool>         antiAliasingEnabled_ {};
    settings::SettingsInterface<bool>         showMapAttribution_ {};
    settings::SettingsInterface<bool>         showMapCenter_ {};
    settings::SettingsInterface<bool>         showMapLogo_ {};
    settings::SettingsInterface<bool>         showSmoothedRangeFolding_ {};
+   settings::SettingsInterface<bool>         gpuProjectionEnabled_ {};
    settings::SettingsInterface<bool>         updateNotificationsEnabled_ {};
    settings::SettingsInterface<bool>         cursorIconAlwaysOn_ {};
    settings::SettingsInterface<bool>         debugEnabled_ {};
@@ -751,6 +757,11 @@ void SettingsDialogImpl::SetupGeneralTab()
    warningsProvider_.SetResetButton(self_->ui->resetWarningsProviderButton);
    warningsProvider_.EnableTrimming();
 
+   level2ChunkPath_.SetSettingsVariable(generalSettings.level2_chunk_path());
+   level2ChunkPath_.SetEditWidget(self_->ui->level2ChunkPathLineEdit);
+   level2ChunkPath_.SetResetButton(self_->ui->resetLevel2ChunkPathButton);
+   level2ChunkPath_.EnableTrimming();
+
    radarSiteThreshold_.SetSettingsVariable(
       generalSettings.radar_site_threshold());
    radarSiteThreshold_.SetEditWidget(self_->ui->radarSiteThresholdSpinBox);
@@ -772,6 +783,11 @@ void SettingsDialogImpl::SetupGeneralTab()
    radarSiteThresholdUpdateUnits(
       settings::UnitSettings::Instance().distance_units().GetValue());
 
+   animationCacheSize_.SetSettingsVariable(
+      productSettings.animation_cache_size());
+   animationCacheSize_.SetEditWidget(self_->ui->animationCacheSizeSpinBox);
+   animationCacheSize_.SetResetButton(self_->ui->resetAnimationCacheSizeButton);
+
    antiAliasingEnabled_.SetSettingsVariable(
       generalSettings.anti_aliasing_enabled());
    antiAliasingEnabled_.SetEditWidget(self_->ui->antiAliasingEnabledCheckBox);
@@ -791,6 +807,11 @@ void SettingsDialogImpl::SetupGeneralTab()
    showSmoothedRangeFolding_.SetEditWidget(
       self_->ui->showSmoothedRangeFoldingCheckBox);
 
+   gpuProjectionEnabled_.SetSettingsVariable(
+      productSettings.gpu_projection_enabled());
+   gpuProjectionEnabled_.SetEditWidget(
+      self_->ui->gpuProjectionEnabledCheckBox);
+
    updateNotificationsEnabled_.SetSettingsVariable(
       generalSettings.update_notifications_enabled());
    updateNotificationsEnabled_.SetEditWidget(
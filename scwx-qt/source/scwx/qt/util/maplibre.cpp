@@ -43,6 +43,40 @@ glm::vec2 GetMapScale(const QMapLibre::CustomLayerRenderParameters& params)
    return glm::vec2 {xScale, yScale};
 }
 
+std::pair<common::Coordinate, common::Coordinate>
+GetMapBounds(const QMapLibre::CustomLayerRenderParameters& params)
+{
+   static constexpr double RAD2DEG_D = 180.0 / M_PI;
+
+   const glm::vec2 scale  = GetMapScale(params);
+   const glm::vec2 center =
+      LatLongToScreenCoordinate({params.latitude, params.longitude});
+
+   // Half extents of the viewport in screen coordinates, enclosing the
+   // viewport rotated by the bearing
+   const double bearing    = glm::radians(params.bearing);
+   const double cosBearing = std::abs(std::cos(bearing));
+   const double sinBearing = std::abs(std::sin(bearing));
+   const double halfWidth  = 1.0 / scale.x;
+   const double halfHeight = 1.0 / scale.y;
+
+   const double dx = cosBearing * halfWidth + sinBearing * halfHeight;
+   const double dy = sinBearing * halfWidth + cosBearing * halfHeight;
+
+   // Inverse of LatLongToScreenCoordinate
+   auto latitude = [](double y)
+   {
+      return RAD2DEG_D *
+             (2.0 * std::atan(std::exp((y + mbgl::util::LONGITUDE_MAX) /
+                                       RAD2DEG_D)) -
+              M_PI / 2.0);
+   };
+   auto longitude = [](double x) { return x - mbgl::util::LONGITUDE_MAX; };
+
+   return {{latitude(center.y - dy), longitude(center.x - dx)},
+           {latitude(center.y + dy), longitude(center.x + dx)}};
+}
+
 bool IsPointInPolygon(const std::vector<glm::vec2>& vertices,
                       const glm::vec2&              point)
 {
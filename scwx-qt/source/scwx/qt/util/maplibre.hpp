@@ -1,6 +1,7 @@
 #pragma once
 
 #include <scwx/qt/map/map_context.hpp>
+#include <scwx/common/geographic.hpp>
 
 #include <QMapLibre/Map>
 #include <QMapLibre/Types>
@@ -21,6 +22,17 @@ units::length::meters<double>
 glm::mat4 GetMapMatrix(const QMapLibre::CustomLayerRenderParameters& params);
 glm::vec2 GetMapScale(const QMapLibre::CustomLayerRenderParameters& params);
 
+/**
+ * @brief Get the bounds of the map viewport. When the map is rotated, the
+ * bounds enclose the rotated viewport.
+ *
+ * @param [in] params Map render parameters
+ *
+ * @return South-west and north-east corners of the bounds
+ */
+std::pair<common::Coordinate, common::Coordinate>
+GetMapBounds(const QMapLibre::CustomLayerRenderParameters& params);
+
 /**
  * @brief Determine whether a point lies within a polygon
  *
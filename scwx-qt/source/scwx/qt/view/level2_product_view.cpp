@@ -1,14 +1,20 @@
 #include <scwx/qt/view/level2_product_view.hpp>
+#include <scwx/qt/view/sweep_geometry.hpp>
 #include <scwx/qt/settings/unit_settings.hpp>
 #include <scwx/qt/types/unit_types.hpp>
-#include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/common/characters.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/lru_cache.hpp>
 #include <scwx/util/threads.hpp>
 #include <scwx/util/time.hpp>
 
-#include <boost/range/irange.hpp>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <set>
+
+#include <boost/asio/post.hpp>
 #include <boost/timer/timer.hpp>
 
 namespace scwx
@@ -21,18 +27,13 @@ namespace view
 static const std::string logPrefix_ = "scwx::qt::view::level2_product_view";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
-static constexpr std::uint32_t kMaxRadialGates_ =
-   common::MAX_0_5_DEGREE_RADIALS * common::MAX_DATA_MOMENT_GATES;
-static constexpr std::uint32_t kMaxCoordinates_ = kMaxRadialGates_ * 2u;
-
-static constexpr std::uint8_t kDataWordSize8_ = 8u;
+static constexpr uint16_t RANGE_FOLDED = 1u;
 
-static constexpr std::size_t kVerticesPerGate_       = 6u;
-static constexpr std::size_t kVerticesPerOriginGate_ = 3u;
-
-static constexpr uint16_t RANGE_FOLDED      = 1u;
-static constexpr uint32_t VERTICES_PER_BIN  = 6u;
-static constexpr uint32_t VALUES_PER_VERTEX = 2u;
+// Level 2 radial coordinates are followed by the radar site
+static constexpr std::size_t kNumLevel2RadialGates_ =
+   std::size_t {common::MAX_0_5_DEGREE_RADIALS} * common::MAX_DATA_MOMENT_GATES;
+static constexpr std::size_t kNumLevel2Coordinates_ =
+   (kNumLevel2RadialGates_ + 1u) * 2u;
 
 static const std::unordered_map<common::Level2Product,
                                 wsr88d::rda::DataBlockType>
@@ -61,6 +62,79 @@ static const std::unordered_map<common::Level2Product, std::string>
                   {common::Level2Product::CorrelationCoefficient, "%"},
                   {common::Level2Product::ClutterFilterPowerRemoved, "dB"}};
 
+struct Level2SweepKey
+{
+   // A cached sweep does not retain its elevation scan, which is released with
+   // the radar product record
+   std::weak_ptr<const wsr88d::rda::PackedElevationScan> elevationScan_ {};
+   wsr88d::rda::DataBlockType                            dataBlockType_ {
+      wsr88d::rda::DataBlockType::Unknown};
+   bool smoothingEnabled_ {false};
+   bool gpuProjectionEnabled_ {false};
+   bool showSmoothedRangeFolding_ {false};
+
+   bool operator==(const Level2SweepKey& o) const
+   {
+      // Elevation scans are compared by ownership, so the key of a released
+      // elevation scan never matches a new elevation scan
+      return !elevationScan_.owner_before(o.elevationScan_) &&
+             !o.elevationScan_.owner_before(elevationScan_) &&
+             dataBlockType_ == o.dataBlockType_ &&
+             smoothingEnabled_ == o.smoothingEnabled_ &&
+             gpuProjectionEnabled_ == o.gpuProjectionEnabled_ &&
+             showSmoothedRangeFolding_ == o.showSmoothedRangeFolding_;
+   }
+};
+
+struct Level2Sweep
+{
+   Level2Sweep()
+   {
+      geometry_.polar_.radialAngles_.resize(common::MAX_0_5_DEGREE_RADIALS);
+   }
+
+   [[nodiscard]] std::size_t size() const;
+
+   Level2SweepKey key_ {};
+
+   // Set once the sweep is retained by the animation cache, after which the
+   // sweep is no longer modified
+   bool cached_ {false};
+
+   // Coordinates of a complete elevation scan are shared with other sweeps of
+   // the same radial geometry. Coordinates of an elevation scan in progress
+   // are owned by the sweep, and radials appended to the scan are computed in
+   // place.
+   std::shared_ptr<const std::vector<float>> coordinates_ {};
+   std::shared_ptr<std::vector<float>>       partialCoordinates_ {};
+   std::uint16_t                             edgeValue_ {};
+
+   // Radial moment offsets are used to update only the radials appended to a
+   // real-time elevation scan
+   SweepGeometry geometry_ {};
+};
+
+// Animation loop for which sweeps are cached
+struct Level2CacheRequest
+{
+   wsr88d::rda::DataBlockType dataBlockType_ {
+      wsr88d::rda::DataBlockType::Unknown};
+   float                                 elevation_ {0.0f};
+   std::chrono::system_clock::time_point startTime_ {};
+   std::chrono::system_clock::time_point endTime_ {};
+   bool                                  smoothingEnabled_ {false};
+   bool                                  gpuProjectionEnabled_ {false};
+   bool                                  showSmoothedRangeFolding_ {false};
+
+   bool operator==(const Level2CacheRequest&) const = default;
+};
+
+// Complete sweeps are retained for animation by all views, limited by their
+// total size in bytes
+static std::mutex sweepCacheMutex_ {};
+static scwx::util::LruCache<Level2SweepKey, std::shared_ptr<Level2Sweep>>
+   sweepCache_ {0u};
+
 class Level2ProductView::Impl
 {
 public:
@@ -69,7 +143,7 @@ public:
        product_ {product},
        selectedElevation_ {0.0f},
        elevationScan_ {nullptr},
-       momentDataBlock0_ {nullptr},
+       moment_ {nullptr},
        latitude_ {},
        longitude_ {},
        elevationCut_ {},
@@ -87,8 +161,6 @@ public:
    {
       auto& unitSettings = settings::UnitSettings::Instance();
 
-      coordinates_.resize(kMaxCoordinates_);
-
       SetProduct(product);
 
       otherUnitsCallbackUuid_ =
@@ -110,7 +182,10 @@ public:
       unitSettings.speed_units().UnregisterValueChangedCallback(
          speedUnitsCallbackUuid_);
 
-      threadPool_.join();
+      // Sweeps which have not started caching are abandoned
+      cacheTaskQueue_.stop();
+      cacheTaskQueue_.join();
+      taskQueue_.join();
    };
 
    Impl(const Impl&)            = delete;
@@ -119,26 +194,40 @@ public:
    Impl(Impl&&) noexcept            = delete;
    Impl& operator=(Impl&&) noexcept = delete;
 
-   void ComputeCoordinates(
-      const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData,
-      bool                                               smoothingEnabled);
+   void ComputeCoordinates(const wsr88d::rda::PackedElevationScan& radarData,
+                           std::size_t                             firstRadial,
+                           Level2Sweep&                            sweep,
+                           const std::function<bool()>&            cancelled);
+   void ComputeRadialAngles(const wsr88d::rda::PackedElevationScan& radarData,
+                            std::size_t                             firstRadial,
+                            Level2Sweep&                            sweep);
+   void ComputeSweepGeometry(
+      const wsr88d::rda::PackedElevationScan&         radarData,
+      const wsr88d::rda::PackedElevationScan::Moment& momentData,
+      std::size_t                                     firstRadial,
+      Level2Sweep&                                    sweep,
+      const std::function<bool()>&                    cancelled = nullptr);
+   [[nodiscard]] std::shared_ptr<const SweepBinLookup>
+   ComputeBinLookup(const wsr88d::rda::PackedElevationScan& radarData) const;
+   [[nodiscard]] std::size_t GetFirstUpdatedRadial(
+      const std::shared_ptr<const wsr88d::rda::PackedElevationScan>& radarData)
+      const;
 
    void SetProduct(const std::string& productName);
    void SetProduct(common::Level2Product product);
    void UpdateOtherUnits(const std::string& name);
    void UpdateSpeedUnits(const std::string& name);
 
-   void ComputeEdgeValue();
-   template<typename T>
-   [[nodiscard]] inline T RemapDataMoment(T dataMoment) const;
-
-   static bool IsRadarDataIncomplete(
-      const std::shared_ptr<const wsr88d::rda::ElevationScan>& radarData);
-   static units::degrees<float> NormalizeAngle(units::degrees<float> angle);
+   void CacheSweep(const std::shared_ptr<Level2Sweep>& sweep);
+   void CacheSweeps(const Level2CacheRequest& request,
+                    std::size_t               generation);
+   std::shared_ptr<Level2Sweep> FindCachedSweep(const Level2SweepKey& key);
 
    Level2ProductView* self_;
 
-   boost::asio::thread_pool threadPool_ {1u};
+   scwx::util::TaskQueue taskQueue_ {scwx::util::TaskPriority::Interactive};
+   scwx::util::TaskQueue cacheTaskQueue_ {
+      scwx::util::TaskPriority::Background};
 
    common::Level2Product      product_;
    wsr88d::rda::DataBlockType dataBlockType_ {
@@ -146,19 +235,23 @@ public:
 
    float selectedElevation_;
 
-   std::shared_ptr<wsr88d::rda::ElevationScan> elevationScan_;
-   std::shared_ptr<wsr88d::rda::GenericRadarData::MomentDataBlock>
-      momentDataBlock0_;
+   std::shared_ptr<const wsr88d::rda::PackedElevationScan> elevationScan_;
+   const wsr88d::rda::PackedElevationScan::Moment*         moment_;
 
+   bool lastGpuProjectionEnabled_ {false};
    bool lastShowSmoothedRangeFolding_ {false};
    bool lastSmoothingEnabled_ {false};
 
-   std::vector<float>    coordinates_ {};
-   std::vector<float>    vertices_ {};
-   std::vector<uint8_t>  dataMoments8_ {};
-   std::vector<uint16_t> dataMoments16_ {};
-   std::vector<uint8_t>  cfpMoments_ {};
-   std::uint16_t         edgeValue_ {};
+   std::shared_ptr<Level2Sweep> sweep_ {std::make_shared<Level2Sweep>()};
+
+   // Locates the bin under the cursor in the elevation scan
+   std::shared_ptr<const SweepBinLookup> binLookup_ {};
+
+   // Each animation cache request supersedes sweeps of previous requests
+   // which have not been computed. A request repeating the previous request
+   // is skipped.
+   std::atomic<std::size_t> cacheGeneration_ {0u};
+   Level2CacheRequest       cacheRequest_ {};
 
    bool showSmoothedRangeFolding_ {false};
 
@@ -224,9 +317,9 @@ void Level2ProductView::DisconnectRadarProductManager()
               nullptr);
 }
 
-boost::asio::thread_pool& Level2ProductView::thread_pool()
+scwx::util::TaskQueue& Level2ProductView::task_queue()
 {
-   return p->threadPool_;
+   return p->taskQueue_;
 }
 
 std::shared_ptr<common::ColorTable> Level2ProductView::color_table() const
@@ -341,7 +434,51 @@ uint16_t Level2ProductView::vcp() const
 
 const std::vector<float>& Level2ProductView::vertices() const
 {
-   return p->vertices_;
+   const Level2Sweep& sweep = *p->sweep_;
+
+   // The indexed layout shares the radial coordinates between gates
+   if (sweep.geometry_.layout_ == SweepLayout::Indexed &&
+       sweep.coordinates_ != nullptr)
+   {
+      return *sweep.coordinates_;
+   }
+
+   return sweep.geometry_.vertices_;
+}
+
+const PolarSweepGeometry* Level2ProductView::polar_geometry() const
+{
+   if (p->sweep_->geometry_.layout_ == SweepLayout::Polar)
+   {
+      return &p->sweep_->geometry_.polar_;
+   }
+
+   return nullptr;
+}
+
+const std::vector<std::uint32_t>* Level2ProductView::vertex_indices() const
+{
+   if (p->sweep_->geometry_.layout_ == SweepLayout::Indexed)
+   {
+      return &p->sweep_->geometry_.indices_;
+   }
+
+   return nullptr;
+}
+
+const std::vector<SweepLevel>* Level2ProductView::sweep_levels() const
+{
+   return &p->sweep_->geometry_.levels_;
+}
+
+std::shared_ptr<const void> Level2ProductView::cached_sweep() const
+{
+   if (p->sweep_->cached_)
+   {
+      return p->sweep_;
+   }
+
+   return nullptr;
 }
 
 common::RadarProductGroup Level2ProductView::GetRadarProductGroup() const
@@ -361,20 +498,22 @@ std::vector<float> Level2ProductView::GetElevationCuts() const
 
 std::tuple<const void*, size_t, size_t> Level2ProductView::GetMomentData() const
 {
+   const SweepGeometry& geometry = p->sweep_->geometry_;
+
    const void* data;
    size_t      dataSize;
    size_t      componentSize;
 
-   if (p->dataMoments8_.size() > 0)
+   if (geometry.dataMoments8_.size() > 0)
    {
-      data          = p->dataMoments8_.data();
-      dataSize      = p->dataMoments8_.size() * sizeof(uint8_t);
+      data          = geometry.dataMoments8_.data();
+      dataSize      = geometry.dataMoments8_.size() * sizeof(uint8_t);
       componentSize = 1;
    }
    else
    {
-      data          = p->dataMoments16_.data();
-      dataSize      = p->dataMoments16_.size() * sizeof(uint16_t);
+      data          = geometry.dataMoments16_.data();
+      dataSize      = geometry.dataMoments16_.size() * sizeof(uint16_t);
       componentSize = 2;
    }
 
@@ -384,14 +523,16 @@ std::tuple<const void*, size_t, size_t> Level2ProductView::GetMomentData() const
 std::tuple<const void*, size_t, size_t>
 Level2ProductView::GetCfpMomentData() const
 {
+   const SweepGeometry& geometry = p->sweep_->geometry_;
+
    const void* data          = nullptr;
    size_t      dataSize      = 0;
    size_t      componentSize = 1;
 
-   if (p->cfpMoments_.size() > 0)
+   if (geometry.cfpMoments_.size() > 0)
    {
-      data     = p->cfpMoments_.data();
-      dataSize = p->cfpMoments_.size() * sizeof(uint8_t);
+      data     = geometry.cfpMoments_.data();
+      dataSize = geometry.cfpMoments_.size() * sizeof(uint8_t);
    }
 
    return std::tie(data, dataSize, componentSize);
@@ -404,6 +545,54 @@ void Level2ProductView::LoadColorTable(
    UpdateColorTableLut();
 }
 
+void Level2ProductView::CacheSweeps(
+   std::chrono::system_clock::time_point startTime,
+   std::chrono::system_clock::time_point endTime)
+{
+   if (animation_cache_size() == 0u ||
+       p->dataBlockType_ == wsr88d::rda::DataBlockType::Unknown)
+   {
+      // The animation cache is disabled, or there is nothing to cache
+      p->cacheRequest_ = {};
+      return;
+   }
+
+   const bool smoothingEnabled = smoothing_enabled();
+
+   const Level2CacheRequest request {
+      p->dataBlockType_,
+      p->selectedElevation_,
+      startTime,
+      endTime,
+      smoothingEnabled,
+      gpu_projection_enabled(),
+      smoothingEnabled && show_smoothed_range_folding()};
+
+   if (request == p->cacheRequest_)
+   {
+      // The loop is restarted each time playback wraps, and its sweeps have
+      // already been requested
+      return;
+   }
+
+   p->cacheRequest_ = request;
+
+   const std::size_t generation = ++p->cacheGeneration_;
+
+   boost::asio::post(p->cacheTaskQueue_.get_executor(),
+                     [=, this]()
+                     {
+                        try
+                        {
+                           p->CacheSweeps(request, generation);
+                        }
+                        catch (const std::exception& ex)
+                        {
+                           logger_->error(ex.what());
+                        }
+                     });
+}
+
 void Level2ProductView::SelectElevation(float elevation)
 {
    p->selectedElevation_ = elevation;
@@ -448,16 +637,16 @@ void Level2ProductView::Impl::UpdateSpeedUnits(const std::string& name)
 
 void Level2ProductView::UpdateColorTableLut()
 {
-   if (p->momentDataBlock0_ == nullptr || //
-       p->colorTable_ == nullptr ||       //
+   if (p->moment_ == nullptr ||     //
+       p->colorTable_ == nullptr || //
        !p->colorTable_->IsValid())
    {
       // Nothing to update
       return;
    }
 
-   float offset = p->momentDataBlock0_->offset();
-   float scale  = p->momentDataBlock0_->scale();
+   float offset = p->moment_->offset();
+   float scale  = p->moment_->scale();
 
    if (p->savedColorTable_ == p->colorTable_ && //
        p->savedOffset_ == offset &&             //
@@ -467,58 +656,10 @@ void Level2ProductView::UpdateColorTableLut()
       return;
    }
 
-   uint16_t rangeMin;
-   uint16_t rangeMax;
-
-   switch (p->product_)
-   {
-   case common::Level2Product::Reflectivity:
-   case common::Level2Product::Velocity:
-   case common::Level2Product::SpectrumWidth:
-   case common::Level2Product::CorrelationCoefficient:
-   default:
-      rangeMin = 1;
-      rangeMax = 255;
-      break;
-
-   case common::Level2Product::DifferentialReflectivity:
-      rangeMin = 1;
-      rangeMax = 1058;
-      break;
-
-   case common::Level2Product::DifferentialPhase:
-      rangeMin = 1;
-      rangeMax = 1023;
-      break;
-
-   case common::Level2Product::ClutterFilterPowerRemoved:
-      rangeMin = 1;
-      rangeMax = 81;
-      break;
-   }
+   const auto [rangeMin, rangeMax] = GetLevel2DataRange(p->dataBlockType_);
 
-   boost::integer_range<uint16_t> dataRange =
-      boost::irange<uint16_t>(rangeMin, rangeMax + 1);
-
-   std::vector<boost::gil::rgba8_pixel_t>& lut = p->colorTableLut_;
-   lut.resize(rangeMax - rangeMin + 1);
-   lut.shrink_to_fit();
-
-   std::for_each(std::execution::par_unseq,
-                 dataRange.begin(),
-                 dataRange.end(),
-                 [&](uint16_t i)
-                 {
-                    if (i == RANGE_FOLDED)
-                    {
-                       lut[i - *dataRange.begin()] = p->colorTable_->rf_color();
-                    }
-                    else
-                    {
-                       float f                     = (i - offset) / scale;
-                       lut[i - *dataRange.begin()] = p->colorTable_->Color(f);
-                    }
-                 });
+   ComputeLevel2ColorTableLut(
+      *p->colorTable_, rangeMin, rangeMax, offset, scale, p->colorTableLut_);
 
    p->colorTableMin_ = rangeMin;
    p->colorTableMax_ = rangeMax;
@@ -536,6 +677,8 @@ void Level2ProductView::ComputeSweep()
 
    boost::timer::cpu_timer timer;
 
+   const std::function<bool()> cancelled = sweep_cancelled();
+
    if (p->dataBlockType_ == wsr88d::rda::DataBlockType::Unknown)
    {
       Q_EMIT SweepNotComputed(types::NoUpdateReason::InvalidProduct);
@@ -547,11 +690,12 @@ void Level2ProductView::ComputeSweep()
    std::shared_ptr<manager::RadarProductManager> radarProductManager =
       radar_product_manager();
    const bool smoothingEnabled          = smoothing_enabled();
+   const bool gpuProjectionEnabled      = gpu_projection_enabled();
    p->showSmoothedRangeFolding_         = show_smoothed_range_folding();
    const bool& showSmoothedRangeFolding = p->showSmoothedRangeFolding_;
 
-   std::shared_ptr<wsr88d::rda::ElevationScan> radarData;
-   std::chrono::system_clock::time_point       requestedTime {selected_time()};
+   std::shared_ptr<const wsr88d::rda::PackedElevationScan> radarData;
+   std::chrono::system_clock::time_point requestedTime {selected_time()};
    std::tie(radarData, p->elevationCut_, p->elevationCuts_, std::ignore) =
       radarProductManager->GetLevel2Data(
          p->dataBlockType_, p->selectedElevation_, requestedTime);
@@ -561,870 +705,531 @@ void Level2ProductView::ComputeSweep()
       Q_EMIT SweepNotComputed(types::NoUpdateReason::NotLoaded);
       return;
    }
-   if (radarData == p->elevationScan_ &&
-       smoothingEnabled == p->lastSmoothingEnabled_ &&
-       (showSmoothedRangeFolding == p->lastShowSmoothedRangeFolding_ ||
-        !smoothingEnabled))
+
+   if (radarData->radial_count() == 0u)
    {
-      Q_EMIT SweepNotComputed(types::NoUpdateReason::NoChange);
+      logger_->warn("No radials for {}", common::GetLevel2Name(p->product_));
+      Q_EMIT SweepNotComputed(types::NoUpdateReason::InvalidData);
       return;
    }
 
-   p->lastShowSmoothedRangeFolding_ = showSmoothedRangeFolding;
-   p->lastSmoothingEnabled_         = smoothingEnabled;
-
-   logger_->debug("Computing Sweep");
+   // Loading may have taken long enough for the sweep to be superseded
+   if (cancelled())
+   {
+      logger_->debug("Sweep superseded");
+      return;
+   }
 
-   std::size_t radials       = radarData->crbegin()->first + 1;
-   std::size_t vertexRadials = radials;
+   const bool settingsUnchanged =
+      smoothingEnabled == p->lastSmoothingEnabled_ &&
+      gpuProjectionEnabled == p->lastGpuProjectionEnabled_ &&
+      (showSmoothedRangeFolding == p->lastShowSmoothedRangeFolding_ ||
+       !smoothingEnabled);
 
-   // When there is missing data, insert another empty vertex radial at the end
-   // to avoid stretching
-   const bool isRadarDataIncomplete = Impl::IsRadarDataIncomplete(radarData);
-   if (isRadarDataIncomplete)
+   if (radarData == p->elevationScan_ && settingsUnchanged)
    {
-      ++vertexRadials;
+      Q_EMIT SweepNotComputed(types::NoUpdateReason::NoChange);
+      return;
    }
 
-   // Limit radials
-   radials = std::min<std::size_t>(radials, common::MAX_0_5_DEGREE_RADIALS);
-   vertexRadials =
-      std::min<std::size_t>(vertexRadials, common::MAX_0_5_DEGREE_RADIALS);
+   // If radials have been appended to the previously computed elevation scan,
+   // only the new radials are computed
+   const std::size_t firstUpdatedRadial =
+      settingsUnchanged ? p->GetFirstUpdatedRadial(radarData) : 0u;
 
-   p->ComputeCoordinates(radarData, smoothingEnabled);
-
-   const std::vector<float>& coordinates = p->coordinates_;
+   logger_->debug("Computing Sweep");
 
-   auto& radarData0     = (*radarData)[0];
-   auto  momentData0    = radarData0->moment_data_block(p->dataBlockType_);
-   p->elevationScan_    = radarData;
-   p->momentDataBlock0_ = momentData0;
+   const auto& radarData0  = radarData->radial_headers()[0];
+   const auto* momentData0 = radarData->moment(p->dataBlockType_);
+   if (momentData0 != nullptr && momentData0->data_moments(0) == nullptr)
+   {
+      momentData0 = nullptr;
+   }
 
    if (momentData0 == nullptr)
    {
+      p->lastGpuProjectionEnabled_     = gpuProjectionEnabled;
+      p->lastShowSmoothedRangeFolding_ = showSmoothedRangeFolding;
+      p->lastSmoothingEnabled_         = smoothingEnabled;
+      p->elevationScan_                = radarData;
+      p->moment_                       = nullptr;
+      p->binLookup_                    = nullptr;
+
       logger_->warn("No moment data for {}",
                     common::GetLevel2Name(p->product_));
       Q_EMIT SweepNotComputed(types::NoUpdateReason::InvalidData);
       return;
    }
 
-   const uint32_t gates = momentData0->number_of_data_moment_gates();
+   const Level2SweepKey key {
+      radarData,
+      p->dataBlockType_,
+      smoothingEnabled,
+      gpuProjectionEnabled,
+      smoothingEnabled && showSmoothedRangeFolding};
+
+   // A complete sweep may have been computed for animation
+   std::shared_ptr<Level2Sweep> sweep =
+      (firstUpdatedRadial == 0u) ? p->FindCachedSweep(key) : nullptr;
+
+   if (sweep != nullptr)
+   {
+      logger_->debug("Sweep found in animation cache");
+   }
+   else
+   {
+      // A sweep retained by the animation cache is not modified. A complete
+      // sweep is computed separately, and is abandoned if superseded. Appended
+      // radials are computed in place, and are not abandoned.
+      const bool computeSeparately =
+         p->sweep_->cached_ || firstUpdatedRadial == 0u;
+      sweep = computeSeparately ? std::make_shared<Level2Sweep>() : p->sweep_;
+      sweep->key_ = key;
+
+      // Calculate vertices
+      timer.start();
+
+      p->ComputeSweepGeometry(*radarData,
+                              *momentData0,
+                              firstUpdatedRadial,
+                              *sweep,
+                              computeSeparately ? cancelled : nullptr);
+
+      if (computeSeparately && cancelled())
+      {
+         // The previous sweep, and the elevation scan it was computed from,
+         // remain displayed
+         logger_->debug("Sweep superseded");
+         return;
+      }
+
+      const std::size_t radialCount = radarData->radial_count();
+
+      timer.stop();
+      logger_->debug("Vertices calculated in {} ({} of {} radials)",
+                     timer.format(6, "%ws"),
+                     radialCount - firstUpdatedRadial,
+                     radialCount);
+
+      if (!IsLevel2SweepIncomplete(*radarData))
+      {
+         p->CacheSweep(sweep);
+      }
+   }
+
+   // The elevation scan is committed with its sweep, so that a superseded
+   // sweep leaves the displayed elevation scan unchanged
+   const auto     momentRadials = momentData0->radials();
+   const uint32_t gates         = momentRadials[0].numberOfDataMomentGates;
 
    auto radarSite = radarProductManager->radar_site();
-   p->latitude_   = radarSite->latitude();
-   p->longitude_  = radarSite->longitude();
+
+   p->lastGpuProjectionEnabled_     = gpuProjectionEnabled;
+   p->lastShowSmoothedRangeFolding_ = showSmoothedRangeFolding;
+   p->lastSmoothingEnabled_         = smoothingEnabled;
+   p->sweep_                        = sweep;
+   p->elevationScan_                = radarData;
+   p->moment_                       = momentData0;
+   p->binLookup_                    = p->ComputeBinLookup(*radarData);
+   p->latitude_                     = radarSite->latitude();
+   p->longitude_                    = radarSite->longitude();
    p->range_ =
-      momentData0->data_moment_range() +
-      momentData0->data_moment_range_sample_interval() * (gates - 0.5f);
-   p->sweepTime_ = scwx::util::TimePoint(radarData0->modified_julian_date(),
-                                         radarData0->collection_time());
-   p->vcp_       = radarData0->volume_coverage_pattern_number();
+      momentData0->data_moment_range(0) +
+      momentData0->data_moment_range_sample_interval(0) * (gates - 0.5f);
+   p->sweepTime_ = scwx::util::TimePoint(radarData0.modifiedJulianDate,
+                                         radarData0.collectionTime);
+   p->vcp_       = radarData0.volumeCoveragePatternNumber;
 
-   // Calculate vertices
-   timer.start();
+   UpdateColorTableLut();
+
+   Q_EMIT SweepComputed();
+}
 
-   // Setup vertex vector
-   std::vector<float>& vertices = p->vertices_;
-   size_t              vIndex   = 0;
-   vertices.clear();
-   vertices.resize(vertexRadials * gates * VERTICES_PER_BIN *
-                   VALUES_PER_VERTEX);
+void Level2ProductView::Impl::ComputeSweepGeometry(
+   const wsr88d::rda::PackedElevationScan&         radarData,
+   const wsr88d::rda::PackedElevationScan::Moment& momentData,
+   std::size_t                                     firstRadial,
+   Level2Sweep&                                    sweep,
+   const std::function<bool()>&                    cancelled)
+{
+   auto radarProductManager = self_->radar_product_manager();
+   auto radarSite           = radarProductManager->radar_site();
 
-   // Setup data moment vector
-   std::vector<uint8_t>&  dataMoments8  = p->dataMoments8_;
-   std::vector<uint16_t>& dataMoments16 = p->dataMoments16_;
-   std::vector<uint8_t>&  cfpMoments    = p->cfpMoments_;
-   size_t                 mIndex        = 0;
+   const Level2SweepKey& key = sweep.key_;
 
-   if (momentData0->data_word_size() == 8)
+   // When projecting on the GPU, only the radial angles are required
+   if (key.gpuProjectionEnabled_)
    {
-      dataMoments16.resize(0);
-      dataMoments16.shrink_to_fit();
-
-      dataMoments8.resize(radials * gates * VERTICES_PER_BIN);
+      ComputeRadialAngles(radarData, firstRadial, sweep);
    }
    else
    {
-      dataMoments8.resize(0);
-      dataMoments8.shrink_to_fit();
-
-      dataMoments16.resize(radials * gates * VERTICES_PER_BIN);
+      ComputeCoordinates(radarData, firstRadial, sweep, cancelled);
    }
 
-   if (p->dataBlockType_ == wsr88d::rda::DataBlockType::MomentRef &&
-       radarData0->moment_data_block(wsr88d::rda::DataBlockType::MomentCfp) !=
-          nullptr)
+   // For most products other than reflectivity, the edge should not go to the
+   // bottom of the color table
+   if (key.smoothingEnabled_)
    {
-      cfpMoments.resize(radials * gates * VERTICES_PER_BIN);
+      sweep.edgeValue_ =
+         ComputeLevel2EdgeValue(key.dataBlockType_, momentData.offset());
    }
-   else
+
+   SweepParameters parameters {};
+   parameters.radarLatitude_            = radarSite->latitude();
+   parameters.radarLongitude_           = radarSite->longitude();
+   parameters.gateSize_                 = radarProductManager->gate_size();
+   parameters.smoothingEnabled_         = key.smoothingEnabled_;
+   parameters.showSmoothedRangeFolding_ = key.showSmoothedRangeFolding_;
+   parameters.edgeValue_                = sweep.edgeValue_;
+   parameters.layout_ =
+      key.gpuProjectionEnabled_ ? SweepLayout::Polar : SweepLayout::Indexed;
+   parameters.cancelled_ = cancelled;
+
+   if (IsSweepCancelled(parameters))
    {
-      cfpMoments.resize(0);
-      cfpMoments.shrink_to_fit();
+      return;
    }
 
    // Compute threshold at which to display an individual bin (minimum of 2)
-   const std::uint16_t snrThreshold =
-      std::max<std::int16_t>(2, momentData0->snr_threshold_raw());
-
-   // Start radial is always 0, as coordinates are calculated for each sweep
-   constexpr std::uint16_t startRadial = 0u;
-
-   // For most products other than reflectivity, the edge should not go to the
-   // bottom of the color table
-   if (smoothingEnabled)
+   parameters.snrThreshold_ =
+      std::max<std::int16_t>(2, momentData.snr_threshold_raw());
+
+   // Coordinates are not computed when projecting on the GPU
+   static const std::vector<float> kNoCoordinates {};
+   const std::vector<float>&       coordinates =
+      (sweep.coordinates_ != nullptr) ? *sweep.coordinates_ : kNoCoordinates;
+
+   ComputeLevel2Sweep(radarData,
+                      key.dataBlockType_,
+                      parameters,
+                      coordinates,
+                      firstRadial,
+                      sweep.geometry_);
+
+   if (IsSweepCancelled(parameters))
    {
-      p->ComputeEdgeValue();
+      return;
    }
 
-   for (auto it = radarData->cbegin(); it != radarData->cend(); ++it)
-   {
-      const auto&   radialPair = *it;
-      std::uint16_t radial     = radialPair.first;
-      const auto&   radialData = radialPair.second;
-      const std::shared_ptr<wsr88d::rda::GenericRadarData::MomentDataBlock>
-         momentData = radialData->moment_data_block(p->dataBlockType_);
+   ComputeLevel2SweepLevels(
+      radarData, key.dataBlockType_, parameters, sweep.geometry_);
 
-      if (momentData0->data_word_size() != momentData->data_word_size())
-      {
-         logger_->warn("Radial {} has different word size", radial);
-         continue;
-      }
+   // Sectors of the polar layout are bounded by the geodesic table used to
+   // project them
+   ComputeSweepSectors(coordinates,
+                       radarProductManager->geodesic_table().get(),
+                       sweep.geometry_);
+}
 
-      // Compute gate interval
-      const std::int32_t dataMomentInterval =
-         momentData->data_moment_range_sample_interval_raw();
-      const std::int32_t dataMomentIntervalH = dataMomentInterval / 2;
-      const std::int32_t dataMomentRange     = std::max<std::int32_t>(
-         momentData->data_moment_range_raw(), dataMomentIntervalH);
-
-      // Compute gate size (number of base 250m gates per bin)
-      const std::int32_t gateSizeMeters =
-         static_cast<std::int32_t>(radarProductManager->gate_size());
-      const std::int32_t gateSize =
-         std::max<std::int32_t>(1, dataMomentInterval / gateSizeMeters);
-
-      // Compute gate range [startGate, endGate)
-      std::int32_t startGate =
-         (dataMomentRange - dataMomentIntervalH) / gateSizeMeters;
-      const std::int32_t numberOfDataMomentGates =
-         std::min<std::int32_t>(momentData->number_of_data_moment_gates(),
-                                static_cast<std::int32_t>(gates));
-      const std::int32_t endGate = std::min<std::int32_t>(
-         startGate + numberOfDataMomentGates * gateSize,
-         static_cast<std::int32_t>(common::MAX_DATA_MOMENT_GATES));
-
-      if (smoothingEnabled)
-      {
-         // If smoothing is enabled, the start gate is incremented by one, as we
-         // are skipping the radar site origin. The end gate is unaffected, as
-         // we need to draw one less data point.
-         ++startGate;
-      }
+std::shared_ptr<const SweepBinLookup>
+Level2ProductView::Impl::ComputeBinLookup(
+   const wsr88d::rda::PackedElevationScan& radarData) const
+{
+   auto radarSite = self_->radar_product_manager()->radar_site();
 
-      const std::uint8_t*  dataMomentsArray8      = nullptr;
-      const std::uint16_t* dataMomentsArray16     = nullptr;
-      const std::uint8_t*  nextDataMomentsArray8  = nullptr;
-      const std::uint16_t* nextDataMomentsArray16 = nullptr;
-      const std::uint8_t*  cfpMomentsArray        = nullptr;
+   SweepParameters parameters {};
+   parameters.radarLatitude_  = radarSite->latitude();
+   parameters.radarLongitude_ = radarSite->longitude();
 
-      if (momentData->data_word_size() == 8)
-      {
-         dataMomentsArray8 =
-            reinterpret_cast<const std::uint8_t*>(momentData->data_moments());
-      }
-      else
-      {
-         dataMomentsArray16 =
-            reinterpret_cast<const std::uint16_t*>(momentData->data_moments());
-      }
+   // A new lookup is computed, as the previous lookup may be in use
+   auto binLookup = std::make_shared<SweepBinLookup>();
+   ComputeLevel2BinLookup(radarData, parameters, *binLookup);
 
-      if (cfpMoments.size() > 0)
-      {
-         cfpMomentsArray = reinterpret_cast<const std::uint8_t*>(
-            radialData->moment_data_block(wsr88d::rda::DataBlockType::MomentCfp)
-               ->data_moments());
-      }
+   return binLookup;
+}
 
-      std::shared_ptr<wsr88d::rda::GenericRadarData::MomentDataBlock>
-                   nextMomentData              = nullptr;
-      std::int32_t numberOfNextDataMomentGates = 0;
-      if (smoothingEnabled)
-      {
-         // Smoothing requires the next radial pair as well
-         auto nextIt = std::next(it);
-         if (nextIt == radarData->cend())
-         {
-            nextIt = radarData->cbegin();
-         }
-
-         const auto& nextRadialPair = *(nextIt);
-         const auto& nextRadialData = nextRadialPair.second;
-         nextMomentData = nextRadialData->moment_data_block(p->dataBlockType_);
-
-         if (momentData->data_word_size() != nextMomentData->data_word_size())
-         {
-            // Data should be consistent between radials
-            logger_->warn("Invalid data moment size");
-            continue;
-         }
-
-         if (nextMomentData->data_word_size() == kDataWordSize8_)
-         {
-            nextDataMomentsArray8 = reinterpret_cast<const std::uint8_t*>(
-               nextMomentData->data_moments());
-         }
-         else
-         {
-            nextDataMomentsArray16 = reinterpret_cast<const std::uint16_t*>(
-               nextMomentData->data_moments());
-         }
-
-         numberOfNextDataMomentGates = std::min<std::int32_t>(
-            nextMomentData->number_of_data_moment_gates(),
-            static_cast<std::int32_t>(gates));
-      }
+void Level2ProductView::Impl::ComputeCoordinates(
+   const wsr88d::rda::PackedElevationScan& radarData,
+   std::size_t                             firstRadial,
+   Level2Sweep&                            sweep,
+   const std::function<bool()>&            cancelled)
+{
+   logger_->debug("ComputeCoordinates()");
+
+   boost::timer::cpu_timer timer;
+
+   auto radarProductManager = self_->radar_product_manager();
+
+   timer.start();
 
-      for (std::int32_t gate = startGate, i = 0; gate + gateSize <= endGate;
-           gate += gateSize, ++i)
+   if (IsLevel2SweepIncomplete(radarData))
+   {
+      if (sweep.partialCoordinates_ == nullptr || firstRadial == 0u)
       {
-         if (gate < 0)
-         {
-            continue;
-         }
-
-         const std::size_t vertexCount =
-            (gate > 0) ? kVerticesPerGate_ : kVerticesPerOriginGate_;
-
-         // Allow pointer arithmetic here, as bounds have already been checked
-         // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-
-         // Store data moment value
-         if (dataMomentsArray8 != nullptr)
-         {
-            if (!smoothingEnabled)
-            {
-               const std::uint8_t& dataValue = dataMomentsArray8[i];
-               if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
-               {
-                  continue;
-               }
-
-               for (std::size_t m = 0; m < vertexCount; m++)
-               {
-                  dataMoments8[mIndex++] = dataValue;
-
-                  if (cfpMomentsArray != nullptr)
-                  {
-                     cfpMoments[mIndex - 1] = cfpMomentsArray[i];
-                  }
-               }
-            }
-            else if (gate > 0)
-            {
-               // Validate indices are all in range
-               if (i + 1 >= numberOfDataMomentGates ||
-                   i + 1 >= numberOfNextDataMomentGates)
-               {
-                  continue;
-               }
-
-               const std::uint8_t& dm1 = dataMomentsArray8[i];
-               const std::uint8_t& dm2 = dataMomentsArray8[i + 1];
-               const std::uint8_t& dm3 = nextDataMomentsArray8[i];
-               const std::uint8_t& dm4 = nextDataMomentsArray8[i + 1];
-
-               if ((!showSmoothedRangeFolding && //
-                    (dm1 < snrThreshold || dm1 == RANGE_FOLDED) &&
-                    (dm2 < snrThreshold || dm2 == RANGE_FOLDED) &&
-                    (dm3 < snrThreshold || dm3 == RANGE_FOLDED) &&
-                    (dm4 < snrThreshold || dm4 == RANGE_FOLDED)) ||
-                   (showSmoothedRangeFolding && //
-                    dm1 < snrThreshold && dm1 != RANGE_FOLDED &&
-                    dm2 < snrThreshold && dm2 != RANGE_FOLDED &&
-                    dm3 < snrThreshold && dm3 != RANGE_FOLDED &&
-                    dm4 < snrThreshold && dm4 != RANGE_FOLDED))
-               {
-                  // Skip only if all data moments are hidden
-                  continue;
-               }
-
-               // The order must match the store vertices section below
-               dataMoments8[mIndex++] = p->RemapDataMoment(dm1);
-               dataMoments8[mIndex++] = p->RemapDataMoment(dm2);
-               dataMoments8[mIndex++] = p->RemapDataMoment(dm4);
-               dataMoments8[mIndex++] = p->RemapDataMoment(dm1);
-               dataMoments8[mIndex++] = p->RemapDataMoment(dm3);
-               dataMoments8[mIndex++] = p->RemapDataMoment(dm4);
-
-               // cfpMoments is unused, so not populated here
-            }
-            else
-            {
-               // If smoothing is enabled, gate should never start at zero
-               // (radar site origin)
-               logger_->error(
-                  "Smoothing enabled, gate should not start at zero");
-               continue;
-            }
-         }
-         else
-         {
-            if (!smoothingEnabled)
-            {
-               const std::uint16_t& dataValue = dataMomentsArray16[i];
-               if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
-               {
-                  continue;
-               }
-
-               for (std::size_t m = 0; m < vertexCount; m++)
-               {
-                  dataMoments16[mIndex++] = dataValue;
-               }
-            }
-            else if (gate > 0)
-            {
-               // Validate indices are all in range
-               if (i + 1 >= numberOfDataMomentGates ||
-                   i + 1 >= numberOfNextDataMomentGates)
-               {
-                  continue;
-               }
-
-               const std::uint16_t& dm1 = dataMomentsArray16[i];
-               const std::uint16_t& dm2 = dataMomentsArray16[i + 1];
-               const std::uint16_t& dm3 = nextDataMomentsArray16[i];
-               const std::uint16_t& dm4 = nextDataMomentsArray16[i + 1];
-
-               if ((!showSmoothedRangeFolding && //
-                    (dm1 < snrThreshold || dm1 == RANGE_FOLDED) &&
-                    (dm2 < snrThreshold || dm2 == RANGE_FOLDED) &&
-                    (dm3 < snrThreshold || dm3 == RANGE_FOLDED) &&
-                    (dm4 < snrThreshold || dm4 == RANGE_FOLDED)) ||
-                   (showSmoothedRangeFolding && //
-                    dm1 < snrThreshold && dm1 != RANGE_FOLDED &&
-                    dm2 < snrThreshold && dm2 != RANGE_FOLDED &&
-                    dm3 < snrThreshold && dm3 != RANGE_FOLDED &&
-                    dm4 < snrThreshold && dm4 != RANGE_FOLDED))
-               {
-                  // Skip only if all data moments are hidden
-                  continue;
-               }
-
-               // The order must match the store vertices section below
-               dataMoments16[mIndex++] = p->RemapDataMoment(dm1);
-               dataMoments16[mIndex++] = p->RemapDataMoment(dm2);
-               dataMoments16[mIndex++] = p->RemapDataMoment(dm4);
-               dataMoments16[mIndex++] = p->RemapDataMoment(dm1);
-               dataMoments16[mIndex++] = p->RemapDataMoment(dm3);
-               dataMoments16[mIndex++] = p->RemapDataMoment(dm4);
-
-               // cfpMoments is unused, so not populated here
-            }
-            else
-            {
-               // If smoothing is enabled, gate should never start at zero
-               // (radar site origin)
-               continue;
-            }
-         }
-
-         // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-
-         // Store vertices
-         if (gate > 0)
-         {
-            // Draw two triangles per gate
-            //
-            // 2 +---+ 4
-            //   |  /|
-            //   | / |
-            //   |/  |
-            // 1 +---+ 3
-
-            const std::uint16_t baseCoord = gate - 1;
-
-            const std::size_t offset1 =
-               ((startRadial + radial) % vertexRadials *
-                   common::MAX_DATA_MOMENT_GATES +
-                baseCoord) *
-               2;
-            const std::size_t offset2 =
-               offset1 + static_cast<std::size_t>(gateSize) * 2;
-            const std::size_t offset3 =
-               (((startRadial + radial + 1) % vertexRadials) *
-                   common::MAX_DATA_MOMENT_GATES +
-                baseCoord) *
-               2;
-            const std::size_t offset4 =
-               offset3 + static_cast<std::size_t>(gateSize) * 2;
-
-            vertices[vIndex++] = coordinates[offset1];
-            vertices[vIndex++] = coordinates[offset1 + 1];
-
-            vertices[vIndex++] = coordinates[offset2];
-            vertices[vIndex++] = coordinates[offset2 + 1];
-
-            vertices[vIndex++] = coordinates[offset4];
-            vertices[vIndex++] = coordinates[offset4 + 1];
-
-            vertices[vIndex++] = coordinates[offset1];
-            vertices[vIndex++] = coordinates[offset1 + 1];
-
-            vertices[vIndex++] = coordinates[offset3];
-            vertices[vIndex++] = coordinates[offset3 + 1];
-
-            vertices[vIndex++] = coordinates[offset4];
-            vertices[vIndex++] = coordinates[offset4 + 1];
-         }
-         else
-         {
-            const std::uint16_t baseCoord = gate;
-
-            std::size_t offset1 = ((startRadial + radial) % vertexRadials *
-                                      common::MAX_DATA_MOMENT_GATES +
-                                   baseCoord) *
-                                  2;
-            std::size_t offset2 =
-               (((startRadial + radial + 1) % vertexRadials) *
-                   common::MAX_DATA_MOMENT_GATES +
-                baseCoord) *
-               2;
-
-            vertices[vIndex++] = p->latitude_;
-            vertices[vIndex++] = p->longitude_;
-
-            vertices[vIndex++] = coordinates[offset1];
-            vertices[vIndex++] = coordinates[offset1 + 1];
-
-            vertices[vIndex++] = coordinates[offset2];
-            vertices[vIndex++] = coordinates[offset2 + 1];
-         }
+         sweep.partialCoordinates_ =
+            std::make_shared<std::vector<float>>(kNumLevel2Coordinates_);
+         firstRadial = 0u;
       }
-   }
-   vertices.resize(vIndex);
-   vertices.shrink_to_fit();
 
-   if (momentData0->data_word_size() == 8)
-   {
-      dataMoments8.resize(mIndex);
-      dataMoments8.shrink_to_fit();
+      auto radarSite = radarProductManager->radar_site();
+
+      SweepParameters parameters {};
+      parameters.radarLatitude_    = radarSite->latitude();
+      parameters.radarLongitude_   = radarSite->longitude();
+      parameters.gateSize_         = radarProductManager->gate_size();
+      parameters.smoothingEnabled_ = sweep.key_.smoothingEnabled_;
+      parameters.cancelled_        = cancelled;
+
+      ComputeLevel2Coordinates(
+         radarData, parameters, firstRadial, *sweep.partialCoordinates_);
+
+      sweep.coordinates_ = sweep.partialCoordinates_;
    }
    else
    {
-      dataMoments16.resize(mIndex);
-      dataMoments16.shrink_to_fit();
-   }
-
-   if (cfpMoments.size() > 0)
-   {
-      cfpMoments.resize(mIndex);
-      cfpMoments.shrink_to_fit();
+      // Coordinates are shared with other sweeps of the same radial geometry
+      sweep.partialCoordinates_ = nullptr;
+      sweep.coordinates_        = radarProductManager->GetLevel2Coordinates(
+         radarData, sweep.key_.smoothingEnabled_, cancelled);
    }
 
    timer.stop();
-   logger_->debug("Vertices calculated in {}", timer.format(6, "%ws"));
-
-   UpdateColorTableLut();
-
-   Q_EMIT SweepComputed();
+   logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
 }
 
-void Level2ProductView::Impl::ComputeEdgeValue()
+void Level2ProductView::Impl::ComputeRadialAngles(
+   const wsr88d::rda::PackedElevationScan& radarData,
+   std::size_t                             firstRadial,
+   Level2Sweep&                            sweep)
 {
-   const float offset = momentDataBlock0_->offset();
+   logger_->debug("ComputeRadialAngles()");
 
-   switch (dataBlockType_)
-   {
-   case wsr88d::rda::DataBlockType::MomentVel:
-   case wsr88d::rda::DataBlockType::MomentZdr:
-      edgeValue_ = static_cast<std::uint16_t>(offset);
-      break;
+   SweepParameters parameters {};
+   parameters.smoothingEnabled_ = sweep.key_.smoothingEnabled_;
 
-   case wsr88d::rda::DataBlockType::MomentSw:
-   case wsr88d::rda::DataBlockType::MomentPhi:
-      edgeValue_ = 2;
-      break;
+   ComputeLevel2RadialAngles(
+      radarData, parameters, firstRadial, sweep.geometry_.polar_.radialAngles_);
+}
 
-   case wsr88d::rda::DataBlockType::MomentRho:
-      edgeValue_ = std::numeric_limits<std::uint8_t>::max();
-      break;
+std::size_t Level2Sweep::size() const
+{
+   const PolarSweepGeometry& polar = geometry_.polar_;
+
+   // Coordinates are shared between sweeps, and the elevation scan is not
+   // retained, so neither are included
+   return geometry_.vertices_.capacity() * sizeof(float) +
+          geometry_.indices_.capacity() * sizeof(std::uint32_t) +
+          geometry_.dataMoments8_.capacity() * sizeof(std::uint8_t) +
+          geometry_.dataMoments16_.capacity() * sizeof(std::uint16_t) +
+          geometry_.cfpMoments_.capacity() * sizeof(std::uint8_t) +
+          geometry_.radialMomentOffsets_.capacity() * sizeof(std::size_t) +
+          polar.cells_.capacity() * sizeof(std::uint16_t) +
+          polar.radialAngles_.capacity() * sizeof(float);
+}
 
-   case wsr88d::rda::DataBlockType::MomentRef:
-   default:
-      edgeValue_ = 0;
-      break;
-   }
+std::shared_ptr<Level2Sweep>
+Level2ProductView::Impl::FindCachedSweep(const Level2SweepKey& key)
+{
+   std::unique_lock lock {sweepCacheMutex_};
+
+   std::shared_ptr<Level2Sweep>* sweep = sweepCache_.Find(key);
+   return (sweep != nullptr) ? *sweep : nullptr;
 }
 
-template<typename T>
-T Level2ProductView::Impl::RemapDataMoment(T dataMoment) const
+void Level2ProductView::Impl::CacheSweep(
+   const std::shared_ptr<Level2Sweep>& sweep)
 {
-   if (dataMoment != 0 &&
-       (dataMoment != RANGE_FOLDED || showSmoothedRangeFolding_))
-   {
-      return dataMoment;
-   }
-   else
+   const std::size_t cacheLimit = self_->animation_cache_size();
+   const std::size_t sweepSize  = sweep->size();
+
+   std::unique_lock lock {sweepCacheMutex_};
+
+   // Sweeps of released elevation scans can no longer be selected
+   sweepCache_.EraseIf([](const Level2SweepKey& key, const auto&)
+                       { return key.elevationScan_.expired(); });
+   sweepCache_.set_limit(cacheLimit);
+
+   // If the same sweep was cached while computing, the cached sweep is kept
+   if (sweepCache_.Insert(sweep->key_, sweep, sweepSize))
    {
-      return edgeValue_;
+      sweep->cached_ = true;
    }
 }
 
-void Level2ProductView::Impl::ComputeCoordinates(
-   const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData,
-   bool                                               smoothingEnabled)
+void Level2ProductView::Impl::CacheSweeps(const Level2CacheRequest& request,
+                                          std::size_t generation)
 {
-   logger_->debug("ComputeCoordinates()");
+   using namespace std::chrono_literals;
 
-   boost::timer::cpu_timer timer;
+   auto radarProductManager = self_->radar_product_manager();
 
-   const GeographicLib::Geodesic& geodesic(
-      util::GeographicLib::DefaultGeodesic());
+   // Animation selects a time each minute. Consecutive minutes usually select
+   // the same volume scan, which is cached once.
+   std::set<std::chrono::system_clock::time_point> volumeTimes {};
 
-   auto         radarProductManager = self_->radar_product_manager();
-   auto         radarSite           = radarProductManager->radar_site();
-   const float  gateSize            = radarProductManager->gate_size();
-   const double radarLatitude       = radarSite->latitude();
-   const double radarLongitude      = radarSite->longitude();
+   for (std::chrono::system_clock::time_point time = request.startTime_;
+        time <= request.endTime_;
+        time += 1min)
+   {
+      if (generation != cacheGeneration_)
+      {
+         // Superseded by a later request
+         logger_->trace("Sweep caching superseded");
+         return;
+      }
 
-   // Calculate azimuth coordinates
-   timer.start();
+      std::shared_ptr<const wsr88d::rda::PackedElevationScan> radarData;
+      std::chrono::system_clock::time_point                   volumeTime;
+      std::tie(radarData, std::ignore, std::ignore, volumeTime) =
+         radarProductManager->GetLevel2Data(
+            request.dataBlockType_, request.elevation_, time);
+
+      if (!volumeTimes.insert(volumeTime).second)
+      {
+         // The volume scan has already been cached
+         continue;
+      }
 
-   auto& radarData0  = (*radarData)[0];
-   auto  momentData0 = radarData0->moment_data_block(dataBlockType_);
+      // Only complete elevation scans are cached
+      if (radarData == nullptr || radarData->radial_count() == 0u ||
+          IsLevel2SweepIncomplete(*radarData))
+      {
+         continue;
+      }
 
-   std::uint16_t numRadials =
-      static_cast<std::uint16_t>(radarData->crbegin()->first + 1);
-   const std::uint16_t numRangeBins =
-      std::max(momentData0->number_of_data_moment_gates() + 1u,
-               common::MAX_DATA_MOMENT_GATES);
+      const auto* momentData0 = radarData->moment(request.dataBlockType_);
+      if (momentData0 == nullptr || momentData0->data_moments(0) == nullptr)
+      {
+         continue;
+      }
 
-   // Add an extra radial when incomplete data exists
-   if (IsRadarDataIncomplete(radarData))
-   {
-      ++numRadials;
-   }
+      const Level2SweepKey key {radarData,
+                                request.dataBlockType_,
+                                request.smoothingEnabled_,
+                                request.gpuProjectionEnabled_,
+                                request.showSmoothedRangeFolding_};
 
-   // Limit radials
-   numRadials =
-      std::min<std::uint16_t>(numRadials, common::MAX_0_5_DEGREE_RADIALS);
-
-   auto radials = boost::irange<std::uint32_t>(0u, numRadials);
-   auto gates   = boost::irange<std::uint32_t>(0u, numRangeBins);
-
-   const float gateRangeOffset = (smoothingEnabled) ?
-                                    // Center of the first gate is half the gate
-                                    // size distance from the radar site
-                                    0.5f :
-                                    // Far end of the first gate is the gate
-                                    // size distance from the radar site
-                                    1.0f;
-
-   std::for_each(
-      std::execution::par_unseq,
-      radials.begin(),
-      radials.end(),
-      [&](std::uint32_t radial)
+      if (FindCachedSweep(key) != nullptr)
       {
-         units::degrees<float> angle {};
-
-         auto radialData = radarData->find(radial);
-         if (radialData != radarData->cend() && !smoothingEnabled)
-         {
-            angle = radialData->second->azimuth_angle();
-         }
-         else
-         {
-            auto prevRadial1 = radarData->find(
-               (radial >= 1) ? radial - 1 : numRadials - (1 - radial));
-            auto prevRadial2 = radarData->find(
-               (radial >= 2) ? radial - 2 : numRadials - (2 - radial));
-
-            if (radialData != radarData->cend() &&
-                prevRadial1 != radarData->cend() && smoothingEnabled)
-            {
-               const units::degrees<float> currentAngle =
-                  radialData->second->azimuth_angle();
-               const units::degrees<float> prevAngle =
-                  prevRadial1->second->azimuth_angle();
-
-               // Calculate delta angle
-               const units::degrees<float> deltaAngle =
-                  NormalizeAngle(currentAngle - prevAngle);
-
-               // Delta scale is half the delta angle to reach the center of the
-               // bin, because smoothing is enabled
-               constexpr float deltaScale = 0.5f;
-
-               angle = currentAngle + deltaAngle * deltaScale;
-            }
-            else if (radialData != radarData->cend() && smoothingEnabled)
-            {
-               const units::degrees<float> currentAngle =
-                  radialData->second->azimuth_angle();
-
-               // Assume a half degree delta if there aren't enough angles
-               // to determine a delta angle
-               constexpr units::degrees<float> deltaAngle {0.5f};
-
-               // Delta scale is half the delta angle to reach the center of the
-               // bin, because smoothing is enabled
-               constexpr float deltaScale = 0.5f;
-
-               angle = currentAngle + deltaAngle * deltaScale;
-            }
-            else if (prevRadial1 != radarData->cend() &&
-                     prevRadial2 != radarData->cend())
-            {
-               const units::degrees<float> prevAngle1 =
-                  prevRadial1->second->azimuth_angle();
-               const units::degrees<float> prevAngle2 =
-                  prevRadial2->second->azimuth_angle();
-
-               // Calculate delta angle
-               const units::degrees<float> deltaAngle =
-                  NormalizeAngle(prevAngle1 - prevAngle2);
-
-               const float deltaScale =
-                  (smoothingEnabled) ?
-                     // Delta scale is 1.5x the delta angle to reach the center
-                     // of the next bin, because smoothing is enabled
-                     1.5f :
-                     // Delta scale is 1.0x the delta angle
-                     1.0f;
-
-               angle = prevAngle1 + deltaAngle * deltaScale;
-            }
-            else if (prevRadial1 != radarData->cend())
-            {
-               const units::degrees<float> prevAngle1 =
-                  prevRadial1->second->azimuth_angle();
-
-               // Assume a half degree delta if there aren't enough angles
-               // to determine a delta angle
-               constexpr units::degrees<float> deltaAngle {0.5f};
-
-               const float deltaScale =
-                  (smoothingEnabled) ?
-                     // Delta scale is 1.5x the delta angle to reach the center
-                     // of the next bin, because smoothing is enabled
-                     1.5f :
-                     // Delta scale is 1.0x the delta angle
-                     1.0f;
-
-               angle = prevAngle1 + deltaAngle * deltaScale;
-            }
-            else
-            {
-               // Not enough angles present to determine an angle
-               return;
-            }
-         }
-
-         std::for_each(
-            std::execution::par_unseq,
-            gates.begin(),
-            gates.end(),
-            [&](std::uint32_t gate)
-            {
-               const std::uint32_t radialGate =
-                  radial * common::MAX_DATA_MOMENT_GATES + gate;
-               const float range =
-                  (static_cast<float>(gate) + gateRangeOffset) * gateSize;
-               const std::size_t offset =
-                  static_cast<std::size_t>(radialGate) * 2;
-
-               double latitude  = 0.0;
-               double longitude = 0.0;
-
-               geodesic.Direct(radarLatitude,
-                               radarLongitude,
-                               angle.value(),
-                               range,
-                               latitude,
-                               longitude);
-
-               coordinates_[offset]     = static_cast<float>(latitude);
-               coordinates_[offset + 1] = static_cast<float>(longitude);
-            });
-      });
-   timer.stop();
-   logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
-}
+         // The sweep is already cached
+         continue;
+      }
 
-bool Level2ProductView::Impl::IsRadarDataIncomplete(
-   const std::shared_ptr<const wsr88d::rda::ElevationScan>& radarData)
-{
-   // Assume the data is incomplete when the delta between the first and last
-   // angles is greater than 2.5 degrees.
-   constexpr units::degrees<float> kIncompleteDataAngleThreshold_ {2.5};
-
-   const units::degrees<float> firstAngle =
-      radarData->cbegin()->second->azimuth_angle();
-   const units::degrees<float> lastAngle =
-      radarData->crbegin()->second->azimuth_angle();
-   const units::degrees<float> angleDelta =
-      common::GetAngleDelta(firstAngle, lastAngle);
-
-   return angleDelta > kIncompleteDataAngleThreshold_;
+      logger_->trace("Caching sweep: {}", scwx::util::TimeString(volumeTime));
+
+      auto sweep  = std::make_shared<Level2Sweep>();
+      sweep->key_ = key;
+
+      ComputeSweepGeometry(*radarData, *momentData0, 0u, *sweep);
+      CacheSweep(sweep);
+   }
 }
 
-units::degrees<float>
-Level2ProductView::Impl::NormalizeAngle(units::degrees<float> angle)
+std::size_t Level2ProductView::Impl::GetFirstUpdatedRadial(
+   const std::shared_ptr<const wsr88d::rda::PackedElevationScan>& radarData)
+   const
 {
-   constexpr auto angleLimit = units::degrees<float> {180.0f};
-   constexpr auto fullAngle  = units::degrees<float> {360.0f};
+   const auto& previousData = elevationScan_;
+
+   if (previousData == nullptr || moment_ == nullptr ||
+       previousData->moment(dataBlockType_) != moment_)
+   {
+      return 0u;
+   }
 
-   // Normalize angle to [-180, 180)
-   while (angle < -angleLimit)
+   const std::size_t previousRadialCount = previousData->radial_count();
+   const auto*       previousLastRadial  = previousData->last_radial_header();
+   const auto*       momentData          = radarData->moment(dataBlockType_);
+
+   // Radials of an elevation scan in progress are appended in azimuth order.
+   // Once the scan is complete, the first and last radials are joined, and the
+   // sweep is recomputed.
+   if (previousLastRadial == nullptr || momentData == nullptr ||
+       momentData->data_moments(0) == nullptr ||
+       radarData->radial_count() <= previousRadialCount ||
+       radarData->radial_count() > common::MAX_0_5_DEGREE_RADIALS ||
+       sweep_->geometry_.radialMomentOffsets_.size() !=
+          previousRadialCount + 1u ||
+       !IsLevel2SweepIncomplete(*previousData) ||
+       !IsLevel2SweepIncomplete(*radarData))
    {
-      angle += fullAngle;
+      return 0u;
    }
-   while (angle >= angleLimit)
+
+   if (momentData->data_word_size() != moment_->data_word_size() ||
+       momentData->snr_threshold_raw() != moment_->snr_threshold_raw() ||
+       momentData->offset() != moment_->offset() ||
+       momentData->radials()[0].numberOfDataMomentGates !=
+          moment_->radials()[0].numberOfDataMomentGates)
    {
-      angle -= fullAngle;
+      return 0u;
    }
 
-   return angle;
+   // Previously computed radials must be unchanged
+   const auto previousHeaders = previousData->radial_headers();
+   const auto radialHeaders   = radarData->radial_headers();
+   const auto previousAngles  = previousData->azimuth_angles();
+   const auto azimuthAngles   = radarData->azimuth_angles();
+
+   for (std::size_t radial = 0; radial < previousRadialCount; ++radial)
+   {
+      const auto& previousHeader = previousHeaders[radial];
+      const auto& radialHeader   = radialHeaders[radial];
+
+      if (previousHeader.valid != radialHeader.valid ||
+          previousHeader.collectionTime != radialHeader.collectionTime ||
+          previousHeader.modifiedJulianDate !=
+             radialHeader.modifiedJulianDate ||
+          previousHeader.elevationNumber != radialHeader.elevationNumber ||
+          previousAngles[radial] != azimuthAngles[radial])
+      {
+         return 0u;
+      }
+   }
+
+   // The last radial is recomputed, as its edge (and its smoothing neighbor)
+   // is now the first appended radial
+   return static_cast<std::size_t>(previousLastRadial -
+                                   previousHeaders.data());
 }
 
 std::optional<std::uint16_t>
 Level2ProductView::GetBinLevel(const common::Coordinate& coordinate) const
 {
    auto radarData     = p->elevationScan_;
+   auto binLookup     = p->binLookup_;
    auto dataBlockType = p->dataBlockType_;
 
-   if (radarData == nullptr)
+   if (radarData == nullptr || binLookup == nullptr)
    {
       return std::nullopt;
    }
 
-   auto         radarProductManager = radar_product_manager();
-   auto         radarSite           = radarProductManager->radar_site();
-   const double radarLatitude       = radarSite->latitude();
-   const double radarLongitude      = radarSite->longitude();
-
-   // Determine distance and azimuth of coordinate relative to radar location
-   double s12;  // Distance (meters)
-   double azi1; // Azimuth (degrees)
-   double azi2; // Unused
-   util::GeographicLib::DefaultGeodesic().Inverse(radarLatitude,
-                                                  radarLongitude,
-                                                  coordinate.latitude_,
-                                                  coordinate.longitude_,
-                                                  s12,
-                                                  azi1,
-                                                  azi2);
-
-   if (std::isnan(azi1))
-   {
-      // If a problem occurred with the geodesic inverse calculation
-      return std::nullopt;
-   }
+   auto radarProductManager = radar_product_manager();
 
-   // Azimuth is returned as [-180, 180) from the geodesic inverse, we need a
-   // range of [0, 360)
-   while (azi1 < 0.0)
-   {
-      azi1 += 360.0;
-   }
-
-   // Find Radial
-   std::uint16_t numRadials =
-      static_cast<std::uint16_t>(radarData->crbegin()->first + 1);
+   // Determine radial and distance of coordinate relative to radar location
+   const std::optional<SweepBin> bin =
+      FindSweepBin(*binLookup, coordinate.latitude_, coordinate.longitude_);
 
-   // Add an extra radial when incomplete data exists
-   if (Impl::IsRadarDataIncomplete(radarData))
+   if (!bin.has_value())
    {
-      ++numRadials;
+      // No radial was found (not likely to happen without a gap in data)
+      return std::nullopt;
    }
 
-   // Limit radials
-   numRadials =
-      std::min<std::uint16_t>(numRadials, common::MAX_0_5_DEGREE_RADIALS);
+   const std::uint16_t radial = bin->radial_;
+   const double        s12    = bin->range_; // Distance (meters)
 
-   auto radials = boost::irange<std::uint32_t>(0u, numRadials);
+   const auto* momentData  = radarData->moment(dataBlockType);
+   const void* dataMoments = (momentData != nullptr) ?
+                                momentData->data_moments(radial) :
+                                nullptr;
 
-   auto radial = std::find_if( //
-      std::execution::par_unseq,
-      radials.begin(),
-      radials.end(),
-      [&](std::uint32_t i)
-      {
-         bool hasNextAngle = false;
-         bool found        = false;
-
-         units::degrees<float> startAngle {};
-         units::degrees<float> nextAngle {};
-
-         auto radialData = radarData->find(i);
-         if (radialData != radarData->cend())
-         {
-            startAngle = radialData->second->azimuth_angle();
-
-            auto nextRadial = radarData->find((i + 1) % numRadials);
-            if (nextRadial != radarData->cend())
-            {
-               nextAngle    = nextRadial->second->azimuth_angle();
-               hasNextAngle = true;
-            }
-            else
-            {
-               // Next angle is not available, interpolate
-               auto prevRadial =
-                  radarData->find((i >= 1) ? i - 1 : numRadials - (1 - i));
-
-               if (prevRadial != radarData->cend())
-               {
-                  const units::degrees<float> prevAngle =
-                     prevRadial->second->azimuth_angle();
-
-                  const units::degrees<float> deltaAngle =
-                     common::GetAngleDelta(startAngle, prevAngle);
-
-                  nextAngle    = startAngle + deltaAngle;
-                  hasNextAngle = true;
-               }
-            }
-         }
-
-         if (hasNextAngle)
-         {
-            if (startAngle < nextAngle)
-            {
-               if (startAngle.value() <= azi1 && azi1 < nextAngle.value())
-               {
-                  found = true;
-               }
-            }
-            else
-            {
-               // If the bin crosses 0/360 degrees, special handling is needed
-               if (startAngle.value() <= azi1 || azi1 < nextAngle.value())
-               {
-                  found = true;
-               }
-            }
-         }
-
-         return found;
-      });
-
-   if (radial == radials.end())
+   if (dataMoments == nullptr)
    {
-      // No radial was found (not likely to happen without a gap in data)
+      // No data for the moment in the radial
       return std::nullopt;
    }
 
+   const auto& momentRadial = momentData->radials()[radial];
+
    // Compute gate interval
-   auto momentData = (*radarData)[*radial]->moment_data_block(dataBlockType);
    const std::int32_t dataMomentInterval =
-      momentData->data_moment_range_sample_interval_raw();
+      momentRadial.dataMomentRangeSampleIntervalRaw;
    const std::int32_t dataMomentIntervalH = dataMomentInterval / 2;
    const std::int32_t dataMomentRange     = std::max<std::int32_t>(
-      momentData->data_moment_range_raw(), dataMomentIntervalH);
+      momentRadial.dataMomentRangeRaw, dataMomentIntervalH);
 
    // Compute gate size (number of base 250m gates per bin)
    const std::int32_t gateSizeMeters =
@@ -1434,7 +1239,7 @@ Level2ProductView::GetBinLevel(const common::Coordinate& coordinate) const
    const std::int32_t startGate =
       (dataMomentRange - dataMomentIntervalH) / gateSizeMeters;
    const std::int32_t numberOfDataMomentGates =
-      momentData->number_of_data_moment_gates();
+      momentRadial.numberOfDataMomentGates;
 
    const std::int32_t gate = s12 / dataMomentInterval - startGate;
 
@@ -1452,13 +1257,11 @@ Level2ProductView::GetBinLevel(const common::Coordinate& coordinate) const
 
    if (momentData->data_word_size() == 8)
    {
-      level =
-         reinterpret_cast<const uint8_t*>(momentData->data_moments())[gate];
+      level = reinterpret_cast<const uint8_t*>(dataMoments)[gate];
    }
    else
    {
-      level =
-         reinterpret_cast<const uint16_t*>(momentData->data_moments())[gate];
+      level = reinterpret_cast<const uint16_t*>(dataMoments)[gate];
    }
 
    if (level < snrThreshold && level != RANGE_FOLDED)
@@ -1515,8 +1318,8 @@ Level2ProductView::GetDataLevelCode(std::uint16_t level) const
 
 std::optional<float> Level2ProductView::GetDataValue(std::uint16_t level) const
 {
-   const float   offset    = p->momentDataBlock0_->offset();
-   const float   scale     = p->momentDataBlock0_->scale();
+   const float   offset    = p->moment_->offset();
+   const float   scale     = p->moment_->scale();
    std::uint16_t threshold = std::numeric_limits<std::uint16_t>::max();
 
    switch (p->product_)
@@ -37,7 +37,13 @@ public:
    std::string                           units() const override;
    std::uint16_t                         vcp() const override;
    const std::vector<float>&             vertices() const override;
+   const PolarSweepGeometry*             polar_geometry() const override;
+   const std::vector<std::uint32_t>*     vertex_indices() const override;
+   const std::vector<SweepLevel>*        sweep_levels() const override;
+   std::shared_ptr<const void>           cached_sweep() const override;
 
+   void CacheSweeps(std::chrono::system_clock::time_point startTime,
+                    std::chrono::system_clock::time_point endTime) override;
    void LoadColorTable(std::shared_ptr<common::ColorTable> colorTable) override;
    void SelectElevation(float elevation) override;
    void SelectProduct(const std::string& productName) override;
@@ -61,7 +67,7 @@ public:
           std::shared_ptr<manager::RadarProductManager> radarProductManager);
 
 protected:
-   boost::asio::thread_pool& thread_pool() override;
+   scwx::util::TaskQueue& task_queue() override;
 
    void ConnectRadarProductManager() override;
    void DisconnectRadarProductManager() override;
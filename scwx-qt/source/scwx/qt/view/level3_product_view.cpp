@@ -1,4 +1,5 @@
 #include <scwx/qt/view/level3_product_view.hpp>
+#include <scwx/qt/view/sweep_geometry.hpp>
 #include <scwx/qt/settings/general_settings.hpp>
 #include <scwx/qt/settings/unit_settings.hpp>
 #include <scwx/qt/types/unit_types.hpp>
@@ -27,8 +28,6 @@ namespace view
 static const std::string logPrefix_ = "scwx::qt::view::level3_product_view";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
-static constexpr uint16_t RANGE_FOLDED = 1u;
-
 static const std::unordered_map<common::Level3ProductCategory, float>
    categoryScale_ {
       {common::Level3ProductCategory::CorrelationCoefficient, 100.0f}};
@@ -428,62 +427,11 @@ void Level3ProductView::UpdateColorTableLut()
       return;
    }
 
-   // Iterate over [rangeMin, numberOfLevels)
-   boost::integer_range<uint16_t> dataRange =
-      boost::irange<uint16_t>(rangeMin, numberOfLevels);
-
-   std::vector<boost::gil::rgba8_pixel_t>& lut = p->colorTableLut_;
-   lut.resize(numberOfLevels - rangeMin);
-   lut.shrink_to_fit();
-
-   std::for_each(
-      std::execution::par_unseq,
-      dataRange.begin(),
-      dataRange.end(),
-      [&](uint16_t i)
-      {
-         const size_t lutIndex = i - *dataRange.begin();
-
-         std::optional<float> f = descriptionBlock->data_value(i);
-
-         // Different products use different scale/offset formulas
-         if (numberOfLevels > 16 || !descriptionBlock->IsDataLevelCoded())
-         {
-            if (i == RANGE_FOLDED && threshold > RANGE_FOLDED)
-            {
-               lut[lutIndex] = p->colorTable_->rf_color();
-            }
-            else
-            {
-               if (f.has_value())
-               {
-                  lut[lutIndex] = p->colorTable_->Color(f.value());
-               }
-               else
-               {
-                  lut[lutIndex] = boost::gil::rgba8_pixel_t {0, 0, 0, 0};
-               }
-            }
-         }
-         else
-         {
-            std::optional<wsr88d::DataLevelCode> dataLevelCode =
-               descriptionBlock->data_level_code(i);
-
-            if (dataLevelCode == wsr88d::DataLevelCode::RangeFolded)
-            {
-               lut[lutIndex] = p->colorTable_->rf_color();
-            }
-            else if (f.has_value())
-            {
-               lut[lutIndex] = p->colorTable_->Color(f.value());
-            }
-            else
-            {
-               lut[lutIndex] = boost::gil::rgba8_pixel_t {0, 0, 0, 0};
-            }
-         }
-      });
+   ComputeLevel3ColorTableLut(*p->colorTable_,
+                              *descriptionBlock,
+                              rangeMin,
+                              threshold,
+                              p->colorTableLut_);
 
    p->colorTableMin_ = rangeMin;
    p->colorTableMax_ = rangeMax;
@@ -498,15 +446,13 @@ void Level3ProductView::UpdateColorTableLut()
    Q_EMIT ColorTableLutUpdated();
 }
 
-std::uint8_t Level3ProductView::ComputeEdgeValue() const
+std::uint8_t Level3ProductView::ComputeEdgeValue(
+   const wsr88d::rpg::ProductDescriptionBlock& descriptionBlock) const
 {
    std::uint8_t edgeValue = 0;
 
-   const std::shared_ptr<wsr88d::rpg::ProductDescriptionBlock>
-      descriptionBlock = p->graphicMessage_->description_block();
-
-   const float offset = descriptionBlock->offset();
-   const float scale  = descriptionBlock->scale();
+   const float offset = descriptionBlock.offset();
+   const float scale  = descriptionBlock.scale();
 
    switch (p->category_)
    {
@@ -527,7 +473,7 @@ std::uint8_t Level3ProductView::ComputeEdgeValue() const
    case common::Level3ProductCategory::CorrelationCoefficient:
       edgeValue = static_cast<std::uint8_t>(
          std::max<std::uint16_t>(std::numeric_limits<std::uint8_t>::max(),
-                                 descriptionBlock->number_of_levels()));
+                                 descriptionBlock.number_of_levels()));
       break;
 
    case common::Level3ProductCategory::Reflectivity:
@@ -58,7 +58,8 @@ protected:
    void DisconnectRadarProductManager() override;
    void UpdateColorTableLut() override;
 
-   [[nodiscard]] std::uint8_t ComputeEdgeValue() const;
+   [[nodiscard]] std::uint8_t ComputeEdgeValue(
+      const wsr88d::rpg::ProductDescriptionBlock& descriptionBlock) const;
 
 private:
    class Impl;
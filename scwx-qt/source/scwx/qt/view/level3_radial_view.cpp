@@ -1,5 +1,5 @@
 #include <scwx/qt/view/level3_radial_view.hpp>
-#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/qt/view/sweep_geometry.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/threads.hpp>
@@ -7,7 +7,6 @@
 #include <scwx/wsr88d/rpg/digital_radial_data_array_packet.hpp>
 #include <scwx/wsr88d/rpg/radial_data_packet.hpp>
 
-#include <boost/range/irange.hpp>
 #include <boost/timer/timer.hpp>
 
 namespace scwx
@@ -24,9 +23,7 @@ static constexpr std::uint32_t kMaxRadialGates_ =
    common::MAX_0_5_DEGREE_RADIALS * common::MAX_DATA_MOMENT_GATES;
 static constexpr std::uint32_t kMaxCoordinates_ = kMaxRadialGates_ * 2u;
 
-static constexpr std::uint16_t RANGE_FOLDED      = 1u;
-static constexpr std::uint32_t VERTICES_PER_BIN  = 6u;
-static constexpr std::uint32_t VALUES_PER_VERTEX = 2u;
+static constexpr std::uint16_t RANGE_FOLDED = 1u;
 
 class Level3RadialView::Impl
 {
@@ -41,27 +38,27 @@ public:
    {
       coordinates_.resize(kMaxCoordinates_);
    }
-   ~Impl() { threadPool_.join(); };
+   ~Impl() { taskQueue_.join(); };
 
    void ComputeCoordinates(
       const std::shared_ptr<wsr88d::rpg::GenericRadialDataPacket>& radialData,
-      bool smoothingEnabled);
-
-   [[nodiscard]] inline std::uint8_t
-   RemapDataMoment(std::uint8_t dataMoment) const;
+      bool                         smoothingEnabled,
+      const std::function<bool()>& cancelled);
+   [[nodiscard]] std::shared_ptr<const SweepBinLookup> ComputeBinLookup(
+      const wsr88d::rpg::GenericRadialDataPacket& radialData) const;
 
    Level3RadialView* self_;
 
-   boost::asio::thread_pool threadPool_ {1u};
+   scwx::util::TaskQueue taskQueue_ {scwx::util::TaskPriority::Interactive};
 
-   std::vector<float>        coordinates_ {};
-   std::vector<float>        vertices_ {};
-   std::vector<std::uint8_t> dataMoments8_ {};
-   std::uint8_t              edgeValue_ {};
+   std::vector<float> coordinates_ {};
+   SweepGeometry      geometry_ {};
+   std::uint8_t       edgeValue_ {};
 
    bool showSmoothedRangeFolding_ {false};
 
    std::shared_ptr<wsr88d::rpg::GenericRadialDataPacket> lastRadialData_ {};
+   std::shared_ptr<const SweepBinLookup>                 binLookup_ {};
    bool lastShowSmoothedRangeFolding_ {false};
    bool lastSmoothingEnabled_ {false};
 
@@ -86,9 +83,9 @@ Level3RadialView::~Level3RadialView()
    std::unique_lock sweepLock {sweep_mutex()};
 }
 
-boost::asio::thread_pool& Level3RadialView::thread_pool()
+scwx::util::TaskQueue& Level3RadialView::task_queue()
 {
-   return p->threadPool_;
+   return p->taskQueue_;
 }
 
 float Level3RadialView::range() const
@@ -108,7 +105,12 @@ uint16_t Level3RadialView::vcp() const
 
 const std::vector<float>& Level3RadialView::vertices() const
 {
-   return p->vertices_;
+   return p->geometry_.vertices_;
+}
+
+const std::vector<SweepLevel>* Level3RadialView::sweep_levels() const
+{
+   return &p->geometry_.levels_;
 }
 
 std::tuple<const void*, size_t, size_t> Level3RadialView::GetMomentData() const
@@ -117,8 +119,8 @@ std::tuple<const void*, size_t, size_t> Level3RadialView::GetMomentData() const
    size_t      dataSize;
    size_t      componentSize;
 
-   data          = p->dataMoments8_.data();
-   dataSize      = p->dataMoments8_.size() * sizeof(uint8_t);
+   data          = p->geometry_.dataMoments8_.data();
+   dataSize      = p->geometry_.dataMoments8_.size() * sizeof(uint8_t);
    componentSize = 1;
 
    return std::tie(data, dataSize, componentSize);
@@ -130,6 +132,8 @@ void Level3RadialView::ComputeSweep()
 
    boost::timer::cpu_timer timer;
 
+   const std::function<bool()> cancelled = sweep_cancelled();
+
    std::scoped_lock sweepLock(sweep_mutex());
 
    std::shared_ptr<manager::RadarProductManager> radarProductManager =
@@ -158,6 +162,13 @@ void Level3RadialView::ComputeSweep()
       return;
    }
 
+   // Loading may have taken long enough for the sweep to be superseded
+   if (cancelled())
+   {
+      logger_->debug("Sweep superseded");
+      return;
+   }
+
    // A message with radial data should be a Graphic Product Message
    std::shared_ptr<wsr88d::rpg::GraphicProductMessage> gpm =
       std::dynamic_pointer_cast<wsr88d::rpg::GraphicProductMessage>(message);
@@ -176,10 +187,6 @@ void Level3RadialView::ComputeSweep()
       Q_EMIT SweepNotComputed(types::NoUpdateReason::NoChange);
       return;
    }
-   set_graphic_product_message(gpm);
-
-   p->lastShowSmoothedRangeFolding_ = showSmoothedRangeFolding;
-   p->lastSmoothingEnabled_         = smoothingEnabled;
 
    // A message with radial data should have a Product Description Block and
    // Product Symbology Block
@@ -257,8 +264,6 @@ void Level3RadialView::ComputeSweep()
       return;
    }
 
-   p->lastRadialData_ = radialData;
-
    // Valid number of radials is 1-720
    size_t radials = radialData->number_of_radials();
    if (radials < 1 || radials > 720)
@@ -296,38 +301,14 @@ void Level3RadialView::ComputeSweep()
       return;
    }
 
-   p->latitude_  = descriptionBlock->latitude_of_radar();
-   p->longitude_ = descriptionBlock->longitude_of_radar();
-   p->range_     = descriptionBlock->range();
-   p->sweepTime_ =
-      scwx::util::TimePoint(descriptionBlock->volume_scan_date(),
-                            descriptionBlock->volume_scan_start_time() * 1000);
-   p->vcp_ = descriptionBlock->volume_coverage_pattern();
-
    // Calculate vertices
    timer.start();
 
-   // Setup vertex vector
-   std::vector<float>& vertices = p->vertices_;
-   size_t              vIndex   = 0;
-   vertices.clear();
-   vertices.resize(radials * numberOfDataMomentGates * VERTICES_PER_BIN *
-                   VALUES_PER_VERTEX);
-
-   // Setup data moment vector
-   std::vector<uint8_t>& dataMoments8 = p->dataMoments8_;
-   size_t                mIndex       = 0;
-
-   dataMoments8.resize(radials * numberOfDataMomentGates * VERTICES_PER_BIN);
-
-   // Compute threshold at which to display an individual bin
-   const uint16_t snrThreshold = descriptionBlock->threshold();
-
    // Determine which radial to start at
    std::uint16_t startRadial;
    if (radialSize == common::RadialSize::NonStandard)
    {
-      p->ComputeCoordinates(radialData, smoothingEnabled);
+      p->ComputeCoordinates(radialData, smoothingEnabled, cancelled);
       startRadial = 0;
    }
    else
@@ -337,170 +318,75 @@ void Level3RadialView::ComputeSweep()
       startRadial = std::lroundf(startAngle * radialMultiplier);
    }
 
-   // Compute gate interval
-   const std::uint16_t dataMomentInterval =
-      descriptionBlock->x_resolution_raw();
-
-   // Compute gate size (number of base gates per bin)
-   const std::uint16_t gateSize = std::max<std::uint16_t>(
-      1,
-      dataMomentInterval /
-         static_cast<std::uint16_t>(radarProductManager->gate_size()));
+   SweepParameters parameters {};
+   parameters.radarLatitude_  = descriptionBlock->latitude_of_radar();
+   parameters.radarLongitude_ = descriptionBlock->longitude_of_radar();
 
-   // Compute gate range [startGate, endGate)
-   std::uint16_t       startGate = 0;
-   const std::uint16_t endGate =
-      std::min<std::uint16_t>(startGate + numberOfDataMomentGates * gateSize,
-                              common::MAX_DATA_MOMENT_GATES);
+   parameters.gateSize_                 = radarProductManager->gate_size();
+   parameters.smoothingEnabled_         = smoothingEnabled;
+   parameters.showSmoothedRangeFolding_ = showSmoothedRangeFolding;
+   parameters.edgeValue_                = p->edgeValue_;
+   parameters.cancelled_                = cancelled;
 
    if (smoothingEnabled)
    {
-      // If smoothing is enabled, the start gate is incremented by one, as we
-      // are skipping the radar site origin. The end gate is unaffected, as
-      // we need to draw one less data point.
-      ++startGate;
-
       // For most products other than reflectivity, the edge should not go to
       // the bottom of the color table
-      p->edgeValue_ = ComputeEdgeValue();
+      parameters.edgeValue_ = ComputeEdgeValue(*descriptionBlock);
    }
 
-   for (std::uint16_t radial = 0; radial < radialData->number_of_radials();
-        ++radial)
-   {
-      const auto& dataMomentsArray8 = radialData->level(radial);
-
-      const std::uint16_t nextRadial =
-         (radial == radialData->number_of_radials() - 1) ? 0 : radial + 1;
-      const auto& nextDataMomentsArray8 = radialData->level(nextRadial);
-
-      for (std::uint16_t gate = startGate, i = 0; gate + gateSize <= endGate;
-           gate += gateSize, ++i)
-      {
-         size_t vertexCount = (gate > 0) ? 6 : 3;
-
-         if (!smoothingEnabled)
-         {
-            // Store data moment value
-            const uint8_t dataValue =
-               (i < dataMomentsArray8.size()) ? dataMomentsArray8[i] : 0;
-            if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
-            {
-               continue;
-            }
-
-            for (size_t m = 0; m < vertexCount; m++)
-            {
-               dataMoments8[mIndex++] = dataValue;
-            }
-         }
-         else if (gate > 0)
-         {
-            // Validate indices are all in range
-            if (i + 1 >= numberOfDataMomentGates)
-            {
-               continue;
-            }
-
-            const std::uint8_t& dm1 = dataMomentsArray8[i];
-            const std::uint8_t& dm2 = dataMomentsArray8[i + 1];
-            const std::uint8_t& dm3 = nextDataMomentsArray8[i];
-            const std::uint8_t& dm4 = nextDataMomentsArray8[i + 1];
-
-            if ((!showSmoothedRangeFolding && //
-                 (dm1 < snrThreshold || dm1 == RANGE_FOLDED) &&
-                 (dm2 < snrThreshold || dm2 == RANGE_FOLDED) &&
-                 (dm3 < snrThreshold || dm3 == RANGE_FOLDED) &&
-                 (dm4 < snrThreshold || dm4 == RANGE_FOLDED)) ||
-                (showSmoothedRangeFolding && //
-                 dm1 < snrThreshold && dm1 != RANGE_FOLDED &&
-                 dm2 < snrThreshold && dm2 != RANGE_FOLDED &&
-                 dm3 < snrThreshold && dm3 != RANGE_FOLDED &&
-                 dm4 < snrThreshold && dm4 != RANGE_FOLDED))
-            {
-               // Skip only if all data moments are hidden
-               continue;
-            }
-
-            // The order must match the store vertices section below
-            dataMoments8[mIndex++] = p->RemapDataMoment(dm1);
-            dataMoments8[mIndex++] = p->RemapDataMoment(dm2);
-            dataMoments8[mIndex++] = p->RemapDataMoment(dm4);
-            dataMoments8[mIndex++] = p->RemapDataMoment(dm1);
-            dataMoments8[mIndex++] = p->RemapDataMoment(dm3);
-            dataMoments8[mIndex++] = p->RemapDataMoment(dm4);
-         }
-         else
-         {
-            // If smoothing is enabled, gate should never start at zero
-            // (radar site origin)
-            logger_->error("Smoothing enabled, gate should not start at zero");
-            continue;
-         }
-
-         // Store vertices
-         if (gate > 0)
-         {
-            const uint16_t baseCoord = gate - 1;
-
-            size_t offset1 = ((startRadial + radial) % radials *
-                                 common::MAX_DATA_MOMENT_GATES +
-                              baseCoord) *
-                             2;
-            size_t offset2 = offset1 + gateSize * 2;
-            size_t offset3 = (((startRadial + radial + 1) % radials) *
-                                 common::MAX_DATA_MOMENT_GATES +
-                              baseCoord) *
-                             2;
-            size_t offset4 = offset3 + gateSize * 2;
-
-            vertices[vIndex++] = coordinates[offset1];
-            vertices[vIndex++] = coordinates[offset1 + 1];
-
-            vertices[vIndex++] = coordinates[offset2];
-            vertices[vIndex++] = coordinates[offset2 + 1];
-
-            vertices[vIndex++] = coordinates[offset4];
-            vertices[vIndex++] = coordinates[offset4 + 1];
-
-            vertices[vIndex++] = coordinates[offset1];
-            vertices[vIndex++] = coordinates[offset1 + 1];
+   // Compute threshold at which to display an individual bin
+   parameters.snrThreshold_ = descriptionBlock->threshold();
 
-            vertices[vIndex++] = coordinates[offset3];
-            vertices[vIndex++] = coordinates[offset3 + 1];
+   // Compute gate interval
+   const std::uint16_t dataMomentInterval =
+      descriptionBlock->x_resolution_raw();
 
-            vertices[vIndex++] = coordinates[offset4];
-            vertices[vIndex++] = coordinates[offset4 + 1];
-         }
-         else
-         {
-            const uint16_t baseCoord = gate;
+   // The sweep is computed separately, and is abandoned if superseded
+   SweepGeometry geometry {};
+
+   ComputeLevel3RadialSweep(*radialData,
+                            parameters,
+                            coordinates,
+                            startRadial,
+                            dataMomentInterval,
+                            geometry);
+   ComputeLevel3RadialSweepLevels(*radialData,
+                                  parameters,
+                                  coordinates,
+                                  startRadial,
+                                  dataMomentInterval,
+                                  geometry);
+
+   if (IsSweepCancelled(parameters))
+   {
+      // The previous sweep, and the message it was computed from, remain
+      // displayed
+      logger_->debug("Sweep superseded");
+      return;
+   }
 
-            size_t offset1 = ((startRadial + radial) % radials *
-                                 common::MAX_DATA_MOMENT_GATES +
-                              baseCoord) *
-                             2;
-            size_t offset2 = (((startRadial + radial + 1) % radials) *
-                                 common::MAX_DATA_MOMENT_GATES +
-                              baseCoord) *
-                             2;
+   // The message is committed with its sweep, so that a superseded sweep
+   // leaves the displayed message unchanged
+   set_graphic_product_message(gpm);
 
-            vertices[vIndex++] = p->latitude_;
-            vertices[vIndex++] = p->longitude_;
+   p->lastShowSmoothedRangeFolding_ = showSmoothedRangeFolding;
+   p->lastSmoothingEnabled_         = smoothingEnabled;
 
-            vertices[vIndex++] = coordinates[offset1];
-            vertices[vIndex++] = coordinates[offset1 + 1];
+   ComputeSweepSectors(coordinates, nullptr, geometry);
+   p->geometry_  = std::move(geometry);
+   p->edgeValue_ = parameters.edgeValue_;
 
-            vertices[vIndex++] = coordinates[offset2];
-            vertices[vIndex++] = coordinates[offset2 + 1];
-         }
-      }
-   }
-   vertices.resize(vIndex);
-   vertices.shrink_to_fit();
+   p->lastRadialData_ = radialData;
+   p->binLookup_      = p->ComputeBinLookup(*radialData);
 
-   dataMoments8.resize(mIndex);
-   dataMoments8.shrink_to_fit();
+   p->latitude_  = descriptionBlock->latitude_of_radar();
+   p->longitude_ = descriptionBlock->longitude_of_radar();
+   p->range_     = descriptionBlock->range();
+   p->sweepTime_ =
+      scwx::util::TimePoint(descriptionBlock->volume_scan_date(),
+                            descriptionBlock->volume_scan_start_time() * 1000);
+   p->vcp_ = descriptionBlock->volume_coverage_pattern();
 
    timer.stop();
    logger_->debug("Vertices calculated in {}", timer.format(6, "%ws"));
@@ -510,94 +396,47 @@ void Level3RadialView::ComputeSweep()
    Q_EMIT SweepComputed();
 }
 
-std::uint8_t
-Level3RadialView::Impl::RemapDataMoment(std::uint8_t dataMoment) const
+std::shared_ptr<const SweepBinLookup>
+Level3RadialView::Impl::ComputeBinLookup(
+   const wsr88d::rpg::GenericRadialDataPacket& radialData) const
 {
-   if (dataMoment != 0 &&
-       (dataMoment != RANGE_FOLDED || showSmoothedRangeFolding_))
-   {
-      return dataMoment;
-   }
-   else
-   {
-      return edgeValue_;
-   }
+   auto radarSite = self_->radar_product_manager()->radar_site();
+
+   SweepParameters parameters {};
+   parameters.radarLatitude_  = radarSite->latitude();
+   parameters.radarLongitude_ = radarSite->longitude();
+
+   // A new lookup is computed, as the previous lookup may be in use
+   auto binLookup = std::make_shared<SweepBinLookup>();
+   ComputeLevel3RadialBinLookup(radialData, parameters, *binLookup);
+
+   return binLookup;
 }
 
 void Level3RadialView::Impl::ComputeCoordinates(
    const std::shared_ptr<wsr88d::rpg::GenericRadialDataPacket>& radialData,
-   bool smoothingEnabled)
+   bool                         smoothingEnabled,
+   const std::function<bool()>& cancelled)
 {
    logger_->debug("ComputeCoordinates()");
 
    boost::timer::cpu_timer timer;
 
-   const GeographicLib::Geodesic& geodesic(
-      util::GeographicLib::DefaultGeodesic());
+   auto radarProductManager = self_->radar_product_manager();
+   auto radarSite           = radarProductManager->radar_site();
 
-   auto         radarProductManager = self_->radar_product_manager();
-   auto         radarSite           = radarProductManager->radar_site();
-   const float  gateSize            = radarProductManager->gate_size();
-   const double radarLatitude       = radarSite->latitude();
-   const double radarLongitude      = radarSite->longitude();
+   SweepParameters parameters {};
+   parameters.radarLatitude_    = radarSite->latitude();
+   parameters.radarLongitude_   = radarSite->longitude();
+   parameters.gateSize_         = radarProductManager->gate_size();
+   parameters.smoothingEnabled_ = smoothingEnabled;
+   parameters.cancelled_        = cancelled;
 
    // Calculate azimuth coordinates
    timer.start();
 
-   const std::uint16_t numRadials   = radialData->number_of_radials();
-   const std::uint16_t numRangeBins = radialData->number_of_range_bins();
-
-   auto radials = boost::irange<std::uint32_t>(0u, numRadials);
-   auto gates   = boost::irange<std::uint32_t>(0u, numRangeBins);
-
-   const float gateRangeOffset = (smoothingEnabled) ?
-                                    // Center of the first gate is half the gate
-                                    // size distance from the radar site
-                                    0.5f :
-                                    // Far end of the first gate is the gate
-                                    // size distance from the radar site
-                                    1.0f;
-
-   std::for_each(
-      std::execution::par_unseq,
-      radials.begin(),
-      radials.end(),
-      [&](std::uint32_t radial)
-      {
-         float angle = radialData->start_angle(radial);
+   ComputeLevel3RadialCoordinates(*radialData, parameters, coordinates_);
 
-         if (smoothingEnabled)
-         {
-            static constexpr float kDeltaAngleFactor = 0.5f;
-            angle += radialData->delta_angle(radial) * kDeltaAngleFactor;
-         }
-
-         std::for_each(
-            std::execution::par_unseq,
-            gates.begin(),
-            gates.end(),
-            [&](std::uint32_t gate)
-            {
-               const std::uint32_t radialGate =
-                  radial * common::MAX_DATA_MOMENT_GATES + gate;
-               const float range =
-                  (static_cast<float>(gate) + gateRangeOffset) * gateSize;
-               const std::size_t offset = static_cast<size_t>(radialGate) * 2;
-
-               double latitude  = 0.0;
-               double longitude = 0.0;
-
-               geodesic.Direct(radarLatitude,
-                               radarLongitude,
-                               angle,
-                               range,
-                               latitude,
-                               longitude);
-
-               coordinates_[offset]     = static_cast<float>(latitude);
-               coordinates_[offset + 1] = static_cast<float>(longitude);
-            });
-      });
    timer.stop();
    logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
 }
@@ -625,41 +464,27 @@ Level3RadialView::GetBinLevel(const common::Coordinate& coordinate) const
       return std::nullopt;
    }
 
-   auto         radarProductManager = radar_product_manager();
-   auto         radarSite           = radarProductManager->radar_site();
-   const double radarLatitude       = radarSite->latitude();
-   const double radarLongitude      = radarSite->longitude();
-
-   // Determine distance and azimuth of coordinate relative to radar location
-   double s12;  // Distance (meters)
-   double azi1; // Azimuth (degrees)
-   double azi2; // Unused
-   util::GeographicLib::DefaultGeodesic().Inverse(radarLatitude,
-                                                  radarLongitude,
-                                                  coordinate.latitude_,
-                                                  coordinate.longitude_,
-                                                  s12,
-                                                  azi1,
-                                                  azi2);
-
-   if (std::isnan(azi1))
+   std::shared_ptr<const SweepBinLookup> binLookup = p->binLookup_;
+   if (binLookup == nullptr)
    {
-      // If a problem occurred with the geodesic inverse calculation
       return std::nullopt;
    }
 
-   // Azimuth is returned as [-180, 180) from the geodesic inverse, we need a
-   // range of [0, 360)
-   while (azi1 < 0.0)
+   // Determine radial and distance of coordinate relative to radar location
+   const std::optional<SweepBin> bin =
+      FindSweepBin(*binLookup, coordinate.latitude_, coordinate.longitude_);
+
+   if (!bin.has_value() || bin->radial_ >= radialData->number_of_radials())
    {
-      azi1 += 360.0;
+      // No radial was found (not likely to happen without a gap in data)
+      return std::nullopt;
    }
 
    // Compute gate interval
    const std::uint16_t gates = radialData->number_of_range_bins();
    const std::uint16_t dataMomentInterval =
       descriptionBlock->x_resolution_raw();
-   std::uint16_t gate = s12 / dataMomentInterval;
+   std::uint16_t gate = bin->range_ / dataMomentInterval;
 
    if (gate >= gates)
    {
@@ -667,48 +492,9 @@ Level3RadialView::GetBinLevel(const common::Coordinate& coordinate) const
       return std::nullopt;
    }
 
-   // Find Radial
-   const std::uint16_t numRadials = radialData->number_of_radials();
-   auto                radials = boost::irange<std::uint32_t>(0u, numRadials);
-
-   auto radial = std::find_if( //
-      std::execution::par_unseq,
-      radials.begin(),
-      radials.end(),
-      [&](std::uint32_t i)
-      {
-         bool   found      = false;
-         double startAngle = radialData->start_angle(i);
-         double nextAngle  = radialData->start_angle((i + 1) % numRadials);
-
-         if (startAngle < nextAngle)
-         {
-            if (startAngle <= azi1 && azi1 < nextAngle)
-            {
-               found = true;
-            }
-         }
-         else
-         {
-            // If the bin crosses 0/360 degrees, special handling is needed
-            if (startAngle <= azi1 || azi1 < nextAngle)
-            {
-               found = true;
-            }
-         }
-
-         return found;
-      });
-
-   if (radial == radials.end())
-   {
-      // No radial was found (not likely to happen without a gap in data)
-      return std::nullopt;
-   }
-
    // Compute threshold at which to display an individual bin
    const std::uint16_t snrThreshold = descriptionBlock->threshold();
-   const std::uint8_t  level        = radialData->level(*radial).at(gate);
+   const std::uint8_t  level        = radialData->level(bin->radial_).at(gate);
 
    if (level < snrThreshold && level != RANGE_FOLDED)
    {
@@ -1,4 +1,5 @@
 #include <scwx/qt/view/level3_raster_view.hpp>
+#include <scwx/qt/view/sweep_geometry.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/util/logger.hpp>
@@ -20,10 +21,6 @@ namespace view
 static const std::string logPrefix_ = "scwx::qt::view::level3_raster_view";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
-static constexpr uint16_t RANGE_FOLDED      = 1u;
-static constexpr uint32_t VERTICES_PER_BIN  = 6u;
-static constexpr uint32_t VALUES_PER_VERTEX = 2u;
-
 class Level3RasterViewImpl
 {
 public:
@@ -31,16 +28,12 @@ public:
        latitude_ {}, longitude_ {}, range_ {}, vcp_ {}, sweepTime_ {}
    {
    }
-   ~Level3RasterViewImpl() { threadPool_.join(); };
-
-   [[nodiscard]] inline std::uint8_t
-   RemapDataMoment(std::uint8_t dataMoment) const;
+   ~Level3RasterViewImpl() { taskQueue_.join(); };
 
-   boost::asio::thread_pool threadPool_ {1u};
+   scwx::util::TaskQueue taskQueue_ {scwx::util::TaskPriority::Interactive};
 
-   std::vector<float>        vertices_ {};
-   std::vector<std::uint8_t> dataMoments8_ {};
-   std::uint8_t              edgeValue_ {};
+   SweepGeometry geometry_ {};
+   std::uint8_t  edgeValue_ {};
 
    bool showSmoothedRangeFolding_ {false};
 
@@ -69,9 +62,9 @@ Level3RasterView::~Level3RasterView()
    std::unique_lock sweepLock {sweep_mutex()};
 }
 
-boost::asio::thread_pool& Level3RasterView::thread_pool()
+scwx::util::TaskQueue& Level3RasterView::task_queue()
 {
-   return p->threadPool_;
+   return p->taskQueue_;
 }
 
 float Level3RasterView::range() const
@@ -91,7 +84,12 @@ uint16_t Level3RasterView::vcp() const
 
 const std::vector<float>& Level3RasterView::vertices() const
 {
-   return p->vertices_;
+   return p->geometry_.vertices_;
+}
+
+const std::vector<SweepLevel>* Level3RasterView::sweep_levels() const
+{
+   return &p->geometry_.levels_;
 }
 
 std::tuple<const void*, size_t, size_t> Level3RasterView::GetMomentData() const
@@ -100,8 +98,8 @@ std::tuple<const void*, size_t, size_t> Level3RasterView::GetMomentData() const
    size_t      dataSize;
    size_t      componentSize;
 
-   data          = p->dataMoments8_.data();
-   dataSize      = p->dataMoments8_.size() * sizeof(uint8_t);
+   data          = p->geometry_.dataMoments8_.data();
+   dataSize      = p->geometry_.dataMoments8_.size() * sizeof(uint8_t);
    componentSize = 1;
 
    return std::tie(data, dataSize, componentSize);
@@ -113,6 +111,8 @@ void Level3RasterView::ComputeSweep()
 
    boost::timer::cpu_timer timer;
 
+   const std::function<bool()> cancelled = sweep_cancelled();
+
    std::scoped_lock sweepLock(sweep_mutex());
 
    std::shared_ptr<manager::RadarProductManager> radarProductManager =
@@ -141,6 +141,13 @@ void Level3RasterView::ComputeSweep()
       return;
    }
 
+   // Loading may have taken long enough for the sweep to be superseded
+   if (cancelled())
+   {
+      logger_->debug("Sweep superseded");
+      return;
+   }
+
    // A message with radial data should be a Graphic Product Message
    std::shared_ptr<wsr88d::rpg::GraphicProductMessage> gpm =
       std::dynamic_pointer_cast<wsr88d::rpg::GraphicProductMessage>(message);
@@ -159,10 +166,6 @@ void Level3RasterView::ComputeSweep()
       Q_EMIT SweepNotComputed(types::NoUpdateReason::NoChange);
       return;
    }
-   set_graphic_product_message(gpm);
-
-   p->lastShowSmoothedRangeFolding_ = showSmoothedRangeFolding;
-   p->lastSmoothingEnabled_         = smoothingEnabled;
 
    // A message with radial data should have a Product Description Block and
    // Product Symbology Block
@@ -220,15 +223,8 @@ void Level3RasterView::ComputeSweep()
       return;
    }
 
-   p->lastRasterData_ = rasterData;
-
    // Calculate raster grid size
-   const uint16_t rows       = rasterData->number_of_rows();
-   size_t         maxColumns = 0;
-   for (uint16_t r = 0; r < rows; r++)
-   {
-      maxColumns = std::max<size_t>(maxColumns, rasterData->level(r).size());
-   }
+   const size_t maxColumns = GetLevel3RasterColumns(*rasterData);
 
    if (maxColumns == 0)
    {
@@ -237,65 +233,37 @@ void Level3RasterView::ComputeSweep()
       return;
    }
 
-   p->latitude_  = descriptionBlock->latitude_of_radar();
-   p->longitude_ = descriptionBlock->longitude_of_radar();
-   p->range_     = descriptionBlock->range();
-   p->sweepTime_ =
-      scwx::util::TimePoint(descriptionBlock->volume_scan_date(),
-                            descriptionBlock->volume_scan_start_time() * 1000);
-   p->vcp_ = descriptionBlock->volume_coverage_pattern();
+   SweepParameters parameters {};
+   parameters.radarLatitude_  = descriptionBlock->latitude_of_radar();
+   parameters.radarLongitude_ = descriptionBlock->longitude_of_radar();
 
-   const GeographicLib::Geodesic& geodesic =
-      util::GeographicLib::DefaultGeodesic();
+   parameters.smoothingEnabled_         = smoothingEnabled;
+   parameters.showSmoothedRangeFolding_ = showSmoothedRangeFolding;
+   parameters.edgeValue_                = p->edgeValue_;
+   parameters.cancelled_                = cancelled;
 
-   const std::uint16_t xResolution = descriptionBlock->x_resolution_raw();
-   const std::uint16_t yResolution = descriptionBlock->y_resolution_raw();
-   const double        iCoordinate =
-      (-rasterData->i_coordinate_start() - 1.0 - p->range_) * 1000.0;
-   const double jCoordinate =
-      (rasterData->j_coordinate_start() + 1.0 + p->range_) * 1000.0;
-   const double xOffset = (smoothingEnabled) ? xResolution * 0.5 : 0.0;
-   const double yOffset = (smoothingEnabled) ? yResolution * 0.5 : 0.0;
+   if (smoothingEnabled)
+   {
+      // For most products other than reflectivity, the edge should not go to
+      // the bottom of the color table
+      parameters.edgeValue_ = ComputeEdgeValue(*descriptionBlock);
+   }
 
-   const std::size_t numCoordinates =
-      static_cast<size_t>(rows + 1) * static_cast<size_t>(maxColumns + 1);
-   const auto coordinateRange =
-      boost::irange<uint32_t>(0, static_cast<uint32_t>(numCoordinates));
+   // Compute threshold at which to display an individual bin
+   parameters.snrThreshold_ = descriptionBlock->threshold();
 
    std::vector<float> coordinates;
-   coordinates.resize(numCoordinates * 2);
 
    // Calculate coordinates
    timer.start();
 
-   std::for_each(
-      std::execution::par_unseq,
-      coordinateRange.begin(),
-      coordinateRange.end(),
-      [&](uint32_t index)
-      {
-         // For each row or column, there is one additional coordinate. Each bin
-         // is bounded by 4 coordinates.
-         const uint32_t col = index % (rows + 1);
-         const uint32_t row = index / (rows + 1);
-
-         const double i = iCoordinate + xResolution * col + xOffset;
-         const double j = jCoordinate - yResolution * row - yOffset;
-
-         // Calculate polar coordinates based on i and j
-         const double angle  = std::atan2(i, j) * 180.0 / M_PI;
-         const double range  = std::sqrt(i * i + j * j);
-         const size_t offset = static_cast<size_t>(index) * 2;
-
-         double latitude;
-         double longitude;
-
-         geodesic.Direct(
-            p->latitude_, p->longitude_, angle, range, latitude, longitude);
-
-         coordinates[offset]     = latitude;
-         coordinates[offset + 1] = longitude;
-      });
+   ComputeLevel3RasterCoordinates(*rasterData,
+                                  parameters,
+                                  descriptionBlock->x_resolution_raw(),
+                                  descriptionBlock->y_resolution_raw(),
+                                  descriptionBlock->range(),
+                                  maxColumns,
+                                  coordinates);
 
    timer.stop();
    logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
@@ -303,130 +271,40 @@ void Level3RasterView::ComputeSweep()
    // Calculate vertices
    timer.start();
 
-   // Setup vertex vector
-   std::vector<float>& vertices = p->vertices_;
-   size_t              vIndex   = 0;
-   vertices.clear();
-   vertices.resize(rows * maxColumns * VERTICES_PER_BIN * VALUES_PER_VERTEX);
-
-   // Setup data moment vector
-   std::vector<uint8_t>& dataMoments8 = p->dataMoments8_;
-   size_t                mIndex       = 0;
+   // The sweep is computed separately, and is abandoned if superseded
+   SweepGeometry geometry {};
 
-   dataMoments8.resize(rows * maxColumns * VERTICES_PER_BIN);
+   ComputeLevel3RasterSweep(
+      *rasterData, parameters, coordinates, maxColumns, geometry);
 
-   // Compute threshold at which to display an individual bin
-   const uint16_t snrThreshold = descriptionBlock->threshold();
-
-   const std::size_t rowCount = (smoothingEnabled) ?
-                                   rasterData->number_of_rows() - 1 :
-                                   rasterData->number_of_rows();
-
-   if (smoothingEnabled)
+   if (IsSweepCancelled(parameters))
    {
-      // For most products other than reflectivity, the edge should not go to
-      // the bottom of the color table
-      p->edgeValue_ = ComputeEdgeValue();
+      // The previous sweep, and the message it was computed from, remain
+      // displayed
+      logger_->debug("Sweep superseded");
+      return;
    }
 
-   for (std::size_t row = 0; row < rowCount; ++row)
-   {
-      const std::size_t nextRow =
-         (row == static_cast<std::size_t>(rasterData->number_of_rows() - 1)) ?
-            0 :
-            row + 1;
-
-      const auto& dataMomentsArray8 =
-         rasterData->level(static_cast<uint16_t>(row));
-      const auto& nextDataMomentsArray8 =
-         rasterData->level(static_cast<uint16_t>(nextRow));
-
-      for (size_t bin = 0; bin < dataMomentsArray8.size(); ++bin)
-      {
-         if (!smoothingEnabled)
-         {
-            static constexpr std::size_t vertexCount = 6;
-
-            // Store data moment value
-            const std::uint8_t& dataValue = dataMomentsArray8[bin];
-            if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
-            {
-               continue;
-            }
-
-            for (size_t m = 0; m < vertexCount; m++)
-            {
-               dataMoments8[mIndex++] = dataValue;
-            }
-         }
-         else
-         {
-            // Validate indices are all in range
-            if (bin + 1 >= dataMomentsArray8.size() ||
-                bin + 1 >= nextDataMomentsArray8.size())
-            {
-               continue;
-            }
-
-            const std::uint8_t& dm1 = dataMomentsArray8[bin];
-            const std::uint8_t& dm2 = dataMomentsArray8[bin + 1];
-            const std::uint8_t& dm3 = nextDataMomentsArray8[bin];
-            const std::uint8_t& dm4 = nextDataMomentsArray8[bin + 1];
-
-            if ((!showSmoothedRangeFolding && //
-                 (dm1 < snrThreshold || dm1 == RANGE_FOLDED) &&
-                 (dm2 < snrThreshold || dm2 == RANGE_FOLDED) &&
-                 (dm3 < snrThreshold || dm3 == RANGE_FOLDED) &&
-                 (dm4 < snrThreshold || dm4 == RANGE_FOLDED)) ||
-                (showSmoothedRangeFolding && //
-                 dm1 < snrThreshold && dm1 != RANGE_FOLDED &&
-                 dm2 < snrThreshold && dm2 != RANGE_FOLDED &&
-                 dm3 < snrThreshold && dm3 != RANGE_FOLDED &&
-                 dm4 < snrThreshold && dm4 != RANGE_FOLDED))
-            {
-               // Skip only if all data moments are hidden
-               continue;
-            }
-
-            // The order must match the store vertices section below
-            dataMoments8[mIndex++] = p->RemapDataMoment(dm1);
-            dataMoments8[mIndex++] = p->RemapDataMoment(dm2);
-            dataMoments8[mIndex++] = p->RemapDataMoment(dm4);
-            dataMoments8[mIndex++] = p->RemapDataMoment(dm1);
-            dataMoments8[mIndex++] = p->RemapDataMoment(dm3);
-            dataMoments8[mIndex++] = p->RemapDataMoment(dm4);
-         }
-
-         // Store vertices
-         size_t offset1 = (row * (maxColumns + 1) + bin) * 2;
-         size_t offset2 = offset1 + 2;
-         size_t offset3 = ((row + 1) * (maxColumns + 1) + bin) * 2;
-         size_t offset4 = offset3 + 2;
-
-         vertices[vIndex++] = coordinates[offset1];
-         vertices[vIndex++] = coordinates[offset1 + 1];
-
-         vertices[vIndex++] = coordinates[offset2];
-         vertices[vIndex++] = coordinates[offset2 + 1];
-
-         vertices[vIndex++] = coordinates[offset4];
-         vertices[vIndex++] = coordinates[offset4 + 1];
+   // The message is committed with its sweep, so that a superseded sweep
+   // leaves the displayed message unchanged
+   set_graphic_product_message(gpm);
 
-         vertices[vIndex++] = coordinates[offset1];
-         vertices[vIndex++] = coordinates[offset1 + 1];
+   p->lastShowSmoothedRangeFolding_ = showSmoothedRangeFolding;
+   p->lastSmoothingEnabled_         = smoothingEnabled;
 
-         vertices[vIndex++] = coordinates[offset3];
-         vertices[vIndex++] = coordinates[offset3 + 1];
+   ComputeSweepSectors(coordinates, nullptr, geometry);
+   p->geometry_  = std::move(geometry);
+   p->edgeValue_ = parameters.edgeValue_;
 
-         vertices[vIndex++] = coordinates[offset4];
-         vertices[vIndex++] = coordinates[offset4 + 1];
-      }
-   }
-   vertices.resize(vIndex);
-   vertices.shrink_to_fit();
+   p->lastRasterData_ = rasterData;
 
-   dataMoments8.resize(mIndex);
-   dataMoments8.shrink_to_fit();
+   p->latitude_  = descriptionBlock->latitude_of_radar();
+   p->longitude_ = descriptionBlock->longitude_of_radar();
+   p->range_     = descriptionBlock->range();
+   p->sweepTime_ =
+      scwx::util::TimePoint(descriptionBlock->volume_scan_date(),
+                            descriptionBlock->volume_scan_start_time() * 1000);
+   p->vcp_ = descriptionBlock->volume_coverage_pattern();
 
    timer.stop();
    logger_->debug("Vertices calculated in {}", timer.format(6, "%ws"));
@@ -436,20 +314,6 @@ void Level3RasterView::ComputeSweep()
    Q_EMIT SweepComputed();
 }
 
-std::uint8_t
-Level3RasterViewImpl::RemapDataMoment(std::uint8_t dataMoment) const
-{
-   if (dataMoment != 0 &&
-       (dataMoment != RANGE_FOLDED || showSmoothedRangeFolding_))
-   {
-      return dataMoment;
-   }
-   else
-   {
-      return edgeValue_;
-   }
-}
-
 std::optional<std::uint16_t>
 Level3RasterView::GetBinLevel(const common::Coordinate& coordinate) const
 {
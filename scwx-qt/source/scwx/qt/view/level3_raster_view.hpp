@@ -29,6 +29,7 @@ public:
    std::chrono::system_clock::time_point sweep_time() const override;
    std::uint16_t                         vcp() const override;
    const std::vector<float>&             vertices() const override;
+   const std::vector<SweepLevel>*        sweep_levels() const override;
 
    std::tuple<const void*, std::size_t, std::size_t>
    GetMomentData() const override;
@@ -41,7 +42,7 @@ public:
           std::shared_ptr<manager::RadarProductManager> radarProductManager);
 
 protected:
-   boost::asio::thread_pool& thread_pool() override;
+   scwx::util::TaskQueue& task_queue() override;
 
 protected slots:
    void ComputeSweep() override;
@@ -1,6 +1,7 @@
 #include <scwx/qt/view/overlay_product_view.hpp>
 #include <scwx/qt/manager/radar_product_manager.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/scheduler.hpp>
 #include <scwx/util/time.hpp>
 
 #include <mutex>
@@ -24,7 +25,7 @@ class OverlayProductView::Impl
 {
 public:
    explicit Impl(OverlayProductView* self) : self_ {self} {}
-   ~Impl() { threadPool_.join(); }
+   ~Impl() { taskQueue_.join(); }
 
    void ConnectRadarProductManager();
    void DisconnectRadarProductManager();
@@ -38,7 +39,7 @@ public:
    OverlayProductView* self_;
    boost::uuids::uuid  uuid_ {boost::uuids::random_generator()()};
 
-   boost::asio::thread_pool threadPool_ {1u};
+   scwx::util::TaskQueue taskQueue_ {scwx::util::TaskPriority::Decode};
 
    bool autoRefreshEnabled_ {false};
    bool autoUpdateEnabled_ {false};
@@ -237,7 +238,7 @@ void OverlayProductView::Impl::LoadProduct(
    }
 
    // Load file
-   boost::asio::post(threadPool_,
+   boost::asio::post(taskQueue_.get_executor(),
                      [=, this]()
                      {
                         try
@@ -3,6 +3,8 @@
 #include <scwx/common/constants.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <atomic>
+
 #include <boost/asio.hpp>
 #include <boost/range/irange.hpp>
 #include <boost/timer/timer.hpp>
@@ -44,26 +46,53 @@ public:
             showSmoothedRangeFolding_ = settings::ProductSettings::Instance()
                                            .show_smoothed_range_folding()
                                            .GetValue();
+            gpuProjectionEnabled_ = settings::ProductSettings::Instance()
+                                       .gpu_projection_enabled()
+                                       .GetValue();
+            animationCacheSize_ = GetAnimationCacheSize();
             self_->Update();
          });
+      gpuProjectionEnabled_ =
+         productSettings.gpu_projection_enabled().GetValue();
+      animationCacheSize_ = GetAnimationCacheSize();
       ;
    }
    ~RadarProductViewImpl() {}
 
+   static std::size_t GetAnimationCacheSize();
+
    RadarProductView* self_;
 
    bool       initialized_;
    std::mutex sweepMutex_;
 
    std::chrono::system_clock::time_point selectedTime_;
+   bool                                  gpuProjectionEnabled_ {false};
    bool                                  showSmoothedRangeFolding_ {false};
    bool                                  smoothingEnabled_ {false};
 
+   std::atomic<std::size_t> animationCacheSize_ {0u};
+
+   // Each update supersedes the sweeps of previous generations
+   std::atomic<std::size_t> sweepGeneration_ {0u};
+   std::atomic<bool>        sweepPending_ {false};
+
    std::shared_ptr<manager::RadarProductManager> radarProductManager_;
 
    boost::signals2::scoped_connection connection_;
 };
 
+std::size_t RadarProductViewImpl::GetAnimationCacheSize()
+{
+   static constexpr std::size_t kBytesPerMegabyte = 1024u * 1024u;
+
+   // The animation cache size setting is in megabytes
+   return static_cast<std::size_t>(settings::ProductSettings::Instance()
+                                      .animation_cache_size()
+                                      .GetValue()) *
+          kBytesPerMegabyte;
+}
+
 RadarProductView::RadarProductView(
    std::shared_ptr<manager::RadarProductManager> radarProductManager) :
     p(std::make_unique<RadarProductViewImpl>(this, radarProductManager)) {};
@@ -90,6 +119,31 @@ float RadarProductView::elevation() const
    return 0.0f;
 }
 
+const PolarSweepGeometry* RadarProductView::polar_geometry() const
+{
+   return nullptr;
+}
+
+const std::vector<std::uint32_t>* RadarProductView::vertex_indices() const
+{
+   return nullptr;
+}
+
+const std::vector<SweepLevel>* RadarProductView::sweep_levels() const
+{
+   return nullptr;
+}
+
+std::shared_ptr<const void> RadarProductView::cached_sweep() const
+{
+   return nullptr;
+}
+
+std::size_t RadarProductView::animation_cache_size() const
+{
+   return p->animationCacheSize_;
+}
+
 std::shared_ptr<manager::RadarProductManager>
 RadarProductView::radar_product_manager() const
 {
@@ -106,6 +160,11 @@ std::chrono::system_clock::time_point RadarProductView::selected_time() const
    return p->selectedTime_;
 }
 
+bool RadarProductView::gpu_projection_enabled() const
+{
+   return p->gpuProjectionEnabled_;
+}
+
 bool RadarProductView::show_smoothed_range_folding() const
 {
    return p->showSmoothedRangeFolding_;
@@ -126,6 +185,12 @@ std::mutex& RadarProductView::sweep_mutex()
    return p->sweepMutex_;
 }
 
+std::function<bool()> RadarProductView::sweep_cancelled() const
+{
+   const std::size_t generation = p->sweepGeneration_;
+   return [this, generation]() { return p->sweepGeneration_ != generation; };
+}
+
 void RadarProductView::set_radar_product_manager(
    std::shared_ptr<manager::RadarProductManager> radarProductManager)
 {
@@ -153,11 +218,28 @@ void RadarProductView::SelectTime(std::chrono::system_clock::time_point time)
    p->selectedTime_ = time;
 }
 
+void RadarProductView::CacheSweeps(
+   std::chrono::system_clock::time_point /*startTime*/,
+   std::chrono::system_clock::time_point /*endTime*/)
+{
+}
+
 void RadarProductView::Update()
 {
-   boost::asio::post(thread_pool(),
+   // Supersede the sweep being computed
+   ++p->sweepGeneration_;
+
+   // A pending computation has not started, and will compute the latest sweep
+   if (p->sweepPending_.exchange(true))
+   {
+      return;
+   }
+
+   boost::asio::post(task_queue().get_executor(),
                      [this]()
                      {
+                        p->sweepPending_ = false;
+
                         try
                         {
                            ComputeSweep();
@@ -5,16 +5,17 @@
 #include <scwx/common/products.hpp>
 #include <scwx/qt/manager/radar_product_manager.hpp>
 #include <scwx/qt/types/map_types.hpp>
+#include <scwx/util/scheduler.hpp>
 #include <scwx/wsr88d/wsr88d_types.hpp>
 
 #include <chrono>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <vector>
 
 #include <QObject>
-#include <boost/asio/thread_pool.hpp>
 
 namespace scwx
 {
@@ -24,6 +25,8 @@ namespace view
 {
 
 class RadarProductViewImpl;
+struct PolarSweepGeometry;
+struct SweepLevel;
 
 class RadarProductView : public QObject
 {
@@ -47,9 +50,44 @@ public:
    virtual std::uint16_t                         vcp() const        = 0;
    virtual const std::vector<float>&             vertices() const   = 0;
 
+   /**
+    * Gets the polar sweep geometry, when the sweep was computed for projection
+    * on the GPU. Otherwise, the sweep is drawn from vertices().
+    */
+   virtual const PolarSweepGeometry* polar_geometry() const;
+
+   /**
+    * Gets the vertex indices of each gate, when the sweep was computed in the
+    * indexed layout. Vertices are shared between gates, and each vertex has a
+    * corresponding data moment.
+    */
+   virtual const std::vector<std::uint32_t>* vertex_indices() const;
+
+   /**
+    * Gets the levels of detail of the sweep, beginning with the full
+    * resolution sweep. Decimated levels are stored after the full resolution
+    * sweep, in the same buffers. Each level is divided into sectors, which are
+    * not drawn outside of the viewport. Returns nullptr when the sweep has a
+    * single level without sectors.
+    */
+   virtual const std::vector<SweepLevel>* sweep_levels() const;
+
+   /**
+    * Gets the computed sweep when it is retained by the animation cache. The
+    * sweep is immutable while it is referenced, and identifies buffers which
+    * may remain resident while animating. Otherwise, returns nullptr.
+    */
+   virtual std::shared_ptr<const void> cached_sweep() const;
+
+   /**
+    * Gets the animation cache budget in bytes. Sweeps cached by all views
+    * share one budget, as do the buffers of cached sweeps of all layers.
+    */
+   [[nodiscard]] std::size_t animation_cache_size() const;
    [[nodiscard]] std::shared_ptr<manager::RadarProductManager>
    radar_product_manager() const;
    [[nodiscard]] std::chrono::system_clock::time_point selected_time() const;
+   [[nodiscard]] bool        gpu_projection_enabled() const;
    [[nodiscard]] bool        show_smoothed_range_folding() const;
    [[nodiscard]] bool        smoothing_enabled() const;
    [[nodiscard]] std::mutex& sweep_mutex();
@@ -64,7 +102,20 @@ public:
    virtual void SelectElevation(float elevation);
    virtual void SelectProduct(const std::string& productName) = 0;
    void         SelectTime(std::chrono::system_clock::time_point time);
-   void         Update();
+
+   /**
+    * Computes the sweep in the background. The sweep being computed is
+    * superseded, and updates requested before the sweep is computed are
+    * coalesced into a single computation.
+    */
+   void Update();
+
+   /**
+    * Computes the sweeps of each volume scan from the start time through the
+    * end time in the background, retaining them in the animation cache.
+    */
+   virtual void CacheSweeps(std::chrono::system_clock::time_point startTime,
+                            std::chrono::system_clock::time_point endTime);
 
    bool IsInitialized() const;
 
@@ -87,7 +138,14 @@ public:
    GetDescriptionFields() const;
 
 protected:
-   virtual boost::asio::thread_pool& thread_pool() = 0;
+   virtual scwx::util::TaskQueue& task_queue() = 0;
+
+   /**
+    * Gets a function returning true once the sweep being computed has been
+    * superseded by a later update, and may be abandoned. Must be called as
+    * the sweep computation begins.
+    */
+   [[nodiscard]] std::function<bool()> sweep_cancelled() const;
 
    virtual void ConnectRadarProductManager()    = 0;
    virtual void DisconnectRadarProductManager() = 0;
@@ -0,0 +1,3390 @@
+#include <scwx/qt/view/sweep_geometry.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/common/constants.hpp>
+#include <scwx/common/geographic.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <execution>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <optional>
+
+#include <boost/container_hash/hash.hpp>
+#include <boost/range/irange.hpp>
+#include <units/angle.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+static const std::string logPrefix_ = "scwx::qt::view::sweep_geometry";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+static constexpr std::uint8_t kDataWordSize8_ = 8u;
+
+static constexpr std::size_t kVerticesPerGate_       = 6u;
+static constexpr std::size_t kVerticesPerOriginGate_ = 3u;
+static constexpr std::size_t kCornersPerCell_        = 4u;
+static constexpr std::size_t kEdgesPerCell_          = 4u;
+static constexpr std::size_t kProvokingCorner_       = 3u;
+
+// The radar site follows the Level 2 radial coordinates
+static constexpr std::size_t kLevel2SiteCoordinate_ =
+   static_cast<std::size_t>(common::MAX_0_5_DEGREE_RADIALS) *
+   common::MAX_DATA_MOMENT_GATES;
+static constexpr std::size_t kLevel2Coordinates_ = kLevel2SiteCoordinate_ + 1u;
+
+// Radial edge azimuths in a coordinate key are quantized to 0.001 degrees,
+// which is less than 10 meters at the maximum range
+static constexpr float        kCoordinateKeyAzimuthScale_ = 1000.0f;
+static constexpr std::int32_t kCoordinateKeyNoAzimuth_ =
+   std::numeric_limits<std::int32_t>::min();
+
+// Decimated levels of detail merge gates and radials into cells covering
+// approximately a range and an azimuth, independent of the native resolution
+struct LevelOfDetail
+{
+   float gateLength_;  ///< Range covered by each cell (meters)
+   float radialWidth_; ///< Azimuth covered by each cell (degrees)
+};
+
+static constexpr std::array<LevelOfDetail, 2> kLevelsOfDetail_ {
+   {{1000.0f, 1.0f}, {4000.0f, 2.0f}}};
+
+// Sectors cover this many gates, balancing the number of sectors tested each
+// frame against the area drawn outside of the viewport
+static constexpr std::size_t kGatesPerSector_ = 64u;
+
+// Bin lookup azimuth buckets are 0.01 degrees, narrower than any radial, so
+// that at most two radials cover each bucket
+static constexpr double        kBinLookupBucketsPerDegree_ = 100.0;
+static constexpr std::size_t   kBinLookupBuckets_          = 36000u;
+static constexpr std::size_t   kBinLookupRadialsPerBucket_ = 2u;
+static constexpr std::uint16_t kBinLookupNoRadial_ =
+   std::numeric_limits<std::uint16_t>::max();
+
+static constexpr std::uint16_t RANGE_FOLDED      = 1u;
+static constexpr std::uint32_t VERTICES_PER_BIN  = 6u;
+static constexpr std::uint32_t VALUES_PER_VERTEX = 2u;
+
+static units::degrees<float> NormalizeAngle(units::degrees<float> angle);
+
+template<typename T>
+[[nodiscard]] static inline T RemapDataMoment(const SweepParameters& parameters,
+                                              T dataMoment)
+{
+   if (dataMoment != 0 &&
+       (dataMoment != RANGE_FOLDED || parameters.showSmoothedRangeFolding_))
+   {
+      return dataMoment;
+   }
+   else
+   {
+      return static_cast<T>(parameters.edgeValue_);
+   }
+}
+
+/**
+ * Determines whether all four data moments surrounding a smoothed vertex are
+ * hidden.
+ */
+template<typename T>
+[[nodiscard]] static inline bool IsSmoothedDataHidden(
+   const SweepParameters& parameters, T dm1, T dm2, T dm3, T dm4)
+{
+   const std::uint16_t snrThreshold = parameters.snrThreshold_;
+
+   return (!parameters.showSmoothedRangeFolding_ && //
+           (dm1 < snrThreshold || dm1 == RANGE_FOLDED) &&
+           (dm2 < snrThreshold || dm2 == RANGE_FOLDED) &&
+           (dm3 < snrThreshold || dm3 == RANGE_FOLDED) &&
+           (dm4 < snrThreshold || dm4 == RANGE_FOLDED)) ||
+          (parameters.showSmoothedRangeFolding_ && //
+           dm1 < snrThreshold && dm1 != RANGE_FOLDED &&
+           dm2 < snrThreshold && dm2 != RANGE_FOLDED &&
+           dm3 < snrThreshold && dm3 != RANGE_FOLDED &&
+           dm4 < snrThreshold && dm4 != RANGE_FOLDED);
+}
+
+/**
+ * Stores the data moments at the near and far corners of a smoothed gate of the
+ * current radial in the indexed layout. Each radial stores the data moments of
+ * its own coordinates, including those of hidden gates, as the coordinates are
+ * shared with the previous radial.
+ */
+template<typename T>
+static inline void StoreRadialDataMoments(
+   const SweepParameters&                             parameters,
+   T                                                  dm1,
+   T                                                  dm2,
+   const std::array<std::uint32_t, kCornersPerCell_>& gateCoordinates,
+   std::vector<T>&                                    dataMoments)
+{
+   dataMoments[gateCoordinates[0]] = RemapDataMoment(parameters, dm1);
+   dataMoments[gateCoordinates[1]] = RemapDataMoment(parameters, dm2);
+}
+
+/**
+ * Stores the data moments at the corners of a smoothed gate. dm1 and dm2 are
+ * the near and far corners of the current radial, and dm3 and dm4 are the near
+ * and far corners of the next radial. In the indexed layout, the corners of the
+ * current radial are stored by StoreRadialDataMoments, and the corners of the
+ * next radial are only stored when storeNextRadial is set.
+ */
+template<typename T>
+static inline void StoreSmoothedDataMoments(
+   const SweepParameters&                             parameters,
+   T                                                  dm1,
+   T                                                  dm2,
+   T                                                  dm3,
+   T                                                  dm4,
+   const std::array<std::uint32_t, kCornersPerCell_>& gateCoordinates,
+   bool                                               storeNextRadial,
+   std::vector<T>&                                    dataMoments,
+   std::size_t&                                       mIndex)
+{
+   if (parameters.layout_ == SweepLayout::Indexed)
+   {
+      if (storeNextRadial)
+      {
+         dataMoments[gateCoordinates[2]] = RemapDataMoment(parameters, dm3);
+         dataMoments[gateCoordinates[3]] = RemapDataMoment(parameters, dm4);
+      }
+   }
+   else if (parameters.layout_ == SweepLayout::Polar)
+   {
+      // One data moment per corner, in polar cell edge order
+      dataMoments[mIndex++] = RemapDataMoment(parameters, dm1);
+      dataMoments[mIndex++] = RemapDataMoment(parameters, dm2);
+      dataMoments[mIndex++] = RemapDataMoment(parameters, dm3);
+      dataMoments[mIndex++] = RemapDataMoment(parameters, dm4);
+   }
+   else
+   {
+      // The order must match the store vertices section of the sweep
+      dataMoments[mIndex++] = RemapDataMoment(parameters, dm1);
+      dataMoments[mIndex++] = RemapDataMoment(parameters, dm2);
+      dataMoments[mIndex++] = RemapDataMoment(parameters, dm4);
+      dataMoments[mIndex++] = RemapDataMoment(parameters, dm1);
+      dataMoments[mIndex++] = RemapDataMoment(parameters, dm3);
+      dataMoments[mIndex++] = RemapDataMoment(parameters, dm4);
+   }
+}
+
+/**
+ * Gets the indices of the Level 2 coordinates at the corners of a gate, in the
+ * order of the data moments of a smoothed gate. The origin gate is a single
+ * triangle, from the radar site to the far corners of the gate.
+ */
+static inline std::array<std::uint32_t, kCornersPerCell_>
+GetLevel2GateCoordinates(std::size_t  radialCoordinate,
+                         std::size_t  nextRadialCoordinate,
+                         std::int32_t gate,
+                         std::int32_t gateSize)
+{
+   if (gate > 0)
+   {
+      const auto nearCoordinate =
+         static_cast<std::uint32_t>(radialCoordinate + gate - 1);
+      const auto nextNearCoordinate =
+         static_cast<std::uint32_t>(nextRadialCoordinate + gate - 1);
+
+      return {nearCoordinate,
+              nearCoordinate + static_cast<std::uint32_t>(gateSize),
+              nextNearCoordinate,
+              nextNearCoordinate + static_cast<std::uint32_t>(gateSize)};
+   }
+   else
+   {
+      return {static_cast<std::uint32_t>(kLevel2SiteCoordinate_),
+              static_cast<std::uint32_t>(radialCoordinate),
+              static_cast<std::uint32_t>(nextRadialCoordinate),
+              static_cast<std::uint32_t>(nextRadialCoordinate)};
+   }
+}
+
+/**
+ * Counts the output of radials [firstRadial, lastRadial) in parallel, and
+ * offsets each radial by the output of the preceding radials. The offset of
+ * lastRadial is the end of the output, and is returned.
+ *
+ * computeRadial(radial, offset, store) returns the output size of a radial,
+ * and only stores the output at the offset when store is set. Raster rows are
+ * computed in the same way. Radials counted after the sweep is cancelled have
+ * no output.
+ */
+template<typename ComputeRadial>
+static std::size_t ComputeRadialOffsets(const SweepParameters&    parameters,
+                                        std::size_t               firstRadial,
+                                        std::size_t               lastRadial,
+                                        std::size_t               firstOffset,
+                                        std::vector<std::size_t>& offsets,
+                                        const ComputeRadial&      computeRadial)
+{
+   const auto radialRange = boost::irange<std::size_t>(firstRadial, lastRadial);
+
+   offsets.resize(lastRadial + 1u);
+   offsets[lastRadial] = 0u;
+
+   // Counting may log or be cancelled, so is not vectorized
+   std::transform(std::execution::par,
+                  radialRange.begin(),
+                  radialRange.end(),
+                  offsets.begin() + firstRadial,
+                  [&](std::size_t radial) -> std::size_t
+                  {
+                     if (IsSweepCancelled(parameters))
+                     {
+                        return 0u;
+                     }
+                     return computeRadial(radial, 0u, false);
+                  });
+
+   std::exclusive_scan(offsets.begin() + firstRadial,
+                       offsets.end(),
+                       offsets.begin() + firstRadial,
+                       firstOffset);
+
+   return offsets[lastRadial];
+}
+
+/**
+ * Stores the output of radials [firstRadial, lastRadial) in parallel, at the
+ * offsets from ComputeRadialOffsets. Nothing is stored once the sweep is
+ * cancelled, as the offsets may be incomplete.
+ */
+template<typename ComputeRadial>
+static void StoreRadials(const SweepParameters&          parameters,
+                         std::size_t                     firstRadial,
+                         std::size_t                     lastRadial,
+                         const std::vector<std::size_t>& offsets,
+                         const ComputeRadial&            computeRadial)
+{
+   if (IsSweepCancelled(parameters))
+   {
+      return;
+   }
+
+   const auto radialRange = boost::irange<std::size_t>(firstRadial, lastRadial);
+
+   std::for_each(std::execution::par_unseq,
+                 radialRange.begin(),
+                 radialRange.end(),
+                 [&](std::size_t radial)
+                 { computeRadial(radial, offsets[radial], true); });
+}
+
+/**
+ * Stores the vertices of the two triangles of a gate, in the order of the data
+ * moments of a smoothed gate in the vertex layout. The origin gate is a single
+ * triangle, from the radar site to the far corners of the gate.
+ */
+static inline void
+StoreGateVertices(const SweepParameters&    parameters,
+                  const std::vector<float>& coordinates,
+                  std::size_t               radialCoordinate,
+                  std::size_t               nextRadialCoordinate,
+                  std::int32_t              gate,
+                  std::int32_t              gateSize,
+                  std::vector<float>&       vertices,
+                  std::size_t&              vIndex)
+{
+   if (gate > 0)
+   {
+      const std::size_t offset1 = (radialCoordinate + gate - 1) * 2;
+      const std::size_t offset2 =
+         offset1 + static_cast<std::size_t>(gateSize) * 2;
+      const std::size_t offset3 = (nextRadialCoordinate + gate - 1) * 2;
+      const std::size_t offset4 =
+         offset3 + static_cast<std::size_t>(gateSize) * 2;
+
+      vertices[vIndex++] = coordinates[offset1];
+      vertices[vIndex++] = coordinates[offset1 + 1];
+
+      vertices[vIndex++] = coordinates[offset2];
+      vertices[vIndex++] = coordinates[offset2 + 1];
+
+      vertices[vIndex++] = coordinates[offset4];
+      vertices[vIndex++] = coordinates[offset4 + 1];
+
+      vertices[vIndex++] = coordinates[offset1];
+      vertices[vIndex++] = coordinates[offset1 + 1];
+
+      vertices[vIndex++] = coordinates[offset3];
+      vertices[vIndex++] = coordinates[offset3 + 1];
+
+      vertices[vIndex++] = coordinates[offset4];
+      vertices[vIndex++] = coordinates[offset4 + 1];
+   }
+   else
+   {
+      const std::size_t offset1 = (radialCoordinate + gateSize - 1) * 2;
+      const std::size_t offset2 = (nextRadialCoordinate + gateSize - 1) * 2;
+
+      vertices[vIndex++] = static_cast<float>(parameters.radarLatitude_);
+      vertices[vIndex++] = static_cast<float>(parameters.radarLongitude_);
+
+      vertices[vIndex++] = coordinates[offset1];
+      vertices[vIndex++] = coordinates[offset1 + 1];
+
+      vertices[vIndex++] = coordinates[offset2];
+      vertices[vIndex++] = coordinates[offset2 + 1];
+   }
+}
+
+/**
+ * Gets the number of gates or radials merged into each cell of a level of
+ * detail. The factor is a multiple of the factor of the preceding level, so the
+ * cells of each level are nested within the cells of the next.
+ */
+static std::size_t
+GetMergeFactor(float length, float nativeLength, std::size_t previousFactor)
+{
+   const auto factor = static_cast<std::size_t>(
+      std::max<long>(1, std::lround(length / nativeLength)));
+
+   return std::max(previousFactor, factor / previousFactor * previousFactor);
+}
+
+/**
+ * Gets the number of gate and radial merge factors of each decimated level of
+ * detail. Levels which would not merge any more gates or radials than the
+ * preceding level are omitted.
+ */
+static std::vector<std::pair<std::size_t, std::size_t>>
+GetLevelsOfDetail(float nativeRadialWidth, float nativeGateLength)
+{
+   std::vector<std::pair<std::size_t, std::size_t>> strides {};
+
+   std::size_t radialStride = 1u;
+   std::size_t gateStride   = 1u;
+
+   for (const LevelOfDetail& levelOfDetail : kLevelsOfDetail_)
+   {
+      const std::size_t nextRadialStride = GetMergeFactor(
+         levelOfDetail.radialWidth_, nativeRadialWidth, radialStride);
+      const std::size_t nextGateStride = GetMergeFactor(
+         levelOfDetail.gateLength_, nativeGateLength, gateStride);
+
+      if (nextRadialStride != radialStride || nextGateStride != gateStride)
+      {
+         radialStride = nextRadialStride;
+         gateStride   = nextGateStride;
+         strides.emplace_back(radialStride, gateStride);
+      }
+   }
+
+   return strides;
+}
+
+/**
+ * Gets the size of the full resolution sweep, in indices, cells or vertices
+ * according to its layout.
+ */
+static std::size_t GetSweepSize(const SweepGeometry& geometry)
+{
+   switch (geometry.layout_)
+   {
+   case SweepLayout::Indexed:
+      return geometry.indices_.size();
+
+   case SweepLayout::Polar:
+      return geometry.polar_.cells_.size() / kEdgesPerCell_;
+
+   default:
+      return geometry.vertices_.size() / VALUES_PER_VERTEX;
+   }
+}
+
+static float GetGateRangeOffset(bool smoothingEnabled)
+{
+   return (smoothingEnabled) ?
+             // Center of the first gate is half the gate size distance from
+             // the radar site
+             0.5f :
+             // Far end of the first gate is the gate size distance from the
+             // radar site
+             1.0f;
+}
+
+/**
+ * Gets the number of Level 2 radial edges, including an extra radial edge when
+ * the elevation scan is incomplete.
+ */
+static std::uint16_t
+GetLevel2VertexRadials(const wsr88d::rda::PackedElevationScan& radarData)
+{
+   std::uint16_t numRadials =
+      static_cast<std::uint16_t>(radarData.radial_count());
+
+   // Add an extra radial when incomplete data exists
+   if (IsLevel2SweepIncomplete(radarData))
+   {
+      ++numRadials;
+   }
+
+   // Limit radials
+   return std::min<std::uint16_t>(numRadials, common::MAX_0_5_DEGREE_RADIALS);
+}
+
+/**
+ * Gate range of a Level 2 radial, in base gates. Data moment gates are drawn
+ * from startGate_ in steps of gateSize_, while within endGate_.
+ */
+struct Level2GateRange
+{
+   std::int32_t gateSize_ {};
+   std::int32_t startGate_ {};
+   std::int32_t endGate_ {};
+   std::int32_t numberOfDataMomentGates_ {};
+};
+
+/**
+ * Gets the gate range of a Level 2 radial.
+ */
+static Level2GateRange GetLevel2GateRange(
+   const SweepParameters&                                parameters,
+   const wsr88d::rda::PackedElevationScan::MomentRadial& momentRadial,
+   std::uint32_t                                         gates)
+{
+   Level2GateRange gateRange {};
+
+   // Compute gate interval
+   const std::int32_t dataMomentInterval =
+      momentRadial.dataMomentRangeSampleIntervalRaw;
+   const std::int32_t dataMomentIntervalH = dataMomentInterval / 2;
+   const std::int32_t dataMomentRange     = std::max<std::int32_t>(
+      momentRadial.dataMomentRangeRaw, dataMomentIntervalH);
+
+   // Compute gate size (number of base 250m gates per bin)
+   const std::int32_t gateSizeMeters =
+      static_cast<std::int32_t>(parameters.gateSize_);
+   gateRange.gateSize_ =
+      std::max<std::int32_t>(1, dataMomentInterval / gateSizeMeters);
+
+   // Compute gate range [startGate, endGate)
+   gateRange.startGate_ =
+      (dataMomentRange - dataMomentIntervalH) / gateSizeMeters;
+   gateRange.numberOfDataMomentGates_ =
+      std::min<std::int32_t>(momentRadial.numberOfDataMomentGates,
+                             static_cast<std::int32_t>(gates));
+   gateRange.endGate_ = std::min<std::int32_t>(
+      gateRange.startGate_ +
+         gateRange.numberOfDataMomentGates_ * gateRange.gateSize_,
+      static_cast<std::int32_t>(common::MAX_DATA_MOMENT_GATES));
+
+   if (parameters.smoothingEnabled_)
+   {
+      // If smoothing is enabled, the start gate is incremented by one, as we
+      // are skipping the radar site origin. The end gate is unaffected, as
+      // we need to draw one less data point.
+      ++gateRange.startGate_;
+   }
+
+   return gateRange;
+}
+
+/**
+ * Gets the radial following a Level 2 radial, skipping missing radials and
+ * wrapping around to the first radial.
+ */
+static std::size_t
+GetLevel2NextRadial(const wsr88d::rda::PackedElevationScan& radarData,
+                    std::size_t                             radial)
+{
+   const std::size_t radialCount = radarData.radial_count();
+
+   std::size_t nextRadial = radial + 1u;
+   while (nextRadial < radialCount && !radarData.has_radial(nextRadial))
+   {
+      ++nextRadial;
+   }
+   if (nextRadial >= radialCount)
+   {
+      nextRadial = 0u;
+   }
+
+   return nextRadial;
+}
+
+/**
+ * Gets the azimuth of the edge of a Level 2 radial, or the center of the radial
+ * when smoothing. Missing radial angles are extrapolated from the preceding
+ * radials.
+ */
+static std::optional<units::degrees<float>>
+GetLevel2RadialAngle(const wsr88d::rda::PackedElevationScan& radarData,
+                     std::uint32_t                           radial,
+                     std::uint32_t                           numRadials,
+                     bool                                    smoothingEnabled)
+{
+   const auto azimuthAngles = radarData.azimuth_angles();
+
+   units::degrees<float> angle {};
+
+   const bool hasRadial = radarData.has_radial(radial);
+   if (hasRadial && !smoothingEnabled)
+   {
+      angle = units::degrees<float> {azimuthAngles[radial]};
+   }
+   else
+   {
+      const std::uint32_t prevRadial1 =
+         (radial >= 1) ? radial - 1 : numRadials - (1 - radial);
+      const std::uint32_t prevRadial2 =
+         (radial >= 2) ? radial - 2 : numRadials - (2 - radial);
+      const bool hasPrevRadial1 = radarData.has_radial(prevRadial1);
+      const bool hasPrevRadial2 = radarData.has_radial(prevRadial2);
+
+      if (hasRadial && hasPrevRadial1 && smoothingEnabled)
+      {
+         const units::degrees<float> currentAngle {azimuthAngles[radial]};
+         const units::degrees<float> prevAngle {azimuthAngles[prevRadial1]};
+
+         // Calculate delta angle
+         const units::degrees<float> deltaAngle =
+            NormalizeAngle(currentAngle - prevAngle);
+
+         // Delta scale is half the delta angle to reach the center of the
+         // bin, because smoothing is enabled
+         constexpr float deltaScale = 0.5f;
+
+         angle = currentAngle + deltaAngle * deltaScale;
+      }
+      else if (hasRadial && smoothingEnabled)
+      {
+         const units::degrees<float> currentAngle {azimuthAngles[radial]};
+
+         // Assume a half degree delta if there aren't enough angles
+         // to determine a delta angle
+         constexpr units::degrees<float> deltaAngle {0.5f};
+
+         // Delta scale is half the delta angle to reach the center of the
+         // bin, because smoothing is enabled
+         constexpr float deltaScale = 0.5f;
+
+         angle = currentAngle + deltaAngle * deltaScale;
+      }
+      else if (hasPrevRadial1 && hasPrevRadial2)
+      {
+         const units::degrees<float> prevAngle1 {azimuthAngles[prevRadial1]};
+         const units::degrees<float> prevAngle2 {azimuthAngles[prevRadial2]};
+
+         // Calculate delta angle
+         const units::degrees<float> deltaAngle =
+            NormalizeAngle(prevAngle1 - prevAngle2);
+
+         const float deltaScale =
+            (smoothingEnabled) ?
+               // Delta scale is 1.5x the delta angle to reach the center
+               // of the next bin, because smoothing is enabled
+               1.5f :
+               // Delta scale is 1.0x the delta angle
+               1.0f;
+
+         angle = prevAngle1 + deltaAngle * deltaScale;
+      }
+      else if (hasPrevRadial1)
+      {
+         const units::degrees<float> prevAngle1 {azimuthAngles[prevRadial1]};
+
+         // Assume a half degree delta if there aren't enough angles
+         // to determine a delta angle
+         constexpr units::degrees<float> deltaAngle {0.5f};
+
+         const float deltaScale =
+            (smoothingEnabled) ?
+               // Delta scale is 1.5x the delta angle to reach the center
+               // of the next bin, because smoothing is enabled
+               1.5f :
+               // Delta scale is 1.0x the delta angle
+               1.0f;
+
+         angle = prevAngle1 + deltaAngle * deltaScale;
+      }
+      else
+      {
+         // Not enough angles present to determine an angle
+         return std::nullopt;
+      }
+   }
+
+   return angle;
+}
+
+/**
+ * Gets the earth-centered, earth-fixed coordinates of a point on the ellipsoid
+ * of a bin lookup.
+ */
+static std::array<double, 3> GetBinLookupPosition(const SweepBinLookup& lookup,
+                                                  double sinLatitude,
+                                                  double cosLatitude,
+                                                  double sinLongitude,
+                                                  double cosLongitude)
+{
+   const double primeVerticalRadius =
+      lookup.equatorialRadius_ /
+      std::sqrt(1.0 - lookup.eccentricity2_ * sinLatitude * sinLatitude);
+
+   return {primeVerticalRadius * cosLatitude * cosLongitude,
+           primeVerticalRadius * cosLatitude * sinLongitude,
+           primeVerticalRadius * (1.0 - lookup.eccentricity2_) * sinLatitude};
+}
+
+/**
+ * Initializes the local projection of a bin lookup at the radar site, and
+ * clears its radials.
+ */
+static void InitializeBinLookup(const SweepParameters& parameters,
+                                std::size_t            numRadials,
+                                SweepBinLookup&        lookup)
+{
+   const GeographicLib::Geodesic& geodesic(
+      util::GeographicLib::DefaultGeodesic());
+
+   const double flattening = geodesic.Flattening();
+   const double latitude =
+      parameters.radarLatitude_ * common::kDegreesToRadians;
+   const double longitude =
+      parameters.radarLongitude_ * common::kDegreesToRadians;
+
+   lookup.equatorialRadius_ = geodesic.EquatorialRadius();
+   lookup.eccentricity2_    = flattening * (2.0 - flattening);
+   lookup.sinLatitude_      = std::sin(latitude);
+   lookup.cosLatitude_      = std::cos(latitude);
+   lookup.sinLongitude_     = std::sin(longitude);
+   lookup.cosLongitude_     = std::cos(longitude);
+
+   const double w =
+      1.0 - lookup.eccentricity2_ * lookup.sinLatitude_ * lookup.sinLatitude_;
+   lookup.primeVerticalRadius_ = lookup.equatorialRadius_ / std::sqrt(w);
+   lookup.meridionalRadius_ =
+      lookup.primeVerticalRadius_ * (1.0 - lookup.eccentricity2_) / w;
+
+   lookup.radarPosition_ = GetBinLookupPosition(lookup,
+                                                lookup.sinLatitude_,
+                                                lookup.cosLatitude_,
+                                                lookup.sinLongitude_,
+                                                lookup.cosLongitude_);
+
+   lookup.radialAzimuths_.assign(numRadials * 2u, 0.0f);
+   lookup.buckets_.assign(kBinLookupBuckets_ * kBinLookupRadialsPerBucket_,
+                          kBinLookupNoRadial_);
+}
+
+/**
+ * Normalizes an azimuth to [0, 360).
+ */
+static float NormalizeAzimuth(float azimuth)
+{
+   azimuth = std::fmod(azimuth, 360.0f);
+   if (azimuth < 0.0f)
+   {
+      azimuth += 360.0f;
+   }
+
+   // Adding to a small negative azimuth may round to 360 degrees
+   return (azimuth < 360.0f) ? azimuth : 0.0f;
+}
+
+/**
+ * Adds a radial covering the azimuths [startAngle, endAngle) to the buckets of
+ * a bin lookup. Where radials overlap, the first radial added takes precedence.
+ */
+static void AddBinLookupRadial(SweepBinLookup& lookup,
+                               std::uint16_t   radial,
+                               float           startAngle,
+                               float           endAngle)
+{
+   startAngle = NormalizeAzimuth(startAngle);
+   endAngle   = NormalizeAzimuth(endAngle);
+
+   if (startAngle == endAngle)
+   {
+      // The radial does not cover any azimuth
+      return;
+   }
+
+   lookup.radialAzimuths_[radial * 2u]      = startAngle;
+   lookup.radialAzimuths_[radial * 2u + 1u] = endAngle;
+
+   float width = endAngle - startAngle;
+   if (width < 0.0f)
+   {
+      // The radial crosses 0/360 degrees
+      width += 360.0f;
+   }
+
+   const auto firstBucket = std::min(
+      static_cast<std::size_t>(startAngle * kBinLookupBucketsPerDegree_),
+      kBinLookupBuckets_ - 1u);
+   const std::size_t numBuckets = std::min(
+      static_cast<std::size_t>(std::ceil(width * kBinLookupBucketsPerDegree_)) +
+         1u,
+      kBinLookupBuckets_);
+
+   for (std::size_t i = 0u; i < numBuckets; ++i)
+   {
+      const std::size_t bucket = (firstBucket + i) % kBinLookupBuckets_;
+
+      std::uint16_t* radials =
+         &lookup.buckets_[bucket * kBinLookupRadialsPerBucket_];
+      std::uint16_t* slot =
+         std::find(radials,
+                   radials + kBinLookupRadialsPerBucket_,
+                   kBinLookupNoRadial_);
+
+      if (slot != radials + kBinLookupRadialsPerBucket_)
+      {
+         *slot = radial;
+      }
+   }
+}
+
+/**
+ * Determines whether a radial of a bin lookup covers an azimuth.
+ */
+static bool BinLookupRadialContains(const SweepBinLookup& lookup,
+                                    std::uint16_t         radial,
+                                    double                azimuth)
+{
+   const double startAngle = lookup.radialAzimuths_[radial * 2u];
+   const double endAngle   = lookup.radialAzimuths_[radial * 2u + 1u];
+
+   if (startAngle < endAngle)
+   {
+      return startAngle <= azimuth && azimuth < endAngle;
+   }
+
+   // If the radial crosses 0/360 degrees, special handling is needed
+   return startAngle <= azimuth || azimuth < endAngle;
+}
+
+bool IsSweepCancelled(const SweepParameters& parameters)
+{
+   return parameters.cancelled_ != nullptr && parameters.cancelled_();
+}
+
+void ComputeUniformRadialCoordinates(std::uint32_t          numRadials,
+                                     float                  radialAngle,
+                                     float                  angleOffset,
+                                     float                  gateRangeOffset,
+                                     const SweepParameters& parameters,
+                                     std::vector<float>&    coordinates)
+{
+   const GeographicLib::Geodesic& geodesic(
+      util::GeographicLib::DefaultGeodesic());
+
+   const auto radialGates = boost::irange<std::uint32_t>(
+      0u, numRadials * common::MAX_DATA_MOMENT_GATES);
+
+   std::for_each(
+      std::execution::par_unseq,
+      radialGates.begin(),
+      radialGates.end(),
+      [&](std::uint32_t radialGate)
+      {
+         const auto gate = static_cast<std::uint16_t>(
+            radialGate % common::MAX_DATA_MOMENT_GATES);
+         const auto radial = static_cast<std::uint16_t>(
+            radialGate / common::MAX_DATA_MOMENT_GATES);
+
+         const float angle =
+            static_cast<float>(radial) * radialAngle + angleOffset;
+         const float range =
+            (static_cast<float>(gate) + gateRangeOffset) * parameters.gateSize_;
+         const std::size_t offset = static_cast<std::size_t>(radialGate) * 2;
+
+         double latitude  = 0.0;
+         double longitude = 0.0;
+
+         geodesic.Direct(parameters.radarLatitude_,
+                         parameters.radarLongitude_,
+                         angle,
+                         range,
+                         latitude,
+                         longitude);
+
+         coordinates[offset]     = static_cast<float>(latitude);
+         coordinates[offset + 1] = static_cast<float>(longitude);
+      });
+}
+
+void ComputeGeodesicTable(const SweepParameters& parameters,
+                          float                  azimuthInterval,
+                          float                  rangeInterval,
+                          float                  maxRange,
+                          GeodesicTable&         table)
+{
+   const GeographicLib::Geodesic& geodesic(
+      util::GeographicLib::DefaultGeodesic());
+
+   table.radarLatitude_   = parameters.radarLatitude_;
+   table.radarLongitude_  = parameters.radarLongitude_;
+   table.azimuthInterval_ = azimuthInterval;
+   table.rangeInterval_   = rangeInterval;
+   table.azimuths_ =
+      static_cast<std::size_t>(std::lround(360.0f / azimuthInterval));
+   table.ranges_ =
+      static_cast<std::size_t>(std::ceil(maxRange / rangeInterval)) + 1u;
+   table.offsets_.resize(table.azimuths_ * table.ranges_ * 2u);
+
+   const auto samples = boost::irange<std::size_t>(
+      0u, table.azimuths_ * table.ranges_);
+
+   std::for_each(
+      std::execution::par_unseq,
+      samples.begin(),
+      samples.end(),
+      [&](std::size_t sample)
+      {
+         const std::size_t azimuth = sample % table.azimuths_;
+         const std::size_t range   = sample / table.azimuths_;
+
+         double latitude  = 0.0;
+         double longitude = 0.0;
+
+         geodesic.Direct(parameters.radarLatitude_,
+                         parameters.radarLongitude_,
+                         static_cast<double>(azimuth) * azimuthInterval,
+                         static_cast<double>(range) * rangeInterval,
+                         latitude,
+                         longitude);
+
+         // Offsets are stored relative to the radar site to preserve
+         // precision, and do not wrap at the antimeridian
+         double longitudeOffset = longitude - parameters.radarLongitude_;
+         if (longitudeOffset > 180.0)
+         {
+            longitudeOffset -= 360.0;
+         }
+         else if (longitudeOffset < -180.0)
+         {
+            longitudeOffset += 360.0;
+         }
+
+         table.offsets_[sample * 2] =
+            static_cast<float>(latitude - parameters.radarLatitude_);
+         table.offsets_[sample * 2 + 1] = static_cast<float>(longitudeOffset);
+      });
+}
+
+std::optional<SweepBin> FindSweepBin(const SweepBinLookup& lookup,
+                                     double                latitude,
+                                     double                longitude)
+{
+   if (lookup.buckets_.empty())
+   {
+      return std::nullopt;
+   }
+
+   const double phi    = latitude * common::kDegreesToRadians;
+   const double lambda = longitude * common::kDegreesToRadians;
+
+   const std::array<double, 3> position = GetBinLookupPosition(
+      lookup, std::sin(phi), std::cos(phi), std::sin(lambda), std::cos(lambda));
+
+   const double dx = position[0] - lookup.radarPosition_[0];
+   const double dy = position[1] - lookup.radarPosition_[1];
+   const double dz = position[2] - lookup.radarPosition_[2];
+
+   // Rotate the offset from the radar site into local east, north and up
+   const double east = -lookup.sinLongitude_ * dx + lookup.cosLongitude_ * dy;
+   const double north = -lookup.sinLatitude_ * lookup.cosLongitude_ * dx -
+                        lookup.sinLatitude_ * lookup.sinLongitude_ * dy +
+                        lookup.cosLatitude_ * dz;
+   const double up = lookup.cosLatitude_ * lookup.cosLongitude_ * dx +
+                     lookup.cosLatitude_ * lookup.sinLongitude_ * dy +
+                     lookup.sinLatitude_ * dz;
+
+   const double horizontal = std::hypot(east, north);
+   const double chord      = std::hypot(horizontal, up);
+
+   SweepBin bin {};
+   double   azimuth = 0.0;
+
+   if (horizontal > 0.0)
+   {
+      // The chord is lengthened to the arc of the normal section in the
+      // direction of the coordinate, which differs from the geodesic by
+      // centimeters within radar range
+      const double cosAzimuth = north / horizontal;
+      const double sinAzimuth = east / horizontal;
+      const double radius =
+         1.0 / (cosAzimuth * cosAzimuth / lookup.meridionalRadius_ +
+                sinAzimuth * sinAzimuth / lookup.primeVerticalRadius_);
+
+      bin.range_ =
+         2.0 * radius * std::asin(std::min(chord / (2.0 * radius), 1.0));
+
+      azimuth = std::atan2(east, north) / common::kDegreesToRadians;
+      if (azimuth < 0.0)
+      {
+         azimuth += 360.0;
+      }
+   }
+
+   const std::size_t bucket = std::min(
+      static_cast<std::size_t>(azimuth * kBinLookupBucketsPerDegree_),
+      kBinLookupBuckets_ - 1u);
+
+   for (std::size_t i = 0u; i < kBinLookupRadialsPerBucket_; ++i)
+   {
+      const std::uint16_t radial =
+         lookup.buckets_[bucket * kBinLookupRadialsPerBucket_ + i];
+
+      if (radial != kBinLookupNoRadial_ &&
+          BinLookupRadialContains(lookup, radial, azimuth))
+      {
+         bin.radial_ = radial;
+         return bin;
+      }
+   }
+
+   // No radial was found (not likely to happen without a gap in data)
+   return std::nullopt;
+}
+
+bool IsLevel2SweepIncomplete(const wsr88d::rda::PackedElevationScan& radarData)
+{
+   // Assume the data is incomplete when the delta between the first and last
+   // angles is greater than 2.5 degrees.
+   constexpr units::degrees<float> kIncompleteDataAngleThreshold_ {2.5};
+
+   const auto* firstRadial = radarData.first_radial_header();
+   const auto* lastRadial  = radarData.last_radial_header();
+
+   if (firstRadial == nullptr || lastRadial == nullptr)
+   {
+      return true;
+   }
+
+   const auto azimuthAngles = radarData.azimuth_angles();
+
+   const units::degrees<float> firstAngle {
+      azimuthAngles[firstRadial - radarData.radial_headers().data()]};
+   const units::degrees<float> lastAngle {
+      azimuthAngles[lastRadial - radarData.radial_headers().data()]};
+   const units::degrees<float> angleDelta =
+      common::GetAngleDelta(firstAngle, lastAngle);
+
+   return angleDelta > kIncompleteDataAngleThreshold_;
+}
+
+std::uint16_t ComputeLevel2EdgeValue(wsr88d::rda::DataBlockType dataBlockType,
+                                     float                      offset)
+{
+   switch (dataBlockType)
+   {
+   case wsr88d::rda::DataBlockType::MomentVel:
+   case wsr88d::rda::DataBlockType::MomentZdr:
+      return static_cast<std::uint16_t>(offset);
+
+   case wsr88d::rda::DataBlockType::MomentSw:
+   case wsr88d::rda::DataBlockType::MomentPhi:
+      return 2;
+
+   case wsr88d::rda::DataBlockType::MomentRho:
+      return std::numeric_limits<std::uint8_t>::max();
+
+   case wsr88d::rda::DataBlockType::MomentRef:
+   default:
+      return 0;
+   }
+}
+
+void ComputeLevel2Coordinates(
+   const wsr88d::rda::PackedElevationScan& radarData,
+   const SweepParameters&                  parameters,
+   std::size_t                             firstRadial,
+   std::vector<float>&                     coordinates)
+{
+   const GeographicLib::Geodesic& geodesic(
+      util::GeographicLib::DefaultGeodesic());
+
+   const bool   smoothingEnabled = parameters.smoothingEnabled_;
+   const float  gateSize         = parameters.gateSize_;
+   const double radarLatitude    = parameters.radarLatitude_;
+   const double radarLongitude   = parameters.radarLongitude_;
+
+   const std::uint16_t numRadials = GetLevel2VertexRadials(radarData);
+
+   auto radials = boost::irange<std::uint32_t>(
+      std::min<std::uint32_t>(static_cast<std::uint32_t>(firstRadial),
+                              numRadials),
+      numRadials);
+   auto gates = boost::irange<std::uint32_t>(0u, common::MAX_DATA_MOMENT_GATES);
+
+   const float gateRangeOffset = GetGateRangeOffset(smoothingEnabled);
+
+   // Radials may be cancelled, so are not vectorized
+   std::for_each(
+      std::execution::par,
+      radials.begin(),
+      radials.end(),
+      [&](std::uint32_t radial)
+      {
+         if (IsSweepCancelled(parameters))
+         {
+            return;
+         }
+
+         const std::optional<units::degrees<float>> angle =
+            GetLevel2RadialAngle(
+               radarData, radial, numRadials, smoothingEnabled);
+
+         if (!angle.has_value())
+         {
+            return;
+         }
+
+         std::for_each(
+            std::execution::par_unseq,
+            gates.begin(),
+            gates.end(),
+            [&](std::uint32_t gate)
+            {
+               const std::uint32_t radialGate =
+                  radial * common::MAX_DATA_MOMENT_GATES + gate;
+               const float range =
+                  (static_cast<float>(gate) + gateRangeOffset) * gateSize;
+               const std::size_t offset =
+                  static_cast<std::size_t>(radialGate) * 2;
+
+               double latitude  = 0.0;
+               double longitude = 0.0;
+
+               geodesic.Direct(radarLatitude,
+                               radarLongitude,
+                               angle->value(),
+                               range,
+                               latitude,
+                               longitude);
+
+               coordinates[offset]     = static_cast<float>(latitude);
+               coordinates[offset + 1] = static_cast<float>(longitude);
+            });
+      });
+
+   coordinates[kLevel2SiteCoordinate_ * 2] = static_cast<float>(radarLatitude);
+   coordinates[kLevel2SiteCoordinate_ * 2 + 1] =
+      static_cast<float>(radarLongitude);
+}
+
+Level2CoordinateKey
+ComputeLevel2CoordinateKey(const wsr88d::rda::PackedElevationScan& radarData,
+                           const SweepParameters&                  parameters)
+{
+   const bool          smoothingEnabled = parameters.smoothingEnabled_;
+   const std::uint16_t numRadials       = GetLevel2VertexRadials(radarData);
+
+   Level2CoordinateKey key {};
+   key.smoothingEnabled_ = smoothingEnabled;
+   key.radialAngles_.resize(numRadials);
+
+   for (std::uint32_t radial = 0u; radial < numRadials; ++radial)
+   {
+      const std::optional<units::degrees<float>> angle =
+         GetLevel2RadialAngle(radarData, radial, numRadials, smoothingEnabled);
+
+      key.radialAngles_[radial] =
+         (angle.has_value()) ?
+            static_cast<std::int32_t>(
+               std::lround(angle->value() * kCoordinateKeyAzimuthScale_)) :
+            kCoordinateKeyNoAzimuth_;
+   }
+
+   std::size_t seed = 0;
+   boost::hash_combine(seed, key.smoothingEnabled_);
+   boost::hash_range(
+      seed, key.radialAngles_.cbegin(), key.radialAngles_.cend());
+   key.hash_ = seed;
+
+   return key;
+}
+
+bool Level2CoordinateKey::operator==(const Level2CoordinateKey& o) const
+{
+   return (hash_ == o.hash_ && smoothingEnabled_ == o.smoothingEnabled_ &&
+           radialAngles_ == o.radialAngles_);
+}
+
+void ComputeLevel2RadialAngles(
+   const wsr88d::rda::PackedElevationScan& radarData,
+   const SweepParameters&                  parameters,
+   std::size_t                             firstRadial,
+   std::vector<float>&                     radialAngles)
+{
+   const bool          smoothingEnabled = parameters.smoothingEnabled_;
+   const std::uint16_t numRadials       = GetLevel2VertexRadials(radarData);
+
+   for (std::uint32_t radial =
+           std::min<std::uint32_t>(static_cast<std::uint32_t>(firstRadial),
+                                   numRadials);
+        radial < numRadials;
+        ++radial)
+   {
+      const std::optional<units::degrees<float>> angle =
+         GetLevel2RadialAngle(radarData, radial, numRadials, smoothingEnabled);
+
+      // As with radial coordinates, an undetermined angle is left unchanged
+      if (angle.has_value())
+      {
+         radialAngles[radial] = angle->value();
+      }
+   }
+}
+
+void ComputeLevel2Sweep(
+   const wsr88d::rda::PackedElevationScan& radarData,
+   wsr88d::rda::DataBlockType              dataBlockType,
+   const SweepParameters&                  parameters,
+   const std::vector<float>&               coordinates,
+   std::size_t                             firstUpdatedRadial,
+   SweepGeometry&                          geometry)
+{
+   const bool smoothingEnabled = parameters.smoothingEnabled_;
+   const bool vertexLayout     = parameters.layout_ == SweepLayout::Vertices;
+   const bool indexedLayout    = parameters.layout_ == SweepLayout::Indexed;
+   const bool polarLayout      = parameters.layout_ == SweepLayout::Polar;
+
+   const float radarLatitude  = static_cast<float>(parameters.radarLatitude_);
+   const float radarLongitude = static_cast<float>(parameters.radarLongitude_);
+
+   // The polar layout stores one data moment per cell, or one per corner when
+   // smoothing
+   const std::size_t momentsPerCell =
+      (smoothingEnabled) ? kCornersPerCell_ : 1u;
+
+   std::size_t vertexRadials = radarData.radial_count();
+
+   // When there is missing data, insert another empty vertex radial at the end
+   // to avoid stretching
+   if (IsLevel2SweepIncomplete(radarData))
+   {
+      ++vertexRadials;
+   }
+
+   // Limit radials
+   vertexRadials =
+      std::min<std::size_t>(vertexRadials, common::MAX_0_5_DEGREE_RADIALS);
+
+   const auto*    momentData0   = radarData.moment(dataBlockType);
+   const auto     momentRadials = momentData0->radials();
+   const uint32_t gates         = momentRadials[0].numberOfDataMomentGates;
+
+   // Data computed for radials preceding the first updated radial is retained
+   std::vector<std::size_t>& radialMomentOffsets =
+      geometry.radialMomentOffsets_;
+   const std::size_t firstMomentIndex =
+      (firstUpdatedRadial > 0) ? radialMomentOffsets[firstUpdatedRadial] : 0u;
+
+   geometry.layout_ = parameters.layout_;
+
+   std::vector<float>&         vertices      = geometry.vertices_;
+   std::vector<std::uint32_t>& indices       = geometry.indices_;
+   std::vector<std::uint16_t>& cells         = geometry.polar_.cells_;
+   std::vector<uint8_t>&       dataMoments8  = geometry.dataMoments8_;
+   std::vector<uint16_t>&      dataMoments16 = geometry.dataMoments16_;
+   std::vector<uint8_t>&       cfpMoments    = geometry.cfpMoments_;
+
+   const auto* cfpMomentData =
+      radarData.moment(wsr88d::rda::DataBlockType::MomentCfp);
+   const bool cfpEnabled =
+      dataBlockType == wsr88d::rda::DataBlockType::MomentRef &&
+      cfpMomentData != nullptr && cfpMomentData->data_moments(0) != nullptr;
+
+   const std::uint16_t snrThreshold = parameters.snrThreshold_;
+
+   // Start radial is always 0, as coordinates are calculated for each sweep
+   constexpr std::uint16_t startRadial = 0u;
+
+   const std::size_t radialCount = radarData.radial_count();
+
+   // Computes a single radial, returning the number of data moments, or the
+   // number of indices in the indexed layout. Output is only stored when store
+   // is set, starting at the offset of the radial.
+   auto computeRadial =
+      [&](std::size_t radial, std::size_t offset, bool store) -> std::size_t
+   {
+      std::size_t count = 0u;
+
+      size_t vIndex = (vertexLayout) ? offset * VALUES_PER_VERTEX : 0u;
+      size_t iIndex = (indexedLayout) ? offset : 0u;
+      size_t cIndex =
+         (polarLayout) ? offset / momentsPerCell * kEdgesPerCell_ : 0u;
+      size_t mIndex = (indexedLayout) ? 0u : offset;
+
+      const void* dataMoments = momentData0->data_moments(radial);
+
+      if (!radarData.has_radial(radial) || dataMoments == nullptr)
+      {
+         return count;
+      }
+
+      // First coordinate of the current and next radial
+      const std::size_t radialCoordinate =
+         (startRadial + radial) % vertexRadials * common::MAX_DATA_MOMENT_GATES;
+      const std::size_t nextRadialCoordinate =
+         (startRadial + radial + 1) % vertexRadials *
+         common::MAX_DATA_MOMENT_GATES;
+
+      // Compute gate range [startGate, endGate)
+      const Level2GateRange gateRange =
+         GetLevel2GateRange(parameters, momentRadials[radial], gates);
+      const std::int32_t gateSize  = gateRange.gateSize_;
+      const std::int32_t startGate = gateRange.startGate_;
+      const std::int32_t endGate   = gateRange.endGate_;
+      const std::int32_t numberOfDataMomentGates =
+         gateRange.numberOfDataMomentGates_;
+
+      const std::uint8_t*  dataMomentsArray8      = nullptr;
+      const std::uint16_t* dataMomentsArray16     = nullptr;
+      const std::uint8_t*  nextDataMomentsArray8  = nullptr;
+      const std::uint16_t* nextDataMomentsArray16 = nullptr;
+      const std::uint8_t*  cfpMomentsArray        = nullptr;
+
+      if (momentData0->data_word_size() == kDataWordSize8_)
+      {
+         dataMomentsArray8 = reinterpret_cast<const std::uint8_t*>(dataMoments);
+      }
+      else
+      {
+         dataMomentsArray16 =
+            reinterpret_cast<const std::uint16_t*>(dataMoments);
+      }
+
+      if (cfpEnabled)
+      {
+         cfpMomentsArray = reinterpret_cast<const std::uint8_t*>(
+            cfpMomentData->data_moments(radial));
+      }
+
+      std::int32_t numberOfNextDataMomentGates = 0;
+      bool         storeNextRadial             = false;
+      if (smoothingEnabled)
+      {
+         // Smoothing requires the next radial as well, wrapping around to the
+         // first radial
+         const std::size_t nextRadial = GetLevel2NextRadial(radarData, radial);
+
+         const void* nextDataMoments = momentData0->data_moments(nextRadial);
+
+         if (nextDataMoments == nullptr)
+         {
+            if (!store)
+            {
+               // Data should be consistent between radials
+               logger_->warn("Missing data moments in radial {}", nextRadial);
+            }
+            return count;
+         }
+
+         if (momentData0->data_word_size() == kDataWordSize8_)
+         {
+            nextDataMomentsArray8 =
+               reinterpret_cast<const std::uint8_t*>(nextDataMoments);
+         }
+         else
+         {
+            nextDataMomentsArray16 =
+               reinterpret_cast<const std::uint16_t*>(nextDataMoments);
+         }
+
+         numberOfNextDataMomentGates = std::min<std::int32_t>(
+            momentRadials[nextRadial].numberOfDataMomentGates,
+            static_cast<std::int32_t>(gates));
+
+         // In the indexed layout, coordinates of the next vertex radial are
+         // stored by the next radial, unless it is missing
+         storeNextRadial =
+            nextRadial != (startRadial + radial + 1) % vertexRadials ||
+            !radarData.has_radial(nextRadial);
+      }
+
+      for (std::int32_t gate = startGate, i = 0; gate + gateSize <= endGate;
+           gate += gateSize, ++i)
+      {
+         if (gate < 0)
+         {
+            continue;
+         }
+
+         // Number of data moments, or indices in the indexed layout
+         const std::size_t gateCount =
+            (polarLayout) ? momentsPerCell :
+            (gate > 0)    ? kVerticesPerGate_ :
+                            kVerticesPerOriginGate_;
+
+         const std::array<std::uint32_t, kCornersPerCell_> gateCoordinates =
+            GetLevel2GateCoordinates(
+               radialCoordinate, nextRadialCoordinate, gate, gateSize);
+
+         // Allow pointer arithmetic here, as bounds have already been checked
+         // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+         // Store data moment value
+         if (dataMomentsArray8 != nullptr)
+         {
+            if (!smoothingEnabled)
+            {
+               const std::uint8_t& dataValue = dataMomentsArray8[i];
+               if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
+               {
+                  continue;
+               }
+
+               count += gateCount;
+               if (!store)
+               {
+                  continue;
+               }
+
+               if (indexedLayout)
+               {
+                  // The data moment is flat shaded from the provoking vertex
+                  const std::uint32_t coordinate =
+                     gateCoordinates[kProvokingCorner_];
+
+                  dataMoments8[coordinate] = dataValue;
+
+                  if (cfpMomentsArray != nullptr)
+                  {
+                     cfpMoments[coordinate] = cfpMomentsArray[i];
+                  }
+               }
+               else
+               {
+                  for (std::size_t m = 0; m < gateCount; m++)
+                  {
+                     dataMoments8[mIndex++] = dataValue;
+
+                     if (cfpMomentsArray != nullptr)
+                     {
+                        cfpMoments[mIndex - 1] = cfpMomentsArray[i];
+                     }
+                  }
+               }
+            }
+            else if (gate > 0)
+            {
+               // Validate indices are all in range
+               if (i + 1 >= numberOfDataMomentGates)
+               {
+                  continue;
+               }
+
+               if (store && indexedLayout)
+               {
+                  StoreRadialDataMoments(parameters,
+                                         dataMomentsArray8[i],
+                                         dataMomentsArray8[i + 1],
+                                         gateCoordinates,
+                                         dataMoments8);
+               }
+
+               if (i + 1 >= numberOfNextDataMomentGates)
+               {
+                  continue;
+               }
+
+               const std::uint8_t& dm1 = dataMomentsArray8[i];
+               const std::uint8_t& dm2 = dataMomentsArray8[i + 1];
+               const std::uint8_t& dm3 = nextDataMomentsArray8[i];
+               const std::uint8_t& dm4 = nextDataMomentsArray8[i + 1];
+
+               if (IsSmoothedDataHidden(parameters, dm1, dm2, dm3, dm4))
+               {
+                  // Skip only if all data moments are hidden
+                  continue;
+               }
+
+               count += gateCount;
+               if (!store)
+               {
+                  continue;
+               }
+
+               StoreSmoothedDataMoments(parameters,
+                                        dm1,
+                                        dm2,
+                                        dm3,
+                                        dm4,
+                                        gateCoordinates,
+                                        storeNextRadial,
+                                        dataMoments8,
+                                        mIndex);
+
+               // cfpMoments is unused, so not populated here
+            }
+            else
+            {
+               if (!store)
+               {
+                  // If smoothing is enabled, gate should never start at zero
+                  // (radar site origin)
+                  logger_->error(
+                     "Smoothing enabled, gate should not start at zero");
+               }
+               continue;
+            }
+         }
+         else
+         {
+            if (!smoothingEnabled)
+            {
+               const std::uint16_t& dataValue = dataMomentsArray16[i];
+               if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
+               {
+                  continue;
+               }
+
+               count += gateCount;
+               if (!store)
+               {
+                  continue;
+               }
+
+               if (indexedLayout)
+               {
+                  // The data moment is flat shaded from the provoking vertex
+                  dataMoments16[gateCoordinates[kProvokingCorner_]] = dataValue;
+               }
+               else
+               {
+                  for (std::size_t m = 0; m < gateCount; m++)
+                  {
+                     dataMoments16[mIndex++] = dataValue;
+                  }
+               }
+            }
+            else if (gate > 0)
+            {
+               // Validate indices are all in range
+               if (i + 1 >= numberOfDataMomentGates)
+               {
+                  continue;
+               }
+
+               if (store && indexedLayout)
+               {
+                  StoreRadialDataMoments(parameters,
+                                         dataMomentsArray16[i],
+                                         dataMomentsArray16[i + 1],
+                                         gateCoordinates,
+                                         dataMoments16);
+               }
+
+               if (i + 1 >= numberOfNextDataMomentGates)
+               {
+                  continue;
+               }
+
+               const std::uint16_t& dm1 = dataMomentsArray16[i];
+               const std::uint16_t& dm2 = dataMomentsArray16[i + 1];
+               const std::uint16_t& dm3 = nextDataMomentsArray16[i];
+               const std::uint16_t& dm4 = nextDataMomentsArray16[i + 1];
+
+               if (IsSmoothedDataHidden(parameters, dm1, dm2, dm3, dm4))
+               {
+                  // Skip only if all data moments are hidden
+                  continue;
+               }
+
+               count += gateCount;
+               if (!store)
+               {
+                  continue;
+               }
+
+               StoreSmoothedDataMoments(parameters,
+                                        dm1,
+                                        dm2,
+                                        dm3,
+                                        dm4,
+                                        gateCoordinates,
+                                        storeNextRadial,
+                                        dataMoments16,
+                                        mIndex);
+
+               // cfpMoments is unused, so not populated here
+            }
+            else
+            {
+               // If smoothing is enabled, gate should never start at zero
+               // (radar site origin)
+               continue;
+            }
+         }
+
+         // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+         // Store vertices
+         if (polarLayout)
+         {
+            // Store the radial and gate edges of the cell. The vertex shader
+            // draws the same two triangles as the vertex layout below.
+            cells[cIndex++] = static_cast<std::uint16_t>(
+               (startRadial + radial) % vertexRadials);
+            cells[cIndex++] = static_cast<std::uint16_t>(
+               (startRadial + radial + 1) % vertexRadials);
+
+            if (gate > 0)
+            {
+               cells[cIndex++] = static_cast<std::uint16_t>(gate);
+               cells[cIndex++] = static_cast<std::uint16_t>(gate + gateSize);
+            }
+            else
+            {
+               // The near edge of the origin gate is the radar site
+               cells[cIndex++] = 0u;
+               cells[cIndex++] = 1u;
+            }
+         }
+         else if (indexedLayout)
+         {
+            // Store the coordinate indices of the same triangles as the vertex
+            // layout below. The last vertex of each triangle is the provoking
+            // vertex.
+            indices[iIndex++] = gateCoordinates[0];
+            indices[iIndex++] = gateCoordinates[1];
+            indices[iIndex++] = gateCoordinates[3];
+
+            if (gate > 0)
+            {
+               indices[iIndex++] = gateCoordinates[0];
+               indices[iIndex++] = gateCoordinates[2];
+               indices[iIndex++] = gateCoordinates[3];
+            }
+         }
+         else if (gate > 0)
+         {
+            // Draw two triangles per gate
+            //
+            // 2 +---+ 4
+            //   |  /|
+            //   | / |
+            //   |/  |
+            // 1 +---+ 3
+
+            const std::uint16_t baseCoord = gate - 1;
+
+            const std::size_t offset1 =
+               ((startRadial + radial) % vertexRadials *
+                   common::MAX_DATA_MOMENT_GATES +
+                baseCoord) *
+               2;
+            const std::size_t offset2 =
+               offset1 + static_cast<std::size_t>(gateSize) * 2;
+            const std::size_t offset3 =
+               (((startRadial + radial + 1) % vertexRadials) *
+                   common::MAX_DATA_MOMENT_GATES +
+                baseCoord) *
+               2;
+            const std::size_t offset4 =
+               offset3 + static_cast<std::size_t>(gateSize) * 2;
+
+            vertices[vIndex++] = coordinates[offset1];
+            vertices[vIndex++] = coordinates[offset1 + 1];
+
+            vertices[vIndex++] = coordinates[offset2];
+            vertices[vIndex++] = coordinates[offset2 + 1];
+
+            vertices[vIndex++] = coordinates[offset4];
+            vertices[vIndex++] = coordinates[offset4 + 1];
+
+            vertices[vIndex++] = coordinates[offset1];
+            vertices[vIndex++] = coordinates[offset1 + 1];
+
+            vertices[vIndex++] = coordinates[offset3];
+            vertices[vIndex++] = coordinates[offset3 + 1];
+
+            vertices[vIndex++] = coordinates[offset4];
+            vertices[vIndex++] = coordinates[offset4 + 1];
+         }
+         else
+         {
+            const std::uint16_t baseCoord = gate;
+
+            std::size_t offset1 = ((startRadial + radial) % vertexRadials *
+                                      common::MAX_DATA_MOMENT_GATES +
+                                   baseCoord) *
+                                  2;
+            std::size_t offset2 =
+               (((startRadial + radial + 1) % vertexRadials) *
+                   common::MAX_DATA_MOMENT_GATES +
+                baseCoord) *
+               2;
+
+            vertices[vIndex++] = radarLatitude;
+            vertices[vIndex++] = radarLongitude;
+
+            vertices[vIndex++] = coordinates[offset1];
+            vertices[vIndex++] = coordinates[offset1 + 1];
+
+            vertices[vIndex++] = coordinates[offset2];
+            vertices[vIndex++] = coordinates[offset2 + 1];
+         }
+      }
+
+      return count;
+   };
+
+   // Count the updated radials, and offset each from the preceding radials
+   const std::size_t outputSize = ComputeRadialOffsets(parameters,
+                                                       firstUpdatedRadial,
+                                                       radialCount,
+                                                       firstMomentIndex,
+                                                       radialMomentOffsets,
+                                                       computeRadial);
+
+   if (!indexedLayout)
+   {
+      indices.resize(0);
+      indices.shrink_to_fit();
+   }
+
+   if (polarLayout)
+   {
+      vertices.resize(0);
+      vertices.shrink_to_fit();
+
+      geometry.polar_.momentsPerCell_  = momentsPerCell;
+      geometry.polar_.gateSize_        = parameters.gateSize_;
+      geometry.polar_.gateRangeOffset_ = GetGateRangeOffset(smoothingEnabled);
+
+      cells.resize(outputSize / momentsPerCell * kEdgesPerCell_);
+      cells.shrink_to_fit();
+   }
+   else if (indexedLayout)
+   {
+      vertices.resize(0);
+      vertices.shrink_to_fit();
+      cells.resize(0);
+      cells.shrink_to_fit();
+
+      indices.resize(outputSize);
+      indices.shrink_to_fit();
+   }
+   else
+   {
+      cells.resize(0);
+      cells.shrink_to_fit();
+
+      vertices.resize(outputSize * VALUES_PER_VERTEX);
+      vertices.shrink_to_fit();
+   }
+
+   // The indexed layout stores a data moment for each coordinate. Those of
+   // preceding radials are retained, otherwise the data moments are cleared.
+   const std::size_t momentsSize =
+      (indexedLayout) ? kLevel2Coordinates_ : outputSize;
+   const bool clearMoments = indexedLayout && firstUpdatedRadial == 0u;
+
+   if (momentData0->data_word_size() == kDataWordSize8_)
+   {
+      dataMoments16.resize(0);
+      dataMoments16.shrink_to_fit();
+
+      if (clearMoments)
+      {
+         dataMoments8.resize(0);
+      }
+      dataMoments8.resize(momentsSize);
+      dataMoments8.shrink_to_fit();
+   }
+   else
+   {
+      dataMoments8.resize(0);
+      dataMoments8.shrink_to_fit();
+
+      if (clearMoments)
+      {
+         dataMoments16.resize(0);
+      }
+      dataMoments16.resize(momentsSize);
+      dataMoments16.shrink_to_fit();
+   }
+
+   if (cfpEnabled)
+   {
+      if (clearMoments)
+      {
+         cfpMoments.resize(0);
+      }
+
+      // The polar layout stores one CFP moment per cell
+      cfpMoments.resize(polarLayout ? momentsSize / momentsPerCell :
+                                      momentsSize);
+      cfpMoments.shrink_to_fit();
+   }
+   else
+   {
+      cfpMoments.resize(0);
+      cfpMoments.shrink_to_fit();
+   }
+
+   // Store each updated radial at its offset
+   StoreRadials(parameters,
+                firstUpdatedRadial,
+                radialCount,
+                radialMomentOffsets,
+                computeRadial);
+}
+
+/**
+ * Computes a decimated level of a Level 2 sweep, merging blocks of radialStride
+ * radials and gateStride data moment gates into cells. The level is stored
+ * after the preceding levels.
+ */
+template<typename T>
+static SweepLevel ComputeLevel2SweepLevel(
+   const wsr88d::rda::PackedElevationScan&         radarData,
+   const wsr88d::rda::PackedElevationScan::Moment& momentData,
+   const wsr88d::rda::PackedElevationScan::Moment* cfpMomentData,
+   const SweepParameters&                          parameters,
+   std::size_t                                     radialStride,
+   std::size_t                                     gateStride,
+   std::vector<T>&                                 dataMoments,
+   SweepGeometry&                                  geometry)
+{
+   const bool smoothingEnabled = parameters.smoothingEnabled_;
+   const bool indexedLayout    = parameters.layout_ == SweepLayout::Indexed;
+
+   const std::size_t momentsPerCell =
+      (smoothingEnabled) ? kCornersPerCell_ : 1u;
+
+   const std::size_t radialCount   = radarData.radial_count();
+   const std::size_t vertexRadials = GetLevel2VertexRadials(radarData);
+   const std::size_t blockCount =
+      (radialCount + radialStride - 1u) / radialStride;
+
+   const auto          momentRadials = momentData.radials();
+   const std::uint32_t gates         = momentRadials[0].numberOfDataMomentGates;
+   const std::uint16_t snrThreshold  = parameters.snrThreshold_;
+   const auto          mergedGates   = static_cast<std::int32_t>(gateStride);
+
+   std::vector<std::uint32_t>& indices    = geometry.indices_;
+   std::vector<std::uint16_t>& cells      = geometry.polar_.cells_;
+   std::vector<std::uint8_t>&  cfpMoments = geometry.cfpMoments_;
+
+   // Gets the data moments of a radial, or nullptr if the radial is missing
+   auto getDataMoments = [&](std::size_t radial) -> const T*
+   {
+      return (radarData.has_radial(radial)) ?
+                reinterpret_cast<const T*>(momentData.data_moments(radial)) :
+                nullptr;
+   };
+
+   // Gets the representative gate of the cell merging radials [firstRadial,
+   // endRadial) and gates [firstGate, endGate). This is the last visible gate
+   // in drawing order, which is the gate at the provoking vertex of the cell
+   // whenever it is visible.
+   auto getRepresentativeGate =
+      [&](std::size_t  firstRadial,
+          std::size_t  endRadial,
+          std::int32_t firstGate,
+          std::int32_t endGate)
+      -> std::optional<std::pair<std::size_t, std::int32_t>>
+   {
+      for (std::size_t radial = endRadial; radial-- > firstRadial;)
+      {
+         const T* dataMomentsArray = getDataMoments(radial);
+         if (dataMomentsArray == nullptr)
+         {
+            continue;
+         }
+
+         const std::int32_t numberOfDataMomentGates = std::min<std::int32_t>(
+            momentRadials[radial].numberOfDataMomentGates,
+            static_cast<std::int32_t>(gates));
+
+         for (std::int32_t i = std::min(endGate, numberOfDataMomentGates);
+              i-- > firstGate;)
+         {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            const T dataValue = dataMomentsArray[i];
+            if (dataValue >= snrThreshold || dataValue == RANGE_FOLDED)
+            {
+               return std::make_pair(radial, i);
+            }
+         }
+      }
+
+      return std::nullopt;
+   };
+
+   // Computes a block of radials, returning the number of data moments, or the
+   // number of indices in the indexed layout. Output is only stored when store
+   // is set, starting at the offset of the block.
+   auto computeBlock =
+      [&](std::size_t block, std::size_t offset, bool store) -> std::size_t
+   {
+      std::size_t count = 0u;
+
+      std::size_t iIndex = (indexedLayout) ? offset : 0u;
+      std::size_t cIndex =
+         (indexedLayout) ? 0u : offset / momentsPerCell * kEdgesPerCell_;
+      std::size_t mIndex = (indexedLayout) ? 0u : offset;
+
+      const std::size_t firstRadial = block * radialStride;
+      const std::size_t endRadial =
+         std::min(firstRadial + radialStride, radialCount);
+
+      // The gates of the block are those of its first radial with data
+      std::size_t radial = firstRadial;
+      while (radial < endRadial && getDataMoments(radial) == nullptr)
+      {
+         ++radial;
+      }
+
+      if (radial == endRadial)
+      {
+         return count;
+      }
+
+      const T*              dataMomentsArray = getDataMoments(radial);
+      const Level2GateRange gateRange =
+         GetLevel2GateRange(parameters, momentRadials[radial], gates);
+      const std::int32_t gateSize  = gateRange.gateSize_;
+      const std::int32_t startGate = gateRange.startGate_;
+
+      // Data moment gates [firstGate, endGate) are drawn, skipping those
+      // preceding the radar site
+      const std::int32_t firstGate =
+         (startGate < 0) ? (gateSize - 1 - startGate) / gateSize : 0;
+      std::int32_t endGate = std::max<std::int32_t>(
+         0, (gateRange.endGate_ - startGate) / gateSize);
+
+      const T* nextDataMomentsArray = nullptr;
+      if (smoothingEnabled)
+      {
+         // Smoothing requires the radial following the block, and one more
+         // data moment gate
+         const std::size_t nextRadial =
+            GetLevel2NextRadial(radarData, endRadial - 1u);
+
+         nextDataMomentsArray = reinterpret_cast<const T*>(
+            momentData.data_moments(nextRadial));
+
+         if (nextDataMomentsArray == nullptr)
+         {
+            return count;
+         }
+
+         const std::int32_t numberOfNextDataMomentGates =
+            std::min<std::int32_t>(
+               momentRadials[nextRadial].numberOfDataMomentGates,
+               static_cast<std::int32_t>(gates));
+
+         endGate = std::min({endGate,
+                             gateRange.numberOfDataMomentGates_ - 1,
+                             numberOfNextDataMomentGates - 1});
+      }
+
+      // First coordinate of the first and next radial edge of the block
+      const std::size_t radialCoordinate =
+         firstRadial % vertexRadials * common::MAX_DATA_MOMENT_GATES;
+      const std::size_t nextRadialCoordinate =
+         endRadial % vertexRadials * common::MAX_DATA_MOMENT_GATES;
+
+      for (std::int32_t blockGate = firstGate / mergedGates * mergedGates;
+           blockGate < endGate;
+           blockGate += mergedGates)
+      {
+         // Data moment gates [i, nextGate) are merged into a single cell
+         const std::int32_t i        = std::max(blockGate, firstGate);
+         const std::int32_t nextGate =
+            std::min(blockGate + mergedGates, endGate);
+         const std::int32_t gate     = startGate + i * gateSize;
+         const std::int32_t cellSize = (nextGate - i) * gateSize;
+
+         if (smoothingEnabled && gate <= 0)
+         {
+            // If smoothing is enabled, gate should never start at zero (radar
+            // site origin)
+            continue;
+         }
+
+         // Number of data moments, or indices in the indexed layout
+         const std::size_t gateCount =
+            (!indexedLayout) ? momentsPerCell :
+            (gate > 0)       ? kVerticesPerGate_ :
+                               kVerticesPerOriginGate_;
+
+         // The far corners of the origin cell are offset by its size
+         const std::size_t coordinateOffset =
+            (gate > 0) ? 0u : static_cast<std::size_t>(cellSize - 1);
+
+         const std::array<std::uint32_t, kCornersPerCell_> gateCoordinates =
+            GetLevel2GateCoordinates(radialCoordinate + coordinateOffset,
+                                     nextRadialCoordinate + coordinateOffset,
+                                     gate,
+                                     cellSize);
+
+         T            dataValue {};
+         std::uint8_t cfpValue {};
+
+         // Allow pointer arithmetic here, as bounds have already been checked
+         // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+         if (!smoothingEnabled)
+         {
+            const auto representativeGate =
+               getRepresentativeGate(firstRadial, endRadial, i, nextGate);
+
+            if (!representativeGate.has_value())
+            {
+               continue;
+            }
+
+            count += gateCount;
+            if (!store)
+            {
+               continue;
+            }
+
+            const auto [representativeRadial, representativeIndex] =
+               representativeGate.value();
+
+            dataValue =
+               getDataMoments(representativeRadial)[representativeIndex];
+
+            if (cfpMomentData != nullptr)
+            {
+               const auto* cfpMomentsArray = reinterpret_cast<const uint8_t*>(
+                  cfpMomentData->data_moments(representativeRadial));
+
+               if (cfpMomentsArray != nullptr)
+               {
+                  cfpValue = cfpMomentsArray[representativeIndex];
+               }
+            }
+         }
+         else
+         {
+            const T& dm1 = dataMomentsArray[i];
+            const T& dm2 = dataMomentsArray[nextGate];
+            const T& dm3 = nextDataMomentsArray[i];
+            const T& dm4 = nextDataMomentsArray[nextGate];
+
+            if (IsSmoothedDataHidden(parameters, dm1, dm2, dm3, dm4))
+            {
+               // Skip only if all data moments are hidden
+               continue;
+            }
+
+            count += gateCount;
+            if (!store)
+            {
+               continue;
+            }
+
+            // In the indexed layout, the data moments at the corners of the
+            // cell were stored with the full resolution sweep
+            StoreSmoothedDataMoments(parameters,
+                                     dm1,
+                                     dm2,
+                                     dm3,
+                                     dm4,
+                                     gateCoordinates,
+                                     false,
+                                     dataMoments,
+                                     mIndex);
+         }
+
+         // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+         if (indexedLayout)
+         {
+            if (!smoothingEnabled)
+            {
+               // The data moment is flat shaded from the provoking vertex. If
+               // the representative gate is not at the provoking vertex, the
+               // gate at the provoking vertex is hidden, and its data moment
+               // is otherwise unused.
+               const std::uint32_t coordinate =
+                  gateCoordinates[kProvokingCorner_];
+
+               dataMoments[coordinate] = dataValue;
+
+               if (cfpMomentData != nullptr)
+               {
+                  cfpMoments[coordinate] = cfpValue;
+               }
+            }
+
+            indices[iIndex++] = gateCoordinates[0];
+            indices[iIndex++] = gateCoordinates[1];
+            indices[iIndex++] = gateCoordinates[3];
+
+            if (gate > 0)
+            {
+               indices[iIndex++] = gateCoordinates[0];
+               indices[iIndex++] = gateCoordinates[2];
+               indices[iIndex++] = gateCoordinates[3];
+            }
+         }
+         else
+         {
+            if (!smoothingEnabled)
+            {
+               if (cfpMomentData != nullptr)
+               {
+                  cfpMoments[mIndex] = cfpValue;
+               }
+
+               dataMoments[mIndex++] = dataValue;
+            }
+
+            cells[cIndex++] =
+               static_cast<std::uint16_t>(firstRadial % vertexRadials);
+            cells[cIndex++] =
+               static_cast<std::uint16_t>(endRadial % vertexRadials);
+            cells[cIndex++] = static_cast<std::uint16_t>(gate);
+            cells[cIndex++] = static_cast<std::uint16_t>(gate + cellSize);
+         }
+      }
+
+      return count;
+   };
+
+   // Count each block, and offset each from the preceding levels and blocks
+   const std::size_t firstOffset =
+      (indexedLayout) ? indices.size() : dataMoments.size();
+
+   std::vector<std::size_t> blockOffsets {};
+   const std::size_t        outputSize = ComputeRadialOffsets(
+      parameters, 0u, blockCount, firstOffset, blockOffsets, computeBlock);
+
+   if (indexedLayout)
+   {
+      indices.resize(outputSize);
+   }
+   else
+   {
+      cells.resize(outputSize / momentsPerCell * kEdgesPerCell_);
+      dataMoments.resize(outputSize);
+
+      if (cfpMomentData != nullptr)
+      {
+         cfpMoments.resize(outputSize / momentsPerCell);
+      }
+   }
+
+   // Store each block at its offset
+   StoreRadials(parameters, 0u, blockCount, blockOffsets, computeBlock);
+
+   // Levels are offset in indices, or cells in the polar layout
+   const std::size_t levelScale = (indexedLayout) ? 1u : momentsPerCell;
+
+   SweepLevel level {};
+   level.offset_ = firstOffset / levelScale;
+   level.count_  = (outputSize - firstOffset) / levelScale;
+   return level;
+}
+
+void ComputeLevel2SweepLevels(
+   const wsr88d::rda::PackedElevationScan& radarData,
+   wsr88d::rda::DataBlockType              dataBlockType,
+   const SweepParameters&                  parameters,
+   SweepGeometry&                          geometry)
+{
+   std::vector<SweepLevel>& levels = geometry.levels_;
+
+   const auto*       momentData0 = radarData.moment(dataBlockType);
+   const std::size_t radialCount = radarData.radial_count();
+
+   const float nativeGateLength =
+      (momentData0 != nullptr) ?
+         static_cast<float>(
+            momentData0->radials()[0].dataMomentRangeSampleIntervalRaw) :
+         parameters.gateSize_;
+
+   // The first level is the full resolution sweep
+   levels.assign(1u, {nativeGateLength, 0u, GetSweepSize(geometry)});
+
+   if (parameters.layout_ == SweepLayout::Vertices ||
+       momentData0 == nullptr || radialCount == 0u || nativeGateLength <= 0.0f)
+   {
+      return;
+   }
+
+   const auto* cfpMomentData =
+      radarData.moment(wsr88d::rda::DataBlockType::MomentCfp);
+   if (dataBlockType != wsr88d::rda::DataBlockType::MomentRef ||
+       cfpMomentData == nullptr || cfpMomentData->data_moments(0) == nullptr)
+   {
+      cfpMomentData = nullptr;
+   }
+
+   const float nativeRadialWidth = 360.0f / static_cast<float>(radialCount);
+
+   const std::vector<std::pair<std::size_t, std::size_t>> strides =
+      GetLevelsOfDetail(nativeRadialWidth, nativeGateLength);
+
+   // Coarser levels are computed first. In the indexed layout, cells sharing a
+   // provoking vertex are nested, so the data moment stored by the finest
+   // level is representative of each.
+   for (auto it = strides.rbegin(); it != strides.rend(); ++it)
+   {
+      const auto [radialStride, gateStride] = *it;
+
+      SweepLevel level =
+         (momentData0->data_word_size() == kDataWordSize8_) ?
+            ComputeLevel2SweepLevel(radarData,
+                                    *momentData0,
+                                    cfpMomentData,
+                                    parameters,
+                                    radialStride,
+                                    gateStride,
+                                    geometry.dataMoments8_,
+                                    geometry) :
+            ComputeLevel2SweepLevel(radarData,
+                                    *momentData0,
+                                    cfpMomentData,
+                                    parameters,
+                                    radialStride,
+                                    gateStride,
+                                    geometry.dataMoments16_,
+                                    geometry);
+
+      level.gateLength_ = static_cast<float>(gateStride) * nativeGateLength;
+      levels.insert(std::next(levels.begin()), level);
+   }
+}
+
+void ComputeLevel2BinLookup(const wsr88d::rda::PackedElevationScan& radarData,
+                            const SweepParameters&                  parameters,
+                            SweepBinLookup&                         lookup)
+{
+   const auto          azimuthAngles = radarData.azimuth_angles();
+   const std::uint16_t numRadials    = GetLevel2VertexRadials(radarData);
+
+   InitializeBinLookup(parameters, numRadials, lookup);
+
+   for (std::uint16_t radial = 0u; radial < numRadials; ++radial)
+   {
+      if (!radarData.has_radial(radial))
+      {
+         continue;
+      }
+
+      const units::degrees<float> startAngle {azimuthAngles[radial]};
+      units::degrees<float>       nextAngle {};
+
+      const std::uint16_t nextRadial = (radial + 1) % numRadials;
+      if (radarData.has_radial(nextRadial))
+      {
+         nextAngle = units::degrees<float> {azimuthAngles[nextRadial]};
+      }
+      else
+      {
+         // Next angle is not available, interpolate
+         const std::uint16_t prevRadial =
+            (radial >= 1) ? radial - 1 : numRadials - (1 - radial);
+
+         if (!radarData.has_radial(prevRadial))
+         {
+            continue;
+         }
+
+         const units::degrees<float> prevAngle {azimuthAngles[prevRadial]};
+         nextAngle = startAngle + common::GetAngleDelta(startAngle, prevAngle);
+      }
+
+      AddBinLookupRadial(lookup, radial, startAngle.value(), nextAngle.value());
+   }
+}
+
+std::pair<std::uint16_t, std::uint16_t>
+GetLevel2DataRange(wsr88d::rda::DataBlockType dataBlockType)
+{
+   switch (dataBlockType)
+   {
+   case wsr88d::rda::DataBlockType::MomentRef:
+   case wsr88d::rda::DataBlockType::MomentVel:
+   case wsr88d::rda::DataBlockType::MomentSw:
+   case wsr88d::rda::DataBlockType::MomentRho:
+   default:
+      return {1, 255};
+
+   case wsr88d::rda::DataBlockType::MomentZdr:
+      return {1, 1058};
+
+   case wsr88d::rda::DataBlockType::MomentPhi:
+      return {1, 1023};
+
+   case wsr88d::rda::DataBlockType::MomentCfp:
+      return {1, 81};
+   }
+}
+
+void ComputeLevel2ColorTableLut(
+   const common::ColorTable&               colorTable,
+   std::uint16_t                           rangeMin,
+   std::uint16_t                           rangeMax,
+   float                                   offset,
+   float                                   scale,
+   std::vector<boost::gil::rgba8_pixel_t>& lut)
+{
+   boost::integer_range<uint16_t> dataRange =
+      boost::irange<uint16_t>(rangeMin, rangeMax + 1);
+
+   lut.resize(rangeMax - rangeMin + 1);
+   lut.shrink_to_fit();
+
+   std::for_each(std::execution::par_unseq,
+                 dataRange.begin(),
+                 dataRange.end(),
+                 [&](uint16_t i)
+                 {
+                    if (i == RANGE_FOLDED)
+                    {
+                       lut[i - *dataRange.begin()] = colorTable.rf_color();
+                    }
+                    else
+                    {
+                       float f                     = (i - offset) / scale;
+                       lut[i - *dataRange.begin()] = colorTable.Color(f);
+                    }
+                 });
+}
+
+void ComputeLevel3RadialCoordinates(
+   const wsr88d::rpg::GenericRadialDataPacket& radialData,
+   const SweepParameters&                      parameters,
+   std::vector<float>&                         coordinates)
+{
+   const GeographicLib::Geodesic& geodesic(
+      util::GeographicLib::DefaultGeodesic());
+
+   const bool   smoothingEnabled = parameters.smoothingEnabled_;
+   const float  gateSize         = parameters.gateSize_;
+   const double radarLatitude    = parameters.radarLatitude_;
+   const double radarLongitude   = parameters.radarLongitude_;
+
+   const std::uint16_t numRadials   = radialData.number_of_radials();
+   const std::uint16_t numRangeBins = radialData.number_of_range_bins();
+
+   auto radials = boost::irange<std::uint32_t>(0u, numRadials);
+   auto gates   = boost::irange<std::uint32_t>(0u, numRangeBins);
+
+   const float gateRangeOffset = (smoothingEnabled) ?
+                                    // Center of the first gate is half the gate
+                                    // size distance from the radar site
+                                    0.5f :
+                                    // Far end of the first gate is the gate
+                                    // size distance from the radar site
+                                    1.0f;
+
+   // Radials may be cancelled, so are not vectorized
+   std::for_each(
+      std::execution::par,
+      radials.begin(),
+      radials.end(),
+      [&](std::uint32_t radial)
+      {
+         if (IsSweepCancelled(parameters))
+         {
+            return;
+         }
+
+         float angle = radialData.start_angle(radial);
+
+         if (smoothingEnabled)
+         {
+            static constexpr float kDeltaAngleFactor = 0.5f;
+            angle += radialData.delta_angle(radial) * kDeltaAngleFactor;
+         }
+
+         std::for_each(
+            std::execution::par_unseq,
+            gates.begin(),
+            gates.end(),
+            [&](std::uint32_t gate)
+            {
+               const std::uint32_t radialGate =
+                  radial * common::MAX_DATA_MOMENT_GATES + gate;
+               const float range =
+                  (static_cast<float>(gate) + gateRangeOffset) * gateSize;
+               const std::size_t offset = static_cast<size_t>(radialGate) * 2;
+
+               double latitude  = 0.0;
+               double longitude = 0.0;
+
+               geodesic.Direct(radarLatitude,
+                               radarLongitude,
+                               angle,
+                               range,
+                               latitude,
+                               longitude);
+
+               coordinates[offset]     = static_cast<float>(latitude);
+               coordinates[offset + 1] = static_cast<float>(longitude);
+            });
+      });
+}
+
+void ComputeLevel3RadialSweep(
+   const wsr88d::rpg::GenericRadialDataPacket& radialData,
+   const SweepParameters&                      parameters,
+   const std::vector<float>&                   coordinates,
+   std::uint16_t                               startRadial,
+   std::uint16_t                               dataMomentInterval,
+   SweepGeometry&                              geometry)
+{
+   const bool smoothingEnabled = parameters.smoothingEnabled_;
+
+   const float radarLatitude  = static_cast<float>(parameters.radarLatitude_);
+   const float radarLongitude = static_cast<float>(parameters.radarLongitude_);
+
+   const std::size_t   radials = radialData.number_of_radials();
+   const std::uint16_t numberOfDataMomentGates =
+      radialData.number_of_range_bins();
+
+   std::vector<float>&   vertices     = geometry.vertices_;
+   std::vector<uint8_t>& dataMoments8 = geometry.dataMoments8_;
+
+   const uint16_t snrThreshold = parameters.snrThreshold_;
+
+   // Compute gate size (number of base gates per bin)
+   const std::uint16_t gateSize = std::max<std::uint16_t>(
+      1,
+      dataMomentInterval / static_cast<std::uint16_t>(parameters.gateSize_));
+
+   // Compute gate range [startGate, endGate)
+   std::uint16_t       startGate = 0;
+   const std::uint16_t endGate =
+      std::min<std::uint16_t>(startGate + numberOfDataMomentGates * gateSize,
+                              common::MAX_DATA_MOMENT_GATES);
+
+   if (smoothingEnabled)
+   {
+      // If smoothing is enabled, the start gate is incremented by one, as we
+      // are skipping the radar site origin. The end gate is unaffected, as
+      // we need to draw one less data point.
+      ++startGate;
+   }
+
+   // Computes a single radial, returning the number of data moments. Output is
+   // only stored when store is set, starting at the offset of the radial.
+   auto computeRadial =
+      [&](std::size_t radial, std::size_t offset, bool store) -> std::size_t
+   {
+      std::size_t count  = 0u;
+      size_t      vIndex = offset * VALUES_PER_VERTEX;
+      size_t      mIndex = offset;
+
+      const auto& dataMomentsArray8 =
+         radialData.level(static_cast<std::uint16_t>(radial));
+
+      const std::uint16_t nextRadial =
+         (radial == radials - 1) ? 0 : static_cast<std::uint16_t>(radial + 1);
+      const auto& nextDataMomentsArray8 = radialData.level(nextRadial);
+
+      for (std::uint16_t gate = startGate, i = 0; gate + gateSize <= endGate;
+           gate += gateSize, ++i)
+      {
+         size_t vertexCount = (gate > 0) ? 6 : 3;
+
+         if (!smoothingEnabled)
+         {
+            // Store data moment value
+            const uint8_t dataValue =
+               (i < dataMomentsArray8.size()) ? dataMomentsArray8[i] : 0;
+            if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
+            {
+               continue;
+            }
+
+            count += vertexCount;
+            if (!store)
+            {
+               continue;
+            }
+
+            for (size_t m = 0; m < vertexCount; m++)
+            {
+               dataMoments8[mIndex++] = dataValue;
+            }
+         }
+         else if (gate > 0)
+         {
+            // Validate indices are all in range
+            if (i + 1 >= numberOfDataMomentGates)
+            {
+               continue;
+            }
+
+            const std::uint8_t& dm1 = dataMomentsArray8[i];
+            const std::uint8_t& dm2 = dataMomentsArray8[i + 1];
+            const std::uint8_t& dm3 = nextDataMomentsArray8[i];
+            const std::uint8_t& dm4 = nextDataMomentsArray8[i + 1];
+
+            if (IsSmoothedDataHidden(parameters, dm1, dm2, dm3, dm4))
+            {
+               // Skip only if all data moments are hidden
+               continue;
+            }
+
+            count += vertexCount;
+            if (!store)
+            {
+               continue;
+            }
+
+            // The order must match the store vertices section below
+            dataMoments8[mIndex++] = RemapDataMoment(parameters, dm1);
+            dataMoments8[mIndex++] = RemapDataMoment(parameters, dm2);
+            dataMoments8[mIndex++] = RemapDataMoment(parameters, dm4);
+            dataMoments8[mIndex++] = RemapDataMoment(parameters, dm1);
+            dataMoments8[mIndex++] = RemapDataMoment(parameters, dm3);
+            dataMoments8[mIndex++] = RemapDataMoment(parameters, dm4);
+         }
+         else
+         {
+            if (!store)
+            {
+               // If smoothing is enabled, gate should never start at zero
+               // (radar site origin)
+               logger_->error(
+                  "Smoothing enabled, gate should not start at zero");
+            }
+            continue;
+         }
+
+         // Store vertices
+         if (gate > 0)
+         {
+            const uint16_t baseCoord = gate - 1;
+
+            size_t offset1 = ((startRadial + radial) % radials *
+                                 common::MAX_DATA_MOMENT_GATES +
+                              baseCoord) *
+                             2;
+            size_t offset2 = offset1 + gateSize * 2;
+            size_t offset3 = (((startRadial + radial + 1) % radials) *
+                                 common::MAX_DATA_MOMENT_GATES +
+                              baseCoord) *
+                             2;
+            size_t offset4 = offset3 + gateSize * 2;
+
+            vertices[vIndex++] = coordinates[offset1];
+            vertices[vIndex++] = coordinates[offset1 + 1];
+
+            vertices[vIndex++] = coordinates[offset2];
+            vertices[vIndex++] = coordinates[offset2 + 1];
+
+            vertices[vIndex++] = coordinates[offset4];
+            vertices[vIndex++] = coordinates[offset4 + 1];
+
+            vertices[vIndex++] = coordinates[offset1];
+            vertices[vIndex++] = coordinates[offset1 + 1];
+
+            vertices[vIndex++] = coordinates[offset3];
+            vertices[vIndex++] = coordinates[offset3 + 1];
+
+            vertices[vIndex++] = coordinates[offset4];
+            vertices[vIndex++] = coordinates[offset4 + 1];
+         }
+         else
+         {
+            const uint16_t baseCoord = gate;
+
+            size_t offset1 = ((startRadial + radial) % radials *
+                                 common::MAX_DATA_MOMENT_GATES +
+                              baseCoord) *
+                             2;
+            size_t offset2 = (((startRadial + radial + 1) % radials) *
+                                 common::MAX_DATA_MOMENT_GATES +
+                              baseCoord) *
+                             2;
+
+            vertices[vIndex++] = radarLatitude;
+            vertices[vIndex++] = radarLongitude;
+
+            vertices[vIndex++] = coordinates[offset1];
+            vertices[vIndex++] = coordinates[offset1 + 1];
+
+            vertices[vIndex++] = coordinates[offset2];
+            vertices[vIndex++] = coordinates[offset2 + 1];
+         }
+      }
+
+      return count;
+   };
+
+   // Count each radial, and offset each from the preceding radials
+   std::vector<std::size_t> radialOffsets {};
+   const std::size_t        outputSize = ComputeRadialOffsets(
+      parameters, 0u, radials, 0u, radialOffsets, computeRadial);
+
+   vertices.clear();
+   vertices.resize(outputSize * VALUES_PER_VERTEX);
+   vertices.shrink_to_fit();
+
+   dataMoments8.resize(outputSize);
+   dataMoments8.shrink_to_fit();
+
+   // Store each radial at its offset
+   StoreRadials(parameters, 0u, radials, radialOffsets, computeRadial);
+}
+
+/**
+ * Computes a decimated level of a Level 3 radial sweep, merging blocks of
+ * radialStride radials and gateStride gates into cells. The level is stored
+ * after the preceding levels.
+ */
+static SweepLevel ComputeLevel3RadialSweepLevel(
+   const wsr88d::rpg::GenericRadialDataPacket& radialData,
+   const SweepParameters&                      parameters,
+   const std::vector<float>&                   coordinates,
+   std::uint16_t                               startRadial,
+   std::int32_t                                gateSize,
+   std::size_t                                 radialStride,
+   std::size_t                                 gateStride,
+   SweepGeometry&                              geometry)
+{
+   const bool smoothingEnabled = parameters.smoothingEnabled_;
+
+   const std::size_t  radials = radialData.number_of_radials();
+   const std::int32_t numberOfDataMomentGates =
+      radialData.number_of_range_bins();
+   const std::size_t blockCount = (radials + radialStride - 1u) / radialStride;
+
+   std::vector<float>&   vertices     = geometry.vertices_;
+   std::vector<uint8_t>& dataMoments8 = geometry.dataMoments8_;
+
+   const std::uint16_t snrThreshold = parameters.snrThreshold_;
+   const auto          mergedGates  = static_cast<std::int32_t>(gateStride);
+
+   // Compute gate range [startGate, endGate), skipping the radar site origin
+   // when smoothing
+   const std::int32_t startGate = (smoothingEnabled) ? 1 : 0;
+   const std::int32_t endGate   = std::min<std::int32_t>(
+      numberOfDataMomentGates * gateSize, common::MAX_DATA_MOMENT_GATES);
+
+   // Data moment gates [0, drawnGates) are drawn. Smoothing requires one more
+   // data moment gate.
+   std::int32_t drawnGates = std::max(0, (endGate - startGate) / gateSize);
+   if (smoothingEnabled)
+   {
+      drawnGates = std::min(drawnGates, numberOfDataMomentGates - 1);
+   }
+
+   // Gets the data moment of the representative gate of the cell merging
+   // radials [firstRadial, endRadial) and gates [firstGate, endGate), the last
+   // visible gate in drawing order
+   auto getRepresentativeValue =
+      [&](std::size_t  firstRadial,
+          std::size_t  endRadial,
+          std::int32_t firstGate,
+          std::int32_t endGate) -> std::optional<std::uint8_t>
+   {
+      for (std::size_t radial = endRadial; radial-- > firstRadial;)
+      {
+         const auto& dataMomentsArray8 =
+            radialData.level(static_cast<std::uint16_t>(radial));
+
+         for (std::int32_t i = std::min<std::int32_t>(
+                 endGate, static_cast<std::int32_t>(dataMomentsArray8.size()));
+              i-- > firstGate;)
+         {
+            const std::uint8_t dataValue = dataMomentsArray8[i];
+            if (dataValue >= snrThreshold || dataValue == RANGE_FOLDED)
+            {
+               return dataValue;
+            }
+         }
+      }
+
+      return std::nullopt;
+   };
+
+   // Computes a block of radials, returning the number of data moments. Output
+   // is only stored when store is set, starting at the offset of the block.
+   auto computeBlock =
+      [&](std::size_t block, std::size_t offset, bool store) -> std::size_t
+   {
+      std::size_t count  = 0u;
+      std::size_t vIndex = offset * VALUES_PER_VERTEX;
+      std::size_t mIndex = offset;
+
+      const std::size_t firstRadial = block * radialStride;
+      const std::size_t endRadial =
+         std::min(firstRadial + radialStride, radials);
+
+      const auto& dataMomentsArray8 =
+         radialData.level(static_cast<std::uint16_t>(firstRadial));
+      const auto& nextDataMomentsArray8 =
+         radialData.level(static_cast<std::uint16_t>(endRadial % radials));
+
+      // First coordinate of the first and next radial edge of the block
+      const std::size_t radialCoordinate =
+         (startRadial + firstRadial) % radials * common::MAX_DATA_MOMENT_GATES;
+      const std::size_t nextRadialCoordinate =
+         (startRadial + endRadial) % radials * common::MAX_DATA_MOMENT_GATES;
+
+      for (std::int32_t i = 0; i < drawnGates; i += mergedGates)
+      {
+         // Data moment gates [i, nextGate) are merged into a single cell
+         const std::int32_t nextGate = std::min(i + mergedGates, drawnGates);
+         const std::int32_t gate     = startGate + i * gateSize;
+         const std::int32_t cellSize = (nextGate - i) * gateSize;
+
+         const std::size_t vertexCount =
+            (gate > 0) ? kVerticesPerGate_ : kVerticesPerOriginGate_;
+
+         if (!smoothingEnabled)
+         {
+            const std::optional<std::uint8_t> dataValue =
+               getRepresentativeValue(firstRadial, endRadial, i, nextGate);
+
+            if (!dataValue.has_value())
+            {
+               continue;
+            }
+
+            count += vertexCount;
+            if (!store)
+            {
+               continue;
+            }
+
+            for (std::size_t m = 0; m < vertexCount; m++)
+            {
+               dataMoments8[mIndex++] = dataValue.value();
+            }
+         }
+         else
+         {
+            // Validate indices are all in range
+            if (static_cast<std::size_t>(nextGate) >=
+                   dataMomentsArray8.size() ||
+                static_cast<std::size_t>(nextGate) >=
+                   nextDataMomentsArray8.size())
+            {
+               continue;
+            }
+
+            const std::uint8_t& dm1 = dataMomentsArray8[i];
+            const std::uint8_t& dm2 = dataMomentsArray8[nextGate];
+            const std::uint8_t& dm3 = nextDataMomentsArray8[i];
+            const std::uint8_t& dm4 = nextDataMomentsArray8[nextGate];
+
+            if (IsSmoothedDataHidden(parameters, dm1, dm2, dm3, dm4))
+            {
+               // Skip only if all data moments are hidden
+               continue;
+            }
+
+            count += vertexCount;
+            if (!store)
+            {
+               continue;
+            }
+
+            StoreSmoothedDataMoments(parameters,
+                                     dm1,
+                                     dm2,
+                                     dm3,
+                                     dm4,
+                                     {},
+                                     false,
+                                     dataMoments8,
+                                     mIndex);
+         }
+
+         StoreGateVertices(parameters,
+                           coordinates,
+                           radialCoordinate,
+                           nextRadialCoordinate,
+                           gate,
+                           cellSize,
+                           vertices,
+                           vIndex);
+      }
+
+      return count;
+   };
+
+   // Count each block, and offset each from the preceding levels and blocks
+   const std::size_t firstOffset = dataMoments8.size();
+
+   std::vector<std::size_t> blockOffsets {};
+   const std::size_t        outputSize = ComputeRadialOffsets(
+      parameters, 0u, blockCount, firstOffset, blockOffsets, computeBlock);
+
+   vertices.resize(outputSize * VALUES_PER_VERTEX);
+   dataMoments8.resize(outputSize);
+
+   // Store each block at its offset
+   StoreRadials(parameters, 0u, blockCount, blockOffsets, computeBlock);
+
+   SweepLevel level {};
+   level.offset_ = firstOffset;
+   level.count_  = outputSize - firstOffset;
+   return level;
+}
+
+void ComputeLevel3RadialSweepLevels(
+   const wsr88d::rpg::GenericRadialDataPacket& radialData,
+   const SweepParameters&                      parameters,
+   const std::vector<float>&                   coordinates,
+   std::uint16_t                               startRadial,
+   std::uint16_t                               dataMomentInterval,
+   SweepGeometry&                              geometry)
+{
+   std::vector<SweepLevel>& levels = geometry.levels_;
+
+   const std::size_t radials = radialData.number_of_radials();
+
+   // Compute gate size (number of base gates per bin)
+   const std::uint16_t gateSize = std::max<std::uint16_t>(
+      1,
+      dataMomentInterval / static_cast<std::uint16_t>(parameters.gateSize_));
+   const float nativeGateLength =
+      static_cast<float>(gateSize) * parameters.gateSize_;
+
+   // The first level is the full resolution sweep
+   levels.assign(1u, {nativeGateLength, 0u, GetSweepSize(geometry)});
+
+   if (radials == 0u || nativeGateLength <= 0.0f)
+   {
+      return;
+   }
+
+   const float nativeRadialWidth = 360.0f / static_cast<float>(radials);
+
+   for (const auto& [radialStride, gateStride] :
+        GetLevelsOfDetail(nativeRadialWidth, nativeGateLength))
+   {
+      SweepLevel level = ComputeLevel3RadialSweepLevel(radialData,
+                                                       parameters,
+                                                       coordinates,
+                                                       startRadial,
+                                                       gateSize,
+                                                       radialStride,
+                                                       gateStride,
+                                                       geometry);
+
+      level.gateLength_ = static_cast<float>(gateStride) * nativeGateLength;
+      levels.push_back(level);
+   }
+}
+
+void ComputeLevel3RadialBinLookup(
+   const wsr88d::rpg::GenericRadialDataPacket& radialData,
+   const SweepParameters&                      parameters,
+   SweepBinLookup&                             lookup)
+{
+   const std::uint16_t numRadials = radialData.number_of_radials();
+
+   InitializeBinLookup(parameters, numRadials, lookup);
+
+   for (std::uint16_t radial = 0u; radial < numRadials; ++radial)
+   {
+      AddBinLookupRadial(lookup,
+                         radial,
+                         radialData.start_angle(radial),
+                         radialData.start_angle((radial + 1) % numRadials));
+   }
+}
+
+std::size_t
+GetLevel3RasterColumns(const wsr88d::rpg::RasterDataPacket& rasterData)
+{
+   const uint16_t rows       = rasterData.number_of_rows();
+   size_t         maxColumns = 0;
+   for (uint16_t r = 0; r < rows; r++)
+   {
+      maxColumns = std::max<size_t>(maxColumns, rasterData.level(r).size());
+   }
+
+   return maxColumns;
+}
+
+void ComputeLevel3RasterCoordinates(
+   const wsr88d::rpg::RasterDataPacket& rasterData,
+   const SweepParameters&               parameters,
+   std::uint16_t                        xResolution,
+   std::uint16_t                        yResolution,
+   float                                range,
+   std::size_t                          maxColumns,
+   std::vector<float>&                  coordinates)
+{
+   const GeographicLib::Geodesic& geodesic =
+      util::GeographicLib::DefaultGeodesic();
+
+   const bool     smoothingEnabled = parameters.smoothingEnabled_;
+   const uint16_t rows             = rasterData.number_of_rows();
+
+   const double iCoordinate =
+      (-rasterData.i_coordinate_start() - 1.0 - range) * 1000.0;
+   const double jCoordinate =
+      (rasterData.j_coordinate_start() + 1.0 + range) * 1000.0;
+   const double xOffset = (smoothingEnabled) ? xResolution * 0.5 : 0.0;
+   const double yOffset = (smoothingEnabled) ? yResolution * 0.5 : 0.0;
+
+   const std::size_t numCoordinates =
+      static_cast<size_t>(rows + 1) * static_cast<size_t>(maxColumns + 1);
+   const auto coordinateRange =
+      boost::irange<uint32_t>(0, static_cast<uint32_t>(numCoordinates));
+
+   coordinates.resize(numCoordinates * 2);
+
+   std::for_each(
+      std::execution::par_unseq,
+      coordinateRange.begin(),
+      coordinateRange.end(),
+      [&](uint32_t index)
+      {
+         // For each row or column, there is one additional coordinate. Each bin
+         // is bounded by 4 coordinates.
+         const uint32_t col = index % (rows + 1);
+         const uint32_t row = index / (rows + 1);
+
+         const double i = iCoordinate + xResolution * col + xOffset;
+         const double j = jCoordinate - yResolution * row - yOffset;
+
+         // Calculate polar coordinates based on i and j
+         const double angle  = std::atan2(i, j) * 180.0 / M_PI;
+         const double range  = std::sqrt(i * i + j * j);
+         const size_t offset = static_cast<size_t>(index) * 2;
+
+         double latitude;
+         double longitude;
+
+         geodesic.Direct(parameters.radarLatitude_,
+                         parameters.radarLongitude_,
+                         angle,
+                         range,
+                         latitude,
+                         longitude);
+
+         coordinates[offset]     = latitude;
+         coordinates[offset + 1] = longitude;
+      });
+}
+
+void ComputeLevel3RasterSweep(const wsr88d::rpg::RasterDataPacket& rasterData,
+                              const SweepParameters&               parameters,
+                              const std::vector<float>&            coordinates,
+                              std::size_t                          maxColumns,
+                              SweepGeometry&                       geometry)
+{
+   const bool smoothingEnabled = parameters.smoothingEnabled_;
+
+   std::vector<float>&   vertices     = geometry.vertices_;
+   std::vector<uint8_t>& dataMoments8 = geometry.dataMoments8_;
+
+   const uint16_t snrThreshold = parameters.snrThreshold_;
+
+   const std::size_t rowCount = (smoothingEnabled) ?
+                                   rasterData.number_of_rows() - 1 :
+                                   rasterData.number_of_rows();
+
+   // Computes a single row, returning the number of data moments. Output is
+   // only stored when store is set, starting at the offset of the row.
+   auto computeRow =
+      [&](std::size_t row, std::size_t offset, bool store) -> std::size_t
+   {
+      std::size_t count  = 0u;
+      size_t      vIndex = offset * VALUES_PER_VERTEX;
+      size_t      mIndex = offset;
+
+      const std::size_t nextRow =
+         (row == static_cast<std::size_t>(rasterData.number_of_rows() - 1)) ?
+            0 :
+            row + 1;
+
+      const auto& dataMomentsArray8 =
+         rasterData.level(static_cast<uint16_t>(row));
+      const auto& nextDataMomentsArray8 =
+         rasterData.level(static_cast<uint16_t>(nextRow));
+
+      for (size_t bin = 0; bin < dataMomentsArray8.size(); ++bin)
+      {
+         if (!smoothingEnabled)
+         {
+            static constexpr std::size_t vertexCount = 6;
+
+            // Store data moment value
+            const std::uint8_t& dataValue = dataMomentsArray8[bin];
+            if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
+            {
+               continue;
+            }
+
+            count += vertexCount;
+            if (!store)
+            {
+               continue;
+            }
+
+            for (size_t m = 0; m < vertexCount; m++)
+            {
+               dataMoments8[mIndex++] = dataValue;
+            }
+         }
+         else
+         {
+            // Validate indices are all in range
+            if (bin + 1 >= dataMomentsArray8.size() ||
+                bin + 1 >= nextDataMomentsArray8.size())
+            {
+               continue;
+            }
+
+            const std::uint8_t& dm1 = dataMomentsArray8[bin];
+            const std::uint8_t& dm2 = dataMomentsArray8[bin + 1];
+            const std::uint8_t& dm3 = nextDataMomentsArray8[bin];
+            const std::uint8_t& dm4 = nextDataMomentsArray8[bin + 1];
+
+            if (IsSmoothedDataHidden(parameters, dm1, dm2, dm3, dm4))
+            {
+               // Skip only if all data moments are hidden
+               continue;
+            }
+
+            count += VERTICES_PER_BIN;
+            if (!store)
+            {
+               continue;
+            }
+
+            // The order must match the store vertices section below
+            dataMoments8[mIndex++] = RemapDataMoment(parameters, dm1);
+            dataMoments8[mIndex++] = RemapDataMoment(parameters, dm2);
+            dataMoments8[mIndex++] = RemapDataMoment(parameters, dm4);
+            dataMoments8[mIndex++] = RemapDataMoment(parameters, dm1);
+            dataMoments8[mIndex++] = RemapDataMoment(parameters, dm3);
+            dataMoments8[mIndex++] = RemapDataMoment(parameters, dm4);
+         }
+
+         // Store vertices
+         size_t offset1 = (row * (maxColumns + 1) + bin) * 2;
+         size_t offset2 = offset1 + 2;
+         size_t offset3 = ((row + 1) * (maxColumns + 1) + bin) * 2;
+         size_t offset4 = offset3 + 2;
+
+         vertices[vIndex++] = coordinates[offset1];
+         vertices[vIndex++] = coordinates[offset1 + 1];
+
+         vertices[vIndex++] = coordinates[offset2];
+         vertices[vIndex++] = coordinates[offset2 + 1];
+
+         vertices[vIndex++] = coordinates[offset4];
+         vertices[vIndex++] = coordinates[offset4 + 1];
+
+         vertices[vIndex++] = coordinates[offset1];
+         vertices[vIndex++] = coordinates[offset1 + 1];
+
+         vertices[vIndex++] = coordinates[offset3];
+         vertices[vIndex++] = coordinates[offset3 + 1];
+
+         vertices[vIndex++] = coordinates[offset4];
+         vertices[vIndex++] = coordinates[offset4 + 1];
+      }
+
+      return count;
+   };
+
+   // Count each row, and offset each from the preceding rows
+   std::vector<std::size_t> rowOffsets {};
+   const std::size_t        outputSize = ComputeRadialOffsets(
+      parameters, 0u, rowCount, 0u, rowOffsets, computeRow);
+
+   vertices.clear();
+   vertices.resize(outputSize * VALUES_PER_VERTEX);
+   vertices.shrink_to_fit();
+
+   dataMoments8.resize(outputSize);
+   dataMoments8.shrink_to_fit();
+
+   // Store each row at its offset
+   StoreRadials(parameters, 0u, rowCount, rowOffsets, computeRow);
+}
+
+/**
+ * Extends the bounds of a sector to include a position.
+ */
+static inline void
+ExtendSectorBounds(SweepSector& sector, float latitude, float longitude)
+{
+   sector.minLatitude_  = std::min(sector.minLatitude_, latitude);
+   sector.minLongitude_ = std::min(sector.minLongitude_, longitude);
+   sector.maxLatitude_  = std::max(sector.maxLatitude_, latitude);
+   sector.maxLongitude_ = std::max(sector.maxLongitude_, longitude);
+}
+
+/**
+ * Extends the bounds of a sector to include the polar cells between two radial
+ * edge azimuths and two ranges. Positions are interpolated between samples of
+ * the geodesic table, so the cells are bounded by the surrounding samples.
+ */
+static void ExtendPolarSectorBounds(const GeodesicTable& table,
+                                    float                startAzimuth,
+                                    float                endAzimuth,
+                                    float                nearRange,
+                                    float                farRange,
+                                    SweepSector&         sector)
+{
+   // Radial edges wrap at 360 degrees
+   if (endAzimuth < startAzimuth)
+   {
+      endAzimuth += 360.0f;
+   }
+
+   const auto azimuths     = static_cast<std::int64_t>(table.azimuths_);
+   const auto firstAzimuth = static_cast<std::int64_t>(
+      std::floor(startAzimuth / table.azimuthInterval_));
+   const auto lastAzimuth  = static_cast<std::int64_t>(
+      std::ceil(endAzimuth / table.azimuthInterval_));
+
+   // Ranges beyond the table are clamped to its last sample
+   const std::size_t lastSample = table.ranges_ - 1u;
+   const std::size_t firstRange =
+      std::min(static_cast<std::size_t>(nearRange / table.rangeInterval_),
+               lastSample);
+   const std::size_t lastRange  = std::min(
+      static_cast<std::size_t>(std::ceil(farRange / table.rangeInterval_)),
+      lastSample);
+
+   const auto radarLatitude  = static_cast<float>(table.radarLatitude_);
+   const auto radarLongitude = static_cast<float>(table.radarLongitude_);
+
+   for (std::int64_t azimuth = firstAzimuth; azimuth <= lastAzimuth; ++azimuth)
+   {
+      const auto column =
+         static_cast<std::size_t>((azimuth % azimuths + azimuths) % azimuths);
+
+      for (std::size_t range = firstRange; range <= lastRange; ++range)
+      {
+         const std::size_t sample = (range * table.azimuths_ + column) * 2u;
+
+         ExtendSectorBounds(sector,
+                            radarLatitude + table.offsets_[sample],
+                            radarLongitude + table.offsets_[sample + 1]);
+      }
+   }
+}
+
+/**
+ * Computes the bounds of a sector of the polar layout. Consecutive cells
+ * between the same radial edges are bounded together.
+ */
+static void ComputePolarSectorBounds(const PolarSweepGeometry& polar,
+                                     const GeodesicTable&      table,
+                                     SweepSector&              sector)
+{
+   const std::vector<std::uint16_t>& cells = polar.cells_;
+
+   // Gate edge 0 is the radar site
+   auto gateRange = [&polar](std::uint16_t gateEdge)
+   {
+      return (gateEdge == 0u) ? 0.0f :
+                                (static_cast<float>(gateEdge) - 1.0f +
+                                 polar.gateRangeOffset_) *
+                                   polar.gateSize_;
+   };
+
+   const std::size_t endCell = sector.offset_ + sector.count_;
+
+   for (std::size_t cell = sector.offset_; cell < endCell;)
+   {
+      const std::size_t   edges           = cell * kEdgesPerCell_;
+      const std::uint16_t startRadialEdge = cells[edges];
+      const std::uint16_t endRadialEdge   = cells[edges + 1];
+      std::uint16_t       nearGateEdge    = cells[edges + 2];
+      std::uint16_t       farGateEdge     = cells[edges + 3];
+
+      for (++cell; cell < endCell; ++cell)
+      {
+         const std::size_t nextEdges = cell * kEdgesPerCell_;
+
+         if (cells[nextEdges] != startRadialEdge ||
+             cells[nextEdges + 1] != endRadialEdge)
+         {
+            break;
+         }
+
+         nearGateEdge = std::min(nearGateEdge, cells[nextEdges + 2]);
+         farGateEdge  = std::max(farGateEdge, cells[nextEdges + 3]);
+      }
+
+      ExtendPolarSectorBounds(table,
+                              polar.radialAngles_[startRadialEdge],
+                              polar.radialAngles_[endRadialEdge],
+                              gateRange(nearGateEdge),
+                              gateRange(farGateEdge),
+                              sector);
+   }
+}
+
+/**
+ * Computes the bounds of a sector of the indexed layout from the coordinates of
+ * its indices.
+ */
+static void
+ComputeIndexedSectorBounds(const std::vector<std::uint32_t>& indices,
+                           const std::vector<float>&         coordinates,
+                           SweepSector&                      sector)
+{
+   const std::size_t endIndex = sector.offset_ + sector.count_;
+
+   for (std::size_t i = sector.offset_; i < endIndex; ++i)
+   {
+      const std::size_t coordinate = static_cast<std::size_t>(indices[i]) * 2u;
+
+      ExtendSectorBounds(
+         sector, coordinates[coordinate], coordinates[coordinate + 1]);
+   }
+}
+
+/**
+ * Computes the bounds of a sector of the vertex layout from its vertices.
+ */
+static void ComputeVertexSectorBounds(const std::vector<float>& vertices,
+                                      SweepSector&              sector)
+{
+   const std::size_t endVertex = sector.offset_ + sector.count_;
+
+   for (std::size_t v = sector.offset_; v < endVertex; ++v)
+   {
+      ExtendSectorBounds(sector,
+                         vertices[v * VALUES_PER_VERTEX],
+                         vertices[v * VALUES_PER_VERTEX + 1]);
+   }
+}
+
+void ComputeSweepSectors(const std::vector<float>& coordinates,
+                         const GeodesicTable*      geodesicTable,
+                         SweepGeometry&            geometry)
+{
+   std::vector<SweepLevel>& levels = geometry.levels_;
+   const SweepLayout        layout = geometry.layout_;
+
+   if (levels.empty())
+   {
+      // The sweep is drawn at full resolution
+      levels.assign(1u, {0.0f, 0u, GetSweepSize(geometry)});
+   }
+
+   if ((layout == SweepLayout::Indexed && coordinates.empty()) ||
+       (layout == SweepLayout::Polar &&
+        (geodesicTable == nullptr || geodesicTable->offsets_.empty())))
+   {
+      // Sectors cannot be bounded, and each level is drawn in full
+      for (SweepLevel& level : levels)
+      {
+         level.sectors_.clear();
+      }
+      return;
+   }
+
+   // Polar cells are a single gate, and other gates are two triangles
+   const std::size_t sectorSize =
+      (layout == SweepLayout::Polar) ? kGatesPerSector_ :
+                                       kGatesPerSector_ * kVerticesPerGate_;
+
+   for (SweepLevel& level : levels)
+   {
+      std::vector<SweepSector>& sectors = level.sectors_;
+
+      sectors.clear();
+      sectors.reserve((level.count_ + sectorSize - 1u) / sectorSize);
+
+      // Each gate is one or two triangles, so sectors begin on a triangle
+      for (std::size_t offset = 0u; offset < level.count_;
+           offset += sectorSize)
+      {
+         SweepSector& sector  = sectors.emplace_back();
+         sector.offset_       = level.offset_ + offset;
+         sector.count_        = std::min(sectorSize, level.count_ - offset);
+         sector.minLatitude_  = std::numeric_limits<float>::max();
+         sector.minLongitude_ = std::numeric_limits<float>::max();
+         sector.maxLatitude_  = std::numeric_limits<float>::lowest();
+         sector.maxLongitude_ = std::numeric_limits<float>::lowest();
+      }
+
+      std::for_each(std::execution::par_unseq,
+                    sectors.begin(),
+                    sectors.end(),
+                    [&](SweepSector& sector)
+                    {
+                       switch (layout)
+                       {
+                       case SweepLayout::Indexed:
+                          ComputeIndexedSectorBounds(
+                             geometry.indices_, coordinates, sector);
+                          break;
+
+                       case SweepLayout::Polar:
+                          ComputePolarSectorBounds(
+                             geometry.polar_, *geodesicTable, sector);
+                          break;
+
+                       default:
+                          ComputeVertexSectorBounds(geometry.vertices_, sector);
+                          break;
+                       }
+                    });
+   }
+}
+
+void CullSweepSectors(const SweepLevel&         level,
+                      const common::Coordinate& southWest,
+                      const common::Coordinate& northEast,
+                      std::size_t               maxDrawnCulledSectors,
+                      std::vector<std::pair<std::size_t, std::size_t>>& ranges)
+{
+   ranges.clear();
+
+   if (level.count_ == 0u)
+   {
+      return;
+   }
+
+   if (level.sectors_.empty())
+   {
+      // Sectors were not bounded, so the level is drawn in full
+      ranges.emplace_back(level.offset_, level.count_);
+      return;
+   }
+
+   std::size_t culledSectors = 0u;
+
+   for (const SweepSector& sector : level.sectors_)
+   {
+      if (sector.maxLatitude_ < southWest.latitude_ ||
+          sector.minLatitude_ > northEast.latitude_ ||
+          sector.maxLongitude_ < southWest.longitude_ ||
+          sector.minLongitude_ > northEast.longitude_)
+      {
+         ++culledSectors;
+         continue;
+      }
+
+      if (!ranges.empty() && culledSectors <= maxDrawnCulledSectors)
+      {
+         // Extend the preceding range through this sector
+         ranges.back().second =
+            sector.offset_ + sector.count_ - ranges.back().first;
+      }
+      else
+      {
+         ranges.emplace_back(sector.offset_, sector.count_);
+      }
+
+      culledSectors = 0u;
+   }
+}
+
+const SweepLevel& SelectSweepLevel(const std::vector<SweepLevel>& levels,
+                                   double metersPerPixel)
+{
+   // Levels are ordered from the full resolution sweep
+   auto it = std::find_if(levels.crbegin(),
+                          levels.crend(),
+                          [metersPerPixel](const SweepLevel& level)
+                          { return level.gateLength_ <= metersPerPixel; });
+
+   return (it != levels.crend()) ? *it : levels.front();
+}
+
+void ComputeLevel3ColorTableLut(
+   const common::ColorTable&                   colorTable,
+   const wsr88d::rpg::ProductDescriptionBlock& descriptionBlock,
+   std::uint8_t                                rangeMin,
+   std::uint8_t                                threshold,
+   std::vector<boost::gil::rgba8_pixel_t>&     lut)
+{
+   const std::uint16_t numberOfLevels = descriptionBlock.number_of_levels();
+
+   // Iterate over [rangeMin, numberOfLevels)
+   boost::integer_range<uint16_t> dataRange =
+      boost::irange<uint16_t>(rangeMin, numberOfLevels);
+
+   lut.resize(numberOfLevels - rangeMin);
+   lut.shrink_to_fit();
+
+   std::for_each(
+      std::execution::par_unseq,
+      dataRange.begin(),
+      dataRange.end(),
+      [&](uint16_t i)
+      {
+         const size_t lutIndex = i - *dataRange.begin();
+
+         std::optional<float> f = descriptionBlock.data_value(i);
+
+         // Different products use different scale/offset formulas
+         if (numberOfLevels > 16 || !descriptionBlock.IsDataLevelCoded())
+         {
+            if (i == RANGE_FOLDED && threshold > RANGE_FOLDED)
+            {
+               lut[lutIndex] = colorTable.rf_color();
+            }
+            else
+            {
+               if (f.has_value())
+               {
+                  lut[lutIndex] = colorTable.Color(f.value());
+               }
+               else
+               {
+                  lut[lutIndex] = boost::gil::rgba8_pixel_t {0, 0, 0, 0};
+               }
+            }
+         }
+         else
+         {
+            std::optional<wsr88d::DataLevelCode> dataLevelCode =
+               descriptionBlock.data_level_code(i);
+
+            if (dataLevelCode == wsr88d::DataLevelCode::RangeFolded)
+            {
+               lut[lutIndex] = colorTable.rf_color();
+            }
+            else if (f.has_value())
+            {
+               lut[lutIndex] = colorTable.Color(f.value());
+            }
+            else
+            {
+               lut[lutIndex] = boost::gil::rgba8_pixel_t {0, 0, 0, 0};
+            }
+         }
+      });
+}
+
+static units::degrees<float> NormalizeAngle(units::degrees<float> angle)
+{
+   constexpr auto angleLimit = units::degrees<float> {180.0f};
+   constexpr auto fullAngle  = units::degrees<float> {360.0f};
+
+   // Normalize angle to [-180, 180)
+   while (angle < -angleLimit)
+   {
+      angle += fullAngle;
+   }
+   while (angle >= angleLimit)
+   {
+      angle -= fullAngle;
+   }
+
+   return angle;
+}
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,576 @@
+#pragma once
+
+#include <scwx/common/color_table.hpp>
+#include <scwx/common/geographic.hpp>
+#include <scwx/util/lru_cache.hpp>
+#include <scwx/wsr88d/rda/packed_elevation_scan.hpp>
+#include <scwx/wsr88d/rpg/generic_radial_data_packet.hpp>
+#include <scwx/wsr88d/rpg/product_description_block.hpp>
+#include <scwx/wsr88d/rpg/raster_data_packet.hpp>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <boost/gil/typedefs.hpp>
+
+/**
+ * The sweep geometry kernels convert radar data into the vertex and data
+ * moment buffers drawn by the radar product layer. They depend only on the
+ * decoded radar data, and do not require a radar product manager, a Qt
+ * application or an OpenGL context.
+ */
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+/**
+ * @brief Layout of the sweep geometry drawn by the radar product layer.
+ */
+enum class SweepLayout
+{
+   Vertices, ///< Latitude and longitude vertices, with a data moment each
+   Indexed,  ///< Shared radial coordinates, with vertex indices of each gate
+   Polar     ///< Radial and gate edges of each gate, projected on the GPU
+};
+
+/**
+ * @brief Parameters shared by the sweep geometry kernels.
+ */
+struct SweepParameters
+{
+   double        radarLatitude_ {};  ///< Radar latitude (degrees)
+   double        radarLongitude_ {}; ///< Radar longitude (degrees)
+   float         gateSize_ {};       ///< Base gate size (meters)
+   bool          smoothingEnabled_ {false};
+   bool          showSmoothedRangeFolding_ {false};
+   std::uint16_t snrThreshold_ {}; ///< Minimum displayed data level
+   std::uint16_t edgeValue_ {};    ///< Data level at the edge of smoothed data
+   SweepLayout   layout_ {SweepLayout::Vertices};
+
+   /// Returns true once the sweep is superseded, and may be abandoned
+   std::function<bool()> cancelled_ {};
+};
+
+/**
+ * @brief Polar sweep geometry. Each cell is described by four edges: the start
+ * and end radial edge, indexing radialAngles_, and the near and far gate edge.
+ * Gate edge 0 is the radar site, and gate edge n > 0 is (n - 1 +
+ * gateRangeOffset_) gates from the radar site.
+ */
+struct PolarSweepGeometry
+{
+   std::vector<float>         radialAngles_ {}; ///< Radial edge azimuths
+   std::vector<std::uint16_t> cells_ {};        ///< Edges of each cell
+   std::size_t                momentsPerCell_ {1u};
+   float                      gateSize_ {};        ///< Gate size (meters)
+   float                      gateRangeOffset_ {}; ///< Offset of gate edges
+};
+
+/**
+ * @brief Consecutive gates of a level of detail, in drawing order. Gates are
+ * drawn along each radial, so a sector covers a range of gates along one
+ * radial, or spans the end of one radial and the start of the next. A sector
+ * whose bounds are outside of the viewport need not be drawn.
+ */
+struct SweepSector
+{
+   std::size_t offset_ {};       ///< First index, cell or vertex of the sector
+   std::size_t count_ {};        ///< Number of indices, cells or vertices
+   float       minLatitude_ {};  ///< Southern bound (degrees)
+   float       minLongitude_ {}; ///< Western bound (degrees)
+   float       maxLatitude_ {};  ///< Northern bound (degrees)
+   float       maxLongitude_ {}; ///< Eastern bound (degrees)
+};
+
+/**
+ * @brief Level of detail of a sweep. Decimated levels merge gates and radials
+ * into larger cells, and are stored after the full resolution sweep in the same
+ * buffers.
+ */
+struct SweepLevel
+{
+   float       gateLength_ {}; ///< Range covered by each cell (meters)
+   std::size_t offset_ {};     ///< First index, cell or vertex of the level
+   std::size_t count_ {};      ///< Number of indices, cells or vertices
+
+   /// Sectors covering the level, in drawing order
+   std::vector<SweepSector> sectors_ {};
+};
+
+/**
+ * @brief Vertex and data moment buffers computed from a sweep. In the vertex
+ * layout, each vertex has a latitude and longitude, and a corresponding data
+ * moment. In the indexed layout, gates are drawn from the shared radial
+ * coordinates, and each coordinate has a corresponding data moment. Unless
+ * smoothing, the data moment of a gate is stored at its last vertex. In the
+ * polar layout, each cell has one data moment, or one data moment per corner
+ * when smoothing.
+ */
+struct SweepGeometry
+{
+   SweepLayout                layout_ {SweepLayout::Vertices};
+   std::vector<float>         vertices_ {};
+   std::vector<std::uint32_t> indices_ {}; ///< Coordinate indices (indexed)
+   PolarSweepGeometry         polar_ {};
+   std::vector<std::uint8_t>  dataMoments8_ {};
+   std::vector<std::uint16_t> dataMoments16_ {};
+   std::vector<std::uint8_t>  cfpMoments_ {};
+
+   /// Index of the first data moment, or the first coordinate index in the
+   /// indexed layout, computed for each radial (Level 2 only)
+   std::vector<std::size_t> radialMomentOffsets_ {};
+
+   /// Levels of detail, beginning with the full resolution sweep
+   std::vector<SweepLevel> levels_ {};
+};
+
+/**
+ * @brief Latitude and longitude offsets from the radar site, sampled on a
+ * regular grid of azimuths and ranges. Interpolating the table reconstructs
+ * geodesic coordinates without solving the direct geodesic problem per gate.
+ */
+struct GeodesicTable
+{
+   double      radarLatitude_ {};   ///< Radar latitude (degrees)
+   double      radarLongitude_ {};  ///< Radar longitude (degrees)
+   float       azimuthInterval_ {}; ///< Azimuth between samples (degrees)
+   float       rangeInterval_ {};   ///< Range between samples (meters)
+   std::size_t azimuths_ {};        ///< Number of samples covering 360 degrees
+   std::size_t ranges_ {};          ///< Number of samples, beginning at 0
+
+   /// Latitude and longitude offset of each sample, indexed by (range *
+   /// azimuths_ + azimuth) * 2
+   std::vector<float> offsets_ {};
+};
+
+/**
+ * @brief Locates the bin of a sweep under a coordinate. Coordinates are
+ * projected onto the plane tangent to the ellipsoid at the radar site in place
+ * of solving the inverse geodesic problem, and each azimuth bucket holds the
+ * radials covering it in place of searching the radials of the sweep.
+ */
+struct SweepBinLookup
+{
+   double equatorialRadius_ {};    ///< Ellipsoid equatorial radius (meters)
+   double eccentricity2_ {};       ///< Ellipsoid eccentricity squared
+   double meridionalRadius_ {};    ///< Meridian curvature at the radar site
+   double primeVerticalRadius_ {}; ///< Prime vertical curvature at the site
+   double sinLatitude_ {};         ///< Sine of the radar latitude
+   double cosLatitude_ {};         ///< Cosine of the radar latitude
+   double sinLongitude_ {};        ///< Sine of the radar longitude
+   double cosLongitude_ {};        ///< Cosine of the radar longitude
+
+   /// Earth-centered, earth-fixed coordinates of the radar site (meters)
+   std::array<double, 3> radarPosition_ {};
+
+   /// Start and end azimuth of each radial (degrees), indexed by radial * 2
+   std::vector<float> radialAzimuths_ {};
+
+   /// Up to two radials covering each azimuth bucket, indexed by bucket * 2
+   std::vector<std::uint16_t> buckets_ {};
+};
+
+/**
+ * @brief Bin of a sweep located by a bin lookup.
+ */
+struct SweepBin
+{
+   std::uint16_t radial_ {}; ///< Radial containing the coordinate
+   double        range_ {};  ///< Distance from the radar site (meters)
+};
+
+/**
+ * @brief Identifies the radial geometry of a Level 2 elevation scan. Elevation
+ * scans of the same radar site with equal keys have the same radial
+ * coordinates. Coordinates are computed for the maximum number of gates, so
+ * the key does not depend on the moment.
+ */
+struct Level2CoordinateKey
+{
+   bool smoothingEnabled_ {false};
+
+   /// Quantized azimuth of each radial edge
+   std::vector<std::int32_t> radialAngles_ {};
+   std::size_t               hash_ {};
+
+   bool operator==(const Level2CoordinateKey& o) const;
+};
+
+/**
+ * @brief Level 2 radial coordinates, cached by coordinate key. The cache is
+ * limited by the number of entries.
+ */
+typedef util::LruCache<Level2CoordinateKey,
+                       std::shared_ptr<const std::vector<float>>>
+   Level2CoordinateCache;
+
+/**
+ * Determines whether the sweep being computed has been cancelled. Kernels
+ * check for cancellation once for each radial, and leave their output
+ * incomplete once cancelled. Incomplete output must be discarded.
+ */
+bool IsSweepCancelled(const SweepParameters& parameters);
+
+/**
+ * Computes coordinates for radials of uniform width, beginning at 0 degrees.
+ *
+ * @param [in] numRadials Number of radials
+ * @param [in] radialAngle Width of each radial (degrees)
+ * @param [in] angleOffset Offset added to the angle of each radial (degrees)
+ * @param [in] gateRangeOffset Offset of each gate coordinate, in gates
+ * @param [in] parameters Sweep parameters
+ * @param [out] coordinates Latitude and longitude of each radial gate. Must be
+ * sized for numRadials * MAX_DATA_MOMENT_GATES coordinates.
+ */
+void ComputeUniformRadialCoordinates(std::uint32_t          numRadials,
+                                     float                  radialAngle,
+                                     float                  angleOffset,
+                                     float                  gateRangeOffset,
+                                     const SweepParameters& parameters,
+                                     std::vector<float>&    coordinates);
+
+/**
+ * Computes a table of geodesic offsets from the radar site. Sampled every 0.5
+ * degrees and 1 kilometer, bilinear interpolation of the table is within 6
+ * meters of the geodesic to a range of 460 kilometers. The bound requires
+ * interpolation weights in full precision, rather than the 8-bit weights of
+ * hardware texture filtering.
+ *
+ * @param [in] parameters Sweep parameters
+ * @param [in] azimuthInterval Azimuth between samples (degrees). Must divide
+ * 360 degrees.
+ * @param [in] rangeInterval Range between samples (meters)
+ * @param [in] maxRange Maximum range covered by the table (meters)
+ * @param [out] table Geodesic table
+ */
+void ComputeGeodesicTable(const SweepParameters& parameters,
+                          float                  azimuthInterval,
+                          float                  rangeInterval,
+                          float                  maxRange,
+                          GeodesicTable&         table);
+
+/**
+ * Locates the bin of a sweep under a coordinate. Within radar range, the
+ * distance is within 10 centimeters and the azimuth is within 0.001 degrees of
+ * the geodesic.
+ *
+ * @param [in] lookup Bin lookup computed for the sweep
+ * @param [in] latitude Latitude of the coordinate (degrees)
+ * @param [in] longitude Longitude of the coordinate (degrees)
+ *
+ * @return Bin under the coordinate, or std::nullopt if no radial covers the
+ * coordinate
+ */
+std::optional<SweepBin> FindSweepBin(const SweepBinLookup& lookup,
+                                     double                latitude,
+                                     double                longitude);
+
+/**
+ * Determines whether a Level 2 elevation scan is incomplete, based on the gap
+ * between its first and last radials.
+ */
+bool IsLevel2SweepIncomplete(const wsr88d::rda::PackedElevationScan& radarData);
+
+/**
+ * Computes the data level at the edge of smoothed Level 2 data.
+ */
+std::uint16_t ComputeLevel2EdgeValue(wsr88d::rda::DataBlockType dataBlockType,
+                                     float                      offset);
+
+/**
+ * Computes Level 2 radial coordinates from the azimuth angles of each radial.
+ * Coordinates are computed for MAX_DATA_MOMENT_GATES gates of each radial,
+ * regardless of the gates of each moment.
+ *
+ * @param [in] radarData Elevation scan
+ * @param [in] parameters Sweep parameters
+ * @param [in] firstRadial First radial to compute
+ * @param [out] coordinates Latitude and longitude of each radial gate, followed
+ * by the radar site. Must be sized for MAX_0_5_DEGREE_RADIALS *
+ * MAX_DATA_MOMENT_GATES + 1 coordinates.
+ */
+void ComputeLevel2Coordinates(
+   const wsr88d::rda::PackedElevationScan& radarData,
+   const SweepParameters&                  parameters,
+   std::size_t                             firstRadial,
+   std::vector<float>&                     coordinates);
+
+/**
+ * Computes the key identifying the Level 2 radial coordinates of an elevation
+ * scan. The key does not include the radar site or gate size.
+ *
+ * @param [in] radarData Elevation scan
+ * @param [in] parameters Sweep parameters
+ *
+ * @return Coordinate key
+ */
+Level2CoordinateKey
+ComputeLevel2CoordinateKey(const wsr88d::rda::PackedElevationScan& radarData,
+                           const SweepParameters&                  parameters);
+
+/**
+ * Computes the azimuth of each Level 2 radial edge, used in place of radial
+ * coordinates by the polar layout.
+ *
+ * @param [in] radarData Elevation scan
+ * @param [in] parameters Sweep parameters
+ * @param [in] firstRadial First radial to compute
+ * @param [out] radialAngles Azimuth of each radial edge (degrees). Must be
+ * sized for MAX_0_5_DEGREE_RADIALS angles.
+ */
+void ComputeLevel2RadialAngles(
+   const wsr88d::rda::PackedElevationScan& radarData,
+   const SweepParameters&                  parameters,
+   std::size_t                             firstRadial,
+   std::vector<float>&                     radialAngles);
+
+/**
+ * Computes Level 2 vertices and data moments. The moment must be loaded, and
+ * contain data for the first radial.
+ *
+ * @param [in] radarData Elevation scan
+ * @param [in] dataBlockType Displayed moment
+ * @param [in] parameters Sweep parameters
+ * @param [in] coordinates Coordinates computed by ComputeLevel2Coordinates.
+ * These are the vertices of the indexed layout. Unused by the polar layout,
+ * which instead requires the radial angles of the geometry to be computed by
+ * ComputeLevel2RadialAngles.
+ * @param [in] firstUpdatedRadial First radial to compute. Data computed for
+ * preceding radials is retained from the previous sweep. In the indexed
+ * layout, data moments of coordinates that are not drawn may also be retained.
+ * @param [in,out] geometry Sweep geometry
+ */
+void ComputeLevel2Sweep(
+   const wsr88d::rda::PackedElevationScan& radarData,
+   wsr88d::rda::DataBlockType              dataBlockType,
+   const SweepParameters&                  parameters,
+   const std::vector<float>&               coordinates,
+   std::size_t                             firstUpdatedRadial,
+   SweepGeometry&                          geometry);
+
+/**
+ * Computes decimated levels of detail of a Level 2 sweep, stored after the
+ * geometry computed by ComputeLevel2Sweep. Gates are merged along each radial,
+ * and radials are merged beginning with 0.5 degree radials. Unless smoothing, a
+ * merged cell takes the data moment of a representative visible gate. Decimated
+ * levels are computed for the indexed and polar layouts.
+ *
+ * @param [in] radarData Elevation scan
+ * @param [in] dataBlockType Displayed moment
+ * @param [in] parameters Sweep parameters
+ * @param [in,out] geometry Sweep geometry
+ */
+void ComputeLevel2SweepLevels(
+   const wsr88d::rda::PackedElevationScan& radarData,
+   wsr88d::rda::DataBlockType              dataBlockType,
+   const SweepParameters&                  parameters,
+   SweepGeometry&                          geometry);
+
+/**
+ * Computes the bin lookup of a Level 2 elevation scan. Each radial extends to
+ * the azimuth of the next radial, or the azimuth extrapolated from the
+ * preceding radial when the next radial is missing.
+ *
+ * @param [in] radarData Elevation scan
+ * @param [in] parameters Sweep parameters
+ * @param [out] lookup Bin lookup
+ */
+void ComputeLevel2BinLookup(const wsr88d::rda::PackedElevationScan& radarData,
+                            const SweepParameters&                  parameters,
+                            SweepBinLookup&                         lookup);
+
+/**
+ * Gets the range of data levels displayed for a Level 2 moment.
+ *
+ * @return Minimum and maximum data level
+ */
+std::pair<std::uint16_t, std::uint16_t>
+GetLevel2DataRange(wsr88d::rda::DataBlockType dataBlockType);
+
+/**
+ * Computes a Level 2 color table lookup table over a range of data levels.
+ */
+void ComputeLevel2ColorTableLut(
+   const common::ColorTable&               colorTable,
+   std::uint16_t                           rangeMin,
+   std::uint16_t                           rangeMax,
+   float                                   offset,
+   float                                   scale,
+   std::vector<boost::gil::rgba8_pixel_t>& lut);
+
+/**
+ * Computes Level 3 radial coordinates from the start and delta angles of each
+ * radial, for products without a standard radial size.
+ *
+ * @param [in] radialData Radial data
+ * @param [in] parameters Sweep parameters
+ * @param [out] coordinates Latitude and longitude of each radial gate. Must be
+ * sized for MAX_0_5_DEGREE_RADIALS * MAX_DATA_MOMENT_GATES coordinates.
+ */
+void ComputeLevel3RadialCoordinates(
+   const wsr88d::rpg::GenericRadialDataPacket& radialData,
+   const SweepParameters&                      parameters,
+   std::vector<float>&                         coordinates);
+
+/**
+ * Computes Level 3 radial vertices and data moments.
+ *
+ * @param [in] radialData Radial data
+ * @param [in] parameters Sweep parameters
+ * @param [in] coordinates Radial coordinates
+ * @param [in] startRadial Radial coordinate index of the first radial
+ * @param [in] dataMomentInterval Gate interval (meters)
+ * @param [out] geometry Sweep geometry
+ */
+void ComputeLevel3RadialSweep(
+   const wsr88d::rpg::GenericRadialDataPacket& radialData,
+   const SweepParameters&                      parameters,
+   const std::vector<float>&                   coordinates,
+   std::uint16_t                               startRadial,
+   std::uint16_t                               dataMomentInterval,
+   SweepGeometry&                              geometry);
+
+/**
+ * Computes decimated levels of detail of a Level 3 radial sweep, stored after
+ * the vertices computed by ComputeLevel3RadialSweep.
+ *
+ * @param [in] radialData Radial data
+ * @param [in] parameters Sweep parameters
+ * @param [in] coordinates Radial coordinates
+ * @param [in] startRadial Radial coordinate index of the first radial
+ * @param [in] dataMomentInterval Gate interval (meters)
+ * @param [in,out] geometry Sweep geometry
+ */
+void ComputeLevel3RadialSweepLevels(
+   const wsr88d::rpg::GenericRadialDataPacket& radialData,
+   const SweepParameters&                      parameters,
+   const std::vector<float>&                   coordinates,
+   std::uint16_t                               startRadial,
+   std::uint16_t                               dataMomentInterval,
+   SweepGeometry&                              geometry);
+
+/**
+ * Computes the bin lookup of Level 3 radial data. Each radial extends from its
+ * start angle to the start angle of the next radial.
+ *
+ * @param [in] radialData Radial data
+ * @param [in] parameters Sweep parameters
+ * @param [out] lookup Bin lookup
+ */
+void ComputeLevel3RadialBinLookup(
+   const wsr88d::rpg::GenericRadialDataPacket& radialData,
+   const SweepParameters&                      parameters,
+   SweepBinLookup&                             lookup);
+
+/**
+ * Gets the number of columns in the widest row of raster data.
+ */
+std::size_t
+GetLevel3RasterColumns(const wsr88d::rpg::RasterDataPacket& rasterData);
+
+/**
+ * Computes Level 3 raster grid coordinates.
+ *
+ * @param [in] rasterData Raster data
+ * @param [in] parameters Sweep parameters
+ * @param [in] xResolution Grid resolution in the x direction (meters)
+ * @param [in] yResolution Grid resolution in the y direction (meters)
+ * @param [in] range Product range (kilometers)
+ * @param [in] maxColumns Number of columns in the widest row
+ * @param [out] coordinates Latitude and longitude of each grid point
+ */
+void ComputeLevel3RasterCoordinates(
+   const wsr88d::rpg::RasterDataPacket& rasterData,
+   const SweepParameters&               parameters,
+   std::uint16_t                        xResolution,
+   std::uint16_t                        yResolution,
+   float                                range,
+   std::size_t                          maxColumns,
+   std::vector<float>&                  coordinates);
+
+/**
+ * Computes Level 3 raster vertices and data moments.
+ *
+ * @param [in] rasterData Raster data
+ * @param [in] parameters Sweep parameters
+ * @param [in] coordinates Coordinates computed by
+ * ComputeLevel3RasterCoordinates
+ * @param [in] maxColumns Number of columns in the widest row
+ * @param [out] geometry Sweep geometry
+ */
+void ComputeLevel3RasterSweep(const wsr88d::rpg::RasterDataPacket& rasterData,
+                              const SweepParameters&               parameters,
+                              const std::vector<float>&            coordinates,
+                              std::size_t                          maxColumns,
+                              SweepGeometry&                       geometry);
+
+/**
+ * Divides each level of detail of a sweep into sectors of consecutive gates,
+ * and computes the bounds of each sector. A sweep without levels of detail is
+ * given a single level. Sectors are not computed for the polar layout without
+ * a geodesic table.
+ *
+ * @param [in] coordinates Coordinates drawn by the indexed layout. Unused by
+ * the vertex and polar layouts.
+ * @param [in] geodesicTable Geodesic table projecting the polar layout. Unused
+ * by the vertex and indexed layouts.
+ * @param [in,out] geometry Sweep geometry
+ */
+void ComputeSweepSectors(const std::vector<float>& coordinates,
+                         const GeodesicTable*      geodesicTable,
+                         SweepGeometry&            geometry);
+
+/**
+ * Culls the sectors of a level of detail outside of bounds, and merges the
+ * remaining sectors into draw ranges. Visible sectors separated by no more than
+ * maxDrawnCulledSectors culled sectors are drawn in a single range, along with
+ * the culled sectors between them. A level without sectors is drawn in full.
+ *
+ * @param [in] level Level of detail
+ * @param [in] southWest South-west corner of the bounds
+ * @param [in] northEast North-east corner of the bounds
+ * @param [in] maxDrawnCulledSectors Culled sectors drawn to join two ranges
+ * @param [out] ranges First index, cell or vertex, and count of each range
+ */
+void CullSweepSectors(const SweepLevel&         level,
+                      const common::Coordinate& southWest,
+                      const common::Coordinate& northEast,
+                      std::size_t               maxDrawnCulledSectors,
+                      std::vector<std::pair<std::size_t, std::size_t>>& ranges);
+
+/**
+ * Selects the coarsest level of detail whose cells span no more than a pixel in
+ * range, or the full resolution sweep when each of its cells spans more.
+ *
+ * @param [in] levels Levels of detail, beginning with the full resolution
+ * sweep. Must not be empty.
+ * @param [in] metersPerPixel Map resolution (meters per pixel)
+ *
+ * @return Selected level of detail
+ */
+const SweepLevel& SelectSweepLevel(const std::vector<SweepLevel>& levels,
+                                   double metersPerPixel);
+
+/**
+ * Computes a Level 3 color table lookup table, over the data levels
+ * [rangeMin, number of levels).
+ */
+void ComputeLevel3ColorTableLut(
+   const common::ColorTable&                   colorTable,
+   const wsr88d::rpg::ProductDescriptionBlock& descriptionBlock,
+   std::uint8_t                                rangeMin,
+   std::uint8_t                                threshold,
+   std::vector<boost::gil::rgba8_pixel_t>&     lut);
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,55 @@
+cmake_minimum_required(VERSION 3.24)
+project(scwx-benchmark CXX)
+
+find_package(benchmark)
+
+set(SRC_BENCH_MAIN source/scwx/wxbench.cpp)
+set(HDR_BENCH_MAIN source/scwx/wxbench.hpp)
+set(SRC_AWIPS_BENCHMARKS source/scwx/awips/text_product_file.bench.cpp)
+set(SRC_GR_BENCHMARKS source/scwx/gr/placefile.bench.cpp)
+set(SRC_QT_VIEW_BENCHMARKS source/scwx/qt/view/sweep_geometry.bench.cpp)
+set(SRC_UTIL_BENCHMARKS source/scwx/util/decompress.bench.cpp)
+set(SRC_WSR88D_BENCHMARKS source/scwx/wsr88d/ar2v_file.bench.cpp
+                          source/scwx/wsr88d/level3_file.bench.cpp)
+set(SRC_WSR88D_RDA_BENCHMARKS source/scwx/wsr88d/rda/level2_message_factory.bench.cpp)
+
+set(BENCH_CMAKE_FILES benchmark.cmake)
+
+add_executable(wxbench ${SRC_BENCH_MAIN}
+                       ${HDR_BENCH_MAIN}
+                       ${SRC_AWIPS_BENCHMARKS}
+                       ${SRC_GR_BENCHMARKS}
+                       ${SRC_QT_VIEW_BENCHMARKS}
+                       ${SRC_UTIL_BENCHMARKS}
+                       ${SRC_WSR88D_BENCHMARKS}
+                       ${SRC_WSR88D_RDA_BENCHMARKS}
+                       ${BENCH_CMAKE_FILES})
+
+source_group("Header Files\\main"        FILES ${HDR_BENCH_MAIN})
+source_group("Source Files\\main"        FILES ${SRC_BENCH_MAIN})
+source_group("Source Files\\awips"       FILES ${SRC_AWIPS_BENCHMARKS})
+source_group("Source Files\\gr"          FILES ${SRC_GR_BENCHMARKS})
+source_group("Source Files\\qt\\view"    FILES ${SRC_QT_VIEW_BENCHMARKS})
+source_group("Source Files\\util"        FILES ${SRC_UTIL_BENCHMARKS})
+source_group("Source Files\\wsr88d"      FILES ${SRC_WSR88D_BENCHMARKS})
+source_group("Source Files\\wsr88d\\rda" FILES ${SRC_WSR88D_RDA_BENCHMARKS})
+
+set_target_properties(wxbench PROPERTIES CXX_STANDARD 20
+                                         CXX_STANDARD_REQUIRED ON
+                                         CXX_EXTENSIONS OFF)
+
+target_compile_definitions(wxbench PRIVATE SCWX_TEST_DATA_DIR="${SCWX_DIR}/test/data")
+
+if (MSVC)
+    # Don't include Windows macros
+    target_compile_options(wxbench PRIVATE -DNOMINMAX)
+
+    # Enable multi-processor compilation
+    target_compile_options(wxbench PRIVATE "/MP")
+endif()
+
+# Results are written in a machine-readable format with:
+#   wxbench --benchmark_out=<file> --benchmark_out_format=json
+target_link_libraries(wxbench benchmark::benchmark
+                              scwx-qt
+                              wxdata)
@@ -0,0 +1,50 @@
+#include "../wxbench.hpp"
+
+#include <scwx/awips/text_product_file.hpp>
+
+#include <sstream>
+
+#include <benchmark/benchmark.h>
+
+namespace scwx
+{
+namespace awips
+{
+
+static const std::vector<std::string> kTextProductFiles_ = {
+   "/warnings/warnings_20210604_21.txt",
+   "/warnings/warnings_20210606_15.txt",
+   "/text/PGUM_WHPQ41_CFWPQ1_202201231710.nids"};
+
+static void BM_TextProductFileLoadData(benchmark::State& state)
+{
+   const std::string& filename =
+      kTextProductFiles_[static_cast<std::size_t>(state.range(0))];
+
+   auto data = bench::ReadDataFile(filename);
+   if (!data.has_value())
+   {
+      state.SkipWithError("Test data not found");
+      return;
+   }
+
+   for (auto _ : state)
+   {
+      std::istringstream is(*data);
+      TextProductFile    file;
+
+      bool fileValid = file.LoadData(is);
+      benchmark::DoNotOptimize(fileValid);
+   }
+
+   state.SetLabel(filename);
+   state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                           static_cast<std::int64_t>(data->size()));
+}
+
+BENCHMARK(BM_TextProductFileLoadData)
+   ->DenseRange(0, static_cast<int>(kTextProductFiles_.size()) - 1)
+   ->Unit(benchmark::kMicrosecond);
+
+} // namespace awips
+} // namespace scwx
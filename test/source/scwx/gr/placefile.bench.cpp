@@ -0,0 +1,41 @@
+#include "../wxbench.hpp"
+
+#include <scwx/gr/placefile.hpp>
+
+#include <sstream>
+
+#include <benchmark/benchmark.h>
+
+namespace scwx
+{
+namespace gr
+{
+
+static const std::string kPlacefile_ =
+   "/gr/placefiles/placefile-old-example.txt";
+
+static void BM_PlacefileLoad(benchmark::State& state)
+{
+   auto data = bench::ReadDataFile(kPlacefile_);
+   if (!data.has_value())
+   {
+      state.SkipWithError("Test data not found");
+      return;
+   }
+
+   for (auto _ : state)
+   {
+      std::istringstream is(*data);
+
+      std::shared_ptr<Placefile> placefile = Placefile::Load(kPlacefile_, is);
+      benchmark::DoNotOptimize(placefile);
+   }
+
+   state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                           static_cast<std::int64_t>(data->size()));
+}
+
+BENCHMARK(BM_PlacefileLoad)->Unit(benchmark::kMicrosecond);
+
+} // namespace gr
+} // namespace scwx
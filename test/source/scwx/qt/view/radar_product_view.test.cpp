@@ -0,0 +1,182 @@
+#include <scwx/qt/view/radar_product_view.hpp>
+
+#include <atomic>
+#include <functional>
+#include <future>
+#include <mutex>
+
+#include <boost/asio/post.hpp>
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+/**
+ * A product view computing a sweep number in place of radar data. As in the
+ * product views, the sweep is computed before it is committed, and is not
+ * committed once superseded.
+ */
+class TestProductView : public RadarProductView
+{
+public:
+   TestProductView() : RadarProductView(nullptr) {}
+   ~TestProductView() { taskQueue_.join(); }
+
+   std::shared_ptr<common::ColorTable> color_table() const override
+   {
+      return nullptr;
+   }
+   float                     unit_scale() const override { return 1.0f; }
+   std::string               units() const override { return {}; }
+   std::uint16_t             vcp() const override { return 0u; }
+   const std::vector<float>& vertices() const override { return vertices_; }
+
+   void LoadColorTable(std::shared_ptr<common::ColorTable>) override {}
+   void SelectProduct(const std::string&) override {}
+
+   common::RadarProductGroup GetRadarProductGroup() const override
+   {
+      return common::RadarProductGroup::Unknown;
+   }
+   std::string GetRadarProductName() const override { return {}; }
+   std::tuple<const void*, std::size_t, std::size_t>
+   GetMomentData() const override
+   {
+      return {nullptr, 0u, 0u};
+   }
+
+   std::optional<std::uint16_t>
+   GetBinLevel(const common::Coordinate&) const override
+   {
+      return std::nullopt;
+   }
+   std::optional<wsr88d::DataLevelCode>
+   GetDataLevelCode(std::uint16_t) const override
+   {
+      return std::nullopt;
+   }
+   std::optional<float> GetDataValue(std::uint16_t) const override
+   {
+      return std::nullopt;
+   }
+
+   scwx::util::TaskQueue& queue() { return taskQueue_; }
+   void                   join() { taskQueue_.join(); }
+
+   // Invoked with the number of each sweep, before it is committed
+   std::function<void(int)> computing_ {};
+
+   std::atomic<int> computeCount_ {0};
+   int              sweep_ {0};
+
+protected:
+   scwx::util::TaskQueue& task_queue() override { return taskQueue_; }
+
+   void ConnectRadarProductManager() override {}
+   void DisconnectRadarProductManager() override {}
+   void UpdateColorTableLut() override {}
+
+   void ComputeSweep() override
+   {
+      const std::function<bool()> cancelled = sweep_cancelled();
+
+      std::scoped_lock sweepLock(sweep_mutex());
+
+      const int sweep = ++computeCount_;
+      if (computing_ != nullptr)
+      {
+         computing_(sweep);
+      }
+
+      if (cancelled())
+      {
+         return;
+      }
+
+      sweep_ = sweep;
+
+      Q_EMIT SweepComputed();
+   }
+
+private:
+   std::vector<float>    vertices_ {};
+   scwx::util::TaskQueue taskQueue_ {scwx::util::TaskPriority::Interactive};
+};
+
+TEST(RadarProductView, UpdatesAreCoalesced)
+{
+   static constexpr int kUpdateCount = 10;
+
+   TestProductView  view {};
+   std::atomic<int> sweepComputedCount {0};
+
+   QObject::connect(&view,
+                    &RadarProductView::SweepComputed,
+                    [&]() { ++sweepComputedCount; });
+
+   // Hold the task queue, so that each update is requested before the sweep
+   // is computed
+   std::promise<void> release {};
+   boost::asio::post(view.queue().get_executor(),
+                     [future = release.get_future()]() { future.wait(); });
+
+   for (int i = 0; i < kUpdateCount; ++i)
+   {
+      view.Update();
+   }
+
+   release.set_value();
+   view.join();
+
+   EXPECT_EQ(view.computeCount_, 1);
+   EXPECT_EQ(sweepComputedCount, 1);
+   EXPECT_EQ(view.sweep_, 1);
+}
+
+TEST(RadarProductView, SupersededSweepIsNotCommitted)
+{
+   TestProductView  view {};
+   std::atomic<int> sweepComputedCount {0};
+
+   QObject::connect(&view,
+                    &RadarProductView::SweepComputed,
+                    [&]() { ++sweepComputedCount; });
+
+   view.Update();
+   view.join();
+
+   ASSERT_EQ(view.sweep_, 1);
+   ASSERT_EQ(sweepComputedCount, 1);
+
+   int committedSweep = 0;
+
+   view.computing_ = [&](int sweep)
+   {
+      if (sweep == 2)
+      {
+         // Supersede the second sweep while it is being computed
+         view.Update();
+      }
+      else if (sweep == 3)
+      {
+         // The superseding sweep begins from the state of the first sweep
+         committedSweep = view.sweep_;
+      }
+   };
+
+   view.Update();
+   view.join();
+
+   EXPECT_EQ(view.computeCount_, 3);
+   EXPECT_EQ(committedSweep, 1);
+   EXPECT_EQ(view.sweep_, 3);
+   EXPECT_EQ(sweepComputedCount, 2);
+}
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,689 @@
+#include "../../wxbench.hpp"
+#include "sweep_test_data.hpp"
+
+#include <scwx/qt/view/sweep_geometry.hpp>
+#include <scwx/common/constants.hpp>
+#include <scwx/common/geographic.hpp>
+#include <scwx/wsr88d/ar2v_file.hpp>
+#include <scwx/wsr88d/level3_file.hpp>
+#include <scwx/wsr88d/rpg/graphic_product_message.hpp>
+
+#include <cmath>
+#include <sstream>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+static const std::vector<std::pair<SweepLayout, std::string>> kSweepLayouts_ =
+   {{SweepLayout::Vertices, ""},
+    {SweepLayout::Indexed, " (indexed)"},
+    {SweepLayout::Polar, " (polar)"}};
+
+static const std::vector<std::pair<wsr88d::rda::DataBlockType, std::string>>
+   kLevel2Moments_ = {{wsr88d::rda::DataBlockType::MomentRef, "REF"},
+                      {wsr88d::rda::DataBlockType::MomentVel, "VEL"},
+                      {wsr88d::rda::DataBlockType::MomentZdr, "ZDR"},
+                      {wsr88d::rda::DataBlockType::MomentPhi, "PHI"},
+                      {wsr88d::rda::DataBlockType::MomentRho, "RHO"}};
+
+static const std::vector<std::string> kLevel3RadialFiles_ = {
+   "LSX_N0B_2022_03_30_15_40_41",      // 153 Super Res Reflectivity
+   "LSX_N0G_2022_03_30_15_40_41",      // 154 Super Res Velocity
+   "KLSX_SDUS83_N0CLSX_202112110106"}; // 161 Correlation Coefficient
+
+static const std::string kLevel3RasterFile_ =
+   "KLSX_SDUS53_NCRLSX_202112110215"; // 37 Composite Reflectivity
+
+static std::shared_ptr<const wsr88d::rda::PackedElevationScan>
+LoadLevel2Scan(wsr88d::rda::DataBlockType dataBlockType)
+{
+   // The volume is decoded once, and shared between benchmarks
+   static const std::shared_ptr<wsr88d::Ar2vFile> file = []()
+   {
+      auto data =
+         bench::ReadDataFile("/nexrad/level2/Level2_KLSX_20210527_1757.ar2v");
+      if (!data.has_value())
+      {
+         return std::shared_ptr<wsr88d::Ar2vFile> {nullptr};
+      }
+
+      std::istringstream is(*data);
+      auto               ar2vFile = std::make_shared<wsr88d::Ar2vFile>();
+      if (!ar2vFile->LoadData(is))
+      {
+         return std::shared_ptr<wsr88d::Ar2vFile> {nullptr};
+      }
+
+      return ar2vFile;
+   }();
+
+   if (file == nullptr)
+   {
+      return nullptr;
+   }
+
+   auto radarData =
+      std::get<0>(file->GetPackedElevationScan(dataBlockType, 0.5f, {}));
+   if (radarData == nullptr)
+   {
+      return nullptr;
+   }
+
+   const auto* moment = radarData->moment(dataBlockType);
+   if (moment == nullptr || moment->data_moments(0) == nullptr)
+   {
+      return nullptr;
+   }
+
+   return radarData;
+}
+
+static SweepParameters Level2Parameters(
+   const wsr88d::rda::PackedElevationScan::Moment* moment,
+   wsr88d::rda::DataBlockType                      dataBlockType,
+   bool                                            smoothingEnabled)
+{
+   SweepParameters parameters   = Level2Parameters();
+   parameters.smoothingEnabled_ = smoothingEnabled;
+
+   // Thresholds match those used by the Level 2 product view
+   parameters.snrThreshold_ = static_cast<std::uint16_t>(
+      std::max<std::int16_t>(2, moment->snr_threshold_raw()));
+   parameters.edgeValue_ =
+      ComputeLevel2EdgeValue(dataBlockType, moment->offset());
+
+   return parameters;
+}
+
+template<class T>
+static std::shared_ptr<T> LoadLevel3Packet(const std::string& filename)
+{
+   auto data = bench::ReadDataFile("/nexrad/level3/" + filename);
+   if (!data.has_value())
+   {
+      return nullptr;
+   }
+
+   std::istringstream is(*data);
+   wsr88d::Level3File file;
+   if (!file.LoadData(is))
+   {
+      return nullptr;
+   }
+
+   auto gpm = std::dynamic_pointer_cast<wsr88d::rpg::GraphicProductMessage>(
+      file.message());
+   if (gpm == nullptr || gpm->symbology_block() == nullptr)
+   {
+      return nullptr;
+   }
+
+   auto symbologyBlock = gpm->symbology_block();
+   for (std::uint16_t layer = 0; layer < symbologyBlock->number_of_layers();
+        ++layer)
+   {
+      for (auto& packet : symbologyBlock->packet_list(layer))
+      {
+         auto result = std::dynamic_pointer_cast<T>(packet);
+         if (result != nullptr)
+         {
+            return result;
+         }
+      }
+   }
+
+   return nullptr;
+}
+
+static void BM_Level2Coordinates(benchmark::State& state)
+{
+   const auto& [dataBlockType, name] =
+      kLevel2Moments_[static_cast<std::size_t>(state.range(0))];
+   const bool smoothingEnabled = state.range(1) != 0;
+
+   auto radarData = LoadLevel2Scan(dataBlockType);
+   if (radarData == nullptr)
+   {
+      state.SkipWithError("Test data not found");
+      return;
+   }
+
+   const SweepParameters parameters = Level2Parameters(
+      radarData->moment(dataBlockType), dataBlockType, smoothingEnabled);
+
+   std::vector<float> coordinates(kLevel2Coordinates_);
+
+   for (auto _ : state)
+   {
+      ComputeLevel2Coordinates(*radarData, parameters, 0u, coordinates);
+      benchmark::DoNotOptimize(coordinates.data());
+   }
+
+   state.SetLabel(name + (smoothingEnabled ? " (smoothed)" : ""));
+}
+
+static void BM_Level2RadialAngles(benchmark::State& state)
+{
+   const auto& [dataBlockType, name] =
+      kLevel2Moments_[static_cast<std::size_t>(state.range(0))];
+   const bool smoothingEnabled = state.range(1) != 0;
+
+   auto radarData = LoadLevel2Scan(dataBlockType);
+   if (radarData == nullptr)
+   {
+      state.SkipWithError("Test data not found");
+      return;
+   }
+
+   const SweepParameters parameters = Level2Parameters(
+      radarData->moment(dataBlockType), dataBlockType, smoothingEnabled);
+
+   std::vector<float> radialAngles(common::MAX_0_5_DEGREE_RADIALS);
+
+   for (auto _ : state)
+   {
+      ComputeLevel2RadialAngles(*radarData, parameters, 0u, radialAngles);
+      benchmark::DoNotOptimize(radialAngles.data());
+   }
+
+   state.SetLabel(name + (smoothingEnabled ? " (smoothed)" : ""));
+}
+
+static void BM_Level2CoordinateKey(benchmark::State& state)
+{
+   const auto& [dataBlockType, name] =
+      kLevel2Moments_[static_cast<std::size_t>(state.range(0))];
+   const bool smoothingEnabled = state.range(1) != 0;
+
+   auto radarData = LoadLevel2Scan(dataBlockType);
+   if (radarData == nullptr)
+   {
+      state.SkipWithError("Test data not found");
+      return;
+   }
+
+   const SweepParameters parameters = Level2Parameters(
+      radarData->moment(dataBlockType), dataBlockType, smoothingEnabled);
+
+   for (auto _ : state)
+   {
+      Level2CoordinateKey key =
+         ComputeLevel2CoordinateKey(*radarData, parameters);
+      benchmark::DoNotOptimize(key.hash_);
+   }
+
+   state.SetLabel(name + (smoothingEnabled ? " (smoothed)" : ""));
+}
+
+static void BM_Level2BinLookup(benchmark::State& state)
+{
+   const wsr88d::rda::DataBlockType dataBlockType =
+      wsr88d::rda::DataBlockType::MomentRef;
+
+   auto radarData = LoadLevel2Scan(dataBlockType);
+   if (radarData == nullptr)
+   {
+      state.SkipWithError("Test data not found");
+      return;
+   }
+
+   const SweepParameters parameters =
+      Level2Parameters(radarData->moment(dataBlockType), dataBlockType, false);
+
+   SweepBinLookup lookup {};
+
+   for (auto _ : state)
+   {
+      ComputeLevel2BinLookup(*radarData, parameters, lookup);
+      benchmark::DoNotOptimize(lookup.buckets_.data());
+   }
+}
+
+static void BM_FindSweepBin(benchmark::State& state)
+{
+   const wsr88d::rda::DataBlockType dataBlockType =
+      wsr88d::rda::DataBlockType::MomentRef;
+
+   auto radarData = LoadLevel2Scan(dataBlockType);
+   if (radarData == nullptr)
+   {
+      state.SkipWithError("Test data not found");
+      return;
+   }
+
+   const SweepParameters parameters =
+      Level2Parameters(radarData->moment(dataBlockType), dataBlockType, false);
+
+   SweepBinLookup lookup {};
+   ComputeLevel2BinLookup(*radarData, parameters, lookup);
+
+   // Coordinates circle the radar site within radar range, as when hovering
+   std::size_t i = 0u;
+
+   for (auto _ : state)
+   {
+      const double angle =
+         static_cast<double>(i++ % 360u) * common::kDegreesToRadians;
+
+      std::optional<SweepBin> bin =
+         FindSweepBin(lookup,
+                      kRadarLatitude_ + 2.0 * std::cos(angle),
+                      kRadarLongitude_ + 2.0 * std::sin(angle));
+      benchmark::DoNotOptimize(bin);
+   }
+}
+
+static void BM_Level2Sweep(benchmark::State& state)
+{
+   const auto& [dataBlockType, name] =
+      kLevel2Moments_[static_cast<std::size_t>(state.range(0))];
+   const bool smoothingEnabled = state.range(1) != 0;
+   const auto& [layout, layoutName] =
+      kSweepLayouts_[static_cast<std::size_t>(state.range(2))];
+
+   auto radarData = LoadLevel2Scan(dataBlockType);
+   if (radarData == nullptr)
+   {
+      state.SkipWithError("Test data not found");
+      return;
+   }
+
+   const auto*     moment = radarData->moment(dataBlockType);
+   SweepParameters parameters =
+      Level2Parameters(moment, dataBlockType, smoothingEnabled);
+   parameters.layout_ = layout;
+
+   std::vector<float> coordinates {};
+   SweepGeometry      geometry {};
+
+   if (layout == SweepLayout::Polar)
+   {
+      geometry.polar_.radialAngles_.resize(common::MAX_0_5_DEGREE_RADIALS);
+      ComputeLevel2RadialAngles(
+         *radarData, parameters, 0u, geometry.polar_.radialAngles_);
+   }
+   else
+   {
+      coordinates.resize(kLevel2Coordinates_);
+      ComputeLevel2Coordinates(*radarData, parameters, 0u, coordinates);
+   }
+
+   for (auto _ : state)
+   {
+      ComputeLevel2Sweep(
+         *radarData, dataBlockType, parameters, coordinates, 0u, geometry);
+      benchmark::DoNotOptimize(geometry.vertices_.data());
+   }
+
+   state.SetLabel(fmt::format("{} {}-bit{}{}",
+                              name,
+                              moment->data_word_size(),
+                              smoothingEnabled ? " (smoothed)" : "",
+                              layoutName));
+   state.counters["vertices"] =
+      static_cast<double>(geometry.vertices_.size() / 2u);
+
+   // The indexed layout draws the radial coordinates as its vertices
+   const std::size_t vertexValues = (layout == SweepLayout::Indexed) ?
+                                       coordinates.size() :
+                                       geometry.vertices_.size();
+
+   // Size of the buffers uploaded by the radar product layer
+   state.counters["bytes"] = static_cast<double>(
+      vertexValues * sizeof(float) +
+      geometry.indices_.size() * sizeof(std::uint32_t) +
+      geometry.polar_.cells_.size() * sizeof(std::uint16_t) +
+      geometry.polar_.radialAngles_.size() * sizeof(float) +
+      geometry.dataMoments8_.size() * sizeof(std::uint8_t) +
+      geometry.dataMoments16_.size() * sizeof(std::uint16_t) +
+      geometry.cfpMoments_.size() * sizeof(std::uint8_t));
+}
+
+static void BM_Level2SweepLevels(benchmark::State& state)
+{
+   const auto& [dataBlockType, name] =
+      kLevel2Moments_[static_cast<std::size_t>(state.range(0))];
+   const bool smoothingEnabled = state.range(1) != 0;
+   const auto& [layout, layoutName] =
+      kSweepLayouts_[static_cast<std::size_t>(state.range(2))];
+
+   auto radarData = LoadLevel2Scan(dataBlockType);
+   if (radarData == nullptr)
+   {
+      state.SkipWithError("Test data not found");
+      return;
+   }
+
+   const auto*     moment = radarData->moment(dataBlockType);
+   SweepParameters parameters =
+      Level2Parameters(moment, dataBlockType, smoothingEnabled);
+   parameters.layout_ = layout;
+
+   std::vector<float> coordinates {};
+   SweepGeometry      geometry {};
+
+   if (layout == SweepLayout::Polar)
+   {
+      geometry.polar_.radialAngles_.resize(common::MAX_0_5_DEGREE_RADIALS);
+      ComputeLevel2RadialAngles(
+         *radarData, parameters, 0u, geometry.polar_.radialAngles_);
+   }
+   else
+   {
+      coordinates.resize(kLevel2Coordinates_);
+      ComputeLevel2Coordinates(*radarData, parameters, 0u, coordinates);
+   }
+
+   for (auto _ : state)
+   {
+      // Decimated levels are stored after the full resolution sweep
+      state.PauseTiming();
+      ComputeLevel2Sweep(
+         *radarData, dataBlockType, parameters, coordinates, 0u, geometry);
+      state.ResumeTiming();
+
+      ComputeLevel2SweepLevels(*radarData, dataBlockType, parameters, geometry);
+      benchmark::DoNotOptimize(geometry.levels_.data());
+   }
+
+   state.SetLabel(fmt::format("{} {}-bit{}{}",
+                              name,
+                              moment->data_word_size(),
+                              smoothingEnabled ? " (smoothed)" : "",
+                              layoutName));
+   state.counters["levels"] = static_cast<double>(geometry.levels_.size());
+   state.counters["full"] =
+      static_cast<double>(geometry.levels_.front().count_);
+   state.counters["coarsest"] =
+      static_cast<double>(geometry.levels_.back().count_);
+}
+
+static void BM_SweepSectors(benchmark::State& state)
+{
+   const auto& [dataBlockType, name] =
+      kLevel2Moments_[static_cast<std::size_t>(state.range(0))];
+   const bool smoothingEnabled = state.range(1) != 0;
+   const auto& [layout, layoutName] =
+      kSweepLayouts_[static_cast<std::size_t>(state.range(2))];
+
+   auto radarData = LoadLevel2Scan(dataBlockType);
+   if (radarData == nullptr)
+   {
+      state.SkipWithError("Test data not found");
+      return;
+   }
+
+   const auto*     moment = radarData->moment(dataBlockType);
+   SweepParameters parameters =
+      Level2Parameters(moment, dataBlockType, smoothingEnabled);
+   parameters.layout_ = layout;
+
+   std::vector<float> coordinates {};
+   GeodesicTable      table {};
+   SweepGeometry      geometry {};
+
+   if (layout == SweepLayout::Polar)
+   {
+      geometry.polar_.radialAngles_.resize(common::MAX_0_5_DEGREE_RADIALS);
+      ComputeLevel2RadialAngles(
+         *radarData, parameters, 0u, geometry.polar_.radialAngles_);
+      ComputeGeodesicTable(parameters,
+                           0.5f,
+                           1000.0f,
+                           common::MAX_DATA_MOMENT_GATES * kGateSize_,
+                           table);
+   }
+   else
+   {
+      coordinates.resize(kLevel2Coordinates_);
+      ComputeLevel2Coordinates(*radarData, parameters, 0u, coordinates);
+   }
+
+   ComputeLevel2Sweep(
+      *radarData, dataBlockType, parameters, coordinates, 0u, geometry);
+   ComputeLevel2SweepLevels(*radarData, dataBlockType, parameters, geometry);
+
+   for (auto _ : state)
+   {
+      ComputeSweepSectors(coordinates, &table, geometry);
+      benchmark::DoNotOptimize(geometry.levels_.data());
+   }
+
+   std::size_t sectors = 0u;
+   for (const SweepLevel& level : geometry.levels_)
+   {
+      sectors += level.sectors_.size();
+   }
+
+   state.SetLabel(fmt::format("{} {}-bit{}{}",
+                              name,
+                              moment->data_word_size(),
+                              smoothingEnabled ? " (smoothed)" : "",
+                              layoutName));
+   state.counters["sectors"] = static_cast<double>(sectors);
+}
+
+static void BM_GeodesicTable(benchmark::State& state)
+{
+   const float azimuthInterval =
+      static_cast<float>(state.range(0)) / 100.0f; // Hundredths of a degree
+
+   SweepParameters parameters {};
+   parameters.radarLatitude_  = kRadarLatitude_;
+   parameters.radarLongitude_ = kRadarLongitude_;
+
+   GeodesicTable table {};
+
+   for (auto _ : state)
+   {
+      ComputeGeodesicTable(parameters,
+                           azimuthInterval,
+                           1000.0f,
+                           common::MAX_DATA_MOMENT_GATES * kGateSize_,
+                           table);
+      benchmark::DoNotOptimize(table.offsets_.data());
+   }
+
+   state.counters["samples"] =
+      static_cast<double>(table.azimuths_ * table.ranges_);
+}
+
+static void BM_Level2ColorTableLut(benchmark::State& state)
+{
+   const auto& [dataBlockType, name] =
+      kLevel2Moments_[static_cast<std::size_t>(state.range(0))];
+
+   auto radarData  = LoadLevel2Scan(dataBlockType);
+   auto colorTable = common::ColorTable::Load(std::string(SCWX_TEST_DATA_DIR) +
+                                              "/colors/reflectivity.pal");
+   if (radarData == nullptr || colorTable == nullptr ||
+       !colorTable->IsValid())
+   {
+      state.SkipWithError("Test data not found");
+      return;
+   }
+
+   const auto* moment = radarData->moment(dataBlockType);
+
+   const auto [rangeMin, rangeMax] = GetLevel2DataRange(dataBlockType);
+
+   std::vector<boost::gil::rgba8_pixel_t> lut {};
+
+   for (auto _ : state)
+   {
+      ComputeLevel2ColorTableLut(*colorTable,
+                                 rangeMin,
+                                 rangeMax,
+                                 moment->offset(),
+                                 moment->scale(),
+                                 lut);
+      benchmark::DoNotOptimize(lut.data());
+   }
+
+   state.SetLabel(name);
+}
+
+static void BM_UniformRadialCoordinates(benchmark::State& state)
+{
+   const auto numRadials       = static_cast<std::uint32_t>(state.range(0));
+   const bool smoothingEnabled = state.range(1) != 0;
+
+   const float radialAngle = 360.0f / static_cast<float>(numRadials);
+
+   SweepParameters parameters {};
+   parameters.radarLatitude_    = kRadarLatitude_;
+   parameters.radarLongitude_   = kRadarLongitude_;
+   parameters.gateSize_         = kGateSize_;
+   parameters.smoothingEnabled_ = smoothingEnabled;
+
+   std::vector<float> coordinates(static_cast<std::size_t>(numRadials) *
+                                  common::MAX_DATA_MOMENT_GATES * 2u);
+
+   for (auto _ : state)
+   {
+      ComputeUniformRadialCoordinates(
+         numRadials,
+         radialAngle,
+         smoothingEnabled ? radialAngle * 0.5f : 0.0f,
+         smoothingEnabled ? 0.5f : 1.0f,
+         parameters,
+         coordinates);
+      benchmark::DoNotOptimize(coordinates.data());
+   }
+
+   state.SetLabel(smoothingEnabled ? "smoothed" : "");
+}
+
+static void BM_Level3RadialSweep(benchmark::State& state)
+{
+   const std::string& filename =
+      kLevel3RadialFiles_[static_cast<std::size_t>(state.range(0))];
+   const bool smoothingEnabled = state.range(1) != 0;
+
+   auto radialData =
+      LoadLevel3Packet<wsr88d::rpg::GenericRadialDataPacket>(filename);
+   if (radialData == nullptr)
+   {
+      state.SkipWithError("Test data not found");
+      return;
+   }
+
+   SweepParameters parameters {};
+   parameters.radarLatitude_    = kRadarLatitude_;
+   parameters.radarLongitude_   = kRadarLongitude_;
+   parameters.gateSize_         = kGateSize_;
+   parameters.smoothingEnabled_ = smoothingEnabled;
+   parameters.snrThreshold_     = 2u;
+
+   std::vector<float> coordinates(kLevel2Coordinates_);
+   ComputeLevel3RadialCoordinates(*radialData, parameters, coordinates);
+
+   SweepGeometry geometry {};
+
+   for (auto _ : state)
+   {
+      ComputeLevel3RadialSweep(*radialData,
+                               parameters,
+                               coordinates,
+                               0u,
+                               static_cast<std::uint16_t>(kGateSize_),
+                               geometry);
+      benchmark::DoNotOptimize(geometry.vertices_.data());
+   }
+
+   state.SetLabel(filename + (smoothingEnabled ? " (smoothed)" : ""));
+   state.counters["vertices"] =
+      static_cast<double>(geometry.vertices_.size() / 2u);
+}
+
+static void BM_Level3RasterSweep(benchmark::State& state)
+{
+   const bool smoothingEnabled = state.range(0) != 0;
+
+   auto rasterData =
+      LoadLevel3Packet<wsr88d::rpg::RasterDataPacket>(kLevel3RasterFile_);
+   if (rasterData == nullptr)
+   {
+      state.SkipWithError("Test data not found");
+      return;
+   }
+
+   // Composite reflectivity is a 1 km grid extending 460 km from the radar
+   static constexpr std::uint16_t kResolution_ = 1000u;
+   static constexpr float         kRange_      = 460.0f;
+
+   SweepParameters parameters {};
+   parameters.radarLatitude_    = kRadarLatitude_;
+   parameters.radarLongitude_   = kRadarLongitude_;
+   parameters.smoothingEnabled_ = smoothingEnabled;
+   parameters.snrThreshold_     = 2u;
+
+   const std::size_t  maxColumns = GetLevel3RasterColumns(*rasterData);
+   std::vector<float> coordinates {};
+   SweepGeometry      geometry {};
+
+   // Raster coordinates are computed with each sweep
+   for (auto _ : state)
+   {
+      ComputeLevel3RasterCoordinates(*rasterData,
+                                     parameters,
+                                     kResolution_,
+                                     kResolution_,
+                                     kRange_,
+                                     maxColumns,
+                                     coordinates);
+      ComputeLevel3RasterSweep(
+         *rasterData, parameters, coordinates, maxColumns, geometry);
+      benchmark::DoNotOptimize(geometry.vertices_.data());
+   }
+
+   state.SetLabel(smoothingEnabled ? "smoothed" : "");
+   state.counters["vertices"] =
+      static_cast<double>(geometry.vertices_.size() / 2u);
+}
+
+BENCHMARK(BM_Level2Coordinates)
+   ->ArgsProduct({{0, 1, 2, 3, 4}, {0, 1}})
+   ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Level2RadialAngles)
+   ->ArgsProduct({{0, 1, 2, 3, 4}, {0, 1}})
+   ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Level2CoordinateKey)
+   ->ArgsProduct({{0, 1, 2, 3, 4}, {0, 1}})
+   ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Level2BinLookup)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_FindSweepBin)->Unit(benchmark::kNanosecond);
+BENCHMARK(BM_Level2Sweep)
+   ->ArgsProduct({{0, 1, 2, 3, 4}, {0, 1}, {0, 1, 2}})
+   ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Level2SweepLevels)
+   ->ArgsProduct({{0, 1, 2, 3, 4}, {0, 1}, {1, 2}})
+   ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SweepSectors)
+   ->ArgsProduct({{0, 1, 2, 3, 4}, {0, 1}, {0, 1, 2}})
+   ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_GeodesicTable)->Arg(50)->Arg(25)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Level2ColorTableLut)
+   ->DenseRange(0, static_cast<int>(kLevel2Moments_.size()) - 1)
+   ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_UniformRadialCoordinates)
+   ->ArgsProduct(
+      {{common::MAX_1_DEGREE_RADIALS, common::MAX_0_5_DEGREE_RADIALS}, {0, 1}})
+   ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Level3RadialSweep)
+   ->ArgsProduct({{0, 1, 2}, {0, 1}})
+   ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Level3RasterSweep)
+   ->DenseRange(0, 1)
+   ->Unit(benchmark::kMillisecond);
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
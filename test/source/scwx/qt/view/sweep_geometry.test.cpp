@@ -0,0 +1,2356 @@
+#include "sweep_test_data.hpp"
+
+#include <scwx/qt/view/sweep_geometry.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/common/constants.hpp>
+#include <scwx/common/geographic.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if !defined(_MSC_VER)
+#   include <tbb/global_control.h>
+#   include <tbb/task_arena.h>
+#endif
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+static const std::vector<SweepLayout> kSweepLayouts_ = {
+   SweepLayout::Vertices, SweepLayout::Indexed, SweepLayout::Polar};
+
+/**
+ * Expects the elements of two buffers to be identical, byte for byte.
+ */
+template<class T>
+static void ExpectIdentical(const std::vector<T>& actual,
+                            const std::vector<T>& expected,
+                            const std::string&    name)
+{
+   ASSERT_EQ(actual.size(), expected.size()) << name;
+
+   for (std::size_t i = 0; i < actual.size(); ++i)
+   {
+      if (std::memcmp(&actual[i], &expected[i], sizeof(T)) != 0)
+      {
+         ADD_FAILURE() << name << " differs at " << i;
+         return;
+      }
+   }
+}
+
+static std::string
+SweepName(const Level2ScanOptions& options,
+          bool                     smoothingEnabled,
+          SweepLayout              layout = SweepLayout::Vertices)
+{
+   return fmt::format("{}-bit{}{}, layout {}",
+                      options.dataWordSize_,
+                      options.cfpEnabled_ ? ", CFP" : "",
+                      smoothingEnabled ? ", smoothed" : "",
+                      static_cast<int>(layout));
+}
+
+// Moments of 8 and 16 bits, with and without clutter filter power removed
+static const std::vector<Level2ScanOptions> kLevel2ScanOptions_ = {
+   {.missingRadials_ = {100u, 101u, 102u, 300u},
+    .numberOfGates_  = 460u,
+    .dataBlockType_  = wsr88d::rda::DataBlockType::MomentRef,
+    .dataWordSize_   = 8u},
+   {.missingRadials_ = {100u, 101u, 102u, 300u},
+    .numberOfGates_  = 460u,
+    .dataBlockType_  = wsr88d::rda::DataBlockType::MomentRef,
+    .dataWordSize_   = 8u,
+    .cfpEnabled_     = true},
+   {.missingRadials_ = {100u, 101u, 102u, 300u},
+    .numberOfGates_  = 460u,
+    .dataBlockType_  = wsr88d::rda::DataBlockType::MomentPhi,
+    .dataWordSize_   = 16u}};
+
+/**
+ * Computes the geometry of a Level 2 sweep as the Level 2 product view does,
+ * beginning at the first updated radial. Coordinates are computed in place
+ * of radial angles, except in the polar layout.
+ */
+static void ComputeLevel2Geometry(const wsr88d::rda::PackedElevationScan& scan,
+                                  wsr88d::rda::DataBlockType dataBlockType,
+                                  const SweepParameters&     parameters,
+                                  std::size_t                firstUpdatedRadial,
+                                  std::vector<float>&        coordinates,
+                                  SweepGeometry&             geometry)
+{
+   if (parameters.layout_ == SweepLayout::Polar)
+   {
+      geometry.polar_.radialAngles_.resize(common::MAX_0_5_DEGREE_RADIALS);
+      ComputeLevel2RadialAngles(scan,
+                                parameters,
+                                firstUpdatedRadial,
+                                geometry.polar_.radialAngles_);
+   }
+   else
+   {
+      coordinates.resize(kLevel2Coordinates_);
+      ComputeLevel2Coordinates(
+         scan, parameters, firstUpdatedRadial, coordinates);
+   }
+
+   ComputeLevel2Sweep(scan,
+                      dataBlockType,
+                      parameters,
+                      coordinates,
+                      firstUpdatedRadial,
+                      geometry);
+   ComputeLevel2SweepLevels(scan, dataBlockType, parameters, geometry);
+}
+
+/**
+ * Digest of a sweep in the vertex layout. Each vertex is identified by the
+ * index of the coordinate it was copied from, so the digest is independent of
+ * floating point differences in the coordinates themselves.
+ */
+struct SweepDigest
+{
+   std::size_t   vertices_ {};   ///< Number of vertices
+   std::uint64_t vertexHash_ {}; ///< Hash of the coordinate of each vertex
+   std::uint64_t momentHash_ {}; ///< Hash of the data moment of each vertex
+   std::uint64_t cfpHash_ {};    ///< Hash of the clutter filter power moments
+
+   bool operator==(const SweepDigest&) const = default;
+};
+
+static void PrintTo(const SweepDigest& digest, std::ostream* os)
+{
+   *os << fmt::format("{{{}u, 0x{:016x}u, 0x{:016x}u, 0x{:016x}u}}",
+                      digest.vertices_,
+                      digest.vertexHash_,
+                      digest.momentHash_,
+                      digest.cfpHash_);
+}
+
+// Coordinate index identifying a vertex at the radar site
+static constexpr std::uint32_t kRadarSite_ =
+   std::numeric_limits<std::uint32_t>::max();
+
+/**
+ * Hashes values with 64-bit FNV-1a, continuing from a previous hash.
+ */
+template<class T>
+static std::uint64_t HashValues(const std::vector<T>& values,
+                                std::uint64_t hash = 0xcbf29ce484222325u)
+{
+   for (const T& value : values)
+   {
+      hash = (hash ^ static_cast<std::uint64_t>(value)) * 0x100000001b3u;
+   }
+   return hash;
+}
+
+/**
+ * Gets the index of the coordinate of each vertex, or kRadarSite_ for a vertex
+ * at the radar site.
+ */
+static std::vector<std::uint32_t>
+GetVertexCoordinates(const std::vector<float>& vertices,
+                     const std::vector<float>& coordinates)
+{
+   auto key = [](float latitude, float longitude)
+   { return std::bit_cast<std::uint64_t>(std::array {latitude, longitude}); };
+
+   const std::uint64_t site = key(static_cast<float>(kRadarLatitude_),
+                                  static_cast<float>(kRadarLongitude_));
+
+   // The first of any identical coordinates is used
+   std::unordered_map<std::uint64_t, std::uint32_t> indices {};
+   for (std::size_t i = 0; i + 1u < coordinates.size(); i += 2u)
+   {
+      indices.emplace(key(coordinates[i], coordinates[i + 1u]),
+                      static_cast<std::uint32_t>(i / 2u));
+   }
+
+   std::vector<std::uint32_t> vertexCoordinates {};
+   vertexCoordinates.reserve(vertices.size() / 2u);
+
+   for (std::size_t i = 0; i + 1u < vertices.size(); i += 2u)
+   {
+      const std::uint64_t vertex = key(vertices[i], vertices[i + 1u]);
+      if (vertex == site)
+      {
+         vertexCoordinates.push_back(kRadarSite_);
+         continue;
+      }
+
+      auto it = indices.find(vertex);
+      if (it == indices.cend())
+      {
+         ADD_FAILURE() << "Vertex " << i / 2u << " is not a coordinate";
+         return {};
+      }
+      vertexCoordinates.push_back(it->second);
+   }
+
+   return vertexCoordinates;
+}
+
+static SweepDigest ComputeDigest(const SweepGeometry&      geometry,
+                                 const std::vector<float>& coordinates)
+{
+   EXPECT_EQ(geometry.vertices_.size(),
+             (geometry.dataMoments8_.size() + geometry.dataMoments16_.size()) *
+                2u);
+
+   return {geometry.vertices_.size() / 2u,
+           HashValues(GetVertexCoordinates(geometry.vertices_, coordinates)),
+           HashValues(geometry.dataMoments16_,
+                      HashValues(geometry.dataMoments8_)),
+           HashValues(geometry.cfpMoments_)};
+}
+
+/**
+ * Expects a coordinate to be at an azimuth and range from the radar site.
+ */
+static void ExpectCoordinate(const std::vector<float>& coordinates,
+                             std::size_t               index,
+                             double                    azimuth,
+                             double                    range)
+{
+   // Coordinates are stored as single precision
+   static constexpr double kTolerance = 1e-5; // degrees
+
+   double latitude;
+   double longitude;
+   util::GeographicLib::DefaultGeodesic().Direct(
+      kRadarLatitude_, kRadarLongitude_, azimuth, range, latitude, longitude);
+
+   ASSERT_LT(index * 2u + 1u, coordinates.size());
+   EXPECT_NEAR(coordinates[index * 2u], latitude, kTolerance) << index;
+   EXPECT_NEAR(coordinates[index * 2u + 1u], longitude, kTolerance) << index;
+}
+
+static const std::vector<std::pair<bool, bool>> kSmoothingModes_ = {
+   {false, false}, {true, false}, {true, true}};
+
+TEST(SweepGeometry, Level2CoordinatesMatchGeodesic)
+{
+   auto scan = CreateLevel2Scan();
+
+   for (bool smoothingEnabled : {false, true})
+   {
+      SCOPED_TRACE(smoothingEnabled ? "smoothed" : "");
+
+      const SweepParameters parameters =
+         Level2Parameters({}, smoothingEnabled);
+
+      std::vector<float> coordinates(kLevel2Coordinates_);
+      ComputeLevel2Coordinates(*scan, parameters, 0u, coordinates);
+
+      // Coordinates are at the far end of each gate, on the radial azimuth,
+      // or at the center of each gate, midway to the next radial azimuth
+      const double angleOffset = (smoothingEnabled) ? 0.25 : 0.0;
+      const double rangeOffset = (smoothingEnabled) ? 0.5 : 1.0;
+
+      for (std::size_t radial : {0u, 1u, 359u, 719u})
+      {
+         for (std::size_t gate : {0u, 1u, 919u, 1839u})
+         {
+            ExpectCoordinate(coordinates,
+                             radial * common::MAX_DATA_MOMENT_GATES + gate,
+                             radial * 0.5 + 0.27 + angleOffset,
+                             (gate + rangeOffset) * kGateSize_);
+         }
+      }
+   }
+}
+
+TEST(SweepGeometry, Level2SweepVertices)
+{
+   // Three radials of three gates, beginning at the ninth gate. The first gate
+   // of the first radial is below the SNR threshold. The radials span less
+   // than the gap of an incomplete scan, so the sweep is closed.
+   const Level2ScanOptions options {.radialCount_   = 3u,
+                                    .numberOfGates_ = 3u,
+                                    .cfpEnabled_    = true};
+
+   auto scan = CreateLevel2Scan(options);
+   ASSERT_FALSE(IsLevel2SweepIncomplete(*scan));
+
+   const SweepParameters parameters = Level2Parameters(options, false);
+
+   std::vector<float> coordinates(kLevel2Coordinates_);
+   SweepGeometry      geometry {};
+   ComputeLevel2Coordinates(*scan, parameters, 0u, coordinates);
+   ComputeLevel2Sweep(
+      *scan, options.dataBlockType_, parameters, coordinates, 0u, geometry);
+
+   // Each gate is two triangles, between the far ends of the previous and
+   // current gates of the radial and the next radial. The last radial is
+   // joined to the first.
+   static constexpr std::uint32_t G = common::MAX_DATA_MOMENT_GATES;
+   static const std::vector<std::pair<std::array<std::uint32_t, 6>,
+                                      std::uint8_t>>
+      kGates = {{{8, 9, G + 9, 8, G + 8, G + 9}, 11u},
+                {{9, 10, G + 10, 9, G + 9, G + 10}, 22u},
+                {{G + 7, G + 8, 2 * G + 8, G + 7, 2 * G + 7, 2 * G + 8}, 37u},
+                {{G + 8, G + 9, 2 * G + 9, G + 8, 2 * G + 8, 2 * G + 9}, 48u},
+                {{G + 9, G + 10, 2 * G + 10, G + 9, 2 * G + 9, 2 * G + 10},
+                 59u},
+                {{2 * G + 7, 2 * G + 8, 8, 2 * G + 7, 7, 8}, 74u},
+                {{2 * G + 8, 2 * G + 9, 9, 2 * G + 8, 8, 9}, 85u},
+                {{2 * G + 9, 2 * G + 10, 10, 2 * G + 9, 9, 10}, 96u}};
+
+   const std::vector<std::uint32_t> vertexCoordinates =
+      GetVertexCoordinates(geometry.vertices_, coordinates);
+
+   ASSERT_EQ(vertexCoordinates.size(), kGates.size() * 6u);
+   ASSERT_EQ(geometry.dataMoments8_.size(), vertexCoordinates.size());
+   ASSERT_EQ(geometry.cfpMoments_.size(), vertexCoordinates.size());
+   EXPECT_TRUE(geometry.dataMoments16_.empty());
+
+   for (std::size_t i = 0; i < vertexCoordinates.size(); ++i)
+   {
+      const auto& [gateCoordinates, dataMoment] = kGates[i / 6u];
+
+      EXPECT_EQ(vertexCoordinates[i], gateCoordinates[i % 6u]) << i;
+      EXPECT_EQ(geometry.dataMoments8_[i], dataMoment) << i;
+      EXPECT_EQ(geometry.cfpMoments_[i], dataMoment) << i;
+   }
+}
+
+TEST(SweepGeometry, Level2SweepMatchesGolden)
+{
+   // Complete elevation scans, and scans in progress
+   static const std::vector<std::uint16_t> kRadialCounts = {
+      common::MAX_0_5_DEGREE_RADIALS, 250u};
+
+   // Recorded from the Level 2 product view, by scan options, radial count and
+   // smoothing mode
+   static const std::vector<SweepDigest> kDigests = {
+      {1963002u, 0x75e1647d15ffac34u, 0xb16080e3a5b15635u, 0xcbf29ce484222325u},
+      {1971864u, 0xc2e83aa4fe1478e5u, 0x8df1b8aec28d2bbau, 0xcbf29ce484222325u},
+      {1971864u, 0xc2e83aa4fe1478e5u, 0xf6175a706e900589u, 0xcbf29ce484222325u},
+      {677178u, 0x2507e1ec3e963904u, 0x130a646e123d0e8du, 0xcbf29ce484222325u},
+      {680238u, 0xfbd44533990b9ba0u, 0xf3dee3c899c31437u, 0xcbf29ce484222325u},
+      {680238u, 0xfbd44533990b9ba0u, 0x358b170771338ce6u, 0xcbf29ce484222325u},
+      {1963002u, 0x75e1647d15ffac34u, 0xb16080e3a5b15635u, 0xb16080e3a5b15635u},
+      {1971864u, 0xc2e83aa4fe1478e5u, 0x8df1b8aec28d2bbau, 0x48fcd353a0c66505u},
+      {1971864u, 0xc2e83aa4fe1478e5u, 0xf6175a706e900589u, 0x48fcd353a0c66505u},
+      {677178u, 0x2507e1ec3e963904u, 0x130a646e123d0e8du, 0x130a646e123d0e8du},
+      {680238u, 0xfbd44533990b9ba0u, 0xf3dee3c899c31437u, 0xed062950427add5du},
+      {680238u, 0xfbd44533990b9ba0u, 0x358b170771338ce6u, 0xed062950427add5du},
+      {1969584u, 0x3a7934238750a219u, 0x841ab3db29cb425du, 0xcbf29ce484222325u},
+      {1971864u, 0xc2e83aa4fe1478e5u, 0xa03dd22abdda0e06u, 0xcbf29ce484222325u},
+      {1971864u, 0xc2e83aa4fe1478e5u, 0xc67e630c08f912a5u, 0xcbf29ce484222325u},
+      {679452u, 0xb79e68bcd417d6d1u, 0xeae68458cf175e05u, 0xcbf29ce484222325u},
+      {680238u, 0xfbd44533990b9ba0u, 0x893f8ab06ecaaedau, 0xcbf29ce484222325u},
+      {680238u, 0xfbd44533990b9ba0u, 0xb73260b17c883d0eu, 0xcbf29ce484222325u}
+   };
+
+   auto digest = kDigests.cbegin();
+
+   for (Level2ScanOptions options : kLevel2ScanOptions_)
+   {
+      for (std::uint16_t radialCount : kRadialCounts)
+      {
+         options.radialCount_ = radialCount;
+
+         auto scan = CreateLevel2Scan(options);
+
+         for (auto [smoothingEnabled, showSmoothedRangeFolding] :
+              kSmoothingModes_)
+         {
+            SCOPED_TRACE(
+               fmt::format("{}, {} radials{}",
+                           SweepName(options, smoothingEnabled),
+                           radialCount,
+                           showSmoothedRangeFolding ? ", range folding" : ""));
+
+            SweepParameters parameters =
+               Level2Parameters(options, smoothingEnabled);
+            parameters.showSmoothedRangeFolding_ = showSmoothedRangeFolding;
+
+            std::vector<float> coordinates(kLevel2Coordinates_);
+            SweepGeometry      geometry {};
+            ComputeLevel2Coordinates(*scan, parameters, 0u, coordinates);
+            ComputeLevel2Sweep(*scan,
+                               options.dataBlockType_,
+                               parameters,
+                               coordinates,
+                               0u,
+                               geometry);
+
+            ASSERT_NE(digest, kDigests.cend());
+            EXPECT_EQ(ComputeDigest(geometry, coordinates), *digest++);
+         }
+      }
+   }
+}
+
+TEST(SweepGeometry, Level3RadialMatchesGolden)
+{
+   static constexpr std::uint16_t kDataMomentInterval = 250u;
+
+   // Recorded from the Level 3 radial view, by smoothing mode
+   static const std::vector<SweepDigest> kDigests = {
+      {757779u, 0xa8f997657bcfefe4u, 0x356c17c912d98300u, 0xcbf29ce484222325u},
+      {896124u, 0x06555e65f868c485u, 0xc597df08a59190afu, 0xcbf29ce484222325u},
+      {911568u, 0x56bdd49173bc3a21u, 0x064c0d79677b3222u, 0xcbf29ce484222325u}
+   };
+
+   // Radial data without a standard radial size computes its own coordinates
+   const TestRadialDataPacket radialData {359u, 460u};
+
+   auto digest = kDigests.cbegin();
+
+   for (auto [smoothingEnabled, showSmoothedRangeFolding] : kSmoothingModes_)
+   {
+      SCOPED_TRACE(fmt::format("{}{}",
+                               smoothingEnabled ? "smoothed" : "",
+                               showSmoothedRangeFolding ? ", range folding" :
+                                                          ""));
+
+      SweepParameters parameters = Level2Parameters();
+      parameters.smoothingEnabled_         = smoothingEnabled;
+      parameters.showSmoothedRangeFolding_ = showSmoothedRangeFolding;
+      parameters.snrThreshold_             = 16u;
+      parameters.edgeValue_                = 3u;
+
+      std::vector<float> coordinates(kLevel3RadialCoordinates_);
+      SweepGeometry      geometry {};
+      ComputeLevel3RadialCoordinates(radialData, parameters, coordinates);
+      ComputeLevel3RadialSweep(radialData,
+                               parameters,
+                               coordinates,
+                               0u,
+                               kDataMomentInterval,
+                               geometry);
+
+      // Coordinates are at the far end or center of each gate, on the start
+      // angle or midway through each radial
+      const double angleOffset = (smoothingEnabled) ? 1.0 : 0.5;
+      const double rangeOffset = (smoothingEnabled) ? 0.5 : 1.0;
+      for (std::size_t radial : {0u, 179u, 358u})
+      {
+         for (std::size_t gate : {0u, 459u})
+         {
+            ExpectCoordinate(coordinates,
+                             radial * common::MAX_DATA_MOMENT_GATES + gate,
+                             radial + angleOffset,
+                             (gate + rangeOffset) * kGateSize_);
+         }
+      }
+
+      ASSERT_NE(digest, kDigests.cend());
+      EXPECT_EQ(ComputeDigest(geometry, coordinates), *digest++);
+   }
+}
+
+TEST(SweepGeometry, Level3RasterMatchesGolden)
+{
+   static constexpr std::uint16_t kResolution = 1000u;
+   static constexpr float         kRange      = 32.0f;
+
+   // Recorded from the Level 3 raster view, by smoothing mode
+   static const std::vector<SweepDigest> kDigests = {
+      {22998u, 0x2cd6107a0d533909u, 0x6b540f5d059ff9cbu, 0xcbf29ce484222325u},
+      {23184u, 0x169f3cc481970b55u, 0x70b06cf27a5293d0u, 0xcbf29ce484222325u},
+      {23184u, 0x169f3cc481970b55u, 0xecdc4196c27d3a22u, 0xcbf29ce484222325u}
+   };
+
+   auto rasterData = CreateRasterDataPacket(64u);
+   ASSERT_NE(rasterData, nullptr);
+
+   const std::size_t maxColumns = GetLevel3RasterColumns(*rasterData);
+   ASSERT_EQ(maxColumns, 64u);
+
+   auto digest = kDigests.cbegin();
+
+   for (auto [smoothingEnabled, showSmoothedRangeFolding] : kSmoothingModes_)
+   {
+      SCOPED_TRACE(fmt::format("{}{}",
+                               smoothingEnabled ? "smoothed" : "",
+                               showSmoothedRangeFolding ? ", range folding" :
+                                                          ""));
+
+      SweepParameters parameters = Level2Parameters();
+      parameters.smoothingEnabled_         = smoothingEnabled;
+      parameters.showSmoothedRangeFolding_ = showSmoothedRangeFolding;
+      parameters.snrThreshold_             = 2u;
+      parameters.edgeValue_                = 3u;
+
+      std::vector<float> coordinates {};
+      SweepGeometry      geometry {};
+      ComputeLevel3RasterCoordinates(*rasterData,
+                                     parameters,
+                                     kResolution,
+                                     kResolution,
+                                     kRange,
+                                     maxColumns,
+                                     coordinates);
+      ComputeLevel3RasterSweep(
+         *rasterData, parameters, coordinates, maxColumns, geometry);
+
+      // The grid begins at the northwest corner of the product range, and
+      // coordinates are at the corner or center of each grid cell
+      const double offset = (smoothingEnabled) ? 0.5 : 0.0;
+      for (auto [column, row] : {std::pair {0u, 0u},
+                                 std::pair {32u, 10u},
+                                 std::pair {64u, 64u}})
+      {
+         const double i = (column + offset - 1.0 - kRange) * kResolution;
+         const double j = (1.0 + kRange - row - offset) * kResolution;
+
+         ExpectCoordinate(coordinates,
+                          row * (rasterData->number_of_rows() + 1u) + column,
+                          std::atan2(i, j) * 180.0 / M_PI,
+                          std::hypot(i, j));
+      }
+
+      ASSERT_NE(digest, kDigests.cend());
+      EXPECT_EQ(ComputeDigest(geometry, coordinates), *digest++);
+   }
+}
+
+/**
+ * Interpolates the geodesic table as the polar layout vertex shader does.
+ * Samples are interpolated bilinearly, azimuths wrap around 360 degrees, and
+ * ranges beyond the table are clamped to its last sample.
+ *
+ * @return Latitude and longitude (degrees)
+ */
+static std::pair<double, double> InterpolateGeodesicTable(
+   const GeodesicTable& table, double azimuth, double range)
+{
+   const double x = azimuth / table.azimuthInterval_;
+   const double y = std::clamp(range / table.rangeInterval_,
+                               0.0,
+                               static_cast<double>(table.ranges_ - 1u));
+
+   const double x0 = std::floor(x);
+   const double y0 = std::min(std::floor(y),
+                              static_cast<double>(table.ranges_ - 2u));
+   const double fx = x - x0;
+   const double fy = y - y0;
+
+   const auto azimuths = static_cast<std::int64_t>(table.azimuths_);
+   const auto column0  = static_cast<std::size_t>(
+      (static_cast<std::int64_t>(x0) % azimuths + azimuths) % azimuths);
+   const auto column1 = (column0 + 1u) % table.azimuths_;
+   const auto row0    = static_cast<std::size_t>(y0);
+   const auto row1    = row0 + 1u;
+
+   auto sample = [&](std::size_t row, std::size_t column, std::size_t i)
+   {
+      return static_cast<double>(
+         table.offsets_[(row * table.azimuths_ + column) * 2u + i]);
+   };
+
+   std::array<double, 2> offset {};
+   for (std::size_t i = 0; i < offset.size(); ++i)
+   {
+      offset[i] = (1.0 - fy) * ((1.0 - fx) * sample(row0, column0, i) +
+                                fx * sample(row0, column1, i)) +
+                  fy * ((1.0 - fx) * sample(row1, column0, i) +
+                        fx * sample(row1, column1, i));
+   }
+
+   return {table.radarLatitude_ + offset[0],
+           table.radarLongitude_ + offset[1]};
+}
+
+TEST(SweepGeometry, GeodesicTableMatchesGeodesic)
+{
+   // Geodesic table resolution of the radar product manager
+   static constexpr float kAzimuthInterval = 0.5f;    // degrees
+   static constexpr float kRangeInterval   = 1000.0f; // meters
+   static constexpr float kMaxRange =
+      common::MAX_DATA_MOMENT_GATES * kGateSize_; // meters
+
+   // Interpolation tolerance stated by ComputeGeodesicTable
+   static constexpr double kTolerance = 6.0; // meters
+
+   const GeographicLib::Geodesic& geodesic =
+      util::GeographicLib::DefaultGeodesic();
+
+   // KLSX, and a site at high latitude whose sweep crosses the antimeridian
+   static const std::vector<std::pair<double, double>> kRadarSites = {
+      {kRadarLatitude_, kRadarLongitude_}, {64.5, 179.0}};
+
+   for (auto [radarLatitude, radarLongitude] : kRadarSites)
+   {
+      SCOPED_TRACE(fmt::format("{}, {}", radarLatitude, radarLongitude));
+
+      SweepParameters parameters = Level2Parameters();
+      parameters.radarLatitude_  = radarLatitude;
+      parameters.radarLongitude_ = radarLongitude;
+
+      GeodesicTable table {};
+      ComputeGeodesicTable(
+         parameters, kAzimuthInterval, kRangeInterval, kMaxRange, table);
+
+      EXPECT_EQ(table.azimuths_, 720u);
+      EXPECT_EQ(table.ranges_, 461u);
+      ASSERT_EQ(table.offsets_.size(), table.azimuths_ * table.ranges_ * 2u);
+
+      // Azimuths and ranges fall between samples, in addition to the samples
+      // themselves, covering the full table
+      for (double azimuth = 0.0; azimuth < 360.0; azimuth += 0.3 + 1e-3)
+      {
+         for (double range = 0.0; range <= kMaxRange; range += 1250.0 / 3.0)
+         {
+            auto [latitude, longitude] =
+               InterpolateGeodesicTable(table, azimuth, range);
+
+            double expectedLatitude  = 0.0;
+            double expectedLongitude = 0.0;
+            geodesic.Direct(radarLatitude,
+                            radarLongitude,
+                            azimuth,
+                            range,
+                            expectedLatitude,
+                            expectedLongitude);
+
+            double error = 0.0;
+            geodesic.Inverse(expectedLatitude,
+                             expectedLongitude,
+                             latitude,
+                             longitude,
+                             error);
+
+            if (error > kTolerance)
+            {
+               ADD_FAILURE() << "Azimuth " << azimuth << ", range " << range
+                             << " is " << error << " meters from the geodesic";
+               return;
+            }
+         }
+      }
+   }
+}
+
+/**
+ * Expects the triangles of the indexed layout to be those of the vertex layout,
+ * with the same vertices and data moments. Unless smoothing, a triangle of the
+ * indexed layout takes the data moment of its provoking vertex.
+ */
+template<class T>
+static void ExpectIndexedTriangles(const std::vector<float>& coordinates,
+                                   const SweepGeometry&      indexed,
+                                   const std::vector<T>&     indexedMoments,
+                                   const SweepGeometry&      vertices,
+                                   const std::vector<T>&     vertexMoments,
+                                   bool                      smoothingEnabled,
+                                   const std::string&        name)
+{
+   if (indexedMoments.empty() && vertexMoments.empty())
+   {
+      return;
+   }
+
+   ASSERT_FALSE(indexed.levels_.empty());
+
+   const std::size_t count = indexed.levels_[0].count_;
+
+   ASSERT_EQ(indexed.levels_[0].offset_, 0u);
+   ASSERT_EQ(count % 3u, 0u);
+   ASSERT_EQ(count * 2u, vertices.vertices_.size());
+   ASSERT_EQ(vertexMoments.size(), count) << name;
+
+   for (std::size_t i = 0; i < count; ++i)
+   {
+      const std::size_t coordinate = indexed.indices_[i];
+      const std::size_t provoking  = indexed.indices_[i / 3u * 3u + 2u];
+      const std::size_t moment = (smoothingEnabled) ? coordinate : provoking;
+
+      if (std::memcmp(&coordinates[coordinate * 2u],
+                      &vertices.vertices_[i * 2u],
+                      sizeof(float) * 2u) != 0)
+      {
+         ADD_FAILURE() << "Vertex " << i << " differs";
+         return;
+      }
+      if (indexedMoments[moment] != vertexMoments[i])
+      {
+         ADD_FAILURE() << name << " of vertex " << i << " differs";
+         return;
+      }
+   }
+}
+
+TEST(SweepGeometry, Level2IndexedMatchesVertices)
+{
+   std::vector<Level2ScanOptions> scanOptions = kLevel2ScanOptions_;
+
+   // Data beginning at the radar site is drawn with origin triangles
+   scanOptions.push_back(
+      {.missingRadials_  = {100u, 101u, 102u, 300u},
+       .numberOfGates_   = 460u,
+       .dataMomentRange_ = 125,
+       .dataBlockType_   = wsr88d::rda::DataBlockType::MomentRef,
+       .dataWordSize_    = 8u,
+       .cfpEnabled_      = true});
+
+   for (const Level2ScanOptions& options : scanOptions)
+   {
+      auto scan = CreateLevel2Scan(options);
+
+      for (bool smoothingEnabled : {false, true})
+      {
+         SCOPED_TRACE(fmt::format("{}, range {}",
+                                  SweepName(options,
+                                            smoothingEnabled,
+                                            SweepLayout::Indexed),
+                                  options.dataMomentRange_));
+
+         std::vector<float> coordinates {};
+         SweepGeometry      indexed {};
+         ComputeLevel2Geometry(
+            *scan,
+            options.dataBlockType_,
+            Level2Parameters(options, smoothingEnabled, SweepLayout::Indexed),
+            0u,
+            coordinates,
+            indexed);
+
+         std::vector<float> vertexCoordinates {};
+         SweepGeometry      vertices {};
+         ComputeLevel2Geometry(
+            *scan,
+            options.dataBlockType_,
+            Level2Parameters(options, smoothingEnabled, SweepLayout::Vertices),
+            0u,
+            vertexCoordinates,
+            vertices);
+
+         ExpectIdentical(coordinates, vertexCoordinates, "coordinates");
+
+         if (options.dataMomentRange_ < kGateSize_ && !smoothingEnabled)
+         {
+            // The radar site is the first vertex of each origin triangle
+            const auto site =
+               static_cast<std::uint32_t>(kLevel2Coordinates_ / 2u - 1u);
+            EXPECT_NE(std::find(indexed.indices_.cbegin(),
+                                indexed.indices_.cend(),
+                                site),
+                      indexed.indices_.cend());
+         }
+
+         ExpectIndexedTriangles(coordinates,
+                                indexed,
+                                indexed.dataMoments8_,
+                                vertices,
+                                vertices.dataMoments8_,
+                                smoothingEnabled,
+                                "dataMoments8_");
+         ExpectIndexedTriangles(coordinates,
+                                indexed,
+                                indexed.dataMoments16_,
+                                vertices,
+                                vertices.dataMoments16_,
+                                smoothingEnabled,
+                                "dataMoments16_");
+
+         // Clutter filter power is not populated when smoothing
+         if (!smoothingEnabled && options.cfpEnabled_)
+         {
+            ExpectIndexedTriangles(coordinates,
+                                   indexed,
+                                   indexed.cfpMoments_,
+                                   vertices,
+                                   vertices.cfpMoments_,
+                                   smoothingEnabled,
+                                   "cfpMoments_");
+         }
+      }
+   }
+}
+
+static Level2CoordinateKey
+ComputeCoordinateKey(const Level2ScanOptions& options, bool smoothingEnabled)
+{
+   auto scan = CreateLevel2Scan(options);
+   return ComputeLevel2CoordinateKey(
+      *scan,
+      Level2Parameters(options, smoothingEnabled, SweepLayout::Vertices));
+}
+
+TEST(SweepGeometry, Level2CoordinateKeyEqualForSameGeometry)
+{
+   const Level2ScanOptions options {.numberOfGates_ = 460u};
+
+   for (bool smoothingEnabled : {false, true})
+   {
+      SCOPED_TRACE(smoothingEnabled ? "smoothed" : "");
+
+      const Level2CoordinateKey key =
+         ComputeCoordinateKey(options, smoothingEnabled);
+
+      EXPECT_EQ(key.smoothingEnabled_, smoothingEnabled);
+      EXPECT_EQ(key.radialAngles_.size(), common::MAX_0_5_DEGREE_RADIALS);
+
+      // Elevation scans of another moment, with the same radials
+      Level2ScanOptions otherMoment = options;
+      otherMoment.dataBlockType_    = wsr88d::rda::DataBlockType::MomentPhi;
+      otherMoment.dataWordSize_     = 16u;
+
+      // Coordinates are computed for the maximum number of gates, regardless
+      // of the gates of the moment
+      Level2ScanOptions moreGates = options;
+      moreGates.numberOfGates_    = common::MAX_DATA_MOMENT_GATES;
+
+      // Azimuths within the quantization of the key
+      Level2ScanOptions nearAzimuth = options;
+      nearAzimuth.azimuthOffset_ += 0.0001f;
+
+      for (const Level2ScanOptions& other :
+           {otherMoment, moreGates, nearAzimuth})
+      {
+         const Level2CoordinateKey otherKey =
+            ComputeCoordinateKey(other, smoothingEnabled);
+
+         EXPECT_EQ(otherKey.hash_, key.hash_);
+         EXPECT_TRUE(otherKey == key);
+      }
+
+      // The key does not include the radar site or gate size, so coordinates
+      // computed from either scan are identical
+      auto scan      = CreateLevel2Scan(options);
+      auto otherScan = CreateLevel2Scan(otherMoment);
+
+      const SweepParameters parameters =
+         Level2Parameters(options, smoothingEnabled, SweepLayout::Vertices);
+
+      std::vector<float> coordinates(kLevel2Coordinates_);
+      std::vector<float> otherCoordinates(kLevel2Coordinates_);
+      ComputeLevel2Coordinates(*scan, parameters, 0u, coordinates);
+      ComputeLevel2Coordinates(*otherScan, parameters, 0u, otherCoordinates);
+
+      ExpectIdentical(otherCoordinates, coordinates, "coordinates");
+   }
+}
+
+TEST(SweepGeometry, Level2CoordinateKeyDiffersForOtherGeometry)
+{
+   const Level2ScanOptions options {.numberOfGates_ = 460u};
+
+   const Level2CoordinateKey key = ComputeCoordinateKey(options, false);
+
+   // Smoothing offsets coordinates to the center of each gate
+   EXPECT_FALSE(ComputeCoordinateKey(options, true) == key);
+
+   // Azimuths beyond the quantization of the key
+   Level2ScanOptions otherAzimuth = options;
+   otherAzimuth.azimuthOffset_ += 0.002f;
+   EXPECT_FALSE(ComputeCoordinateKey(otherAzimuth, false) == key);
+
+   // A missing radial has an extrapolated azimuth
+   Level2ScanOptions missingRadial = options;
+   missingRadial.missingRadials_   = {100u};
+   EXPECT_TRUE(ComputeCoordinateKey(missingRadial, false) == key);
+
+   // An elevation scan in progress has an additional radial edge
+   Level2ScanOptions incomplete = options;
+   incomplete.radialCount_      = 250u;
+   EXPECT_FALSE(ComputeCoordinateKey(incomplete, false) == key);
+}
+
+TEST(SweepGeometry, Level2CoordinateCacheEvictsLeastRecentlyUsed)
+{
+   // Limit of the Level 2 coordinate cache of the radar product manager
+   static constexpr std::size_t kCacheLimit = 6u;
+
+   Level2CoordinateCache cache {kCacheLimit};
+
+   // Coordinate keys of elevation scans with different azimuths
+   std::vector<Level2CoordinateKey> keys {};
+   for (std::size_t i = 0; i <= kCacheLimit; ++i)
+   {
+      Level2ScanOptions options {.numberOfGates_ = 460u};
+      options.azimuthOffset_ = 0.1f + static_cast<float>(i) * 0.05f;
+      keys.push_back(ComputeCoordinateKey(options, false));
+   }
+
+   for (std::size_t i = 0; i < kCacheLimit; ++i)
+   {
+      auto coordinates = std::make_shared<const std::vector<float>>(
+         1u, static_cast<float>(i));
+      EXPECT_TRUE(cache.Insert(keys[i], coordinates));
+   }
+   EXPECT_EQ(cache.count(), kCacheLimit);
+
+   // Finding the first coordinates makes the second the least recently used
+   ASSERT_NE(cache.Find(keys[0]), nullptr);
+   EXPECT_EQ((**cache.Find(keys[0]))[0], 0.0f);
+
+   EXPECT_TRUE(cache.Insert(
+      keys[kCacheLimit],
+      std::make_shared<const std::vector<float>>(
+         1u, static_cast<float>(kCacheLimit))));
+
+   EXPECT_EQ(cache.count(), kCacheLimit);
+   EXPECT_EQ(cache.Find(keys[1]), nullptr);
+   for (std::size_t i : {0u, 2u, 3u, 4u, 5u, 6u})
+   {
+      ASSERT_NE(cache.Find(keys[i]), nullptr) << i;
+      EXPECT_EQ((**cache.Find(keys[i]))[0], static_cast<float>(i));
+   }
+
+   // Coordinates of the same geometry are found by an equal key
+   Level2ScanOptions sameGeometry {.numberOfGates_ = 460u};
+   sameGeometry.azimuthOffset_ = 0.1f;
+   sameGeometry.dataBlockType_ = wsr88d::rda::DataBlockType::MomentPhi;
+   sameGeometry.dataWordSize_  = 16u;
+   EXPECT_NE(cache.Find(ComputeCoordinateKey(sameGeometry, false)), nullptr);
+
+   // Cached coordinates are kept
+   EXPECT_FALSE(cache.Insert(
+      keys[0], std::make_shared<const std::vector<float>>(1u, -1.0f)));
+   EXPECT_EQ((**cache.Find(keys[0]))[0], 0.0f);
+}
+
+// Parallel computations use at least this many threads, even with fewer cores
+static constexpr std::size_t kParallelThreads_ = 4u;
+
+/**
+ * Runs a computation with the parallel algorithms of the sweep geometry kernels
+ * limited to a single thread.
+ */
+template<class Compute>
+static void ComputeSerially(const Compute& compute)
+{
+#if !defined(_MSC_VER)
+   const tbb::global_control control(
+      tbb::global_control::max_allowed_parallelism, 1u);
+#endif
+
+   compute();
+}
+
+/**
+ * Runs a computation with the parallel algorithms of the sweep geometry kernels
+ * executed by several threads.
+ */
+template<class Compute>
+static void ComputeInParallel(const Compute& compute)
+{
+#if !defined(_MSC_VER)
+   const std::size_t threads = std::max<std::size_t>(
+      kParallelThreads_, std::thread::hardware_concurrency());
+
+   const tbb::global_control control(
+      tbb::global_control::max_allowed_parallelism, threads);
+   tbb::task_arena arena(static_cast<int>(threads));
+
+   arena.execute(compute);
+#else
+   compute();
+#endif
+}
+
+static void ExpectIdenticalGeometry(const SweepGeometry& actual,
+                                    const SweepGeometry& expected)
+{
+   EXPECT_EQ(actual.layout_, expected.layout_);
+
+   ExpectIdentical(actual.vertices_, expected.vertices_, "vertices_");
+   ExpectIdentical(actual.indices_, expected.indices_, "indices_");
+   ExpectIdentical(actual.polar_.radialAngles_,
+                   expected.polar_.radialAngles_,
+                   "polar_.radialAngles_");
+   ExpectIdentical(
+      actual.polar_.cells_, expected.polar_.cells_, "polar_.cells_");
+   ExpectIdentical(
+      actual.dataMoments8_, expected.dataMoments8_, "dataMoments8_");
+   ExpectIdentical(
+      actual.dataMoments16_, expected.dataMoments16_, "dataMoments16_");
+   ExpectIdentical(actual.cfpMoments_, expected.cfpMoments_, "cfpMoments_");
+   ExpectIdentical(actual.radialMomentOffsets_,
+                   expected.radialMomentOffsets_,
+                   "radialMomentOffsets_");
+
+   EXPECT_EQ(actual.polar_.momentsPerCell_, expected.polar_.momentsPerCell_);
+   EXPECT_EQ(actual.polar_.gateSize_, expected.polar_.gateSize_);
+   EXPECT_EQ(actual.polar_.gateRangeOffset_,
+             expected.polar_.gateRangeOffset_);
+
+   ASSERT_EQ(actual.levels_.size(), expected.levels_.size());
+   for (std::size_t level = 0; level < actual.levels_.size(); ++level)
+   {
+      EXPECT_EQ(actual.levels_[level].gateLength_,
+                expected.levels_[level].gateLength_);
+      EXPECT_EQ(actual.levels_[level].offset_, expected.levels_[level].offset_);
+      EXPECT_EQ(actual.levels_[level].count_, expected.levels_[level].count_);
+   }
+}
+
+/**
+ * Expects the data moments drawn by the indexed layout to be identical. The
+ * data moment of a gate is taken from the last vertex of each triangle, or from
+ * each vertex when smoothing.
+ */
+template<class T>
+static void
+ExpectIdenticalDrawnMoments(const std::vector<std::uint32_t>& indices,
+                            bool                              smoothingEnabled,
+                            const std::vector<T>&             actual,
+                            const std::vector<T>&             expected,
+                            const std::string&                name)
+{
+   ASSERT_EQ(actual.size(), expected.size()) << name;
+
+   if (actual.empty())
+   {
+      return;
+   }
+
+   const std::size_t first  = (smoothingEnabled) ? 0u : 2u;
+   const std::size_t stride = (smoothingEnabled) ? 1u : 3u;
+
+   for (std::size_t i = first; i < indices.size(); i += stride)
+   {
+      const std::uint32_t coordinate = indices[i];
+      if (actual[coordinate] != expected[coordinate])
+      {
+         ADD_FAILURE() << name << " differs at coordinate " << coordinate;
+         return;
+      }
+   }
+}
+
+/**
+ * Expects two sweeps to be drawn identically. In the indexed layout, the data
+ * moments of coordinates that are not drawn are unspecified, and are not
+ * compared.
+ */
+static void ExpectEquivalentGeometry(const SweepGeometry&   actual,
+                                     const SweepGeometry&   expected,
+                                     const SweepParameters& parameters)
+{
+   if (parameters.layout_ != SweepLayout::Indexed)
+   {
+      ExpectIdenticalGeometry(actual, expected);
+      return;
+   }
+
+   const bool smoothingEnabled = parameters.smoothingEnabled_;
+
+   ExpectIdenticalDrawnMoments(expected.indices_,
+                               smoothingEnabled,
+                               actual.dataMoments8_,
+                               expected.dataMoments8_,
+                               "dataMoments8_");
+   ExpectIdenticalDrawnMoments(expected.indices_,
+                               smoothingEnabled,
+                               actual.dataMoments16_,
+                               expected.dataMoments16_,
+                               "dataMoments16_");
+   ExpectIdenticalDrawnMoments(expected.indices_,
+                               smoothingEnabled,
+                               actual.cfpMoments_,
+                               expected.cfpMoments_,
+                               "cfpMoments_");
+
+   SweepGeometry actualGeometry   = actual;
+   SweepGeometry expectedGeometry = expected;
+   for (SweepGeometry* geometry : {&actualGeometry, &expectedGeometry})
+   {
+      geometry->dataMoments8_.clear();
+      geometry->dataMoments16_.clear();
+      geometry->cfpMoments_.clear();
+   }
+
+   ExpectIdenticalGeometry(actualGeometry, expectedGeometry);
+}
+
+TEST(SweepGeometry, Level2ParallelMatchesSerial)
+{
+#if defined(_MSC_VER)
+   GTEST_SKIP() << "Parallel algorithms are not limited without TBB";
+#endif
+
+   for (const Level2ScanOptions& options : kLevel2ScanOptions_)
+   {
+      auto scan = CreateLevel2Scan(options);
+
+      for (bool smoothingEnabled : {false, true})
+      {
+         for (SweepLayout layout : kSweepLayouts_)
+         {
+            SCOPED_TRACE(SweepName(options, smoothingEnabled, layout));
+
+            const SweepParameters parameters =
+               Level2Parameters(options, smoothingEnabled, layout);
+
+            std::vector<float> serialCoordinates {};
+            SweepGeometry      serialGeometry {};
+            ComputeSerially(
+               [&]()
+               {
+                  ComputeLevel2Geometry(*scan,
+                                        options.dataBlockType_,
+                                        parameters,
+                                        0u,
+                                        serialCoordinates,
+                                        serialGeometry);
+               });
+
+            std::vector<float> coordinates {};
+            SweepGeometry      geometry {};
+            ComputeInParallel(
+               [&]()
+               {
+                  ComputeLevel2Geometry(*scan,
+                                        options.dataBlockType_,
+                                        parameters,
+                                        0u,
+                                        coordinates,
+                                        geometry);
+               });
+
+            ASSERT_FALSE(serialGeometry.levels_.empty());
+            EXPECT_GT(serialGeometry.levels_[0].count_, 0u);
+
+            ExpectIdentical(coordinates, serialCoordinates, "coordinates");
+            ExpectIdenticalGeometry(geometry, serialGeometry);
+         }
+      }
+   }
+}
+
+TEST(SweepGeometry, Level2IncrementalMatchesComplete)
+{
+   // Radials are appended to an elevation scan in progress, which remains
+   // incomplete
+   static const std::vector<std::uint16_t> kRadialCounts = {
+      8u, 9u, 10u, 47u, 101u, 250u, 251u, 480u, 700u};
+
+   for (Level2ScanOptions options : kLevel2ScanOptions_)
+   {
+      for (bool smoothingEnabled : {false, true})
+      {
+         for (SweepLayout layout : kSweepLayouts_)
+         {
+            SCOPED_TRACE(SweepName(options, smoothingEnabled, layout));
+
+            const SweepParameters parameters =
+               Level2Parameters(options, smoothingEnabled, layout);
+
+            std::vector<float> coordinates {};
+            SweepGeometry      geometry {};
+            std::size_t        firstUpdatedRadial = 0u;
+
+            std::shared_ptr<wsr88d::rda::PackedElevationScan> scan {};
+
+            for (std::uint16_t radialCount : kRadialCounts)
+            {
+               options.radialCount_ = radialCount;
+               scan                 = CreateLevel2Scan(options);
+               ASSERT_TRUE(IsLevel2SweepIncomplete(*scan));
+
+               ComputeLevel2Geometry(*scan,
+                                     options.dataBlockType_,
+                                     parameters,
+                                     firstUpdatedRadial,
+                                     coordinates,
+                                     geometry);
+
+               // The last radial is recomputed with the appended radials, as
+               // the Level 2 product view does
+               firstUpdatedRadial = static_cast<std::size_t>(
+                  scan->last_radial_header() - scan->radial_headers().data());
+            }
+
+            std::vector<float> completeCoordinates {};
+            SweepGeometry      completeGeometry {};
+            ComputeLevel2Geometry(*scan,
+                                  options.dataBlockType_,
+                                  parameters,
+                                  0u,
+                                  completeCoordinates,
+                                  completeGeometry);
+
+            ExpectIdentical(coordinates, completeCoordinates, "coordinates");
+            ExpectEquivalentGeometry(geometry, completeGeometry, parameters);
+         }
+      }
+   }
+}
+
+TEST(SweepGeometry, Level3RadialParallelMatchesSerial)
+{
+#if defined(_MSC_VER)
+   GTEST_SKIP() << "Parallel algorithms are not limited without TBB";
+#endif
+
+   static constexpr std::uint16_t kDataMomentInterval = 250u;
+
+   const TestRadialDataPacket radialData {360u, 460u};
+
+   for (bool smoothingEnabled : {false, true})
+   {
+      SCOPED_TRACE(smoothingEnabled ? "smoothed" : "");
+
+      SweepParameters parameters = Level2Parameters();
+      parameters.smoothingEnabled_ = smoothingEnabled;
+      parameters.snrThreshold_     = 16u;
+
+      std::vector<float> serialCoordinates(kLevel3RadialCoordinates_);
+      SweepGeometry      serialGeometry {};
+      ComputeSerially(
+         [&]()
+         {
+            ComputeLevel3RadialCoordinates(
+               radialData, parameters, serialCoordinates);
+            ComputeLevel3RadialSweep(radialData,
+                                     parameters,
+                                     serialCoordinates,
+                                     0u,
+                                     kDataMomentInterval,
+                                     serialGeometry);
+            ComputeLevel3RadialSweepLevels(radialData,
+                                           parameters,
+                                           serialCoordinates,
+                                           0u,
+                                           kDataMomentInterval,
+                                           serialGeometry);
+         });
+
+      std::vector<float> coordinates(kLevel3RadialCoordinates_);
+      SweepGeometry      geometry {};
+      ComputeInParallel(
+         [&]()
+         {
+            ComputeLevel3RadialCoordinates(radialData, parameters, coordinates);
+            ComputeLevel3RadialSweep(radialData,
+                                     parameters,
+                                     coordinates,
+                                     0u,
+                                     kDataMomentInterval,
+                                     geometry);
+            ComputeLevel3RadialSweepLevels(radialData,
+                                           parameters,
+                                           coordinates,
+                                           0u,
+                                           kDataMomentInterval,
+                                           geometry);
+         });
+
+      EXPECT_FALSE(serialGeometry.dataMoments8_.empty());
+
+      ExpectIdentical(coordinates, serialCoordinates, "coordinates");
+      ExpectIdenticalGeometry(geometry, serialGeometry);
+   }
+}
+
+TEST(SweepGeometry, Level3RasterParallelMatchesSerial)
+{
+#if defined(_MSC_VER)
+   GTEST_SKIP() << "Parallel algorithms are not limited without TBB";
+#endif
+
+   static constexpr std::uint16_t kResolution = 1000u;
+   static constexpr float         kRange      = 32.0f;
+
+   auto rasterData = CreateRasterDataPacket(64u);
+   ASSERT_NE(rasterData, nullptr);
+
+   const std::size_t maxColumns = GetLevel3RasterColumns(*rasterData);
+   ASSERT_EQ(maxColumns, 64u);
+
+   for (bool smoothingEnabled : {false, true})
+   {
+      SCOPED_TRACE(smoothingEnabled ? "smoothed" : "");
+
+      SweepParameters parameters = Level2Parameters();
+      parameters.smoothingEnabled_ = smoothingEnabled;
+      parameters.snrThreshold_     = 2u;
+
+      std::vector<float> serialCoordinates {};
+      SweepGeometry      serialGeometry {};
+      ComputeSerially(
+         [&]()
+         {
+            ComputeLevel3RasterCoordinates(*rasterData,
+                                           parameters,
+                                           kResolution,
+                                           kResolution,
+                                           kRange,
+                                           maxColumns,
+                                           serialCoordinates);
+            ComputeLevel3RasterSweep(*rasterData,
+                                     parameters,
+                                     serialCoordinates,
+                                     maxColumns,
+                                     serialGeometry);
+         });
+
+      std::vector<float> coordinates {};
+      SweepGeometry      geometry {};
+      ComputeInParallel(
+         [&]()
+         {
+            ComputeLevel3RasterCoordinates(*rasterData,
+                                           parameters,
+                                           kResolution,
+                                           kResolution,
+                                           kRange,
+                                           maxColumns,
+                                           coordinates);
+            ComputeLevel3RasterSweep(
+               *rasterData, parameters, coordinates, maxColumns, geometry);
+         });
+
+      EXPECT_FALSE(serialGeometry.dataMoments8_.empty());
+
+      ExpectIdentical(coordinates, serialCoordinates, "coordinates");
+      ExpectIdenticalGeometry(geometry, serialGeometry);
+   }
+}
+
+static constexpr std::size_t  kPolarEdgesPerCell_ = 4u;
+static constexpr std::size_t  kVerticesPerCell_   = 6u;
+static constexpr std::uint8_t kRangeFolded_       = 1u;
+
+/**
+ * Expects the levels of detail to be stored consecutively, without overlap,
+ * and to fill the sweep buffers.
+ */
+static void ExpectLevelsFillSweep(std::vector<SweepLevel> levels,
+                                  std::size_t             sweepSize)
+{
+   std::sort(levels.begin(),
+             levels.end(),
+             [](const SweepLevel& a, const SweepLevel& b)
+             { return a.offset_ < b.offset_; });
+
+   std::size_t offset = 0u;
+   for (const SweepLevel& level : levels)
+   {
+      EXPECT_EQ(level.offset_, offset);
+      offset = level.offset_ + level.count_;
+   }
+   EXPECT_EQ(offset, sweepSize);
+}
+
+/**
+ * Expects each polar cell of a decimated level to merge a block of radials, to
+ * span no more than the gate length of the level, and to enclose the visible
+ * full resolution cells. Each decimated cell must enclose at least one.
+ */
+static void ExpectPolarLevelCells(const PolarSweepGeometry& polar,
+                                  const SweepLevel&         fullLevel,
+                                  const SweepLevel&         level,
+                                  std::size_t               radialStride,
+                                  std::size_t               radialCount,
+                                  bool                      expectNested)
+{
+   const std::vector<std::uint16_t>& cells = polar.cells_;
+
+   // Decimated cells, keyed by start radial and near gate edge
+   std::map<std::pair<std::uint16_t, std::uint16_t>,
+            std::pair<std::uint16_t, bool>>
+      mergedCells {};
+
+   for (std::size_t cell = level.offset_; cell < level.offset_ + level.count_;
+        ++cell)
+   {
+      const std::size_t   edges       = cell * kPolarEdgesPerCell_;
+      const std::uint16_t startRadial = cells[edges];
+      const std::uint16_t endRadial   = cells[edges + 1];
+      const std::uint16_t nearGate    = cells[edges + 2];
+      const std::uint16_t farGate     = cells[edges + 3];
+
+      EXPECT_EQ(startRadial % radialStride, 0u) << "cell " << cell;
+      EXPECT_EQ((endRadial + radialCount - startRadial) % radialCount,
+                radialStride % radialCount)
+         << "cell " << cell;
+      EXPECT_LT(nearGate, farGate) << "cell " << cell;
+      EXPECT_LE(static_cast<float>(farGate - nearGate) * polar.gateSize_,
+                level.gateLength_)
+         << "cell " << cell;
+
+      EXPECT_TRUE(mergedCells
+                     .emplace(std::make_pair(startRadial, nearGate),
+                              std::make_pair(farGate, false))
+                     .second)
+         << "cell " << cell;
+   }
+
+   if (!expectNested)
+   {
+      return;
+   }
+
+   for (std::size_t cell = fullLevel.offset_;
+        cell < fullLevel.offset_ + fullLevel.count_;
+        ++cell)
+   {
+      const std::size_t   edges       = cell * kPolarEdgesPerCell_;
+      const std::uint16_t startRadial = cells[edges];
+      const std::uint16_t nearGate    = cells[edges + 2];
+      const std::uint16_t farGate     = cells[edges + 3];
+
+      const auto blockRadial =
+         static_cast<std::uint16_t>(startRadial / radialStride * radialStride);
+
+      // Find the last decimated cell of the block beginning at or before the
+      // full resolution cell
+      auto it = mergedCells.upper_bound({blockRadial, nearGate});
+      ASSERT_NE(it, mergedCells.begin()) << "cell " << cell;
+      --it;
+
+      ASSERT_EQ(it->first.first, blockRadial) << "cell " << cell;
+      EXPECT_GE(it->second.first, farGate) << "cell " << cell;
+      it->second.second = true;
+   }
+
+   for (const auto& [key, mergedCell] : mergedCells)
+   {
+      EXPECT_TRUE(mergedCell.second)
+         << "radial " << key.first << " gate " << key.second;
+   }
+}
+
+TEST(SweepGeometry, Level2LevelsOfDetail)
+{
+   // 0.5 degree radials and 250 meter gates are merged into 1 degree, 1 km
+   // cells and 2 degree, 4 km cells
+   static const std::vector<float>       kGateLengths   = {250.0f,
+                                                           1000.0f,
+                                                           4000.0f};
+   static const std::vector<std::size_t> kRadialStrides = {1u, 2u, 4u};
+
+   const Level2ScanOptions options {};
+   const auto              scan = CreateLevel2Scan(options);
+
+   for (bool smoothingEnabled : {false, true})
+   {
+      SCOPED_TRACE(smoothingEnabled ? "smoothed" : "");
+
+      std::vector<float> coordinates {};
+      SweepGeometry      polarGeometry {};
+      ComputeLevel2Geometry(
+         *scan,
+         options.dataBlockType_,
+         Level2Parameters(options, smoothingEnabled, SweepLayout::Polar),
+         0u,
+         coordinates,
+         polarGeometry);
+
+      SweepGeometry indexedGeometry {};
+      ComputeLevel2Geometry(
+         *scan,
+         options.dataBlockType_,
+         Level2Parameters(options, smoothingEnabled, SweepLayout::Indexed),
+         0u,
+         coordinates,
+         indexedGeometry);
+
+      const std::vector<SweepLevel>& polarLevels   = polarGeometry.levels_;
+      const std::vector<SweepLevel>& indexedLevels = indexedGeometry.levels_;
+
+      ASSERT_EQ(polarLevels.size(), kGateLengths.size());
+      ASSERT_EQ(indexedLevels.size(), kGateLengths.size());
+
+      ExpectLevelsFillSweep(polarLevels,
+                            polarGeometry.polar_.cells_.size() /
+                               kPolarEdgesPerCell_);
+      ExpectLevelsFillSweep(indexedLevels, indexedGeometry.indices_.size());
+
+      for (std::size_t i = 0; i < kGateLengths.size(); ++i)
+      {
+         SCOPED_TRACE(fmt::format("level {}", i));
+
+         EXPECT_EQ(polarLevels[i].gateLength_, kGateLengths[i]);
+         EXPECT_EQ(indexedLevels[i].gateLength_, kGateLengths[i]);
+
+         // Each level is coarser than the preceding level
+         EXPECT_GT(polarLevels[i].count_, 0u);
+         if (i > 0)
+         {
+            EXPECT_LT(polarLevels[i].count_, polarLevels[i - 1].count_);
+         }
+
+         // The first gate is beyond the radar site, so each cell is two
+         // triangles in the indexed layout
+         EXPECT_EQ(indexedLevels[i].count_,
+                   polarLevels[i].count_ * kVerticesPerCell_);
+
+         ExpectPolarLevelCells(polarGeometry.polar_,
+                               polarLevels[0],
+                               polarLevels[i],
+                               kRadialStrides[i],
+                               options.radialCount_,
+                               !smoothingEnabled);
+      }
+   }
+
+   // Decimated levels are not computed for the vertex layout
+   std::vector<float> coordinates {};
+   SweepGeometry      geometry {};
+   ComputeLevel2Geometry(
+      *scan,
+      options.dataBlockType_,
+      Level2Parameters(options, false, SweepLayout::Vertices),
+      0u,
+      coordinates,
+      geometry);
+
+   ASSERT_EQ(geometry.levels_.size(), 1u);
+   EXPECT_EQ(geometry.levels_[0].gateLength_, kGateSize_);
+   EXPECT_EQ(geometry.levels_[0].offset_, 0u);
+   EXPECT_EQ(geometry.levels_[0].count_, geometry.vertices_.size() / 2u);
+}
+
+TEST(SweepGeometry, Level3RadialLevelsOfDetail)
+{
+   static constexpr std::uint16_t kDataMomentInterval = 250u;
+   static constexpr std::uint16_t kRadials            = 360u;
+   static constexpr std::uint16_t kRangeBins          = 460u;
+
+   // 1 degree radials are merged into 2 degree radials with 4 km cells
+   static const std::vector<float>       kGateLengths   = {250.0f,
+                                                           1000.0f,
+                                                           4000.0f};
+   static const std::vector<std::size_t> kRadialStrides = {1u, 1u, 2u};
+
+   const TestRadialDataPacket radialData {kRadials, kRangeBins};
+
+   SweepParameters parameters = Level2Parameters();
+   parameters.snrThreshold_   = 16u;
+
+   std::vector<float> coordinates(kLevel3RadialCoordinates_);
+   SweepGeometry      geometry {};
+   ComputeLevel3RadialCoordinates(radialData, parameters, coordinates);
+   ComputeLevel3RadialSweep(
+      radialData, parameters, coordinates, 0u, kDataMomentInterval, geometry);
+   ComputeLevel3RadialSweepLevels(
+      radialData, parameters, coordinates, 0u, kDataMomentInterval, geometry);
+
+   const std::vector<SweepLevel>& levels = geometry.levels_;
+
+   ASSERT_EQ(levels.size(), kGateLengths.size());
+   ExpectLevelsFillSweep(levels, geometry.dataMoments8_.size());
+   EXPECT_EQ(geometry.vertices_.size(), geometry.dataMoments8_.size() * 2u);
+
+   const GeographicLib::Geodesic& geodesic =
+      util::GeographicLib::DefaultGeodesic();
+
+   for (std::size_t l = 0; l < levels.size(); ++l)
+   {
+      SCOPED_TRACE(fmt::format("level {}", l));
+
+      const SweepLevel& level        = levels[l];
+      const std::size_t radialStride = kRadialStrides[l];
+      const auto        gateStride   = static_cast<std::uint16_t>(
+         std::lround(kGateLengths[l] / kGateSize_));
+
+      EXPECT_EQ(level.gateLength_, kGateLengths[l]);
+
+      // A cell is drawn if any of its gates are visible, and the origin cell
+      // is a single triangle
+      std::size_t expectedCount = 0u;
+      for (std::size_t radial = 0; radial < kRadials; radial += radialStride)
+      {
+         for (std::uint16_t gate = 0; gate < kRangeBins; gate += gateStride)
+         {
+            bool visible = false;
+            for (std::size_t r = radial; r < radial + radialStride; ++r)
+            {
+               const auto& levels8 =
+                  radialData.level(static_cast<std::uint16_t>(r));
+               for (std::uint16_t g = gate;
+                    g < std::min<std::uint16_t>(gate + gateStride, kRangeBins);
+                    ++g)
+               {
+                  visible = visible ||
+                            levels8[g] >= parameters.snrThreshold_ ||
+                            levels8[g] == kRangeFolded_;
+               }
+            }
+
+            if (visible)
+            {
+               expectedCount += (gate == 0u) ? 3u : kVerticesPerCell_;
+            }
+         }
+      }
+      EXPECT_EQ(level.count_, expectedCount);
+
+      // The vertices of each cell span no more than the gate length in range
+      double maxSpan = 0.0;
+      for (std::size_t v = level.offset_; v < level.offset_ + level.count_;)
+      {
+         const std::size_t vertexCount =
+            (geometry.vertices_[v * 2u] ==
+                static_cast<float>(parameters.radarLatitude_) &&
+             geometry.vertices_[v * 2u + 1u] ==
+                static_cast<float>(parameters.radarLongitude_)) ?
+               3u :
+               kVerticesPerCell_;
+
+         double minRange = std::numeric_limits<double>::max();
+         double maxRange = 0.0;
+         for (std::size_t i = v; i < v + vertexCount; ++i)
+         {
+            double range = 0.0;
+            geodesic.Inverse(parameters.radarLatitude_,
+                             parameters.radarLongitude_,
+                             geometry.vertices_[i * 2u],
+                             geometry.vertices_[i * 2u + 1u],
+                             range);
+            minRange = std::min(minRange, range);
+            maxRange = std::max(maxRange, range);
+         }
+
+         maxSpan = std::max(maxSpan, maxRange - minRange);
+         v += vertexCount;
+      }
+      EXPECT_LE(maxSpan, level.gateLength_ + 1.0);
+   }
+}
+
+TEST(SweepGeometry, SelectSweepLevelFitsPixel)
+{
+   const Level2ScanOptions options {};
+   const auto              scan = CreateLevel2Scan(options);
+
+   std::vector<float> coordinates {};
+   SweepGeometry      geometry {};
+   ComputeLevel2Geometry(*scan,
+                         options.dataBlockType_,
+                         Level2Parameters(options, false, SweepLayout::Polar),
+                         0u,
+                         coordinates,
+                         geometry);
+
+   const std::vector<SweepLevel>& levels = geometry.levels_;
+   ASSERT_EQ(levels.size(), 3u);
+
+   // Meters per pixel, and the expected level of detail
+   static const std::vector<std::pair<double, std::size_t>> kSelections = {
+      {10.0, 0u},
+      {249.9, 0u},
+      {250.0, 0u},
+      {999.9, 0u},
+      {1000.0, 1u},
+      {3999.9, 1u},
+      {4000.0, 2u},
+      {100000.0, 2u}};
+
+   for (const auto& [metersPerPixel, expectedLevel] : kSelections)
+   {
+      SCOPED_TRACE(fmt::format("{} m/px", metersPerPixel));
+
+      const SweepLevel& level = SelectSweepLevel(levels, metersPerPixel);
+      EXPECT_EQ(&level, &levels[expectedLevel]);
+
+      if (metersPerPixel < levels[0].gateLength_)
+      {
+         // The full resolution sweep is drawn when each gate spans pixels
+         continue;
+      }
+
+      // Each cell of the selected level fits within a pixel
+      const std::vector<std::uint16_t>& cells = geometry.polar_.cells_;
+      for (std::size_t cell = level.offset_;
+           cell < level.offset_ + level.count_;
+           ++cell)
+      {
+         const std::size_t edges = cell * kPolarEdgesPerCell_;
+         ASSERT_LE(static_cast<double>(cells[edges + 3] - cells[edges + 2]) *
+                      geometry.polar_.gateSize_,
+                   metersPerPixel)
+            << "cell " << cell;
+      }
+
+      // No coarser level fits
+      if (expectedLevel + 1u < levels.size())
+      {
+         EXPECT_GT(levels[expectedLevel + 1u].gateLength_, metersPerPixel);
+      }
+   }
+
+   // A sweep without decimated levels is drawn at full resolution
+   const std::vector<SweepLevel> fullLevel = {{0.0f, 0u, 100u}};
+   EXPECT_EQ(&SelectSweepLevel(fullLevel, 1.0), &fullLevel[0]);
+   EXPECT_EQ(&SelectSweepLevel(fullLevel, 1.0e6), &fullLevel[0]);
+}
+
+TEST(SweepGeometry, SweepSectorsEncloseCells)
+{
+   // Geodesic table resolution of the radar product manager
+   static constexpr float kAzimuthInterval = 0.5f;    // degrees
+   static constexpr float kRangeInterval   = 1000.0f; // meters
+   static constexpr float kMaxRange =
+      common::MAX_DATA_MOMENT_GATES * kGateSize_; // meters
+
+   // Sector bounds and cell positions are single precision
+   static constexpr double kTolerance = 1e-4; // degrees
+
+   const Level2ScanOptions options {};
+   const auto              scan = CreateLevel2Scan(options);
+
+   GeodesicTable table {};
+   ComputeGeodesicTable(
+      Level2Parameters(), kAzimuthInterval, kRangeInterval, kMaxRange, table);
+
+   for (SweepLayout layout : kSweepLayouts_)
+   {
+      for (bool smoothingEnabled : {false, true})
+      {
+         SCOPED_TRACE(SweepName(options, smoothingEnabled, layout));
+
+         std::vector<float> coordinates {};
+         SweepGeometry      geometry {};
+         ComputeLevel2Geometry(
+            *scan,
+            options.dataBlockType_,
+            Level2Parameters(options, smoothingEnabled, layout),
+            0u,
+            coordinates,
+            geometry);
+         ComputeSweepSectors(coordinates, &table, geometry);
+
+         const PolarSweepGeometry& polar = geometry.polar_;
+
+         // Gets the latitude and longitude of each corner of the cells drawn
+         // from an index, cell or vertex
+         auto getPositions = [&](std::size_t i)
+         {
+            std::vector<std::pair<double, double>> positions {};
+
+            switch (layout)
+            {
+            case SweepLayout::Indexed:
+            {
+               const std::size_t coordinate =
+                  static_cast<std::size_t>(geometry.indices_[i]) * 2u;
+               positions.emplace_back(coordinates[coordinate],
+                                      coordinates[coordinate + 1u]);
+               break;
+            }
+
+            case SweepLayout::Polar:
+            {
+               // Gate edge 0 is the radar site
+               auto gateRange = [&polar](std::uint16_t gateEdge)
+               {
+                  return (gateEdge == 0u) ?
+                            0.0 :
+                            (static_cast<double>(gateEdge) - 1.0 +
+                             polar.gateRangeOffset_) *
+                               polar.gateSize_;
+               };
+
+               const std::size_t edges = i * kPolarEdgesPerCell_;
+               double startAzimuth = polar.radialAngles_[polar.cells_[edges]];
+               double endAzimuth =
+                  polar.radialAngles_[polar.cells_[edges + 1u]];
+               if (endAzimuth < startAzimuth)
+               {
+                  endAzimuth += 360.0;
+               }
+
+               for (double azimuth : {startAzimuth,
+                                      (startAzimuth + endAzimuth) / 2.0,
+                                      endAzimuth})
+               {
+                  for (std::uint16_t gateEdge :
+                       {polar.cells_[edges + 2u], polar.cells_[edges + 3u]})
+                  {
+                     positions.push_back(InterpolateGeodesicTable(
+                        table, azimuth, gateRange(gateEdge)));
+                  }
+               }
+               break;
+            }
+
+            default:
+               positions.emplace_back(geometry.vertices_[i * 2u],
+                                      geometry.vertices_[i * 2u + 1u]);
+               break;
+            }
+
+            return positions;
+         };
+
+         for (const SweepLevel& level : geometry.levels_)
+         {
+            SCOPED_TRACE(fmt::format("level {}", level.gateLength_));
+
+            // Sectors cover the level in drawing order
+            ASSERT_FALSE(level.sectors_.empty());
+            EXPECT_EQ(level.sectors_.front().offset_, level.offset_);
+
+            std::size_t offset = level.offset_;
+            for (const SweepSector& sector : level.sectors_)
+            {
+               EXPECT_EQ(sector.offset_, offset);
+               EXPECT_GT(sector.count_, 0u);
+               offset = sector.offset_ + sector.count_;
+
+               for (std::size_t i = sector.offset_; i < offset; ++i)
+               {
+                  for (auto [latitude, longitude] : getPositions(i))
+                  {
+                     if (latitude < sector.minLatitude_ - kTolerance ||
+                         latitude > sector.maxLatitude_ + kTolerance ||
+                         longitude < sector.minLongitude_ - kTolerance ||
+                         longitude > sector.maxLongitude_ + kTolerance)
+                     {
+                        ADD_FAILURE() << latitude << ", " << longitude
+                                      << " of " << i
+                                      << " is outside of sector at "
+                                      << sector.offset_;
+                        return;
+                     }
+                  }
+               }
+            }
+            EXPECT_EQ(offset, level.offset_ + level.count_);
+         }
+      }
+   }
+}
+
+/**
+ * Expects the draw ranges of a level to cover each sector within the bounds.
+ * Culled sectors are only drawn between two visible sectors separated by up to
+ * maxCulledSectors culled sectors.
+ */
+static void ExpectDrawRanges(
+   const SweepLevel&                                       level,
+   const common::Coordinate&                               southWest,
+   const common::Coordinate&                               northEast,
+   std::size_t                                             maxCulledSectors,
+   const std::vector<std::pair<std::size_t, std::size_t>>& ranges)
+{
+   const std::vector<SweepSector>& sectors = level.sectors_;
+
+   // Index of the range covering each sector
+   std::vector<std::optional<std::size_t>> sectorRanges(sectors.size());
+
+   for (std::size_t r = 0; r < ranges.size(); ++r)
+   {
+      const auto [first, count] = ranges[r];
+
+      if (r > 0)
+      {
+         EXPECT_GT(first, ranges[r - 1u].first + ranges[r - 1u].second);
+      }
+
+      for (std::size_t s = 0; s < sectors.size(); ++s)
+      {
+         const std::size_t sectorEnd = sectors[s].offset_ + sectors[s].count_;
+
+         if (sectors[s].offset_ >= first && sectorEnd <= first + count)
+         {
+            sectorRanges[s] = r;
+         }
+         else
+         {
+            // Ranges do not split sectors
+            EXPECT_TRUE(sectorEnd <= first ||
+                        sectors[s].offset_ >= first + count)
+               << "sector " << s << " range " << r;
+         }
+      }
+   }
+
+   auto isVisible = [&](const SweepSector& sector)
+   {
+      return sector.maxLatitude_ >= southWest.latitude_ &&
+             sector.minLatitude_ <= northEast.latitude_ &&
+             sector.maxLongitude_ >= southWest.longitude_ &&
+             sector.minLongitude_ <= northEast.longitude_;
+   };
+
+   // Each range begins and ends with a visible sector
+   for (const auto& [first, count] : ranges)
+   {
+      for (const SweepSector& sector : sectors)
+      {
+         if (sector.offset_ == first ||
+             sector.offset_ + sector.count_ == first + count)
+         {
+            EXPECT_TRUE(isVisible(sector)) << "sector at " << sector.offset_;
+         }
+      }
+   }
+
+   std::optional<std::size_t> previousVisible {};
+
+   for (std::size_t s = 0; s < sectors.size(); ++s)
+   {
+      if (!isVisible(sectors[s]))
+      {
+         continue;
+      }
+
+      ASSERT_TRUE(sectorRanges[s].has_value()) << "sector " << s;
+
+      if (previousVisible.has_value())
+      {
+         // Visible sectors are joined across up to maxCulledSectors culled
+         // sectors
+         const std::size_t culledSectors = s - previousVisible.value() - 1u;
+         EXPECT_EQ(sectorRanges[s] == sectorRanges[previousVisible.value()],
+                   culledSectors <= maxCulledSectors)
+            << "sector " << s;
+      }
+
+      previousVisible = s;
+   }
+
+   // Without visible sectors, nothing is drawn
+   EXPECT_EQ(ranges.empty(), !previousVisible.has_value());
+}
+
+TEST(SweepGeometry, CullSweepSectorsMergesRanges)
+{
+   static constexpr std::size_t kSectorCount = 64u;
+
+   const common::Coordinate southWest {38.0, -91.0};
+   const common::Coordinate northEast {39.0, -90.0};
+
+   // Sectors alternate between the bounds and outside of them in runs of
+   // varying length
+   auto createLevel = [&](const std::vector<bool>& visibleSectors)
+   {
+      SweepLevel level {};
+      level.offset_ = 120u;
+
+      for (bool visible : visibleSectors)
+      {
+         SweepSector& sector   = level.sectors_.emplace_back();
+         sector.offset_        = level.offset_ + level.count_;
+         sector.count_         = 384u;
+         sector.minLatitude_   = visible ? 38.5f : 40.0f;
+         sector.maxLatitude_   = visible ? 38.6f : 40.1f;
+         sector.minLongitude_  = -90.5f;
+         sector.maxLongitude_  = -90.4f;
+         level.count_         += sector.count_;
+      }
+
+      return level;
+   };
+
+   std::vector<std::vector<bool>> patterns = {
+      {},
+      std::vector<bool>(kSectorCount, true),
+      std::vector<bool>(kSectorCount, false),
+      {true, false, true, false, false, true, false, false, false, true, true},
+      {false, false, false, true, false, false, false, true, false, false}};
+
+   // Runs of visible and culled sectors of each length up to 4
+   std::vector<bool>& runs = patterns.emplace_back();
+   for (std::size_t culled = 0; culled <= 4u; ++culled)
+   {
+      for (std::size_t visible = 1; visible <= 4u; ++visible)
+      {
+         runs.insert(runs.end(), visible, true);
+         runs.insert(runs.end(), culled, false);
+      }
+   }
+
+   std::vector<std::pair<std::size_t, std::size_t>> ranges {};
+
+   for (std::size_t p = 0; p < patterns.size(); ++p)
+   {
+      const SweepLevel level = createLevel(patterns[p]);
+
+      for (std::size_t maxDrawnCulledSectors : {0u, 1u, 2u, 3u})
+      {
+         SCOPED_TRACE(
+            fmt::format("pattern {}, up to {}", p, maxDrawnCulledSectors));
+
+         CullSweepSectors(
+            level, southWest, northEast, maxDrawnCulledSectors, ranges);
+         ExpectDrawRanges(
+            level, southWest, northEast, maxDrawnCulledSectors, ranges);
+      }
+   }
+
+   // Culled sectors between two visible sectors are joined up to the limit
+   const SweepLevel level = createLevel(patterns[3]);
+   CullSweepSectors(level, southWest, northEast, 2u, ranges);
+   ASSERT_EQ(ranges.size(), 2u);
+   EXPECT_EQ(ranges[0].first, level.sectors_[0].offset_);
+   EXPECT_EQ(ranges[0].second,
+             level.sectors_[5].offset_ + level.sectors_[5].count_ -
+                level.sectors_[0].offset_);
+   EXPECT_EQ(ranges[1].first, level.sectors_[9].offset_);
+   EXPECT_EQ(ranges[1].second,
+             level.sectors_[10].offset_ + level.sectors_[10].count_ -
+                level.sectors_[9].offset_);
+
+   // Sectors touching the bounds are drawn
+   SweepLevel edgeLevel = createLevel({true, true, true, true});
+   edgeLevel.sectors_[0].maxLatitude_  = 38.0f;
+   edgeLevel.sectors_[1].minLatitude_  = 39.0f;
+   edgeLevel.sectors_[2].maxLongitude_ = -91.0f;
+   edgeLevel.sectors_[3].minLongitude_ = -90.0f;
+   CullSweepSectors(edgeLevel, southWest, northEast, 0u, ranges);
+   ASSERT_EQ(ranges.size(), 1u);
+   EXPECT_EQ(ranges[0].first, edgeLevel.offset_);
+   EXPECT_EQ(ranges[0].second, edgeLevel.count_);
+
+   // A level without sectors is drawn in full, and an empty level is not drawn
+   const SweepLevel fullLevel {0.0f, 10u, 300u};
+   CullSweepSectors(fullLevel, southWest, northEast, 0u, ranges);
+   ASSERT_EQ(ranges.size(), 1u);
+   EXPECT_EQ(ranges[0].first, 10u);
+   EXPECT_EQ(ranges[0].second, 300u);
+
+   CullSweepSectors(SweepLevel {}, southWest, northEast, 0u, ranges);
+   EXPECT_TRUE(ranges.empty());
+}
+
+TEST(SweepGeometry, CullSweepSectorsMatchesViewport)
+{
+   // Radar product layer limit
+   static constexpr std::size_t kMaxDrawnCulledSectors = 2u;
+
+   const Level2ScanOptions options {};
+   const auto              scan = CreateLevel2Scan(options);
+
+   std::vector<float> coordinates {};
+   SweepGeometry      geometry {};
+   ComputeLevel2Geometry(*scan,
+                         options.dataBlockType_,
+                         Level2Parameters(options, false, SweepLayout::Indexed),
+                         0u,
+                         coordinates,
+                         geometry);
+   ComputeSweepSectors(coordinates, nullptr, geometry);
+
+   // Viewports of a county near the radar and away from it, the radar
+   // coverage, and a viewport without radar data
+   static const std::vector<std::pair<common::Coordinate, common::Coordinate>>
+      kViewports = {{{38.5, -90.9}, {38.9, -90.4}},
+                    {{39.5, -92.0}, {39.9, -91.5}},
+                    {{34.0, -96.0}, {43.0, -85.0}},
+                    {{10.0, 10.0}, {11.0, 11.0}}};
+
+   std::vector<std::pair<std::size_t, std::size_t>> ranges {};
+
+   for (const auto& [southWest, northEast] : kViewports)
+   {
+      SCOPED_TRACE(
+         fmt::format("{}, {}", southWest.latitude_, southWest.longitude_));
+
+      for (const SweepLevel& level : geometry.levels_)
+      {
+         CullSweepSectors(
+            level, southWest, northEast, kMaxDrawnCulledSectors, ranges);
+         ExpectDrawRanges(
+            level, southWest, northEast, kMaxDrawnCulledSectors, ranges);
+      }
+   }
+
+   // A county is a small fraction of the full resolution sweep
+   const SweepLevel& fullLevel = geometry.levels_.front();
+   CullSweepSectors(fullLevel,
+                    kViewports[0].first,
+                    kViewports[0].second,
+                    kMaxDrawnCulledSectors,
+                    ranges);
+
+   std::size_t drawnCount = 0u;
+   for (const auto& range : ranges)
+   {
+      drawnCount += range.second;
+   }
+   EXPECT_GT(drawnCount, 0u);
+   EXPECT_LT(drawnCount, fullLevel.count_ / 10u);
+}
+
+// Bin lookup tolerances stated by FindSweepBin
+static constexpr double kBinRangeTolerance_   = 0.1;   // meters
+static constexpr double kBinAzimuthTolerance_ = 0.001; // degrees
+
+/**
+ * Locates a bin by solving the inverse geodesic problem, and searching each
+ * radial for the azimuth, as the product views did before the bin lookup.
+ * Radial azimuths are normalized to [0, 360).
+ */
+static std::optional<SweepBin>
+FindGeodesicBin(const wsr88d::rda::PackedElevationScan& radarData,
+                double                                  latitude,
+                double                                  longitude)
+{
+   double s12;
+   double azi1;
+   double azi2;
+   util::GeographicLib::DefaultGeodesic().Inverse(
+      kRadarLatitude_, kRadarLongitude_, latitude, longitude, s12, azi1, azi2);
+
+   if (azi1 < 0.0)
+   {
+      azi1 += 360.0;
+   }
+
+   const auto          azimuthAngles = radarData.azimuth_angles();
+   const std::uint16_t numRadials =
+      static_cast<std::uint16_t>(radarData.radial_count());
+
+   auto normalize = [](float angle)
+   { return (angle >= 360.0f) ? angle - 360.0f : angle; };
+
+   for (std::uint16_t radial = 0; radial < numRadials; ++radial)
+   {
+      if (!radarData.has_radial(radial))
+      {
+         continue;
+      }
+
+      const units::degrees<float> startAngle {azimuthAngles[radial]};
+      units::degrees<float>       nextAngle {};
+
+      const std::uint16_t nextRadial = (radial + 1) % numRadials;
+      if (radarData.has_radial(nextRadial))
+      {
+         nextAngle = units::degrees<float> {azimuthAngles[nextRadial]};
+      }
+      else
+      {
+         const std::uint16_t prevRadial =
+            (radial >= 1) ? radial - 1 : numRadials - (1 - radial);
+         if (!radarData.has_radial(prevRadial))
+         {
+            continue;
+         }
+
+         const units::degrees<float> prevAngle {azimuthAngles[prevRadial]};
+         nextAngle = startAngle + common::GetAngleDelta(startAngle, prevAngle);
+      }
+
+      const double start = normalize(startAngle.value());
+      const double next  = normalize(nextAngle.value());
+
+      if ((start < next) ? (start <= azi1 && azi1 < next) :
+                           (start <= azi1 || azi1 < next))
+      {
+         return SweepBin {radial, s12};
+      }
+   }
+
+   return std::nullopt;
+}
+
+/**
+ * Gets the gate of a bin as the Level 2 product view does, or std::nullopt if
+ * the bin is beyond the maximum range of its radial.
+ */
+static std::optional<std::int32_t>
+GetGate(const wsr88d::rda::PackedElevationScan& scan, const SweepBin& bin)
+{
+   const auto* moment = scan.moment(wsr88d::rda::DataBlockType::MomentRef);
+   const auto& radial = moment->radials()[bin.radial_];
+
+   const std::int32_t dataMomentInterval =
+      radial.dataMomentRangeSampleIntervalRaw;
+   const std::int32_t dataMomentIntervalH = dataMomentInterval / 2;
+   const std::int32_t dataMomentRange     = std::max<std::int32_t>(
+      radial.dataMomentRangeRaw, dataMomentIntervalH);
+   const std::int32_t startGate =
+      (dataMomentRange - dataMomentIntervalH) /
+      static_cast<std::int32_t>(kGateSize_);
+
+   const std::int32_t gate =
+      static_cast<std::int32_t>(bin.range_) / dataMomentInterval - startGate;
+
+   if (gate < 0 || gate > radial.numberOfDataMomentGates)
+   {
+      return std::nullopt;
+   }
+
+   return gate;
+}
+
+/**
+ * Compares the bin lookup to the geodesic search at the azimuths and ranges
+ * provided. Azimuths within the azimuth tolerance of a radial edge are
+ * skipped, as either radial may be found.
+ */
+static void
+ExpectBinLookupMatchesGeodesic(const wsr88d::rda::PackedElevationScan& scan,
+                               const std::vector<double>&              azimuths,
+                               const std::vector<double>&              ranges)
+{
+   SweepBinLookup lookup {};
+   ComputeLevel2BinLookup(scan, Level2Parameters(), lookup);
+
+   const auto azimuthAngles = scan.azimuth_angles();
+
+   for (double azimuth : azimuths)
+   {
+      const bool nearEdge = std::any_of(
+         azimuthAngles.begin(),
+         azimuthAngles.end(),
+         [azimuth](float angle)
+         {
+            return std::abs(std::remainder(azimuth - angle, 360.0)) <
+                   kBinAzimuthTolerance_;
+         });
+      if (nearEdge)
+      {
+         continue;
+      }
+
+      for (double range : ranges)
+      {
+         double latitude;
+         double longitude;
+         util::GeographicLib::DefaultGeodesic().Direct(kRadarLatitude_,
+                                                       kRadarLongitude_,
+                                                       azimuth,
+                                                       range,
+                                                       latitude,
+                                                       longitude);
+
+         const std::optional<SweepBin> bin =
+            FindSweepBin(lookup, latitude, longitude);
+         const std::optional<SweepBin> expected =
+            FindGeodesicBin(scan, latitude, longitude);
+
+         ASSERT_EQ(bin.has_value(), expected.has_value())
+            << "azimuth " << azimuth << ", range " << range;
+
+         if (bin.has_value())
+         {
+            EXPECT_EQ(bin->radial_, expected->radial_)
+               << "azimuth " << azimuth << ", range " << range;
+            EXPECT_NEAR(bin->range_, expected->range_, kBinRangeTolerance_)
+               << "azimuth " << azimuth << ", range " << range;
+
+            EXPECT_EQ(GetGate(scan, *bin), GetGate(scan, *expected))
+               << "azimuth " << azimuth << ", range " << range;
+         }
+      }
+   }
+}
+
+TEST(SweepGeometry, BinLookupMatchesGeodesic)
+{
+   auto scan = CreateLevel2Scan();
+
+   std::vector<double> azimuths {};
+   for (double azimuth = 0.0; azimuth < 360.0; azimuth += 0.37)
+   {
+      azimuths.push_back(azimuth);
+   }
+
+   // Range gate centers from the radar site to beyond the maximum range
+   const std::vector<double> ranges {
+      125.0, 2125.0, 50125.0, 230125.0, 457875.0, 458125.0, 470125.0};
+
+   ExpectBinLookupMatchesGeodesic(*scan, azimuths, ranges);
+}
+
+TEST(SweepGeometry, BinLookupBucketBoundaries)
+{
+   auto scan = CreateLevel2Scan();
+
+   // Bucket boundaries are at each 0.01 degrees, sampled either side
+   std::vector<double> azimuths {};
+   for (double boundary = 10.0; boundary < 11.0; boundary += 0.01)
+   {
+      azimuths.push_back(boundary - 1e-6);
+      azimuths.push_back(boundary);
+      azimuths.push_back(boundary + 1e-6);
+   }
+
+   // Radial edges, just outside of the azimuth tolerance
+   for (std::uint16_t radial = 0; radial < 8u; ++radial)
+   {
+      const double angle = radial * 0.5 + 0.27;
+      azimuths.push_back(angle - 2.0 * kBinAzimuthTolerance_);
+      azimuths.push_back(angle + 2.0 * kBinAzimuthTolerance_);
+   }
+
+   ExpectBinLookupMatchesGeodesic(*scan, azimuths, {1125.0, 230125.0});
+}
+
+TEST(SweepGeometry, BinLookupSeam)
+{
+   auto scan = CreateLevel2Scan();
+
+   // The last radial covers 359.77 through 0.27 degrees
+   const std::vector<double> azimuths {
+      359.5, 359.75, 359.8, 359.9, 359.99, 359.999999, 0.0, 0.001, 0.1, 0.26};
+
+   ExpectBinLookupMatchesGeodesic(*scan, azimuths, {1125.0, 230125.0});
+
+   SweepBinLookup lookup {};
+   ComputeLevel2BinLookup(*scan, Level2Parameters(), lookup);
+
+   for (double azimuth : {359.9, 0.0, 0.1})
+   {
+      double latitude;
+      double longitude;
+      util::GeographicLib::DefaultGeodesic().Direct(kRadarLatitude_,
+                                                    kRadarLongitude_,
+                                                    azimuth,
+                                                    10000.0,
+                                                    latitude,
+                                                    longitude);
+
+      const std::optional<SweepBin> bin =
+         FindSweepBin(lookup, latitude, longitude);
+      ASSERT_TRUE(bin.has_value());
+      EXPECT_EQ(bin->radial_, common::MAX_0_5_DEGREE_RADIALS - 1u);
+   }
+}
+
+TEST(SweepGeometry, BinLookupMissingRadials)
+{
+   // A gap in the sweep, a single missing radial, and a missing first radial
+   auto scan = CreateLevel2Scan(
+      {.missingRadials_ = {0u, 100u, 101u, 102u, 103u, 104u, 300u}});
+
+   std::vector<double> azimuths {};
+   for (double azimuth = 0.0; azimuth < 360.0; azimuth += 0.13)
+   {
+      azimuths.push_back(azimuth);
+   }
+
+   ExpectBinLookupMatchesGeodesic(*scan, azimuths, {1125.0, 230125.0});
+
+   SweepBinLookup lookup {};
+   ComputeLevel2BinLookup(*scan, Level2Parameters(), lookup);
+
+   // Within the gap, beyond the extrapolated edge of radial 99, no radial is
+   // found
+   double latitude;
+   double longitude;
+   util::GeographicLib::DefaultGeodesic().Direct(
+      kRadarLatitude_, kRadarLongitude_, 51.5, 10000.0, latitude, longitude);
+   EXPECT_FALSE(FindSweepBin(lookup, latitude, longitude).has_value());
+}
+
+TEST(SweepGeometry, BinLookupEmpty)
+{
+   SweepBinLookup lookup {};
+   EXPECT_FALSE(
+      FindSweepBin(lookup, kRadarLatitude_, kRadarLongitude_).has_value());
+}
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
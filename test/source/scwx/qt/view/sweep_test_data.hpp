@@ -0,0 +1,359 @@
+#pragma once
+
+#include <scwx/qt/view/sweep_geometry.hpp>
+#include <scwx/common/constants.hpp>
+#include <scwx/wsr88d/rda/generic_radar_data.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Synthetic radar data shared by the sweep geometry tests and benchmarks. The
+ * data is generated rather than read from the test data directory, so that
+ * each case is small and deterministic.
+ */
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+static constexpr double kRadarLatitude_  = 38.69889;  // KLSX
+static constexpr double kRadarLongitude_ = -90.68278; // KLSX
+static constexpr float  kGateSize_       = 250.0f;
+
+// Level 2 radial gate coordinates are followed by the radar site
+static constexpr std::size_t kLevel2Coordinates_ =
+   (static_cast<std::size_t>(common::MAX_0_5_DEGREE_RADIALS) *
+       common::MAX_DATA_MOMENT_GATES +
+    1u) *
+   2u;
+
+// Level 3 radial gate coordinates
+static constexpr std::size_t kLevel3RadialCoordinates_ =
+   static_cast<std::size_t>(common::MAX_0_5_DEGREE_RADIALS) *
+   common::MAX_DATA_MOMENT_GATES * 2u;
+
+/**
+ * Moment data block of a synthetic radial. Gates vary with the radial and gate
+ * number, and include levels below the SNR threshold and range folded levels.
+ */
+class TestMomentDataBlock :
+    public wsr88d::rda::GenericRadarData::MomentDataBlock
+{
+public:
+   explicit TestMomentDataBlock(std::uint16_t radial,
+                                std::uint16_t numberOfGates,
+                                std::uint8_t  dataWordSize,
+                                std::int16_t  rangeRaw) :
+       numberOfGates_ {numberOfGates},
+       dataWordSize_ {dataWordSize},
+       rangeRaw_ {rangeRaw}
+   {
+      const std::size_t wordSize = dataWordSize / 8u;
+      gates_.resize(numberOfGates * wordSize);
+
+      for (std::size_t gate = 0; gate < numberOfGates; ++gate)
+      {
+         const std::uint16_t level =
+            static_cast<std::uint16_t>((radial * 37u + gate * 11u) % 300u);
+
+         if (wordSize == 2u)
+         {
+            reinterpret_cast<std::uint16_t*>(gates_.data())[gate] = level;
+         }
+         else
+         {
+            gates_[gate] = static_cast<std::uint8_t>(level);
+         }
+      }
+   }
+
+   std::uint16_t number_of_data_moment_gates() const override
+   {
+      return numberOfGates_;
+   }
+   units::kilometers<float> data_moment_range() const override
+   {
+      return units::kilometers<float> {rangeRaw_ * 0.001f};
+   }
+   std::int16_t data_moment_range_raw() const override { return rangeRaw_; }
+   units::kilometers<float> data_moment_range_sample_interval() const override
+   {
+      return units::kilometers<float> {kGateSize_ * 0.001f};
+   }
+   std::uint16_t data_moment_range_sample_interval_raw() const override
+   {
+      return static_cast<std::uint16_t>(kGateSize_);
+   }
+   std::int16_t snr_threshold_raw() const override { return 2; }
+   std::uint8_t data_word_size() const override { return dataWordSize_; }
+   float        scale() const override { return 2.0f; }
+   float        offset() const override { return 66.0f; }
+   const void*  data_moments() const override { return gates_.data(); }
+
+private:
+   std::uint16_t             numberOfGates_;
+   std::uint8_t              dataWordSize_;
+   std::int16_t              rangeRaw_;
+   std::vector<std::uint8_t> gates_ {};
+};
+
+/**
+ * Synthetic radial of a Level 2 elevation scan.
+ */
+class TestRadarData : public wsr88d::rda::GenericRadarData
+{
+public:
+   explicit TestRadarData(std::uint16_t radial, float azimuthAngle) :
+       radial_ {radial}, azimuthAngle_ {azimuthAngle}
+   {
+   }
+
+   void AddMoment(wsr88d::rda::DataBlockType type,
+                  std::uint16_t              numberOfGates,
+                  std::uint8_t               dataWordSize,
+                  std::int16_t               rangeRaw)
+   {
+      moments_[type] = std::make_shared<TestMomentDataBlock>(
+         radial_, numberOfGates, dataWordSize, rangeRaw);
+   }
+
+   std::uint32_t collection_time() const override { return radial_ * 10u; }
+   std::uint16_t modified_julian_date() const override { return 1u; }
+   units::degrees<float> azimuth_angle() const override
+   {
+      return units::degrees<float> {azimuthAngle_};
+   }
+   std::uint16_t azimuth_number() const override { return radial_ + 1u; }
+   std::uint16_t elevation_number() const override { return 1u; }
+   std::uint16_t volume_coverage_pattern_number() const override
+   {
+      return 212u;
+   }
+
+   std::shared_ptr<MomentDataBlock>
+   moment_data_block(wsr88d::rda::DataBlockType type) const override
+   {
+      auto it = moments_.find(type);
+      return (it != moments_.cend()) ? it->second : nullptr;
+   }
+
+   bool Parse(std::istream& /* is */) override { return false; }
+
+private:
+   std::uint16_t radial_;
+   float         azimuthAngle_;
+
+   std::map<wsr88d::rda::DataBlockType, std::shared_ptr<TestMomentDataBlock>>
+      moments_ {};
+};
+
+/**
+ * Options of a synthetic Level 2 elevation scan.
+ */
+struct Level2ScanOptions
+{
+   std::uint16_t              radialCount_ {common::MAX_0_5_DEGREE_RADIALS};
+   std::set<std::uint16_t>    missingRadials_ {};
+   std::uint16_t              numberOfGates_ {1832u};
+   std::int16_t               dataMomentRange_ {2125}; ///< First gate (m)
+   wsr88d::rda::DataBlockType dataBlockType_ {
+      wsr88d::rda::DataBlockType::MomentRef};
+   std::uint8_t dataWordSize_ {8u};
+   bool         cfpEnabled_ {false};
+   float        azimuthOffset_ {0.27f}; ///< Offset from the half degree
+};
+
+/**
+ * Creates a synthetic 0.5 degree Level 2 elevation scan. Radial azimuths are
+ * offset from the half degree, so the last radial of a complete scan crosses
+ * 0/360 degrees.
+ */
+inline wsr88d::rda::ElevationScan
+CreateLevel2ElevationScan(const Level2ScanOptions& options = {})
+{
+   wsr88d::rda::ElevationScan elevationScan {};
+
+   for (std::uint16_t radial = 0; radial < options.radialCount_; ++radial)
+   {
+      if (options.missingRadials_.contains(radial))
+      {
+         continue;
+      }
+
+      auto radarData = std::make_shared<TestRadarData>(
+         radial, radial * 0.5f + options.azimuthOffset_);
+      radarData->AddMoment(options.dataBlockType_,
+                           options.numberOfGates_,
+                           options.dataWordSize_,
+                           options.dataMomentRange_);
+      if (options.cfpEnabled_)
+      {
+         radarData->AddMoment(wsr88d::rda::DataBlockType::MomentCfp,
+                              options.numberOfGates_,
+                              8u,
+                              options.dataMomentRange_);
+      }
+
+      elevationScan.emplace(radial, radarData);
+   }
+
+   return elevationScan;
+}
+
+/**
+ * Creates a synthetic Level 2 elevation scan, packed as the radar product
+ * manager does.
+ */
+inline std::shared_ptr<wsr88d::rda::PackedElevationScan>
+CreateLevel2Scan(const Level2ScanOptions& options = {})
+{
+   return wsr88d::rda::PackedElevationScan::Create(
+      CreateLevel2ElevationScan(options));
+}
+
+inline SweepParameters Level2Parameters()
+{
+   SweepParameters parameters {};
+   parameters.radarLatitude_  = kRadarLatitude_;
+   parameters.radarLongitude_ = kRadarLongitude_;
+   parameters.gateSize_       = kGateSize_;
+   return parameters;
+}
+
+inline SweepParameters
+Level2Parameters(const Level2ScanOptions& options,
+                 bool                     smoothingEnabled,
+                 SweepLayout              layout = SweepLayout::Vertices)
+{
+   SweepParameters parameters = Level2Parameters();
+   parameters.smoothingEnabled_ = smoothingEnabled;
+   parameters.layout_           = layout;
+
+   // Thresholds match those used by the Level 2 product view
+   parameters.snrThreshold_ = 2u;
+   parameters.edgeValue_ =
+      ComputeLevel2EdgeValue(options.dataBlockType_, 66.0f);
+
+   return parameters;
+}
+
+/**
+ * Synthetic Level 3 radial data of 1 degree radials.
+ */
+class TestRadialDataPacket : public wsr88d::rpg::GenericRadialDataPacket
+{
+public:
+   explicit TestRadialDataPacket(std::uint16_t numberOfRadials,
+                                 std::uint16_t numberOfRangeBins) :
+       numberOfRangeBins_ {numberOfRangeBins}, levels_(numberOfRadials)
+   {
+      for (std::uint16_t radial = 0; radial < numberOfRadials; ++radial)
+      {
+         levels_[radial].resize(numberOfRangeBins);
+
+         for (std::uint16_t bin = 0; bin < numberOfRangeBins; ++bin)
+         {
+            levels_[radial][bin] =
+               static_cast<std::uint8_t>((radial * 7u + bin * 3u) % 64u);
+         }
+      }
+   }
+
+   std::uint16_t packet_code() const override { return 16u; }
+   std::size_t   data_size() const override { return 0u; }
+   bool          Parse(std::istream& /* is */) override { return false; }
+
+   std::uint16_t index_of_first_range_bin() const override { return 0u; }
+   std::int16_t  i_center_of_sweep() const override { return 0; }
+   std::int16_t  j_center_of_sweep() const override { return 0; }
+   std::uint16_t number_of_radials() const override
+   {
+      return static_cast<std::uint16_t>(levels_.size());
+   }
+   std::uint16_t number_of_range_bins() const override
+   {
+      return numberOfRangeBins_;
+   }
+   float start_angle(std::uint16_t r) const override { return r + 0.5f; }
+   float delta_angle(std::uint16_t /* r */) const override { return 1.0f; }
+
+   const std::vector<std::uint8_t>& level(std::uint16_t r) const override
+   {
+      return levels_[r];
+   }
+
+private:
+   std::uint16_t                          numberOfRangeBins_;
+   std::vector<std::vector<std::uint8_t>> levels_;
+};
+
+inline void WriteUInt16(std::ostream& os, std::uint16_t value)
+{
+   const char bytes[] = {static_cast<char>(value >> 8),
+                         static_cast<char>(value & 0xffu)};
+   os.write(bytes, sizeof(bytes));
+}
+
+/**
+ * Creates Level 3 raster data, encoded and parsed as a raster data packet.
+ * Rows differ in length, and are run length encoded from levels 0 through 15.
+ */
+inline std::shared_ptr<wsr88d::rpg::RasterDataPacket>
+CreateRasterDataPacket(std::uint16_t numberOfRows)
+{
+   std::ostringstream os {};
+
+   WriteUInt16(os, 0xBA0Fu);         // Packet code
+   WriteUInt16(os, 0x8000u);         // Op flag
+   WriteUInt16(os, 0x00C0u);         // Op flag
+   WriteUInt16(os, 0u);              // I coordinate start
+   WriteUInt16(os, 0u);              // J coordinate start
+   WriteUInt16(os, 1u);              // X scale
+   WriteUInt16(os, 0u);              // X scale fractional
+   WriteUInt16(os, 1u);              // Y scale
+   WriteUInt16(os, 0u);              // Y scale fractional
+   WriteUInt16(os, numberOfRows);    // Number of rows
+   WriteUInt16(os, 2u);              // Packaging descriptor
+
+   for (std::uint16_t row = 0; row < numberOfRows; ++row)
+   {
+      std::string runs {};
+      std::size_t bins = 0u;
+
+      for (std::uint16_t run = 0; bins + row % 3u < numberOfRows; ++run)
+      {
+         const std::size_t length = std::min<std::size_t>(
+            1u + (row + run) % 4u, numberOfRows - row % 3u - bins);
+         const std::size_t level = (row * 5u + run * 3u) % 16u;
+
+         runs.push_back(static_cast<char>((length << 4) | level));
+         bins += length;
+      }
+
+      // Rows are padded to an even number of bytes
+      if (runs.size() % 2u != 0u)
+      {
+         runs.push_back('\0');
+      }
+
+      WriteUInt16(os, static_cast<std::uint16_t>(runs.size()));
+      os.write(runs.data(), static_cast<std::streamsize>(runs.size()));
+   }
+
+   std::istringstream is {os.str()};
+   return wsr88d::rpg::RasterDataPacket::Create(is);
+}
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,31 @@
+#include <scwx/util/arena.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+TEST(Arena, AllocateShared)
+{
+   auto arena = std::make_shared<Arena>(1024u);
+
+   std::shared_ptr<int> value = AllocateShared<int>(arena, 42);
+   arena.reset();
+
+   // The allocation keeps the arena alive
+   ASSERT_NE(value, nullptr);
+   EXPECT_EQ(*value, 42);
+}
+
+TEST(Arena, AllocateSharedWithoutArena)
+{
+   std::shared_ptr<int> value = AllocateShared<int>(nullptr, 42);
+
+   ASSERT_NE(value, nullptr);
+   EXPECT_EQ(*value, 42);
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,79 @@
+#include <scwx/util/byte_cursor.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+class ByteCursorTest : public ::testing::Test
+{
+protected:
+   ByteCursorTest() : data_ {}, cursor_ {data_} {}
+   ~ByteCursorTest() = default;
+
+   void SetUp() override
+   {
+      static constexpr std::uint8_t kData[] = {
+         0x12, 0x34,                   // uint16_t
+         0x89, 0xab, 0xcd, 0xef,       // uint32_t
+         0x42, 0x28, 0x00, 0x00,       // float (42.0f)
+         's',  'm',  'i',  'l',  'e'}; // string
+
+      std::memcpy(data_.data(), kData, sizeof(kData));
+   }
+
+   std::array<std::byte, 15> data_;
+   ByteCursor                cursor_;
+};
+
+TEST_F(ByteCursorTest, ReadBigEndian)
+{
+   EXPECT_EQ(cursor_.Read<std::uint16_t>(), 0x1234u);
+   EXPECT_EQ(cursor_.Read<std::uint32_t>(), 0x89abcdefu);
+   EXPECT_EQ(cursor_.Read<float>(), 42.0f);
+   EXPECT_EQ(cursor_.ReadString(5), "smile");
+   EXPECT_EQ(cursor_.remaining(), 0u);
+   EXPECT_EQ(cursor_.fail(), false);
+}
+
+TEST_F(ByteCursorTest, ReadBytesIsView)
+{
+   cursor_.Skip(2);
+   std::span<const std::byte> bytes = cursor_.ReadBytes(4);
+
+   EXPECT_EQ(bytes.data(), data_.data() + 2);
+   EXPECT_EQ(bytes.size(), 4u);
+   EXPECT_EQ(cursor_.position(), 6u);
+}
+
+TEST_F(ByteCursorTest, Seek)
+{
+   cursor_.Seek(10);
+   EXPECT_EQ(cursor_.ReadString(3), "smi");
+
+   cursor_.Seek(0);
+   EXPECT_EQ(cursor_.Read<std::int16_t>(), 0x1234);
+   EXPECT_EQ(cursor_.fail(), false);
+}
+
+TEST_F(ByteCursorTest, ReadPastEnd)
+{
+   cursor_.Seek(14);
+   EXPECT_EQ(cursor_.Read<std::uint32_t>(), 0u);
+   EXPECT_EQ(cursor_.fail(), true);
+   EXPECT_EQ(cursor_.remaining(), 0u);
+
+   EXPECT_EQ(cursor_.ReadBytes(1).size(), 0u);
+}
+
+TEST_F(ByteCursorTest, SeekPastEnd)
+{
+   cursor_.Seek(16);
+   EXPECT_EQ(cursor_.fail(), true);
+   EXPECT_EQ(cursor_.position(), 15u);
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,95 @@
+#include <scwx/util/byte_swap.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+class ByteSwapTest : public testing::TestWithParam<std::size_t>
+{
+protected:
+   void SetUp() override
+   {
+      // One extra byte allows testing unaligned source data
+      const std::size_t count = GetParam();
+      data_.resize(count * 2 + 1);
+
+      for (std::size_t i = 0; i < data_.size(); ++i)
+      {
+         data_[i] = static_cast<std::uint8_t>(i * 37 + 11);
+      }
+   }
+
+   std::vector<std::uint16_t> Expected(std::size_t offset) const
+   {
+      std::vector<std::uint16_t> expected(GetParam());
+
+      for (std::size_t i = 0; i < expected.size(); ++i)
+      {
+         expected[i] = static_cast<std::uint16_t>(
+            (data_[offset + i * 2] << 8) | data_[offset + i * 2 + 1]);
+      }
+
+      return expected;
+   }
+
+   std::vector<std::uint8_t> data_ {};
+};
+
+TEST_P(ByteSwapTest, SwapBytes16)
+{
+   for (std::size_t offset : {0u, 1u})
+   {
+      std::vector<std::uint16_t> actual(GetParam());
+
+      SwapBytes16(data_.data() + offset, actual.data(), actual.size());
+
+      EXPECT_EQ(actual, Expected(offset));
+   }
+}
+
+TEST_P(ByteSwapTest, SwapBytes16InPlace)
+{
+   std::vector<std::uint16_t> actual(GetParam());
+   std::copy_n(data_.data(),
+               actual.size() * 2,
+               reinterpret_cast<std::uint8_t*>(actual.data()));
+
+   SwapBytes16(actual.data(), actual.data(), actual.size());
+
+   EXPECT_EQ(actual, Expected(0));
+}
+
+TEST_P(ByteSwapTest, SwapBytes16Statistics)
+{
+   static constexpr std::uint16_t kThreshold = 0x8000;
+
+   std::vector<std::uint16_t> actual(GetParam());
+   std::vector<std::uint16_t> expected = Expected(1);
+
+   GateStatistics statistics =
+      SwapBytes16(data_.data() + 1, actual.data(), actual.size(), kThreshold);
+
+   EXPECT_EQ(actual, expected);
+   EXPECT_EQ(statistics.maxValue_,
+             expected.empty() ?
+                0u :
+                *std::max_element(expected.cbegin(), expected.cend()));
+   EXPECT_EQ(statistics.validGates_,
+             static_cast<std::size_t>(std::count_if(
+                expected.cbegin(),
+                expected.cend(),
+                [](std::uint16_t u) { return u >= kThreshold; })));
+}
+
+INSTANTIATE_TEST_SUITE_P(ByteSwap,
+                         ByteSwapTest,
+                         testing::Values(0u, 1u, 7u, 8u, 17u, 33u, 1840u));
+
+} // namespace util
+} // namespace scwx
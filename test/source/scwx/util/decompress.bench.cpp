@@ -0,0 +1,126 @@
+#include "../wxbench.hpp"
+
+#include <scwx/util/decompress.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <zlib.h>
+
+namespace scwx
+{
+namespace util
+{
+
+static const std::string kLevel2File_ =
+   "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v";
+
+/**
+ * Decompresses a radial LDM record, to be recompressed with zlib.
+ */
+static std::vector<char> ReadRadialRecord()
+{
+   std::vector<char> output {};
+
+   auto data = bench::ReadDataFile(kLevel2File_);
+   if (data.has_value())
+   {
+      DecompressBzip2(bench::ReadLdmRecord(*data, 1), output);
+   }
+
+   return output;
+}
+
+static std::vector<char> CompressZlib(const std::vector<char>& input,
+                                      ZlibFormat               format)
+{
+   static constexpr int kWindowBits     = 15;
+   static constexpr int kGzipWindowBits = kWindowBits + 16;
+   static constexpr int kMemLevel       = 8;
+
+   std::vector<char> output(compressBound(static_cast<uLong>(input.size())) +
+                            32u);
+
+   z_stream stream {};
+   deflateInit2(&stream,
+                Z_DEFAULT_COMPRESSION,
+                Z_DEFLATED,
+                (format == ZlibFormat::Gzip) ? kGzipWindowBits : kWindowBits,
+                kMemLevel,
+                Z_DEFAULT_STRATEGY);
+
+   stream.next_in  = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+   stream.avail_in = static_cast<uInt>(input.size());
+   stream.next_out = reinterpret_cast<Bytef*>(output.data());
+   stream.avail_out = static_cast<uInt>(output.size());
+
+   deflate(&stream, Z_FINISH);
+   output.resize(stream.total_out);
+   deflateEnd(&stream);
+
+   return output;
+}
+
+static void BM_DecompressBzip2(benchmark::State& state)
+{
+   auto data = bench::ReadDataFile(kLevel2File_);
+   if (!data.has_value())
+   {
+      state.SkipWithError("Test data not found");
+      return;
+   }
+
+   const std::vector<char> record = bench::ReadLdmRecord(*data, 1);
+   auto                    pool   = DecompressBufferPool::Instance();
+   std::size_t             size   = 0;
+
+   for (auto _ : state)
+   {
+      std::vector<char> output = pool->Acquire();
+      DecompressBzip2(record, output);
+      size = output.size();
+      benchmark::DoNotOptimize(output.data());
+      pool->Release(std::move(output));
+   }
+
+   state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                           static_cast<std::int64_t>(size));
+}
+
+static void BM_DecompressZlib(benchmark::State& state)
+{
+   const ZlibFormat format = static_cast<ZlibFormat>(state.range(0));
+
+   const std::vector<char> input = ReadRadialRecord();
+   if (input.empty())
+   {
+      state.SkipWithError("Test data not found");
+      return;
+   }
+
+   const std::vector<char> compressed = CompressZlib(input, format);
+   auto                    pool       = DecompressBufferPool::Instance();
+
+   for (auto _ : state)
+   {
+      std::vector<char> output = pool->Acquire(input.size());
+      DecompressZlib(compressed, output, format);
+      benchmark::DoNotOptimize(output.data());
+      pool->Release(std::move(output));
+   }
+
+   state.SetLabel((format == ZlibFormat::Gzip) ? "gzip" : "zlib");
+   state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                           static_cast<std::int64_t>(input.size()));
+}
+
+BENCHMARK(BM_DecompressBzip2)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DecompressZlib)
+   ->Arg(static_cast<int>(ZlibFormat::Zlib))
+   ->Arg(static_cast<int>(ZlibFormat::Gzip))
+   ->Unit(benchmark::kMicrosecond);
+
+} // namespace util
+} // namespace scwx
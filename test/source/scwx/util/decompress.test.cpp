@@ -0,0 +1,109 @@
+#include <scwx/util/decompress.hpp>
+
+#include <string>
+
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filter/bzip2.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+static std::string CreateData()
+{
+   std::string data {};
+   for (int i = 0; i < 100000; ++i)
+   {
+      data += std::to_string(i * 7919 % 10007);
+   }
+   return data;
+}
+
+template<class Compressor>
+static std::vector<char> Compress(const std::string& data)
+{
+   std::vector<char> compressedData {};
+
+   boost::iostreams::filtering_ostream out;
+   out.push(Compressor());
+   out.push(boost::iostreams::back_inserter(compressedData));
+   out.write(data.data(), static_cast<std::streamsize>(data.size()));
+   out.reset();
+
+   return compressedData;
+}
+
+TEST(Decompress, Bzip2)
+{
+   const std::string data = CreateData();
+   std::vector<char> compressedData =
+      Compress<boost::iostreams::bzip2_compressor>(data);
+
+   std::vector<char> output {};
+   ASSERT_TRUE(DecompressBzip2(compressedData, output));
+   EXPECT_EQ(std::string(output.cbegin(), output.cend()), data);
+}
+
+TEST(Decompress, Bzip2Truncated)
+{
+   std::vector<char> compressedData =
+      Compress<boost::iostreams::bzip2_compressor>(CreateData());
+   compressedData.resize(compressedData.size() / 2);
+
+   std::vector<char> output {'a', 'b'};
+   EXPECT_FALSE(DecompressBzip2(compressedData, output));
+   EXPECT_EQ(output.size(), 2u);
+}
+
+TEST(Decompress, Gzip)
+{
+   const std::string data = CreateData();
+   std::vector<char> compressedData =
+      Compress<boost::iostreams::gzip_compressor>(data);
+
+   std::vector<char> output {};
+   ASSERT_TRUE(DecompressZlib(compressedData, output, ZlibFormat::Gzip));
+   EXPECT_EQ(std::string(output.cbegin(), output.cend()), data);
+}
+
+TEST(Decompress, ZlibConsecutiveStreams)
+{
+   const std::string data = CreateData();
+   std::vector<char> compressedData =
+      Compress<boost::iostreams::zlib_compressor>(data);
+   const std::size_t streamSize = compressedData.size();
+   compressedData.insert(
+      compressedData.end(), compressedData.cbegin(), compressedData.cend());
+
+   // Only the first stream is decompressed
+   std::vector<char> output {};
+   std::size_t       bytesConsumed = 0;
+   ASSERT_TRUE(DecompressZlib(
+      compressedData, output, ZlibFormat::Zlib, 0, &bytesConsumed));
+   EXPECT_EQ(bytesConsumed, streamSize);
+   EXPECT_EQ(std::string(output.cbegin(), output.cend()), data);
+}
+
+TEST(Decompress, BufferPool)
+{
+   DecompressBufferPool pool {};
+
+   std::vector<char> buffer = pool.Acquire(1000u);
+   EXPECT_TRUE(buffer.empty());
+   EXPECT_GE(buffer.capacity(), 1000u);
+
+   const char* data = buffer.data();
+   pool.Release(std::move(buffer));
+
+   // The released buffer is reused
+   buffer = pool.Acquire(500u);
+   EXPECT_EQ(buffer.data(), data);
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,154 @@
+#include <scwx/util/lru_cache.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+TEST(LruCache, FindHitAndMiss)
+{
+   LruCache<int, std::string> cache {100u};
+
+   EXPECT_EQ(cache.Find(1), nullptr);
+
+   EXPECT_TRUE(cache.Insert(1, "one", 10u));
+   EXPECT_TRUE(cache.Insert(2, "two", 10u));
+
+   ASSERT_NE(cache.Find(1), nullptr);
+   EXPECT_EQ(*cache.Find(1), "one");
+   ASSERT_NE(cache.Find(2), nullptr);
+   EXPECT_EQ(*cache.Find(2), "two");
+   EXPECT_EQ(cache.Find(3), nullptr);
+
+   EXPECT_EQ(cache.count(), 2u);
+   EXPECT_EQ(cache.size(), 20u);
+}
+
+TEST(LruCache, EvictsLeastRecentlyUsedBySize)
+{
+   LruCache<int, std::string> cache {100u};
+
+   cache.Insert(1, "one", 40u);
+   cache.Insert(2, "two", 40u);
+
+   // Finding the first entry makes the second the least recently used
+   ASSERT_NE(cache.Find(1), nullptr);
+
+   EXPECT_TRUE(cache.Insert(3, "three", 40u));
+
+   EXPECT_NE(cache.Find(1), nullptr);
+   EXPECT_EQ(cache.Find(2), nullptr);
+   EXPECT_NE(cache.Find(3), nullptr);
+   EXPECT_EQ(cache.size(), 80u);
+}
+
+TEST(LruCache, EvictsUntilWithinLimit)
+{
+   LruCache<int, std::string> cache {100u};
+
+   cache.Insert(1, "one", 30u);
+   cache.Insert(2, "two", 30u);
+   cache.Insert(3, "three", 30u);
+
+   // Each of the older entries is removed to fit the new entry
+   EXPECT_TRUE(cache.Insert(4, "four", 90u));
+
+   EXPECT_EQ(cache.count(), 1u);
+   EXPECT_EQ(cache.size(), 90u);
+   EXPECT_NE(cache.Find(4), nullptr);
+}
+
+TEST(LruCache, EntryLargerThanLimitIsNotInserted)
+{
+   LruCache<int, std::string> cache {100u};
+
+   cache.Insert(1, "one", 60u);
+
+   EXPECT_FALSE(cache.Insert(2, "two", 101u));
+
+   EXPECT_EQ(cache.Find(2), nullptr);
+   EXPECT_NE(cache.Find(1), nullptr);
+   EXPECT_EQ(cache.size(), 60u);
+}
+
+TEST(LruCache, CachedEntryIsKept)
+{
+   LruCache<int, std::string> cache {100u};
+
+   EXPECT_TRUE(cache.Insert(1, "one", 10u));
+   EXPECT_FALSE(cache.Insert(1, "uno", 20u));
+
+   ASSERT_NE(cache.Find(1), nullptr);
+   EXPECT_EQ(*cache.Find(1), "one");
+   EXPECT_EQ(cache.count(), 1u);
+   EXPECT_EQ(cache.size(), 10u);
+}
+
+TEST(LruCache, SetLimitEvicts)
+{
+   LruCache<int, std::string> cache {100u};
+
+   for (int i = 0; i < 5; ++i)
+   {
+      cache.Insert(i, std::to_string(i), 10u);
+   }
+
+   cache.set_limit(25u);
+
+   EXPECT_EQ(cache.count(), 2u);
+   EXPECT_EQ(cache.size(), 20u);
+   EXPECT_EQ(cache.Find(2), nullptr);
+   EXPECT_NE(cache.Find(3), nullptr);
+   EXPECT_NE(cache.Find(4), nullptr);
+
+   // A cache with no limit holds no entries
+   cache.set_limit(0u);
+
+   EXPECT_EQ(cache.count(), 0u);
+   EXPECT_FALSE(cache.Insert(5, "5", 1u));
+}
+
+TEST(LruCache, EraseIf)
+{
+   LruCache<int, std::string> cache {100u};
+
+   cache.Insert(1, "one", 10u);
+   cache.Insert(2, "two", 20u);
+   cache.Insert(3, "three", 30u);
+
+   EXPECT_EQ(cache.EraseIf([](int key, const std::string&)
+                           { return key % 2 == 1; }),
+             2u);
+
+   EXPECT_EQ(cache.count(), 1u);
+   EXPECT_EQ(cache.size(), 20u);
+   EXPECT_EQ(cache.Find(1), nullptr);
+   EXPECT_NE(cache.Find(2), nullptr);
+   EXPECT_EQ(cache.Find(3), nullptr);
+}
+
+TEST(LruCache, CountLimit)
+{
+   static constexpr std::size_t kLimit = 6u;
+
+   LruCache<int, std::string> cache {kLimit};
+
+   for (int i = 0; i <= static_cast<int>(kLimit); ++i)
+   {
+      cache.Insert(i, std::to_string(i));
+   }
+
+   EXPECT_EQ(cache.count(), kLimit);
+   EXPECT_EQ(cache.Find(0), nullptr);
+   for (int i = 1; i <= static_cast<int>(kLimit); ++i)
+   {
+      EXPECT_NE(cache.Find(i), nullptr);
+   }
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,257 @@
+#include <scwx/util/scheduler.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+TEST(Scheduler, TaskGroupRunsAllTasks)
+{
+   static constexpr int kTaskCount = 1000;
+
+   std::atomic<int> count {0};
+
+   TaskGroup group {TaskPriority::Decode};
+   for (int i = 0; i < kTaskCount; ++i)
+   {
+      boost::asio::post(group.get_executor(), [&]() { ++count; });
+   }
+   group.join();
+
+   EXPECT_EQ(count, kTaskCount);
+}
+
+TEST(Scheduler, TaskQueueRunsTasksInOrder)
+{
+   static constexpr int kTaskCount = 1000;
+
+   std::vector<int> order {};
+   std::atomic<int> running {0};
+   bool             overlapped = false;
+
+   TaskQueue queue {TaskPriority::Interactive};
+   for (int i = 0; i < kTaskCount; ++i)
+   {
+      boost::asio::post(queue.get_executor(),
+                        [&, i]()
+                        {
+                           if (++running > 1)
+                           {
+                              overlapped = true;
+                           }
+                           order.push_back(i);
+                           --running;
+                        });
+   }
+   queue.join();
+
+   EXPECT_FALSE(overlapped);
+   ASSERT_EQ(order.size(), kTaskCount);
+   for (int i = 0; i < kTaskCount; ++i)
+   {
+      EXPECT_EQ(order[i], i);
+   }
+}
+
+TEST(Scheduler, JoinWaitsForTimers)
+{
+   bool expired = false;
+
+   TaskQueue                 queue {TaskPriority::Background};
+   boost::asio::steady_timer timer {queue.get_executor()};
+
+   timer.expires_after(std::chrono::milliseconds {50});
+   timer.async_wait([&](const boost::system::error_code& e)
+                    { expired = (e == boost::system::errc::success); });
+   queue.join();
+
+   EXPECT_TRUE(expired);
+}
+
+TEST(Scheduler, StopDiscardsPendingTasks)
+{
+   std::atomic<bool> started {false};
+   std::atomic<bool> release {false};
+   std::atomic<int>  count {0};
+
+   TaskQueue queue {TaskPriority::Network};
+   boost::asio::post(queue.get_executor(),
+                     [&]()
+                     {
+                        started = true;
+                        while (!release)
+                        {
+                           std::this_thread::yield();
+                        }
+                     });
+   for (int i = 0; i < 10; ++i)
+   {
+      boost::asio::post(queue.get_executor(), [&]() { ++count; });
+   }
+
+   while (!started)
+   {
+      std::this_thread::yield();
+   }
+   queue.stop();
+   release = true;
+   queue.join();
+
+   EXPECT_EQ(count, 0);
+}
+
+TEST(Scheduler, StopDiscardsTasksQueuedBehindRunningTask)
+{
+   std::atomic<bool> firstStarted {false};
+   std::atomic<bool> releaseFirst {false};
+   std::atomic<bool> started {false};
+   std::atomic<bool> release {false};
+   std::atomic<int>  count {0};
+
+   TaskQueue queue {TaskPriority::Background};
+   boost::asio::post(queue.get_executor(),
+                     [&]()
+                     {
+                        firstStarted = true;
+                        while (!releaseFirst)
+                        {
+                           std::this_thread::yield();
+                        }
+                     });
+
+   while (!firstStarted)
+   {
+      std::this_thread::yield();
+   }
+
+   // Tasks posted while the queue is busy are queued together, and are not
+   // started when the queue is stopped during the first of them
+   boost::asio::post(queue.get_executor(),
+                     [&]()
+                     {
+                        started = true;
+                        while (!release)
+                        {
+                           std::this_thread::yield();
+                        }
+                     });
+   for (int i = 0; i < 10; ++i)
+   {
+      boost::asio::post(queue.get_executor(), [&]() { ++count; });
+   }
+   releaseFirst = true;
+
+   while (!started)
+   {
+      std::this_thread::yield();
+   }
+   queue.stop();
+   release = true;
+   queue.join();
+
+   EXPECT_EQ(count, 0);
+}
+
+TEST(Scheduler, TaskQueuesRunConcurrently)
+{
+   std::atomic<bool> release {false};
+   std::atomic<bool> completed {false};
+
+   TaskQueue blockedQueue {TaskPriority::Decode};
+   TaskQueue queue {TaskPriority::Decode};
+
+   // A busy queue does not hold the tasks of another queue
+   boost::asio::post(blockedQueue.get_executor(),
+                     [&]()
+                     {
+                        while (!release)
+                        {
+                           std::this_thread::yield();
+                        }
+                     });
+   boost::asio::post(queue.get_executor(), [&]() { completed = true; });
+   queue.join();
+
+   EXPECT_TRUE(completed);
+
+   release = true;
+   blockedQueue.join();
+}
+
+TEST(Scheduler, DecodeTasksLeaveThreadsForInteractiveTasks)
+{
+   const int decodeTaskCount =
+      static_cast<int>(std::max(std::thread::hardware_concurrency(), 4u)) * 2;
+
+   std::atomic<int>  started {0};
+   std::atomic<bool> release {false};
+   std::atomic<bool> completed {false};
+
+   TaskGroup group {TaskPriority::Decode};
+   TaskQueue queue {TaskPriority::Interactive};
+
+   // Decode tasks blocking every thread they are permitted to use
+   for (int i = 0; i < decodeTaskCount; ++i)
+   {
+      boost::asio::post(group.get_executor(),
+                        [&]()
+                        {
+                           ++started;
+                           while (!release)
+                           {
+                              std::this_thread::yield();
+                           }
+                        });
+   }
+
+   while (started == 0)
+   {
+      std::this_thread::yield();
+   }
+   std::this_thread::sleep_for(std::chrono::milliseconds {100});
+
+   boost::asio::post(queue.get_executor(), [&]() { completed = true; });
+   queue.join();
+
+   EXPECT_TRUE(completed);
+   EXPECT_LT(started, decodeTaskCount);
+
+   release = true;
+   group.join();
+}
+
+TEST(Scheduler, NestedTasksComplete)
+{
+   static constexpr int kTaskCount = 100;
+
+   std::atomic<int> count {0};
+
+   TaskGroup group {TaskPriority::Decode};
+   TaskQueue queue {TaskPriority::Interactive};
+   for (int i = 0; i < kTaskCount; ++i)
+   {
+      boost::asio::post(group.get_executor(),
+                        [&]()
+                        {
+                           boost::asio::post(queue.get_executor(),
+                                             [&]() { ++count; });
+                        });
+   }
+   group.join();
+   queue.join();
+
+   EXPECT_EQ(count, kTaskCount);
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,85 @@
+#include "../wxbench.hpp"
+
+#include <scwx/wsr88d/ar2v_file.hpp>
+
+#include <sstream>
+
+#include <benchmark/benchmark.h>
+
+namespace scwx
+{
+namespace wsr88d
+{
+
+static const std::vector<std::string> kLevel2Files_ = {
+   "/nexrad/level2/KCLE20021110_221234",
+   "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v",
+   "/nexrad/level2/Level2_TSTL_20220213_2357.ar2v"};
+
+static void BM_Ar2vFileLoadData(benchmark::State& state)
+{
+   const std::string& filename =
+      kLevel2Files_[static_cast<std::size_t>(state.range(0))];
+   const bool filtered = state.range(1) != 0;
+
+   auto data = bench::ReadDataFile(filename);
+   if (!data.has_value())
+   {
+      state.SkipWithError("Test data not found");
+      return;
+   }
+
+   // The filtered load decodes only the lowest reflectivity elevation
+   Ar2vDecodeFilter filter {};
+   if (filtered)
+   {
+      filter.dataBlockTypes_   = {rda::DataBlockType::MomentRef};
+      filter.elevationIndices_ = {0};
+   }
+
+   for (auto _ : state)
+   {
+      std::istringstream is(*data);
+      Ar2vFile           file;
+
+      // Loading includes decompression, message parsing and indexing
+      bool fileValid = file.LoadData(is, filter);
+      benchmark::DoNotOptimize(fileValid);
+   }
+
+   state.SetLabel(filename + (filtered ? " (filtered)" : ""));
+   state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                           static_cast<std::int64_t>(data->size()));
+}
+
+static void BM_Ar2vFileGetPackedElevationScan(benchmark::State& state)
+{
+   auto data = bench::ReadDataFile(kLevel2Files_[1]);
+   if (!data.has_value())
+   {
+      state.SkipWithError("Test data not found");
+      return;
+   }
+
+   std::istringstream is(*data);
+   Ar2vFile           file;
+   file.LoadData(is);
+
+   // Decode the moment data before measuring the lookup
+   file.GetPackedElevationScan(rda::DataBlockType::MomentRef, 0.5f, {});
+
+   for (auto _ : state)
+   {
+      auto result =
+         file.GetPackedElevationScan(rda::DataBlockType::MomentRef, 0.5f, {});
+      benchmark::DoNotOptimize(result);
+   }
+}
+
+BENCHMARK(BM_Ar2vFileLoadData)
+   ->ArgsProduct({{0, 1, 2}, {0, 1}})
+   ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Ar2vFileGetPackedElevationScan);
+
+} // namespace wsr88d
+} // namespace scwx
@@ -1,4 +1,19 @@
 #include <scwx/wsr88d/ar2v_file.hpp>
+#include <scwx/wsr88d/detail/elevation_scan_index.hpp>
+#include <scwx/util/decompress.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -24,6 +39,72 @@ TEST_P(Ar2vValidFileTest, ValidFile)
    EXPECT_EQ(file.message_count(), param.second);
 }
 
+TEST_P(Ar2vValidFileTest, PackedElevationScan)
+{
+   auto& param = GetParam();
+
+   Ar2vFile file;
+   file.LoadFile(std::string(SCWX_TEST_DATA_DIR) + param.first);
+
+   auto [packedScan, elevationCut, elevationCuts] =
+      file.GetPackedElevationScan(rda::DataBlockType::MomentRef, 0.5f, {});
+   ASSERT_NE(packedScan, nullptr);
+
+   auto elevationScan = packedScan->CreateElevationScan();
+   auto moment        = packedScan->moment(rda::DataBlockType::MomentRef);
+   ASSERT_NE(moment, nullptr);
+   EXPECT_TRUE(moment->loaded());
+
+   EXPECT_EQ(packedScan->radial_count(), elevationScan->crbegin()->first + 1u);
+
+   for (auto& [radial, radarData] : *elevationScan)
+   {
+      auto momentData =
+         radarData->moment_data_block(rda::DataBlockType::MomentRef);
+
+      EXPECT_TRUE(packedScan->radial_headers()[radial].valid);
+      EXPECT_EQ(radarData->azimuth_angle().value(),
+                packedScan->azimuth_angles()[radial]);
+
+      if (momentData != nullptr)
+      {
+         EXPECT_EQ(momentData->data_moments(), moment->data_moments(radial));
+         EXPECT_LE(momentData->number_of_data_moment_gates(),
+                   moment->gate_stride());
+      }
+   }
+}
+
+TEST_P(Ar2vValidFileTest, ScanMetadata)
+{
+   auto& param = GetParam();
+
+   const std::string filename = std::string(SCWX_TEST_DATA_DIR) + param.first;
+
+   Ar2vFile file;
+   file.LoadFile(filename);
+
+   std::ifstream f(filename, std::ios_base::in | std::ios_base::binary);
+   auto          metadata = Ar2vFile::ScanMetadata(f);
+   ASSERT_TRUE(metadata.has_value());
+
+   EXPECT_EQ(metadata->group_, common::RadarProductGroup::Level2);
+   EXPECT_EQ(metadata->icao_, file.icao());
+   EXPECT_EQ(metadata->startTime_, file.start_time());
+   EXPECT_EQ(metadata->endTime_, file.end_time());
+
+   auto vcpData = file.vcp_data();
+   if (vcpData != nullptr)
+   {
+      ASSERT_NE(metadata->vcpData_, nullptr);
+      EXPECT_EQ(metadata->volumeCoveragePattern_, vcpData->pattern_number());
+
+      auto [packedScan, elevationCut, elevationCuts] =
+         file.GetPackedElevationScan(rda::DataBlockType::MomentRef, 0.5f, {});
+      EXPECT_EQ(metadata->elevationCuts_, elevationCuts);
+   }
+}
+
 INSTANTIATE_TEST_SUITE_P(
    Ar2vFile,
    Ar2vValidFileTest,
@@ -34,5 +115,587 @@ INSTANTIATE_TEST_SUITE_P(
                    std::pair<std::string, std::size_t> //
                    {"/nexrad/level2/Level2_TSTL_20220213_2357.ar2v", 5763}));
 
+TEST(Ar2vFile, AppendChunk)
+{
+   static constexpr std::size_t kVolumeHeaderSize = 24;
+
+   const std::string filename = std::string(SCWX_TEST_DATA_DIR) +
+                                "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v";
+
+   std::ifstream     f(filename, std::ios_base::in | std::ios_base::binary);
+   std::vector<char> data {std::istreambuf_iterator<char>(f),
+                           std::istreambuf_iterator<char>()};
+   ASSERT_GT(data.size(), kVolumeHeaderSize);
+
+   // Split the file into chunks of one LDM record each, with the Volume Header
+   // Record preceding the first record
+   std::vector<std::string> chunks {};
+   std::size_t              chunkStart = 0;
+   std::size_t              offset     = kVolumeHeaderSize;
+
+   while (offset + 4 <= data.size())
+   {
+      // Control word is a big-endian signed record size
+      std::uint32_t controlWord = 0;
+      for (std::size_t i = 0; i < 4; ++i)
+      {
+         controlWord = (controlWord << 8) |
+                       static_cast<std::uint8_t>(data[offset + i]);
+      }
+      const std::size_t recordSize =
+         std::abs(static_cast<std::int32_t>(controlWord));
+
+      if (recordSize == 0)
+      {
+         break;
+      }
+
+      offset = std::min(offset + 4 + recordSize, data.size());
+      chunks.emplace_back(&data[chunkStart], offset - chunkStart);
+      chunkStart = offset;
+   }
+
+   Ar2vFile file;
+   Ar2vFile chunkFile;
+   file.LoadFile(filename);
+
+   for (auto& chunk : chunks)
+   {
+      std::istringstream is {chunk};
+      EXPECT_TRUE(chunkFile.AppendChunk(is));
+   }
+
+   EXPECT_EQ(chunkFile.message_count(), file.message_count());
+   EXPECT_EQ(chunkFile.icao(), file.icao());
+
+   auto [packedScan, elevationCut, elevationCuts] =
+      file.GetPackedElevationScan(rda::DataBlockType::MomentRef, 0.5f, {});
+   auto [chunkScan, chunkElevationCut, chunkElevationCuts] =
+      chunkFile.GetPackedElevationScan(rda::DataBlockType::MomentRef, 0.5f, {});
+   ASSERT_NE(packedScan, nullptr);
+   ASSERT_NE(chunkScan, nullptr);
+
+   EXPECT_EQ(chunkElevationCuts, elevationCuts);
+   EXPECT_EQ(chunkScan->radial_count(), packedScan->radial_count());
+
+   auto moment      = packedScan->moment(rda::DataBlockType::MomentRef);
+   auto chunkMoment = chunkScan->moment(rda::DataBlockType::MomentRef);
+   ASSERT_NE(moment, nullptr);
+   ASSERT_NE(chunkMoment, nullptr);
+
+   for (std::size_t radial = 0; radial < packedScan->radial_count(); ++radial)
+   {
+      const void* gates      = moment->data_moments(radial);
+      const void* chunkGates = chunkMoment->data_moments(radial);
+
+      ASSERT_EQ(chunkGates == nullptr, gates == nullptr);
+
+      if (gates != nullptr)
+      {
+         EXPECT_EQ(std::memcmp(chunkGates,
+                               gates,
+                               moment->gate_stride() *
+                                  (moment->data_word_size() / 8u)),
+                   0);
+      }
+   }
+}
+
+TEST(Ar2vFile, ParallelDecompressionMatchesSerial)
+{
+   static constexpr std::size_t kVolumeHeaderSize = 24;
+   static constexpr std::size_t kControlWordSize  = 4;
+
+   const std::string filename = std::string(SCWX_TEST_DATA_DIR) +
+                                "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v";
+
+   std::ifstream     f(filename, std::ios_base::in | std::ios_base::binary);
+   std::vector<char> data {std::istreambuf_iterator<char>(f),
+                           std::istreambuf_iterator<char>()};
+   ASSERT_GT(data.size(), kVolumeHeaderSize);
+
+   // Decompress each LDM record in sequence, and concatenate the records
+   // following the Volume Header Record
+   std::string serialData {data.data(), kVolumeHeaderSize};
+   std::size_t offset = kVolumeHeaderSize;
+
+   while (offset + kControlWordSize <= data.size())
+   {
+      // Control word is a big-endian signed record size
+      std::uint32_t controlWord = 0;
+      for (std::size_t i = 0; i < kControlWordSize; ++i)
+      {
+         controlWord = (controlWord << 8) |
+                       static_cast<std::uint8_t>(data[offset + i]);
+      }
+      std::size_t recordSize = std::abs(static_cast<std::int32_t>(controlWord));
+
+      if (recordSize == 0)
+      {
+         break;
+      }
+
+      offset += kControlWordSize;
+      recordSize = std::min(recordSize, data.size() - offset);
+
+      std::vector<char> record {};
+      ASSERT_TRUE(util::DecompressBzip2(
+         std::span<const char> {&data[offset], recordSize}, record));
+      serialData.append(record.data(), record.size());
+
+      offset += recordSize;
+   }
+
+   ASSERT_GT(serialData.size(), kVolumeHeaderSize + kControlWordSize);
+
+   // Each message begins with a CTM header, which is not used. Zeroing the
+   // start of the first CTM header reads as a zero control word, so the
+   // records are loaded as uncompressed message data, parsed in a single pass.
+   std::fill_n(serialData.begin() + kVolumeHeaderSize, kControlWordSize, '\0');
+
+   Ar2vFile file;
+   Ar2vFile serialFile;
+   ASSERT_TRUE(file.LoadFile(filename));
+
+   std::istringstream is {serialData};
+   ASSERT_TRUE(serialFile.LoadData(is));
+
+   EXPECT_EQ(serialFile.message_count(), file.message_count());
+   EXPECT_EQ(serialFile.start_time(), file.start_time());
+   EXPECT_EQ(serialFile.end_time(), file.end_time());
+
+   // Elevation index
+   auto [packedScan, elevationCut, elevationCuts] =
+      file.GetPackedElevationScan(rda::DataBlockType::MomentRef, 0.5f, {});
+   auto [serialScan, serialElevationCut, serialElevationCuts] =
+      serialFile.GetPackedElevationScan(
+         rda::DataBlockType::MomentRef, 0.5f, {});
+   ASSERT_NE(packedScan, nullptr);
+   ASSERT_NE(serialScan, nullptr);
+
+   EXPECT_FLOAT_EQ(serialElevationCut, elevationCut);
+   EXPECT_EQ(serialElevationCuts, elevationCuts);
+
+   // Messages of each elevation scan, in radial order
+   auto radarData       = file.radar_data();
+   auto serialRadarData = serialFile.radar_data();
+   ASSERT_EQ(serialRadarData.size(), radarData.size());
+
+   for (auto& [elevation, elevationScan] : radarData)
+   {
+      auto serialElevationScan = serialRadarData.find(elevation);
+      ASSERT_NE(serialElevationScan, serialRadarData.end()) << elevation;
+      ASSERT_EQ(serialElevationScan->second->size(), elevationScan->size())
+         << elevation;
+
+      for (auto& [radial, radarMessage] : *elevationScan)
+      {
+         auto serialRadial = serialElevationScan->second->find(radial);
+         ASSERT_NE(serialRadial, serialElevationScan->second->end())
+            << elevation << ", " << radial;
+
+         auto& serialMessage = serialRadial->second;
+         EXPECT_EQ(serialMessage->collection_time(),
+                   radarMessage->collection_time());
+         EXPECT_EQ(serialMessage->azimuth_number(),
+                   radarMessage->azimuth_number());
+         EXPECT_EQ(serialMessage->elevation_number(),
+                   radarMessage->elevation_number());
+         EXPECT_EQ(serialMessage->azimuth_angle().value(),
+                   radarMessage->azimuth_angle().value());
+
+         auto momentData =
+            radarMessage->moment_data_block(rda::DataBlockType::MomentRef);
+         auto serialMomentData =
+            serialMessage->moment_data_block(rda::DataBlockType::MomentRef);
+         ASSERT_EQ(serialMomentData == nullptr, momentData == nullptr);
+
+         if (momentData != nullptr)
+         {
+            ASSERT_EQ(serialMomentData->number_of_data_moment_gates(),
+                      momentData->number_of_data_moment_gates());
+            ASSERT_EQ(serialMomentData->data_word_size(),
+                      momentData->data_word_size());
+            EXPECT_EQ(std::memcmp(serialMomentData->data_moments(),
+                                  momentData->data_moments(),
+                                  momentData->number_of_data_moment_gates() *
+                                     (momentData->data_word_size() / 8u)),
+                      0);
+         }
+      }
+   }
+}
+
+TEST(Ar2vFile, DecodeFilter)
+{
+   const std::string filename = std::string(SCWX_TEST_DATA_DIR) +
+                                "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v";
+
+   Ar2vDecodeFilter filter {};
+   filter.dataBlockTypes_   = {rda::DataBlockType::MomentRef};
+   filter.elevationIndices_ = {0};
+
+   Ar2vFile file;
+   Ar2vFile filteredFile;
+   file.LoadFile(filename);
+   EXPECT_TRUE(filteredFile.LoadFile(filename, filter));
+
+   // Skipped messages are still counted
+   EXPECT_EQ(filteredFile.message_count(), file.message_count());
+   EXPECT_NE(filteredFile.vcp_data(), nullptr);
+
+   auto [packedScan, elevationCut, elevationCuts] =
+      filteredFile.GetPackedElevationScan(
+         rda::DataBlockType::MomentRef, 0.5f, {});
+   ASSERT_NE(packedScan, nullptr);
+
+   EXPECT_EQ(elevationCuts.size(), 1u);
+   EXPECT_NE(packedScan->moment(rda::DataBlockType::MomentRef), nullptr);
+   EXPECT_EQ(packedScan->moment(rda::DataBlockType::MomentVel), nullptr);
+
+   auto [velocityScan, velocityCut, velocityCuts] =
+      filteredFile.GetPackedElevationScan(
+         rda::DataBlockType::MomentVel, 0.5f, {});
+   EXPECT_EQ(velocityScan, nullptr);
+}
+
+TEST(Ar2vFile, DecodeFilterIncludesMetadata)
+{
+   const std::string filename = std::string(SCWX_TEST_DATA_DIR) +
+                                "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v";
+
+   // Metadata messages are not filtered by elevation. The second elevation is
+   // the Doppler cut of the lowest split cut.
+   Ar2vDecodeFilter filter {};
+   filter.elevationIndices_ = {1};
+   filter.includeMetadata_  = true;
+
+   Ar2vFile file;
+   Ar2vFile filteredFile;
+   file.LoadFile(filename);
+   EXPECT_TRUE(filteredFile.LoadFile(filename, filter));
+
+   EXPECT_EQ(filteredFile.message_count(), file.message_count());
+   EXPECT_NE(filteredFile.vcp_data(), nullptr);
+
+   auto [packedScan, elevationCut, elevationCuts] =
+      filteredFile.GetPackedElevationScan(
+         rda::DataBlockType::MomentVel, 0.5f, {});
+   ASSERT_NE(packedScan, nullptr);
+
+   EXPECT_EQ(elevationCuts.size(), 1u);
+   EXPECT_EQ(packedScan->radial_headers()[0].elevationNumber, 2u);
+}
+
+TEST(Ar2vFile, Cache)
+{
+   const std::string filename = std::string(SCWX_TEST_DATA_DIR) +
+                                "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v";
+
+   Ar2vFile file;
+   file.LoadFile(filename);
+
+   for (bool compress : {false, true})
+   {
+      std::ostringstream os {};
+      ASSERT_TRUE(file.SaveCache(os, compress));
+
+      std::string     cache = os.str();
+      Ar2vFile        cacheFile;
+      std::span<char> cacheData {cache};
+      EXPECT_TRUE(cacheFile.LoadCache(std::as_bytes(cacheData)));
+
+      EXPECT_EQ(cacheFile.message_count(), file.message_count());
+      EXPECT_EQ(cacheFile.icao(), file.icao());
+      EXPECT_EQ(cacheFile.start_time(), file.start_time());
+      ASSERT_NE(cacheFile.vcp_data(), nullptr);
+      EXPECT_EQ(cacheFile.vcp_data()->pattern_number(),
+                file.vcp_data()->pattern_number());
+
+      auto [packedScan, elevationCut, elevationCuts] =
+         file.GetPackedElevationScan(rda::DataBlockType::MomentVel, 0.5f, {});
+      auto [cacheScan, cacheElevationCut, cacheElevationCuts] =
+         cacheFile.GetPackedElevationScan(
+            rda::DataBlockType::MomentVel, 0.5f, {});
+      ASSERT_NE(packedScan, nullptr);
+      ASSERT_NE(cacheScan, nullptr);
+
+      EXPECT_EQ(cacheElevationCut, elevationCut);
+      EXPECT_EQ(cacheElevationCuts, elevationCuts);
+      EXPECT_EQ(cacheScan->radial_count(), packedScan->radial_count());
+
+      auto moment      = packedScan->moment(rda::DataBlockType::MomentVel);
+      auto cacheMoment = cacheScan->moment(rda::DataBlockType::MomentVel);
+      ASSERT_NE(moment, nullptr);
+      ASSERT_NE(cacheMoment, nullptr);
+
+      EXPECT_EQ(cacheMoment->scale(), moment->scale());
+      EXPECT_EQ(cacheMoment->offset(), moment->offset());
+
+      for (std::size_t radial = 0; radial < packedScan->radial_count();
+           ++radial)
+      {
+         const void* gates      = moment->data_moments(radial);
+         const void* cacheGates = cacheMoment->data_moments(radial);
+
+         ASSERT_EQ(cacheGates == nullptr, gates == nullptr);
+
+         if (gates != nullptr)
+         {
+            EXPECT_EQ(cacheMoment->radials()[radial].numberOfDataMomentGates,
+                      moment->radials()[radial].numberOfDataMomentGates);
+            EXPECT_EQ(std::memcmp(cacheGates,
+                                  gates,
+                                  moment->gate_stride() *
+                                     (moment->data_word_size() / 8u)),
+                      0);
+         }
+      }
+   }
+}
+
+TEST(Ar2vFile, CacheLeavesMomentsUnloaded)
+{
+   const std::string filename = std::string(SCWX_TEST_DATA_DIR) +
+                                "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v";
+
+   Ar2vFile file;
+   file.LoadFile(filename);
+
+   auto [packedScan, elevationCut, elevationCuts] =
+      file.GetPackedElevationScan(rda::DataBlockType::MomentRef, 0.5f, {});
+   ASSERT_NE(packedScan, nullptr);
+
+   auto moment = packedScan->moment(rda::DataBlockType::MomentVel);
+   ASSERT_NE(moment, nullptr);
+   ASSERT_FALSE(moment->loaded());
+
+   std::ostringstream os {};
+   ASSERT_TRUE(file.SaveCache(os, true));
+
+   // Moments decoded to write the cache are not retained
+   EXPECT_FALSE(moment->loaded());
+   EXPECT_TRUE(packedScan->moment(rda::DataBlockType::MomentRef)->loaded());
+}
+
+using ScanTime = std::chrono::system_clock::time_point;
+
+/**
+ * Elevation scan lookup of the nested index maps, as GetPackedElevationScan
+ * walked them before the index was sorted. Returns the coded elevation angle
+ * and the value of the selected scan.
+ */
+static std::pair<std::uint16_t, std::size_t> BaselineSelectElevationScan(
+   const std::map<std::uint16_t, std::map<ScanTime, std::size_t>>& scans,
+   std::uint16_t codedElevation,
+   ScanTime      time)
+{
+   std::uint16_t lowerBound = scans.cbegin()->first;
+   std::uint16_t upperBound = scans.crbegin()->first;
+
+   // Find closest elevation match
+   for (auto& scan : scans)
+   {
+      if (scan.first > lowerBound && scan.first <= codedElevation)
+      {
+         lowerBound = scan.first;
+      }
+      if (scan.first < upperBound && scan.first >= codedElevation)
+      {
+         upperBound = scan.first;
+      }
+   }
+
+   std::int32_t lowerDelta =
+      std::abs(static_cast<std::int32_t>(codedElevation) -
+               static_cast<std::int32_t>(lowerBound));
+   std::int32_t upperDelta =
+      std::abs(static_cast<std::int32_t>(codedElevation) -
+               static_cast<std::int32_t>(upperBound));
+
+   // Select closest elevation match
+   std::uint16_t elevationIndex =
+      (lowerDelta < upperDelta) ? lowerBound : upperBound;
+
+   // Select closest time match, not newer than the selected time
+   std::optional<std::size_t> elevationScan {};
+   ScanTime                   foundTime {};
+
+   for (auto& scan : scans.at(elevationIndex))
+   {
+      auto scanTime = std::chrono::floor<std::chrono::seconds>(scan.first);
+
+      if (!elevationScan.has_value() ||
+          ((scanTime <= time || time == ScanTime {}) && scanTime > foundTime))
+      {
+         elevationScan = scan.second;
+         foundTime     = scanTime;
+      }
+   }
+
+   return {elevationIndex, elevationScan.value()};
+}
+
+TEST(Ar2vFile, SelectElevationScan)
+{
+   using namespace std::chrono_literals;
+
+   const ScanTime t0 {std::chrono::seconds {1622138220}};
+
+   const std::vector<std::uint16_t>         codedElevations = {91u, 273u, 546u};
+   const std::vector<std::vector<ScanTime>> scanTimes       = {
+      {t0, t0 + 300s},
+      {t0 + 60s, t0 + 120s, t0 + 120s, t0 + 180s, t0 + 240s, t0 + 240s},
+      {t0 + 90s}};
+
+   // Exact match, between cuts, midway between cuts, before the first cut and
+   // after the last cut
+   static const std::vector<std::pair<std::uint16_t, std::size_t>>
+      kElevations = {{91u, 0u},
+                     {273u, 1u},
+                     {546u, 2u},
+                     {100u, 0u},
+                     {250u, 1u},
+                     {400u, 1u},
+                     {410u, 2u},
+                     {182u, 1u},
+                     {0u, 0u},
+                     {90u, 0u},
+                     {547u, 2u},
+                     {2000u, 2u}};
+
+   for (const auto& [codedElevation, expectedElevation] : kElevations)
+   {
+      EXPECT_EQ(detail::SelectElevationScan(
+                   codedElevations, scanTimes, codedElevation, {})
+                   .first,
+                expectedElevation)
+         << codedElevation;
+   }
+
+   // Exact match, between scans, before the first scan, after the last scan,
+   // and the newest scan. Of scans sharing the same time, the first is
+   // selected.
+   static const std::vector<std::pair<ScanTime, std::size_t>> kTimes = {
+      {t0 + 60s, 0u},
+      {t0 + 180s, 3u},
+      {t0 + 150s, 1u},
+      {t0 + 120s, 1u},
+      {t0 + 119s, 0u},
+      {t0, 0u},
+      {t0 + 241s, 4u},
+      {t0 + 1h, 4u},
+      {ScanTime {}, 4u}};
+
+   for (const auto& [time, expectedScan] : kTimes)
+   {
+      EXPECT_EQ(
+         detail::SelectElevationScan(codedElevations, scanTimes, 273u, time),
+         std::make_pair(std::size_t {1u}, expectedScan))
+         << (time - t0).count();
+   }
+
+   // A single elevation cut and scan is always selected
+   EXPECT_EQ(detail::SelectElevationScan({546u}, {{t0}}, 0u, t0 - 1h),
+             std::make_pair(std::size_t {0u}, std::size_t {0u}));
+}
+
+TEST(Ar2vFile, SelectElevationScanMatchesMap)
+{
+   using namespace std::chrono_literals;
+
+   const ScanTime t0 {std::chrono::seconds {1622138220}};
+
+   // Cuts of a VCP, with SAILS cuts repeating the lowest elevation. Scans are
+   // collected at sub-second times, some sharing the same second.
+   std::map<std::uint16_t, std::map<ScanTime, std::size_t>> scans {};
+   std::vector<std::uint16_t>                               codedElevations {};
+   std::vector<std::vector<ScanTime>>                       scanTimes {};
+
+   static const std::vector<std::uint16_t> kCodedElevations = {
+      91u, 182u, 273u, 364u, 455u, 546u, 728u, 1092u, 1820u, 3550u};
+
+   for (std::size_t i = 0; i < kCodedElevations.size(); ++i)
+   {
+      auto& elevationScans = scans[kCodedElevations[i]];
+
+      for (std::size_t j = 0; j < i % 4u + 1u; ++j)
+      {
+         const ScanTime time = t0 + std::chrono::seconds {i * 20u + j * 90u} +
+                               std::chrono::milliseconds {(i * 7u + j) % 3u *
+                                                          400u};
+         elevationScans.emplace(time, elevationScans.size());
+
+         if (j == 1u)
+         {
+            // A second scan in the same second
+            elevationScans.emplace(time + 100ms, elevationScans.size());
+         }
+      }
+
+      // The sorted index, as built from the index maps
+      codedElevations.push_back(kCodedElevations[i]);
+      auto& times = scanTimes.emplace_back();
+      for (auto& scan : elevationScans)
+      {
+         times.push_back(std::chrono::floor<std::chrono::seconds>(scan.first));
+      }
+   }
+
+   std::vector<ScanTime> times = {ScanTime {}};
+   for (auto offset = -10s; offset <= 600s; offset += 1s)
+   {
+      times.push_back(t0 + offset);
+   }
+
+   for (std::uint16_t codedElevation = 0u; codedElevation <= 4000u;
+        codedElevation += 7u)
+   {
+      for (ScanTime time : times)
+      {
+         const auto [expectedElevation, expectedScan] =
+            BaselineSelectElevationScan(scans, codedElevation, time);
+         const auto [elevation, scan] = detail::SelectElevationScan(
+            codedElevations, scanTimes, codedElevation, time);
+
+         ASSERT_EQ(codedElevations[elevation], expectedElevation)
+            << codedElevation;
+         ASSERT_EQ(scan, expectedScan)
+            << codedElevation << ", " << (time - t0).count();
+      }
+   }
+}
+
+TEST(Ar2vFile, PackedElevationScanSelectsCuts)
+{
+   const std::string filename = std::string(SCWX_TEST_DATA_DIR) +
+                                "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v";
+
+   Ar2vFile file;
+   file.LoadFile(filename);
+
+   auto [packedScan, elevationCut, elevationCuts] =
+      file.GetPackedElevationScan(rda::DataBlockType::MomentRef, 0.5f, {});
+   ASSERT_NE(packedScan, nullptr);
+   ASSERT_GT(elevationCuts.size(), 1u);
+
+   // Each elevation cut selects itself, and elevations outside of the cuts
+   // select the nearest cut
+   for (float cut : elevationCuts)
+   {
+      auto [cutScan, selectedCut, cuts] =
+         file.GetPackedElevationScan(rda::DataBlockType::MomentRef, cut, {});
+      EXPECT_NE(cutScan, nullptr);
+      EXPECT_FLOAT_EQ(selectedCut, cut);
+   }
+
+   EXPECT_FLOAT_EQ(std::get<1>(file.GetPackedElevationScan(
+                      rda::DataBlockType::MomentRef, -1.0f, {})),
+                   elevationCuts.front());
+   EXPECT_FLOAT_EQ(std::get<1>(file.GetPackedElevationScan(
+                      rda::DataBlockType::MomentRef, 90.0f, {})),
+                   elevationCuts.back());
+}
+
 } // namespace wsr88d
 } // namespace scwx
@@ -0,0 +1,58 @@
+#include "../wxbench.hpp"
+
+#include <scwx/wsr88d/level3_file.hpp>
+
+#include <sstream>
+
+#include <benchmark/benchmark.h>
+
+namespace scwx
+{
+namespace wsr88d
+{
+
+// Representative products, covering radial, raster, generic and graphic
+// products, and compressed and uncompressed symbology
+static const std::vector<std::string> kLevel3Files_ = {
+   "LSX_N0B_2022_03_30_15_40_41",       // 153 Super Res Reflectivity
+   "LSX_N0G_2022_03_30_15_40_41",       // 154 Super Res Velocity
+   "KLSX_SDUS83_N0CLSX_202112110106",   // 161 Correlation Coefficient
+   "KLSX_SDUS83_N0HLSX_202112110212",   // 165 Hydrometeor Classification
+   "KLSX_SDUS53_DVLLSX_202112110152",   // 134 Digital VIL
+   "KLSX_SDUS83_DPRLSX_202112110140",   // 176 Digital Precipitation Rate
+   "KLSX_SDUS53_NCRLSX_202112110215",   // 37 Composite Reflectivity
+   "KLSX_SDUS33_NMDLSX_202112110152",   // 141 Mesocyclone Detection
+   "Level3_STL_TZ0_20211211_0200.nids"}; // 180 TDWR Reflectivity
+
+static void BM_Level3FileLoadData(benchmark::State& state)
+{
+   const std::string& filename =
+      kLevel3Files_[static_cast<std::size_t>(state.range(0))];
+
+   auto data = bench::ReadDataFile("/nexrad/level3/" + filename);
+   if (!data.has_value())
+   {
+      state.SkipWithError("Test data not found");
+      return;
+   }
+
+   for (auto _ : state)
+   {
+      std::istringstream is(*data);
+      Level3File         file;
+
+      bool fileValid = file.LoadData(is);
+      benchmark::DoNotOptimize(fileValid);
+   }
+
+   state.SetLabel(filename);
+   state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                           static_cast<std::int64_t>(data->size()));
+}
+
+BENCHMARK(BM_Level3FileLoadData)
+   ->DenseRange(0, static_cast<int>(kLevel3Files_.size()) - 1)
+   ->Unit(benchmark::kMicrosecond);
+
+} // namespace wsr88d
+} // namespace scwx
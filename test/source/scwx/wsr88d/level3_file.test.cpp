@@ -1,4 +1,7 @@
 #include <scwx/wsr88d/level3_file.hpp>
+#include <scwx/util/time.hpp>
+
+#include <fstream>
 
 #include <gtest/gtest.h>
 
@@ -29,6 +32,37 @@ TEST_P(Level3ValidFileTest, ValidFile)
    EXPECT_EQ(message->header().message_code(), param.first);
 }
 
+TEST_P(Level3ValidFileTest, ScanMetadata)
+{
+   auto param = GetParam();
+
+   const std::string filename {std::string(SCWX_TEST_DATA_DIR) +
+                               "/nexrad/level3/" + param.second};
+
+   Level3File file;
+   file.LoadFile(filename);
+
+   std::ifstream f(filename, std::ios_base::in | std::ios_base::binary);
+   auto          metadata = Level3File::ScanMetadata(f);
+   ASSERT_TRUE(metadata.has_value());
+
+   EXPECT_EQ(metadata->group_, common::RadarProductGroup::Level3);
+   EXPECT_EQ(metadata->productCode_, param.first);
+   EXPECT_EQ(metadata->product_, file.wmo_header()->product_category());
+   EXPECT_EQ(metadata->siteId_, file.wmo_header()->product_designator());
+
+   auto descriptionBlock = file.message()->description_block();
+   if (descriptionBlock != nullptr)
+   {
+      EXPECT_EQ(metadata->volumeCoveragePattern_,
+                descriptionBlock->volume_coverage_pattern());
+      EXPECT_EQ(metadata->startTime_,
+                util::TimePoint(descriptionBlock->volume_scan_date(),
+                                descriptionBlock->volume_scan_start_time() *
+                                   1000u));
+   }
+}
+
 INSTANTIATE_TEST_SUITE_P(
    Level3File,
    Level3ValidFileTest,
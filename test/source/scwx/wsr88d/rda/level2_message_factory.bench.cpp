@@ -0,0 +1,142 @@
+#include "../../wxbench.hpp"
+
+#include <scwx/wsr88d/rda/level2_message_factory.hpp>
+#include <scwx/wsr88d/rda/level2_message_header.hpp>
+#include <scwx/util/byte_cursor.hpp>
+#include <scwx/util/decompress.hpp>
+
+#include <cstdint>
+#include <span>
+#include <sstream>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+static const std::string kLevel2File_ =
+   "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v";
+
+static constexpr std::size_t kDefaultSegmentSize_ = 2432u;
+static constexpr std::size_t kCtmHeaderSize_      = 12u;
+
+/**
+ * Decompresses a radial LDM record, and locates the messages it contains.
+ */
+static std::vector<char> ReadRadialRecord(std::vector<std::size_t>& offsets)
+{
+   std::vector<char> record {};
+
+   auto data = bench::ReadDataFile(kLevel2File_);
+   if (!data.has_value() ||
+       !util::DecompressBzip2(bench::ReadLdmRecord(*data, 1), record))
+   {
+      return {};
+   }
+
+   std::span<const std::byte> recordData = std::as_bytes(std::span(record));
+   std::size_t                offset     = 0;
+
+   while (offset + kCtmHeaderSize_ < recordData.size())
+   {
+      offset += kCtmHeaderSize_;
+
+      std::size_t messageSize = kDefaultSegmentSize_ - kCtmHeaderSize_;
+
+      Level2MessageHeader header;
+      util::ByteCursor    cursor(recordData.subspan(offset));
+      if (header.Parse(cursor))
+      {
+         if (header.message_size() == 65535)
+         {
+            messageSize =
+               (static_cast<std::size_t>(header.number_of_message_segments())
+                << 16) +
+               header.message_segment_number();
+         }
+         else if (header.message_type() == 29 || header.message_type() == 31)
+         {
+            messageSize = static_cast<std::size_t>(header.message_size()) * 2;
+         }
+
+         offsets.push_back(offset);
+      }
+
+      offset += messageSize;
+   }
+
+   return record;
+}
+
+static void BM_Level2MessageFactoryCreate(benchmark::State& state)
+{
+   std::vector<std::size_t> offsets {};
+   const std::vector<char>  record = ReadRadialRecord(offsets);
+   if (record.empty())
+   {
+      state.SkipWithError("Test data not found");
+      return;
+   }
+
+   // Messages are parsed in place without modifying the buffer, so each
+   // iteration parses the same buffer
+   auto buffer = std::make_shared<std::vector<char>>(record);
+   std::span<const std::byte> data = std::as_bytes(std::span(*buffer));
+
+   for (auto _ : state)
+   {
+      auto ctx = Level2MessageFactory::CreateContext();
+
+      for (std::size_t offset : offsets)
+      {
+         Level2MessageInfo info =
+            Level2MessageFactory::Create(data.subspan(offset), buffer, ctx);
+         benchmark::DoNotOptimize(info.message);
+      }
+   }
+
+   state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                           static_cast<std::int64_t>(offsets.size()));
+}
+
+static void BM_Level2MessageFactoryCreateStream(benchmark::State& state)
+{
+   std::vector<std::size_t> offsets {};
+   const std::vector<char>  record = ReadRadialRecord(offsets);
+   if (record.empty())
+   {
+      state.SkipWithError("Test data not found");
+      return;
+   }
+
+   const std::string recordData(record.cbegin(), record.cend());
+
+   for (auto _ : state)
+   {
+      std::istringstream is(recordData);
+      auto               ctx = Level2MessageFactory::CreateContext();
+
+      for (std::size_t offset : offsets)
+      {
+         is.seekg(static_cast<std::streamoff>(offset), std::ios_base::beg);
+
+         Level2MessageInfo info = Level2MessageFactory::Create(is, ctx);
+         benchmark::DoNotOptimize(info.message);
+      }
+   }
+
+   state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                           static_cast<std::int64_t>(offsets.size()));
+}
+
+BENCHMARK(BM_Level2MessageFactoryCreate)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Level2MessageFactoryCreateStream)->Unit(benchmark::kMicrosecond);
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
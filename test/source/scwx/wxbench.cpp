@@ -0,0 +1,91 @@
+#include "wxbench.hpp"
+
+#include <scwx/util/logger.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+
+#include <benchmark/benchmark.h>
+#include <spdlog/spdlog.h>
+
+namespace scwx
+{
+namespace bench
+{
+
+std::optional<std::string> ReadDataFile(const std::string& filename)
+{
+   std::ifstream f(std::string(SCWX_TEST_DATA_DIR) + filename,
+                   std::ios_base::in | std::ios_base::binary);
+   if (!f.good())
+   {
+      return std::nullopt;
+   }
+
+   return std::string(std::istreambuf_iterator<char>(f),
+                      std::istreambuf_iterator<char>());
+}
+
+// Archive II volume header size
+static constexpr std::size_t kVolumeHeaderSize_ = 24u;
+
+std::vector<char> ReadLdmRecord(const std::string& data,
+                                std::size_t        recordIndex)
+{
+   std::size_t offset = kVolumeHeaderSize_;
+
+   while (offset + 4 <= data.size())
+   {
+      // The control word is a big-endian record size, which may be negative
+      std::uint32_t controlWord = 0;
+      for (std::size_t i = 0; i < 4; ++i)
+      {
+         controlWord = (controlWord << 8) |
+                       static_cast<std::uint8_t>(data[offset + i]);
+      }
+
+      const std::int32_t recordSize = static_cast<std::int32_t>(controlWord);
+      const std::size_t  size =
+         static_cast<std::size_t>(recordSize < 0 ? -recordSize : recordSize);
+
+      offset += 4;
+
+      if (size == 0 || offset + size > data.size())
+      {
+         break;
+      }
+
+      if (recordIndex-- == 0)
+      {
+         return std::vector<char>(data.data() + offset,
+                                  data.data() + offset + size);
+      }
+
+      offset += size;
+   }
+
+   return {};
+}
+
+} // namespace bench
+} // namespace scwx
+
+int main(int argc, char** argv)
+{
+   scwx::util::Logger::Initialize();
+
+   // Logging is excluded from the measurements
+   spdlog::set_level(spdlog::level::off);
+
+   ::benchmark::Initialize(&argc, argv);
+   if (::benchmark::ReportUnrecognizedArguments(argc, argv))
+   {
+      return 1;
+   }
+
+   ::benchmark::RunSpecifiedBenchmarks();
+   ::benchmark::Shutdown();
+
+   return 0;
+}
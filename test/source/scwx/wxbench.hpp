@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace scwx
+{
+namespace bench
+{
+
+/**
+ * Reads a file from the test data directory into memory, so benchmarks
+ * measure decoding rather than file I/O.
+ *
+ * @param filename Path relative to the test data directory
+ *
+ * @return File contents, or std::nullopt if the file could not be read
+ */
+std::optional<std::string> ReadDataFile(const std::string& filename);
+
+/**
+ * Extracts a compressed LDM record from an Archive II file. The first record
+ * contains metadata, and the remaining records contain radials.
+ *
+ * @param data Archive II file contents
+ * @param recordIndex Index of the LDM record
+ *
+ * @return Compressed record, or an empty vector if the record was not found
+ */
+std::vector<char> ReadLdmRecord(const std::string& data,
+                                std::size_t        recordIndex);
+
+} // namespace bench
+} // namespace scwx
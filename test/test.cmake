@@ -32,8 +32,17 @@ set(SRC_QT_SETTINGS_TESTS source/scwx/qt/settings/settings_container.test.cpp
 set(SRC_QT_UTIL_TESTS source/scwx/qt/util/q_file_input_stream.test.cpp
                       source/scwx/qt/util/geographic_lib.test.cpp
                       source/scwx/qt/util/network.test.cpp)
-set(SRC_UTIL_TESTS source/scwx/util/float.test.cpp
+set(SRC_QT_VIEW_TESTS source/scwx/qt/view/radar_product_view.test.cpp
+                      source/scwx/qt/view/sweep_geometry.test.cpp)
+set(HDR_QT_VIEW_TESTS source/scwx/qt/view/sweep_test_data.hpp)
+set(SRC_UTIL_TESTS source/scwx/util/arena.test.cpp
+                   source/scwx/util/byte_cursor.test.cpp
+                   source/scwx/util/byte_swap.test.cpp
+                   source/scwx/util/decompress.test.cpp
+                   source/scwx/util/float.test.cpp
+                   source/scwx/util/lru_cache.test.cpp
                    source/scwx/util/rangebuf.test.cpp
+                   source/scwx/util/scheduler.test.cpp
                    source/scwx/util/streams.test.cpp
                    source/scwx/util/strings.test.cpp
                    source/scwx/util/vectorbuf.test.cpp)
@@ -55,6 +64,8 @@ add_executable(wxtest ${SRC_MAIN}
                       ${SRC_QT_MODEL_TESTS}
                       ${SRC_QT_SETTINGS_TESTS}
                       ${SRC_QT_UTIL_TESTS}
+                      ${SRC_QT_VIEW_TESTS}
+                      ${HDR_QT_VIEW_TESTS}
                       ${SRC_UTIL_TESTS}
                       ${SRC_WSR88D_TESTS}
                       ${CMAKE_FILES})
@@ -71,6 +82,8 @@ source_group("Source Files\\qt\\map"      FILES ${SRC_QT_MAP_TESTS})
 source_group("Source Files\\qt\\model"    FILES ${SRC_QT_MODEL_TESTS})
 source_group("Source Files\\qt\\settings" FILES ${SRC_QT_SETTINGS_TESTS})
 source_group("Source Files\\qt\\util"     FILES ${SRC_QT_UTIL_TESTS})
+source_group("Source Files\\qt\\view"     FILES ${SRC_QT_VIEW_TESTS})
+source_group("Header Files\\qt\\view"     FILES ${HDR_QT_VIEW_TESTS})
 source_group("Source Files\\util"         FILES ${SRC_UTIL_TESTS})
 source_group("Source Files\\wsr88d"       FILES ${SRC_WSR88D_TESTS})
 
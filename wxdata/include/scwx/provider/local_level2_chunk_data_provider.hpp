@@ -0,0 +1,66 @@
+#pragma once
+
+#include <scwx/provider/nexrad_data_provider.hpp>
+
+namespace scwx
+{
+namespace provider
+{
+
+/**
+ * @brief Local Level 2 Chunk Data Provider
+ *
+ * Provides real-time Level 2 data from a local directory of LDM chunk files.
+ * Chunk files are located recursively beneath the radar site directory, and
+ * are named YYYYMMDD-HHMMSS-NNN-T, where the date and time identify the volume
+ * scan, NNN is the chunk number, and T is the chunk type (S = start, I =
+ * intermediate, E = end). This matches the layout of the real-time chunks
+ * bucket, e.g. <directory>/KLSX/123/20240101-000123-001-S.
+ *
+ * Chunks arriving after a volume scan has been loaded are appended to the
+ * loaded volume scan, and the volume scan is reported as a new object.
+ */
+class LocalLevel2ChunkDataProvider : public NexradDataProvider
+{
+public:
+   explicit LocalLevel2ChunkDataProvider(const std::string& radarSite,
+                                         const std::string& directory);
+   ~LocalLevel2ChunkDataProvider();
+
+   LocalLevel2ChunkDataProvider(const LocalLevel2ChunkDataProvider&) = delete;
+   LocalLevel2ChunkDataProvider&
+   operator=(const LocalLevel2ChunkDataProvider&) = delete;
+
+   LocalLevel2ChunkDataProvider(LocalLevel2ChunkDataProvider&&) noexcept;
+   LocalLevel2ChunkDataProvider&
+   operator=(LocalLevel2ChunkDataProvider&&) noexcept;
+
+   size_t cache_size() const override;
+
+   std::chrono::system_clock::time_point last_modified() const override;
+   std::chrono::seconds                  update_period() const override;
+
+   std::string FindKey(std::chrono::system_clock::time_point time) override;
+   std::string FindLatestKey() override;
+   std::tuple<bool, size_t, size_t>
+   ListObjects(std::chrono::system_clock::time_point date) override;
+   std::shared_ptr<wsr88d::NexradFile>
+   LoadObjectByKey(const std::string& key) override;
+   bool IsObjectComplete(const std::string& key) const override;
+   std::pair<size_t, size_t> Refresh() override;
+
+   std::chrono::system_clock::time_point
+   GetTimePointByKey(const std::string& key) const override;
+   std::vector<std::chrono::system_clock::time_point>
+   GetTimePointsByDate(std::chrono::system_clock::time_point date) override;
+
+   static std::chrono::system_clock::time_point
+   GetTimePointFromKey(const std::string& key);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace provider
+} // namespace scwx
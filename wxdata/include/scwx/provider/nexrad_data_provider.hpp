@@ -81,6 +81,17 @@ public:
    virtual std::shared_ptr<wsr88d::NexradFile>
    LoadObjectByKey(const std::string& key) = 0;
 
+   /**
+    * Determines whether the NEXRAD object for the given key is complete, and
+    * will not change when it is loaded again. Objects which are still being
+    * received should not be persisted.
+    *
+    * @param key NEXRAD data key
+    *
+    * @return Whether the object is complete
+    */
+   virtual bool IsObjectComplete(const std::string& key) const;
+
    /**
     * Lists NEXRAD objects for the current date, and adds them to the cache. If
     * no objects have been added to the cache for the current date, the previous
@@ -3,6 +3,7 @@
 #include <scwx/provider/nexrad_data_provider.hpp>
 
 #include <memory>
+#include <string>
 
 namespace scwx
 {
@@ -24,8 +25,18 @@ private:
    operator=(NexradDataProviderFactory&&) noexcept = delete;
 
 public:
+   /**
+    * Creates a Level 2 data provider for a radar site.
+    *
+    * @param [in] radarSite Radar site ICAO
+    * @param [in] chunkPath Directory of real-time Level 2 chunks. The AWS
+    * archive is used if empty.
+    *
+    * @return Level 2 data provider
+    */
    static std::shared_ptr<NexradDataProvider>
-   CreateLevel2DataProvider(const std::string& radarSite);
+   CreateLevel2DataProvider(const std::string& radarSite,
+                            const std::string& chunkPath = {});
 
    static std::shared_ptr<NexradDataProvider>
    CreateLevel3DataProvider(const std::string& radarSite,
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief Monotonic memory arena. Memory allocated from the arena is released
+ * all at once, when the arena is destroyed.
+ */
+typedef std::pmr::monotonic_buffer_resource Arena;
+
+/**
+ * @brief Allocator drawing from a shared arena. Each allocator holds a
+ * reference to the arena, so the arena remains valid until every object
+ * allocated from it, including its shared_ptr control block, has been
+ * destroyed. The arena is not thread-safe, and must only be allocated from by
+ * one thread at a time.
+ */
+template<class T>
+class ArenaAllocator
+{
+public:
+   typedef T value_type;
+
+   explicit ArenaAllocator(std::shared_ptr<Arena> arena) noexcept :
+       arena_ {std::move(arena)}
+   {
+   }
+
+   template<class U>
+   ArenaAllocator(const ArenaAllocator<U>& other) noexcept :
+       arena_ {other.arena()}
+   {
+   }
+
+   T* allocate(std::size_t n)
+   {
+      return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+   }
+
+   void deallocate(T* p, std::size_t n) noexcept
+   {
+      arena_->deallocate(p, n * sizeof(T), alignof(T));
+   }
+
+   const std::shared_ptr<Arena>& arena() const noexcept { return arena_; }
+
+   template<class U>
+   bool operator==(const ArenaAllocator<U>& other) const noexcept
+   {
+      return arena_ == other.arena();
+   }
+
+private:
+   std::shared_ptr<Arena> arena_;
+};
+
+/**
+ * Creates a shared object in the arena, or on the heap if no arena is given.
+ */
+template<class T, class... Args>
+std::shared_ptr<T> AllocateShared(const std::shared_ptr<Arena>& arena,
+                                  Args&&... args)
+{
+   if (arena != nullptr)
+   {
+      return std::allocate_shared<T>(ArenaAllocator<T> {arena},
+                                     std::forward<Args>(args)...);
+   }
+
+   return std::make_shared<T>(std::forward<Args>(args)...);
+}
+
+} // namespace util
+} // namespace scwx
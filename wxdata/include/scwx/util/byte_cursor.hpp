@@ -0,0 +1,133 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+#include <span>
+#include <string>
+#include <type_traits>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief Sequential reader over a contiguous byte buffer. Fields are decoded
+ * from big-endian (network) byte order directly from the buffer, and byte
+ * ranges are returned as views into the buffer instead of being copied.
+ *
+ * Reading past the end of the buffer sets the fail state, returns a
+ * value-initialized result, and positions the cursor at the end of the buffer.
+ */
+class ByteCursor
+{
+public:
+   explicit ByteCursor(std::span<const std::byte> data) : data_ {data} {}
+   ~ByteCursor() = default;
+
+   ByteCursor(const ByteCursor&)            = default;
+   ByteCursor& operator=(const ByteCursor&) = default;
+
+   ByteCursor(ByteCursor&&) noexcept            = default;
+   ByteCursor& operator=(ByteCursor&&) noexcept = default;
+
+   std::span<const std::byte> data() const { return data_; }
+
+   std::size_t position() const { return position_; }
+   std::size_t size() const { return data_.size(); }
+   std::size_t remaining() const { return data_.size() - position_; }
+   bool        fail() const { return fail_; }
+
+   void Seek(std::size_t position)
+   {
+      if (position > data_.size())
+      {
+         position_ = data_.size();
+         fail_     = true;
+      }
+      else
+      {
+         position_ = position;
+      }
+   }
+
+   void Skip(std::size_t count) { Seek(position_ + count); }
+
+   template<typename T>
+      requires std::is_arithmetic_v<T>
+   T Read()
+   {
+      T value {};
+
+      if (remaining() < sizeof(T))
+      {
+         position_ = data_.size();
+         fail_     = true;
+         return value;
+      }
+
+      std::array<std::byte, sizeof(T)> bytes;
+      std::memcpy(bytes.data(), data_.data() + position_, sizeof(T));
+      position_ += sizeof(T);
+
+      if constexpr (std::endian::native == std::endian::little)
+      {
+         std::reverse(bytes.begin(), bytes.end());
+      }
+
+      std::memcpy(&value, bytes.data(), sizeof(T));
+      return value;
+   }
+
+   std::span<const std::byte> ReadBytes(std::size_t count)
+   {
+      if (remaining() < count)
+      {
+         position_ = data_.size();
+         fail_     = true;
+         return {};
+      }
+
+      std::span<const std::byte> bytes = data_.subspan(position_, count);
+      position_ += count;
+      return bytes;
+   }
+
+   std::string ReadString(std::size_t count)
+   {
+      std::span<const std::byte> bytes = ReadBytes(count);
+      return std::string(reinterpret_cast<const char*>(bytes.data()),
+                         bytes.size());
+   }
+
+private:
+   std::span<const std::byte> data_;
+   std::size_t                position_ {0};
+   bool                       fail_ {false};
+};
+
+/**
+ * @brief Writes a field in big-endian (network) byte order, as read by
+ * ByteCursor::Read.
+ */
+template<typename T>
+   requires std::is_arithmetic_v<T>
+void WriteBytes(std::ostream& os, T value)
+{
+   std::array<char, sizeof(T)> bytes;
+   std::memcpy(bytes.data(), &value, sizeof(T));
+
+   if constexpr (std::endian::native == std::endian::little)
+   {
+      std::reverse(bytes.begin(), bytes.end());
+   }
+
+   os.write(bytes.data(), sizeof(T));
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief Statistics computed over a gate array while it is byte swapped.
+ */
+struct GateStatistics
+{
+   std::uint16_t maxValue_ {0};   ///< Maximum gate value
+   std::size_t   validGates_ {0}; ///< Number of gates at or above threshold
+};
+
+/**
+ * Converts an array of big-endian 16-bit values to host byte order. Uses
+ * SSE2, AVX2 or NEON where supported by the CPU, selected at runtime.
+ *
+ * @param src Big-endian source data, with no alignment requirement
+ * @param dst Destination array, which may be the same as the source
+ * @param count Number of 16-bit values
+ */
+void SwapBytes16(const void* src, std::uint16_t* dst, std::size_t count);
+
+/**
+ * Converts an array of big-endian 16-bit values to host byte order, and
+ * computes gate statistics in the same pass.
+ *
+ * @param src Big-endian source data, with no alignment requirement
+ * @param dst Destination array, which may be the same as the source
+ * @param count Number of 16-bit values
+ * @param threshold Minimum value of a valid gate
+ *
+ * @return Gate statistics, in host byte order
+ */
+GateStatistics SwapBytes16(const void*    src,
+                           std::uint16_t* dst,
+                           std::size_t    count,
+                           std::uint16_t  threshold);
+
+} // namespace util
+} // namespace scwx
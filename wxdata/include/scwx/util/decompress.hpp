@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace scwx
+{
+namespace util
+{
+
+enum class ZlibFormat
+{
+   Zlib,
+   Gzip
+};
+
+/**
+ * @brief Pool of decompression output buffers, shared across loads. Reusing
+ * buffers avoids repeatedly growing a fresh buffer for each record or file.
+ */
+class DecompressBufferPool :
+    public std::enable_shared_from_this<DecompressBufferPool>
+{
+public:
+   explicit DecompressBufferPool();
+   ~DecompressBufferPool();
+
+   DecompressBufferPool(const DecompressBufferPool&)            = delete;
+   DecompressBufferPool& operator=(const DecompressBufferPool&) = delete;
+
+   DecompressBufferPool(DecompressBufferPool&&) noexcept;
+   DecompressBufferPool& operator=(DecompressBufferPool&&) noexcept;
+
+   /**
+    * Acquires an empty buffer from the pool.
+    *
+    * @param sizeHint Expected size of the buffer contents. Capacity for at
+    * least this many bytes is reserved.
+    *
+    * @return Empty buffer
+    */
+   std::vector<char> Acquire(std::size_t sizeHint = 0);
+
+   /**
+    * Returns a buffer to the pool. Buffers are discarded if the pool is full.
+    */
+   void Release(std::vector<char>&& buffer);
+
+   /**
+    * Moves a buffer into a shared pointer, which returns the buffer to the
+    * pool once the last reference is released.
+    */
+   std::shared_ptr<std::vector<char>> MakeShared(std::vector<char>&& buffer);
+
+   static std::shared_ptr<DecompressBufferPool> Instance();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+/**
+ * Decompresses a bzip2 stream, appending the result to the output buffer.
+ * Concatenated streams are decompressed in sequence.
+ *
+ * @param input Compressed data
+ * @param output Output buffer. Existing capacity is reused.
+ * @param sizeHint Expected decompressed size, used to size the output buffer
+ *
+ * @return true if the stream was decompressed successfully
+ */
+bool DecompressBzip2(std::span<const char> input,
+                     std::vector<char>&    output,
+                     std::size_t           sizeHint = 0);
+
+/**
+ * Decompresses a single zlib stream, or all members of a gzip stream,
+ * appending the result to the output buffer. If no size hint is provided for
+ * a gzip stream, the size recorded in the gzip trailer is used.
+ *
+ * @param input Compressed data
+ * @param output Output buffer. Existing capacity is reused.
+ * @param format Stream format
+ * @param sizeHint Expected decompressed size, used to size the output buffer
+ * @param bytesConsumed If provided, set to the number of input bytes consumed
+ *
+ * @return true if the stream was decompressed successfully
+ */
+bool DecompressZlib(std::span<const char> input,
+                    std::vector<char>&    output,
+                    ZlibFormat            format,
+                    std::size_t           sizeHint      = 0,
+                    std::size_t*          bytesConsumed = nullptr);
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <list>
+#include <utility>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief Least recently used cache, limited by the total size of its entries.
+ * The size of each entry is provided by the caller, e.g., in bytes, or 1 to
+ * limit the number of entries.
+ *
+ * Entries are found by comparing keys for equality, as caches are expected to
+ * hold few entries. The cache is not thread-safe.
+ */
+template<class Key, class T>
+class LruCache
+{
+public:
+   explicit LruCache(std::size_t limit) : limit_ {limit} {}
+   ~LruCache() = default;
+
+   LruCache(const LruCache&)            = delete;
+   LruCache& operator=(const LruCache&) = delete;
+
+   LruCache(LruCache&&) noexcept            = default;
+   LruCache& operator=(LruCache&&) noexcept = default;
+
+   [[nodiscard]] std::size_t count() const { return entries_.size(); }
+   [[nodiscard]] std::size_t limit() const { return limit_; }
+   [[nodiscard]] std::size_t size() const { return size_; }
+
+   /**
+    * Sets the size limit of the cache, removing the least recently used
+    * entries until the cache is within the limit.
+    */
+   void set_limit(std::size_t limit)
+   {
+      limit_ = limit;
+      Prune();
+   }
+
+   /**
+    * Finds the entry for a key, and marks it as the most recently used.
+    *
+    * @param [in] key Entry key
+    *
+    * @return Pointer to the cached value, or nullptr if the key is not cached.
+    * The pointer is valid until the entry is removed.
+    */
+   T* Find(const Key& key)
+   {
+      auto it = FindEntry(key);
+      if (it == entries_.end())
+      {
+         return nullptr;
+      }
+
+      // Move the entry to the front of the cache
+      entries_.splice(entries_.begin(), entries_, it);
+      return &it->value_;
+   }
+
+   /**
+    * Inserts an entry as the most recently used, and removes the least
+    * recently used entries until the cache is within its limit. An entry
+    * larger than the limit is not inserted. If the key is already cached, the
+    * cached entry is kept.
+    *
+    * @param [in] key Entry key
+    * @param [in] value Value to cache
+    * @param [in] size Size of the entry
+    *
+    * @return true if the entry was inserted
+    */
+   bool Insert(const Key& key, T value, std::size_t size = 1u)
+   {
+      bool inserted = false;
+
+      if (size <= limit_ && FindEntry(key) == entries_.end())
+      {
+         entries_.emplace_front(Entry {key, std::move(value), size});
+         size_ += size;
+         inserted = true;
+      }
+
+      Prune();
+
+      return inserted;
+   }
+
+   /**
+    * Removes the entries for which the predicate returns true.
+    *
+    * @param [in] pred Predicate called with the key and value of each entry
+    *
+    * @return Number of entries removed
+    */
+   template<class Predicate>
+   std::size_t EraseIf(Predicate pred)
+   {
+      std::size_t erased = 0u;
+
+      for (auto it = entries_.begin(); it != entries_.end();)
+      {
+         if (pred(std::as_const(it->key_), std::as_const(it->value_)))
+         {
+            size_ -= it->size_;
+            it = entries_.erase(it);
+            ++erased;
+         }
+         else
+         {
+            ++it;
+         }
+      }
+
+      return erased;
+   }
+
+   void Clear()
+   {
+      entries_.clear();
+      size_ = 0u;
+   }
+
+private:
+   struct Entry
+   {
+      Key         key_;
+      T           value_;
+      std::size_t size_;
+   };
+
+   typename std::list<Entry>::iterator FindEntry(const Key& key)
+   {
+      return std::find_if(entries_.begin(),
+                          entries_.end(),
+                          [&key](const Entry& entry)
+                          { return entry.key_ == key; });
+   }
+
+   void Prune()
+   {
+      // Remove the least recently used entries until within the limit
+      while (size_ > limit_ && !entries_.empty())
+      {
+         size_ -= entries_.back().size_;
+         entries_.pop_back();
+      }
+   }
+
+   std::list<Entry> entries_ {};
+   std::size_t      limit_;
+   std::size_t      size_ {0u};
+};
+
+} // namespace util
+} // namespace scwx
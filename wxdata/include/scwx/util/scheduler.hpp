@@ -0,0 +1,241 @@
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <boost/asio/execution.hpp>
+#include <boost/asio/execution_context.hpp>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief Priority of a task run by the process-wide scheduler. When a scheduler
+ * thread becomes available, it starts the oldest task of the highest priority
+ * below its share of the threads. Only interactive tasks may use every thread.
+ */
+enum class TaskPriority
+{
+   Interactive, ///< Computation of displayed products
+   Decode,      ///< Loading and decoding of products
+   Network,     ///< Network requests and refreshes
+   Background   ///< Prefetching and other deferred work
+};
+
+namespace detail
+{
+
+class Task
+{
+public:
+   virtual ~Task()    = default;
+   virtual void Run() = 0;
+};
+
+template<class F>
+class FunctionTask : public Task
+{
+public:
+   template<class G>
+   explicit FunctionTask(G&& f) : f_ {std::forward<G>(f)}
+   {
+   }
+
+   void Run() override { std::move(f_)(); }
+
+private:
+   F f_;
+};
+
+/**
+ * @brief State shared by the executors of a task group, counting the tasks
+ * submitted and not yet completed, and the executors tracking outstanding work.
+ * The tasks of a serial group run one at a time, in the order submitted.
+ */
+class TaskState
+{
+public:
+   explicit TaskState(TaskPriority priority, bool serial);
+   ~TaskState();
+
+   TaskState(const TaskState&)            = delete;
+   TaskState& operator=(const TaskState&) = delete;
+
+   [[nodiscard]] TaskPriority priority() const;
+   [[nodiscard]] bool         serial() const;
+   [[nodiscard]] bool         stopped() const;
+
+   void Stop();
+   void Wait();
+   void WorkStarted();
+   void WorkFinished();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+void Submit(const std::shared_ptr<TaskState>& state,
+            std::unique_ptr<Task>             task);
+
+boost::asio::execution_context& SchedulerContext();
+
+} // namespace detail
+
+/**
+ * @brief Executor submitting the tasks of a task group to the process-wide
+ * scheduler. Tasks submitted through the same executor may run concurrently.
+ */
+class TaskExecutor
+{
+public:
+   TaskExecutor(std::shared_ptr<detail::TaskState> state,
+                bool                               tracked) noexcept;
+   ~TaskExecutor();
+
+   TaskExecutor(const TaskExecutor& other) noexcept;
+   TaskExecutor(TaskExecutor&& other) noexcept;
+   TaskExecutor& operator=(const TaskExecutor& other) noexcept;
+   TaskExecutor& operator=(TaskExecutor&& other) noexcept;
+
+   template<class F>
+   void execute(F&& f) const
+   {
+      detail::Submit(state_,
+                     std::make_unique<detail::FunctionTask<std::decay_t<F>>>(
+                        std::forward<F>(f)));
+   }
+
+   [[nodiscard]] boost::asio::execution_context&
+   query(boost::asio::execution::context_t) const noexcept;
+
+   [[nodiscard]] constexpr boost::asio::execution::blocking_t
+   query(boost::asio::execution::blocking_t) const noexcept
+   {
+      return boost::asio::execution::blocking.never;
+   }
+
+   [[nodiscard]] constexpr boost::asio::execution::relationship_t
+   query(boost::asio::execution::relationship_t) const noexcept
+   {
+      return boost::asio::execution::relationship.fork;
+   }
+
+   [[nodiscard]] constexpr boost::asio::execution::outstanding_work_t
+   query(boost::asio::execution::outstanding_work_t) const noexcept
+   {
+      return tracked_ ? boost::asio::execution::outstanding_work_t {
+                           boost::asio::execution::outstanding_work.tracked} :
+                        boost::asio::execution::outstanding_work_t {
+                           boost::asio::execution::outstanding_work.untracked};
+   }
+
+   [[nodiscard]] TaskExecutor
+   require(boost::asio::execution::blocking_t::never_t) const noexcept
+   {
+      return *this;
+   }
+
+   [[nodiscard]] TaskExecutor
+   require(boost::asio::execution::outstanding_work_t::tracked_t) const noexcept
+   {
+      return TaskExecutor {state_, true};
+   }
+
+   [[nodiscard]] TaskExecutor require(
+      boost::asio::execution::outstanding_work_t::untracked_t) const noexcept
+   {
+      return TaskExecutor {state_, false};
+   }
+
+   friend bool operator==(const TaskExecutor& a,
+                          const TaskExecutor& b) noexcept
+   {
+      return a.state_ == b.state_;
+   }
+
+   friend bool operator!=(const TaskExecutor& a,
+                          const TaskExecutor& b) noexcept
+   {
+      return a.state_ != b.state_;
+   }
+
+private:
+   std::shared_ptr<detail::TaskState> state_;
+   bool                               tracked_;
+};
+
+/**
+ * @brief Group of tasks run concurrently by the process-wide scheduler, in
+ * place of a thread pool. Destroying the group waits for its tasks to complete.
+ */
+class TaskGroup
+{
+public:
+   using executor_type = TaskExecutor;
+
+   explicit TaskGroup(TaskPriority priority);
+   ~TaskGroup();
+
+   TaskGroup(const TaskGroup&)            = delete;
+   TaskGroup& operator=(const TaskGroup&) = delete;
+
+   [[nodiscard]] executor_type get_executor() const noexcept;
+
+   /**
+    * Waits for the tasks of the group to complete, including those submitted
+    * by pending timers and other outstanding work.
+    */
+   void join();
+
+   /**
+    * Discards the tasks of the group which have not started, and any tasks
+    * submitted afterward.
+    */
+   void stop();
+
+private:
+   std::shared_ptr<detail::TaskState> state_;
+};
+
+/**
+ * @brief Serial task group, in place of a thread pool with a single thread.
+ * Tasks are held in the scheduler queue of their priority, together with the
+ * tasks of other groups, and a task of the queue is not started while another
+ * is running. Tasks run in the order they are submitted, and may run on any
+ * scheduler thread. Destroying the queue waits for its tasks to complete.
+ */
+class TaskQueue
+{
+public:
+   using executor_type = TaskExecutor;
+
+   explicit TaskQueue(TaskPriority priority);
+   ~TaskQueue();
+
+   TaskQueue(const TaskQueue&)            = delete;
+   TaskQueue& operator=(const TaskQueue&) = delete;
+
+   [[nodiscard]] executor_type get_executor() const noexcept;
+
+   /**
+    * Waits for the tasks of the queue to complete, including those submitted
+    * by pending timers and other outstanding work.
+    */
+   void join();
+
+   /**
+    * Discards the tasks of the queue which have not started, and any tasks
+    * submitted afterward.
+    */
+   void stop();
+
+private:
+   std::shared_ptr<detail::TaskState> state_;
+};
+
+} // namespace util
+} // namespace scwx
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstddef>
 #include <istream>
+#include <vector>
 
 namespace scwx
 {
@@ -9,5 +11,16 @@ namespace util
 
 std::istream& getline(std::istream& is, std::string& t);
 
+/**
+ * Reads the remainder of a stream, appending it to the buffer. If the stream
+ * is seekable, the buffer is sized to the remaining length before reading.
+ *
+ * @param is Input stream
+ * @param buffer Buffer to append to
+ *
+ * @return Number of bytes read
+ */
+std::size_t ReadRemaining(std::istream& is, std::vector<char>& buffer);
+
 } // namespace util
 } // namespace scwx
@@ -1,11 +1,17 @@
 #pragma once
 
 #include <scwx/wsr88d/nexrad_file.hpp>
+#include <scwx/wsr88d/nexrad_file_metadata.hpp>
 #include <scwx/wsr88d/rda/generic_radar_data.hpp>
+#include <scwx/wsr88d/rda/packed_elevation_scan.hpp>
 #include <scwx/wsr88d/rda/volume_coverage_pattern_data.hpp>
 
 #include <chrono>
 #include <memory>
+#include <optional>
+#include <ostream>
+#include <set>
+#include <span>
 #include <string>
 
 namespace scwx
@@ -15,6 +21,24 @@ namespace wsr88d
 
 class Ar2vFileImpl;
 
+/**
+ * @brief Selects the data decoded when loading an Archive II file. Data which
+ * is not selected is skipped without being copied.
+ */
+struct Ar2vDecodeFilter
+{
+   /// Moments to decode, or all moments if empty. Selecting reflectivity also
+   /// selects clutter filter power removed, which is displayed along with it.
+   std::set<rda::DataBlockType> dataBlockTypes_ {};
+
+   /// Elevation numbers (0-based) to decode, or all elevations if empty
+   std::set<std::uint16_t> elevationIndices_ {};
+
+   /// Decode messages which are not displayed (RDA status, performance and
+   /// maintenance, clutter filter and adaptation data)
+   bool includeMetadata_ {false};
+};
+
 /**
  * @brief The Archive II file is specified in the Interface Control Document for
  * the Archive II/User, Document Number 2620010H, published by the WSR-88D Radar
@@ -50,9 +74,92 @@ public:
                     float                                 elevation,
                     std::chrono::system_clock::time_point time) const;
 
+   /**
+    * Gets the packed elevation scan closest to the requested elevation, not
+    * newer than the requested time. Returns the elevation scan, the selected
+    * elevation cut, and the available elevation cuts.
+    */
+   std::tuple<std::shared_ptr<const rda::PackedElevationScan>,
+              float,
+              std::vector<float>>
+   GetPackedElevationScan(rda::DataBlockType                    dataBlockType,
+                          float                                 elevation,
+                          std::chrono::system_clock::time_point time) const;
+
    bool LoadFile(const std::string& filename);
    bool LoadData(std::istream& is);
 
+   /**
+    * Loads an Archive II file, decoding only the data selected by the filter.
+    * The filter also applies to chunks appended later.
+    *
+    * @param [in] filename Archive II filename
+    * @param [in] filter Decode filter
+    *
+    * @return true if the data was loaded
+    */
+   bool LoadFile(const std::string& filename, const Ar2vDecodeFilter& filter);
+   bool LoadData(std::istream& is, const Ar2vDecodeFilter& filter);
+
+   /**
+    * Appends a real-time LDM chunk (start, intermediate or end) to the volume.
+    * The start chunk begins with the Volume Header Record. Each chunk is
+    * decoded as it arrives, and only the elevation scans receiving new radials
+    * are repacked. Elevation scans may be read concurrently with an append,
+    * but appends must not be made concurrently with each other or with
+    * LoadData.
+    *
+    * @param [in] is Chunk data
+    *
+    * @return true if the chunk was appended
+    */
+   bool AppendChunk(std::istream& is);
+   bool AppendChunkFile(const std::string& filename);
+
+   /**
+    * Returns the elevation numbers (0-based) modified by the most recent
+    * append, in ascending order.
+    */
+   std::vector<std::uint16_t> updated_elevations() const;
+
+   /**
+    * Writes the decoded volume to a cache, which can be reloaded without
+    * decompressing or parsing the Archive II data. The cache contains the
+    * volume header, the VCP, the elevation scan index and the gate matrices
+    * of each moment. Moments which have not been decoded are decoded as they
+    * are written, and are not retained.
+    *
+    * @param [in] os Output stream
+    * @param [in] compress Compress the moment gates with zlib
+    *
+    * @return true if the cache was written
+    */
+   bool SaveCache(std::ostream& os, bool compress = false) const;
+   bool SaveCacheFile(const std::string& filename, bool compress = false) const;
+
+   /**
+    * Loads a decoded volume from a cache written by SaveCache. Cache files are
+    * memory mapped.
+    *
+    * @param [in] data Cache data
+    *
+    * @return true if the cache was loaded
+    */
+   bool LoadCache(std::span<const std::byte> data);
+   bool LoadCacheFile(const std::string& filename);
+
+   /**
+    * Reads the volume header, VCP and collection times of an Archive II file
+    * without decoding its radar data. Only the first LDM record, containing
+    * the metadata messages, and the last LDM record are decompressed. The
+    * records in between are skipped if the stream is seekable.
+    *
+    * @param [in] is Input stream, positioned at the Volume Header Record
+    *
+    * @return File metadata, or std::nullopt if the header could not be read
+    */
+   static std::optional<NexradFileMetadata> ScanMetadata(std::istream& is);
+
 private:
    std::unique_ptr<Ar2vFileImpl> p;
 };
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace detail
+{
+
+/**
+ * @brief Selects an elevation scan from a sorted index of elevation cuts and
+ * scan times.
+ *
+ * The closest elevation cut is selected, or the higher cut if the elevation is
+ * midway between two cuts. An elevation outside of the cuts selects the nearest
+ * cut. Of the scans of the cut, the newest scan not newer than the time is
+ * selected, or the oldest scan if each is newer. Of scans sharing the same
+ * time, the first is selected.
+ *
+ * @param [in] codedElevations Coded elevation angles in ascending order. Must
+ * not be empty.
+ * @param [in] scanTimes Scan times of each elevation cut in ascending order.
+ * Each must not be empty.
+ * @param [in] codedElevation Coded elevation angle
+ * @param [in] time Scan time, or the default time point for the newest scan
+ *
+ * @return Index of the elevation cut, and of the scan of the cut
+ */
+std::pair<std::size_t, std::size_t> SelectElevationScan(
+   const std::vector<std::uint16_t>& codedElevations,
+   const std::vector<std::vector<std::chrono::system_clock::time_point>>&
+                                         scanTimes,
+   std::uint16_t                         codedElevation,
+   std::chrono::system_clock::time_point time);
+
+} // namespace detail
+} // namespace wsr88d
+} // namespace scwx
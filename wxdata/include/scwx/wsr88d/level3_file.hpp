@@ -2,9 +2,11 @@
 
 #include <scwx/awips/wmo_header.hpp>
 #include <scwx/wsr88d/nexrad_file.hpp>
+#include <scwx/wsr88d/nexrad_file_metadata.hpp>
 #include <scwx/wsr88d/rpg/level3_message.hpp>
 
 #include <memory>
+#include <optional>
 #include <string>
 
 namespace scwx
@@ -32,6 +34,17 @@ public:
    bool LoadFile(const std::string& filename);
    bool LoadData(std::istream& is);
 
+   /**
+    * Reads the WMO header, message header and product description block of a
+    * Level 3 file without decoding the product symbology. Compressed files are
+    * decompressed only as far as the product description block.
+    *
+    * @param [in] is Input stream
+    *
+    * @return File metadata, or std::nullopt if the headers could not be read
+    */
+   static std::optional<NexradFileMetadata> ScanMetadata(std::istream& is);
+
 private:
    std::unique_ptr<Level3FileImpl> p;
 };
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <scwx/wsr88d/ar2v_file.hpp>
 #include <scwx/wsr88d/nexrad_file.hpp>
+#include <scwx/wsr88d/nexrad_file_metadata.hpp>
+
+#include <optional>
 
 namespace scwx
 {
@@ -22,6 +26,33 @@ private:
 public:
    static std::shared_ptr<NexradFile> Create(const std::string& filename);
    static std::shared_ptr<NexradFile> Create(std::istream& is);
+
+   /**
+    * Creates a NEXRAD file, decoding only the Level 2 data selected by the
+    * filter. The filter does not apply to Level 3 files.
+    *
+    * @param [in] filename NEXRAD file
+    * @param [in] filter Level 2 decode filter
+    *
+    * @return NEXRAD file, or nullptr if the file could not be read
+    */
+   static std::shared_ptr<NexradFile> Create(const std::string&      filename,
+                                             const Ar2vDecodeFilter& filter);
+   static std::shared_ptr<NexradFile> Create(std::istream&           is,
+                                             const Ar2vDecodeFilter& filter);
+
+   /**
+    * Reads the metadata of a Level 2 or Level 3 file, without decoding its
+    * radar data. This is significantly faster than Create, and is suitable for
+    * populating timelines and indexing archives.
+    *
+    * @param [in] filename NEXRAD file
+    *
+    * @return File metadata, or std::nullopt if the file could not be read
+    */
+   static std::optional<NexradFileMetadata>
+   ScanMetadata(const std::string& filename);
+   static std::optional<NexradFileMetadata> ScanMetadata(std::istream& is);
 };
 
 } // namespace wsr88d
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <scwx/common/products.hpp>
+#include <scwx/wsr88d/rda/volume_coverage_pattern_data.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace scwx
+{
+namespace wsr88d
+{
+
+/**
+ * @brief Summary of a NEXRAD file, read without decoding its radar data.
+ */
+struct NexradFileMetadata
+{
+   common::RadarProductGroup group_ {common::RadarProductGroup::Unknown};
+
+   std::string  icao_ {};        ///< Radar ICAO (Level 2) or WMO ICAO (Level 3)
+   std::string  siteId_ {};      ///< Product designator (Level 3)
+   std::string  product_ {};     ///< Product category (Level 3)
+   std::int16_t productCode_ {0}; ///< Message code (Level 3)
+
+   std::chrono::system_clock::time_point startTime_ {}; ///< Volume start time
+   std::chrono::system_clock::time_point endTime_ {};   ///< Last radial time
+                                                        ///< (Level 2) or
+                                                        ///< generation time
+                                                        ///< (Level 3)
+
+   std::uint16_t volumeCoveragePattern_ {0};
+   std::vector<float> elevationCuts_ {}; ///< Sorted elevation cuts in degrees
+
+   std::shared_ptr<const rda::VolumeCoveragePatternData> vcpData_ {};
+};
+
+} // namespace wsr88d
+} // namespace scwx
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <scwx/util/arena.hpp>
+#include <scwx/util/byte_cursor.hpp>
 #include <scwx/wsr88d/rda/generic_radar_data.hpp>
 
+#include <span>
+
 namespace scwx
 {
 namespace wsr88d
@@ -51,10 +55,31 @@ public:
    moment_data_block(DataBlockType type) const;
 
    bool Parse(std::istream& is);
+   bool Parse(std::span<const std::byte>          data,
+              const std::shared_ptr<const void>&  buffer,
+              const std::shared_ptr<util::Arena>& arena = nullptr);
 
    static std::shared_ptr<DigitalRadarDataGeneric>
    Create(Level2MessageHeader&& header, std::istream& is);
 
+   /**
+    * Creates a message from a span. The message is parsed in place, and
+    * retains views into the span.
+    *
+    * @param header Message header
+    * @param data Message data, following the message header
+    * @param buffer Owner of the message data
+    * @param arena If provided, the message and its data blocks are allocated
+    * from the arena, which is kept alive by the returned message
+    *
+    * @return Message, or nullptr if the message is invalid
+    */
+   static std::shared_ptr<DigitalRadarDataGeneric>
+   Create(Level2MessageHeader&&               header,
+          std::span<const std::byte>          data,
+          const std::shared_ptr<const void>&  buffer,
+          const std::shared_ptr<util::Arena>& arena = nullptr);
+
 private:
    class Impl;
    std::unique_ptr<Impl> p;
@@ -62,9 +87,11 @@ private:
 
 class DigitalRadarDataGeneric::DataBlock
 {
+public:
+   DataBlockType data_block_type() const;
+
 protected:
-   explicit DataBlock(const std::string& dataBlockType,
-                      const std::string& dataName);
+   explicit DataBlock(DataBlockType dataBlockType);
    virtual ~DataBlock();
 
    DataBlock(const DataBlock&)            = delete;
@@ -74,15 +101,13 @@ protected:
    DataBlock& operator=(DataBlock&&) noexcept;
 
 private:
-   class Impl;
-   std::unique_ptr<Impl> p;
+   DataBlockType dataBlockType_;
 };
 
 class DigitalRadarDataGeneric::ElevationDataBlock : public DataBlock
 {
 public:
-   explicit ElevationDataBlock(const std::string& dataBlockType,
-                               const std::string& dataName);
+   explicit ElevationDataBlock(DataBlockType dataBlockType);
    ~ElevationDataBlock();
 
    ElevationDataBlock(const ElevationDataBlock&)            = delete;
@@ -92,15 +117,15 @@ public:
    ElevationDataBlock& operator=(ElevationDataBlock&&) noexcept;
 
    static std::shared_ptr<ElevationDataBlock>
-   Create(const std::string& dataBlockType,
-          const std::string& dataName,
-          std::istream&      is);
+   Create(DataBlockType                       dataBlockType,
+          util::ByteCursor&                   cursor,
+          const std::shared_ptr<util::Arena>& arena = nullptr);
 
 private:
    class Impl;
    std::unique_ptr<Impl> p;
 
-   bool Parse(std::istream& is);
+   bool Parse(util::ByteCursor& cursor);
 };
 
 class DigitalRadarDataGeneric::MomentDataBlock :
@@ -108,8 +133,7 @@ class DigitalRadarDataGeneric::MomentDataBlock :
     public GenericRadarData::MomentDataBlock
 {
 public:
-   explicit MomentDataBlock(const std::string& dataBlockType,
-                            const std::string& dataName);
+   explicit MomentDataBlock(DataBlockType dataBlockType);
    ~MomentDataBlock();
 
    MomentDataBlock(const MomentDataBlock&)            = delete;
@@ -130,23 +154,38 @@ public:
    float                    offset() const;
    const void*              data_moments() const;
 
+   /**
+    * Creates a moment data block. 8-bit gates are not copied, and instead
+    * reference the cursor data. 16-bit gates are copied in host byte order,
+    * and the cursor data is not modified.
+    *
+    * @param dataBlockType Data block type
+    * @param cursor Cursor positioned after the data block type and name
+    * @param buffer Owner of the cursor data
+    * @param arena If provided, the data block and any 16-bit gates are
+    * allocated from the arena
+    *
+    * @return Moment data block
+    */
    static std::shared_ptr<MomentDataBlock>
-   Create(const std::string& dataBlockType,
-          const std::string& dataName,
-          std::istream&      is);
+   Create(DataBlockType                       dataBlockType,
+          util::ByteCursor&                   cursor,
+          const std::shared_ptr<const void>&  buffer,
+          const std::shared_ptr<util::Arena>& arena = nullptr);
 
 private:
    class Impl;
    std::unique_ptr<Impl> p;
 
-   bool Parse(std::istream& is);
+   bool Parse(util::ByteCursor&                   cursor,
+              const std::shared_ptr<const void>&  buffer,
+              const std::shared_ptr<util::Arena>& arena);
 };
 
 class DigitalRadarDataGeneric::RadialDataBlock : public DataBlock
 {
 public:
-   explicit RadialDataBlock(const std::string& dataBlockType,
-                            const std::string& dataName);
+   explicit RadialDataBlock(DataBlockType dataBlockType);
    ~RadialDataBlock();
 
    RadialDataBlock(const RadialDataBlock&)            = delete;
@@ -158,22 +197,21 @@ public:
    float unambiguous_range() const;
 
    static std::shared_ptr<RadialDataBlock>
-   Create(const std::string& dataBlockType,
-          const std::string& dataName,
-          std::istream&      is);
+   Create(DataBlockType                       dataBlockType,
+          util::ByteCursor&                   cursor,
+          const std::shared_ptr<util::Arena>& arena = nullptr);
 
 private:
    class Impl;
    std::unique_ptr<Impl> p;
 
-   bool Parse(std::istream& is);
+   bool Parse(util::ByteCursor& cursor);
 };
 
 class DigitalRadarDataGeneric::VolumeDataBlock : public DataBlock
 {
 public:
-   explicit VolumeDataBlock(const std::string& dataBlockType,
-                            const std::string& dataName);
+   explicit VolumeDataBlock(DataBlockType dataBlockType);
    ~VolumeDataBlock();
 
    VolumeDataBlock(const VolumeDataBlock&)            = delete;
@@ -187,15 +225,15 @@ public:
    std::uint16_t volume_coverage_pattern_number() const;
 
    static std::shared_ptr<VolumeDataBlock>
-   Create(const std::string& dataBlockType,
-          const std::string& dataName,
-          std::istream&      is);
+   Create(DataBlockType                       dataBlockType,
+          util::ByteCursor&                   cursor,
+          const std::shared_ptr<util::Arena>& arena = nullptr);
 
 private:
    class Impl;
    std::unique_ptr<Impl> p;
 
-   bool Parse(std::istream& is);
+   bool Parse(util::ByteCursor& cursor);
 };
 
 } // namespace rda
@@ -2,6 +2,8 @@
 
 #include <scwx/wsr88d/rda/level2_message.hpp>
 
+#include <span>
+
 namespace scwx
 {
 namespace wsr88d
@@ -39,6 +41,22 @@ public:
    static std::shared_ptr<Context> CreateContext();
    static Level2MessageInfo        Create(std::istream&             is,
                                           std::shared_ptr<Context>& ctx);
+
+   /**
+    * Creates a message from a span beginning at the message header. Digital
+    * Radar Data Generic Format messages are parsed in place, and retain views
+    * into the span. The buffer owning the span is kept alive by the returned
+    * message. The span is not modified.
+    *
+    * @param data Message data, beginning with the message header
+    * @param buffer Owner of the message data
+    * @param ctx Message factory context
+    *
+    * @return Message info
+    */
+   static Level2MessageInfo Create(std::span<const std::byte>         data,
+                                   const std::shared_ptr<const void>& buffer,
+                                   std::shared_ptr<Context>&          ctx);
 };
 
 } // namespace rda
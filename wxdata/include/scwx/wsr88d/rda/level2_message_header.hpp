@@ -1,6 +1,9 @@
 #pragma once
 
+#include <scwx/util/byte_cursor.hpp>
+
 #include <cstdint>
+#include <istream>
 #include <memory>
 
 namespace scwx
@@ -36,6 +39,7 @@ public:
    void set_message_size(uint16_t messageSize);
 
    bool Parse(std::istream& is);
+   bool Parse(util::ByteCursor& cursor);
 
    static const size_t SIZE = 16u;
 
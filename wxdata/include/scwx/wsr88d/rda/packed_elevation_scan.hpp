@@ -0,0 +1,309 @@
+#pragma once
+
+#include <scwx/util/byte_cursor.hpp>
+#include <scwx/wsr88d/rda/generic_radar_data.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <set>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+/**
+ * @brief Contiguous, structure-of-arrays representation of an elevation scan.
+ *
+ * Radials are stored densely, indexed by azimuth number - 1. Radial headers and
+ * azimuth angles are stored in parallel arrays, and the gates of each moment
+ * are stored in a single radials x gates matrix. Radials that were not present
+ * in the source elevation scan are marked invalid.
+ *
+ * When created with a record source, moment gates are not copied. Instead, the
+ * location of each radial's gates within the source records is recorded, and
+ * the gates are decoded from the records by LoadMoment.
+ */
+class PackedElevationScan :
+    public std::enable_shared_from_this<PackedElevationScan>
+{
+public:
+   struct RadialHeader
+   {
+      bool          valid {false};
+      std::uint32_t collectionTime {0};
+      std::uint16_t modifiedJulianDate {0};
+      std::uint16_t azimuthNumber {0};
+      std::uint16_t elevationNumber {0};
+      std::uint16_t volumeCoveragePatternNumber {0};
+   };
+
+   struct MomentRadial
+   {
+      std::uint16_t numberOfDataMomentGates {0};
+      std::int16_t  dataMomentRangeRaw {0};
+      std::uint16_t dataMomentRangeSampleIntervalRaw {0};
+   };
+
+   struct MomentLocation
+   {
+      std::size_t recordIndex {0};
+      std::size_t offset {0};
+   };
+
+   class Moment;
+   class RecordSource;
+
+   explicit PackedElevationScan();
+   ~PackedElevationScan();
+
+   PackedElevationScan(const PackedElevationScan&)            = delete;
+   PackedElevationScan& operator=(const PackedElevationScan&) = delete;
+
+   PackedElevationScan(PackedElevationScan&&) noexcept            = delete;
+   PackedElevationScan& operator=(PackedElevationScan&&) noexcept = delete;
+
+   std::size_t radial_count() const { return radialHeaders_.size(); }
+
+   /**
+    * Returns true if the radial was present in the source elevation scan.
+    */
+   bool has_radial(std::size_t radial) const
+   {
+      return radial < radialHeaders_.size() && radialHeaders_[radial].valid;
+   }
+
+   std::span<const RadialHeader> radial_headers() const
+   {
+      return radialHeaders_;
+   }
+
+   /**
+    * Azimuth angles of each radial, in degrees.
+    */
+   std::span<const float> azimuth_angles() const { return azimuthAngles_; }
+
+   /**
+    * Returns the first valid radial header, or nullptr if no radials are
+    * valid.
+    */
+   const RadialHeader* first_radial_header() const;
+
+   /**
+    * Returns the last valid radial header, or nullptr if no radials are valid.
+    */
+   const RadialHeader* last_radial_header() const;
+
+   /**
+    * Returns the moment data for the data block type, or nullptr if the moment
+    * is not present in the elevation scan.
+    */
+   const Moment* moment(DataBlockType dataBlockType) const;
+
+   /**
+    * Creates an elevation scan map view of the packed data. The radials and
+    * moment data blocks reference the packed data, and do not copy gates.
+    */
+   std::shared_ptr<ElevationScan> CreateElevationScan() const;
+
+   /**
+    * Decodes the gates of a moment from the record source, if they have not
+    * already been decoded. Safe to call concurrently.
+    *
+    * @param [in] dataBlockType Moment data block type
+    *
+    * @return true if the moment gates are available
+    */
+   bool LoadMoment(DataBlockType dataBlockType);
+
+   /**
+    * Decodes the gates of several moments from the record source, if they
+    * have not already been decoded. Each record is decoded once for all of
+    * the moments. Safe to call concurrently.
+    *
+    * @param [in] dataBlockTypes Moment data block types
+    *
+    * @return true if the gates of each moment present are available
+    */
+   bool LoadMoments(const std::set<DataBlockType>& dataBlockTypes);
+
+   /**
+    * Writes the packed elevation scan to a volume cache. Moments which have
+    * not been decoded are decoded together into temporary gates, and remain
+    * unloaded. Gates are written in native byte order, so they are read
+    * without byte swapping.
+    *
+    * @param [in] os Output stream
+    * @param [in] compress Compress the moment gates with zlib
+    *
+    * @return true if the elevation scan was written
+    */
+   bool Write(std::ostream& os, bool compress);
+
+   /**
+    * Reads a packed elevation scan written by Write.
+    *
+    * @param [in] cursor Volume cache data, positioned at the elevation scan
+    * @param [in] compressed Whether the moment gates are compressed
+    *
+    * @return Packed elevation scan, or nullptr if the data is invalid
+    */
+   static std::shared_ptr<PackedElevationScan> Read(util::ByteCursor& cursor,
+                                                    bool compressed);
+
+   /**
+    * Creates a packed elevation scan.
+    *
+    * @param [in] elevationScan Source elevation scan
+    * @param [in] recordSource Optional source of the records referenced by the
+    * elevation scan. Moments which can be located within the records are
+    * decoded on demand by LoadMoment. Other moments are copied immediately.
+    * @param [in] dataBlockTypes Moments to pack. If empty, all moments are
+    * packed. Other moments are skipped without copying their gates.
+    */
+   static std::shared_ptr<PackedElevationScan>
+   Create(const ElevationScan&                elevationScan,
+          std::shared_ptr<const RecordSource> recordSource   = nullptr,
+          const std::set<DataBlockType>&      dataBlockTypes = {});
+
+private:
+   /**
+    * Decodes the gates of moments from the record source. Radials which cannot
+    * be decoded are left zero. The moments are not modified.
+    *
+    * @param [in] moments Moments to decode
+    * @param [out] gates Decoded moment matrix of each moment
+    */
+   void DecodeMoments(std::span<const Moment* const>          moments,
+                      std::vector<std::vector<std::uint8_t>>& gates) const;
+
+   std::vector<RadialHeader> radialHeaders_ {};
+   std::vector<float>        azimuthAngles_ {};
+
+   std::unordered_map<DataBlockType, std::unique_ptr<Moment>> moments_ {};
+
+   std::shared_ptr<const RecordSource> recordSource_ {};
+   std::mutex                          loadMutex_ {};
+};
+
+class PackedElevationScan::Moment
+{
+public:
+   explicit Moment() = default;
+   ~Moment()         = default;
+
+   Moment(const Moment&)            = delete;
+   Moment& operator=(const Moment&) = delete;
+
+   Moment(Moment&&) noexcept            = delete;
+   Moment& operator=(Moment&&) noexcept = delete;
+
+   std::uint8_t  data_word_size() const { return dataWordSize_; }
+   std::uint16_t gate_stride() const { return gateStride_; }
+   std::int16_t  snr_threshold_raw() const { return snrThresholdRaw_; }
+   float         scale() const { return scale_; }
+   float         offset() const { return offset_; }
+
+   std::span<const MomentRadial> radials() const { return radials_; }
+
+   /**
+    * Returns true if the moment gates have been decoded.
+    */
+   bool loaded() const { return loaded_.load(std::memory_order_acquire); }
+
+   units::kilometers<float> data_moment_range(std::size_t radial) const
+   {
+      return units::kilometers<float> {radials_[radial].dataMomentRangeRaw *
+                                       kRangeScale};
+   }
+
+   units::kilometers<float>
+   data_moment_range_sample_interval(std::size_t radial) const
+   {
+      return units::kilometers<float> {
+         radials_[radial].dataMomentRangeSampleIntervalRaw * kRangeScale};
+   }
+
+   /**
+    * Returns the gates for a radial, or nullptr if the radial does not contain
+    * the moment, or the moment has not been loaded. Gates are 8-bit or 16-bit
+    * as specified by the data word size.
+    */
+   const void* data_moments(std::size_t radial) const
+   {
+      if (!loaded() || radial >= radials_.size() ||
+          radials_[radial].numberOfDataMomentGates == 0)
+      {
+         return nullptr;
+      }
+
+      return gates_.data() + radial * gateStride_ * (dataWordSize_ / 8u);
+   }
+
+private:
+   friend class PackedElevationScan;
+
+   static constexpr float kRangeScale = 0.001f;
+
+   std::uint8_t  dataWordSize_ {0};
+   std::uint16_t gateStride_ {0};
+   std::int16_t  snrThresholdRaw_ {0};
+   float         scale_ {0.0f};
+   float         offset_ {0.0f};
+
+   std::vector<MomentRadial> radials_ {};
+   std::vector<std::uint8_t> gates_ {};
+
+   std::vector<MomentLocation> locations_ {};
+   std::atomic<bool>           loaded_ {false};
+};
+
+/**
+ * @brief Source of the records containing deferred moment gates.
+ */
+class PackedElevationScan::RecordSource
+{
+public:
+   explicit RecordSource() = default;
+   virtual ~RecordSource() = default;
+
+   RecordSource(const RecordSource&)            = delete;
+   RecordSource& operator=(const RecordSource&) = delete;
+
+   RecordSource(RecordSource&&) noexcept            = delete;
+   RecordSource& operator=(RecordSource&&) noexcept = delete;
+
+   /**
+    * Locates data within the decoded records.
+    *
+    * @param [in] data Pointer to data referenced by a parsed message
+    * @param [in] size Size of the data in bytes
+    *
+    * @return Record index and offset of the data, or std::nullopt if the data
+    * is not contained within a record
+    */
+   virtual std::optional<MomentLocation> Locate(const void* data,
+                                                std::size_t size) const = 0;
+
+   /**
+    * Decodes a record.
+    *
+    * @param [in] recordIndex Record index
+    *
+    * @return Decoded record, or an empty vector on failure
+    */
+   virtual std::vector<char> Decode(std::size_t recordIndex) const = 0;
+};
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
@@ -13,6 +13,7 @@ enum class MessageId : std::uint8_t
    RdaStatusData              = 2,
    PerformanceMaintenanceData = 3,
    VolumeCoveragePatternData  = 5,
+   ClutterFilterBypassMap     = 13,
    ClutterFilterMap           = 15,
    RdaAdaptationData          = 18,
    DigitalRadarDataGeneric    = 31
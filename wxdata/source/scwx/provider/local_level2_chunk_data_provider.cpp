@@ -0,0 +1,573 @@
+#include <scwx/provider/local_level2_chunk_data_provider.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/map.hpp>
+#include <scwx/util/time.hpp>
+#include <scwx/wsr88d/ar2v_file.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include <fmt/chrono.h>
+#include <fmt/ranges.h>
+
+#if (__cpp_lib_chrono < 201907L)
+#   include <date/date.h>
+#endif
+
+namespace scwx
+{
+namespace provider
+{
+
+static const std::string logPrefix_ =
+   "scwx::provider::local_level2_chunk_data_provider";
+static const auto logger_ = util::Logger::Create(logPrefix_);
+
+class LocalLevel2ChunkDataProvider::Impl
+{
+public:
+   struct ChunkRecord
+   {
+      std::filesystem::path                 path_;
+      std::chrono::system_clock::time_point lastModified_;
+   };
+
+   struct VolumeRecord
+   {
+      explicit VolumeRecord(const std::string& key) : key_ {key} {}
+      ~VolumeRecord() = default;
+
+      std::string                           key_;
+      std::map<int, ChunkRecord>            chunks_ {};
+      std::chrono::system_clock::time_point lastModified_ {};
+
+      // Chunks are appended to a loaded volume scan in chunk number order. The
+      // volume scan is retained only while it is in use.
+      std::weak_ptr<wsr88d::Ar2vFile> file_ {};
+      int                             nextChunk_ {1};
+
+      // Set once the end chunk of the volume scan has been found
+      bool endChunkFound_ {false};
+   };
+
+   explicit Impl(const std::string& radarSite, const std::string& directory) :
+       radarSite_ {radarSite}, directory_ {directory}
+   {
+   }
+
+   ~Impl() {}
+
+   using ChunkList = std::vector<std::pair<int, std::filesystem::path>>;
+
+   std::tuple<bool, std::size_t, std::size_t>
+                    ScanDirectory(std::chrono::system_clock::time_point date);
+   static ChunkList PendingChunks(const VolumeRecord& volume, int firstChunk);
+   static bool
+   AppendChunks(const ChunkList&                         chunks,
+                const std::shared_ptr<wsr88d::Ar2vFile>& file);
+   void             UpdateMetadata();
+
+   static bool ParseChunkFilename(const std::string& filename,
+                                  std::string&       volumeId,
+                                  int&               chunkNumber);
+
+   std::string           radarSite_;
+   std::filesystem::path directory_;
+
+   std::map<std::chrono::system_clock::time_point, VolumeRecord> volumes_ {};
+   std::shared_mutex volumesMutex_ {};
+
+   // Serializes appends to loaded volume scans. Chunks are decompressed and
+   // appended without holding volumesMutex_.
+   std::mutex loadMutex_ {};
+
+   std::chrono::system_clock::time_point lastModified_ {};
+   std::chrono::seconds                  updatePeriod_ {};
+};
+
+LocalLevel2ChunkDataProvider::LocalLevel2ChunkDataProvider(
+   const std::string& radarSite, const std::string& directory) :
+    p(std::make_unique<Impl>(radarSite, directory))
+{
+}
+LocalLevel2ChunkDataProvider::~LocalLevel2ChunkDataProvider() = default;
+
+LocalLevel2ChunkDataProvider::LocalLevel2ChunkDataProvider(
+   LocalLevel2ChunkDataProvider&&) noexcept = default;
+LocalLevel2ChunkDataProvider& LocalLevel2ChunkDataProvider::operator=(
+   LocalLevel2ChunkDataProvider&&) noexcept = default;
+
+size_t LocalLevel2ChunkDataProvider::cache_size() const
+{
+   return p->volumes_.size();
+}
+
+std::chrono::system_clock::time_point
+LocalLevel2ChunkDataProvider::last_modified() const
+{
+   return p->lastModified_;
+}
+
+std::chrono::seconds LocalLevel2ChunkDataProvider::update_period() const
+{
+   return p->updatePeriod_;
+}
+
+std::string LocalLevel2ChunkDataProvider::FindKey(
+   std::chrono::system_clock::time_point time)
+{
+   logger_->debug("FindKey: {}", util::TimeString(time));
+
+   std::string key {};
+
+   std::shared_lock lock(p->volumesMutex_);
+
+   auto element = util::GetBoundedElement(p->volumes_, time);
+
+   if (element.has_value())
+   {
+      key = element->key_;
+   }
+
+   return key;
+}
+
+std::string LocalLevel2ChunkDataProvider::FindLatestKey()
+{
+   logger_->debug("FindLatestKey()");
+
+   std::string key {};
+
+   std::shared_lock lock(p->volumesMutex_);
+
+   if (!p->volumes_.empty())
+   {
+      key = p->volumes_.crbegin()->second.key_;
+   }
+
+   return key;
+}
+
+std::tuple<bool, size_t, size_t> LocalLevel2ChunkDataProvider::ListObjects(
+   std::chrono::system_clock::time_point date)
+{
+   logger_->debug("ListObjects: {}", util::TimeString(date));
+
+   return p->ScanDirectory(date);
+}
+
+std::shared_ptr<wsr88d::NexradFile>
+LocalLevel2ChunkDataProvider::LoadObjectByKey(const std::string& key)
+{
+   logger_->debug("LoadObjectByKey: {}", key);
+
+   const auto time = GetTimePointFromKey(key);
+
+   std::shared_ptr<wsr88d::Ar2vFile> nexradFile = nullptr;
+   Impl::ChunkList                   chunks {};
+   int                               firstChunk = 1;
+
+   std::unique_lock loadLock(p->loadMutex_);
+   std::unique_lock lock(p->volumesMutex_);
+
+   auto it = p->volumes_.find(time);
+   if (it == p->volumes_.end() || it->second.key_ != key)
+   {
+      logger_->warn("Volume scan not found: {}", key);
+      return nullptr;
+   }
+
+   nexradFile        = it->second.file_.lock();
+   const bool loaded = (nexradFile != nullptr);
+
+   if (loaded)
+   {
+      firstChunk = it->second.nextChunk_;
+   }
+   else
+   {
+      nexradFile = std::make_shared<wsr88d::Ar2vFile>();
+   }
+
+   chunks = Impl::PendingChunks(it->second, firstChunk);
+
+   lock.unlock();
+
+   // Append any chunks which have not yet been loaded
+   const bool appended = Impl::AppendChunks(chunks, nexradFile);
+
+   if (!appended && !loaded)
+   {
+      logger_->warn("No chunks loaded for volume scan: {}", key);
+      return nullptr;
+   }
+
+   lock.lock();
+
+   Impl::VolumeRecord& volume = p->volumes_.at(time);
+   volume.file_               = nexradFile;
+   volume.nextChunk_          = firstChunk + static_cast<int>(chunks.size());
+
+   return nexradFile;
+}
+
+bool LocalLevel2ChunkDataProvider::IsObjectComplete(
+   const std::string& key) const
+{
+   std::shared_lock lock(p->volumesMutex_);
+
+   auto it = p->volumes_.find(GetTimePointFromKey(key));
+   if (it == p->volumes_.cend() || it->second.key_ != key)
+   {
+      return false;
+   }
+
+   // Chunks are numbered consecutively from 1, ending with the end chunk
+   const Impl::VolumeRecord& volume = it->second;
+   return volume.endChunkFound_ && !volume.chunks_.empty() &&
+          volume.chunks_.crbegin()->first ==
+             static_cast<int>(volume.chunks_.size());
+}
+
+std::pair<size_t, size_t> LocalLevel2ChunkDataProvider::Refresh()
+{
+   logger_->debug("Refresh()");
+
+   auto [success, newObjects, totalObjects] =
+      p->ScanDirectory(std::chrono::system_clock::time_point {});
+
+   return std::make_pair(newObjects, totalObjects);
+}
+
+std::chrono::system_clock::time_point
+LocalLevel2ChunkDataProvider::GetTimePointByKey(const std::string& key) const
+{
+   return GetTimePointFromKey(key);
+}
+
+std::vector<std::chrono::system_clock::time_point>
+LocalLevel2ChunkDataProvider::GetTimePointsByDate(
+   std::chrono::system_clock::time_point date)
+{
+   const auto day = std::chrono::floor<std::chrono::days>(date);
+
+   std::vector<std::chrono::system_clock::time_point> timePoints {};
+
+   logger_->trace("GetTimePointsByDate: {}", util::TimeString(date));
+
+   std::shared_lock lock(p->volumesMutex_);
+
+   auto volumesBegin = p->volumes_.lower_bound(day);
+   auto volumesEnd   = p->volumes_.lower_bound(day + std::chrono::days {1});
+
+   std::transform(volumesBegin,
+                  volumesEnd,
+                  std::back_inserter(timePoints),
+                  [](const auto& volume) { return volume.first; });
+
+   return timePoints;
+}
+
+std::chrono::system_clock::time_point
+LocalLevel2ChunkDataProvider::GetTimePointFromKey(const std::string& key)
+{
+   std::chrono::system_clock::time_point time {};
+
+   const size_t lastSeparator = key.rfind('/');
+   const size_t offset =
+      (lastSeparator == std::string::npos) ? 0 : lastSeparator + 1;
+
+   // Key format is YYYYMMDD-HHMMSS, optionally followed by the chunk number
+   // and type
+   static const size_t formatSize = std::string("YYYYMMDD-HHMMSS").size();
+
+   if (key.size() >= offset + formatSize)
+   {
+      using namespace std::chrono;
+
+#if (__cpp_lib_chrono < 201907L)
+      using namespace date;
+#endif
+
+      static const std::string timeFormat {"%Y%m%d-%H%M%S"};
+
+      std::string        timeStr {key.substr(offset, formatSize)};
+      std::istringstream in {timeStr};
+      in >> parse(timeFormat, time);
+
+      if (in.fail())
+      {
+         logger_->warn("Invalid time: \"{}\"", timeStr);
+      }
+   }
+   else
+   {
+      logger_->warn("Time not parsable from key: \"{}\"", key);
+   }
+
+   return time;
+}
+
+bool LocalLevel2ChunkDataProvider::Impl::ParseChunkFilename(
+   const std::string& filename, std::string& volumeId, int& chunkNumber)
+{
+   // Filename format is YYYYMMDD-HHMMSS-NNN-T
+   static const size_t formatSize =
+      std::string("YYYYMMDD-HHMMSS-NNN-T").size();
+   static const size_t volumeIdSize = std::string("YYYYMMDD-HHMMSS").size();
+
+   if (filename.size() != formatSize || filename[volumeIdSize] != '-' ||
+       filename[formatSize - 2] != '-')
+   {
+      return false;
+   }
+
+   const char chunkType = filename[formatSize - 1];
+   if (chunkType != 'S' && chunkType != 'I' && chunkType != 'E')
+   {
+      return false;
+   }
+
+   try
+   {
+      chunkNumber = std::stoi(filename.substr(volumeIdSize + 1, 3));
+   }
+   catch (const std::exception&)
+   {
+      return false;
+   }
+
+   volumeId = filename.substr(0, volumeIdSize);
+
+   return true;
+}
+
+std::tuple<bool, std::size_t, std::size_t>
+LocalLevel2ChunkDataProvider::Impl::ScanDirectory(
+   std::chrono::system_clock::time_point date)
+{
+   const std::filesystem::path siteDirectory = directory_ / radarSite_;
+   const auto day = std::chrono::floor<std::chrono::days>(date);
+
+   std::error_code ec;
+   if (!std::filesystem::is_directory(siteDirectory, ec))
+   {
+      logger_->warn("Chunk directory not found: {}", siteDirectory.string());
+      return {false, 0u, 0u};
+   }
+
+   const auto fileNow   = std::filesystem::file_time_type::clock::now();
+   const auto systemNow = std::chrono::system_clock::now();
+
+   // Volume scans which are new, or have received new chunks
+   std::set<std::chrono::system_clock::time_point> updatedVolumes {};
+
+   std::unique_lock lock(volumesMutex_);
+
+   for (auto& file :
+        std::filesystem::recursive_directory_iterator(siteDirectory, ec))
+   {
+      const std::string filename = file.path().filename().string();
+
+      std::string volumeId {};
+      int         chunkNumber {};
+
+      if (!file.is_regular_file() ||
+          !ParseChunkFilename(filename, volumeId, chunkNumber))
+      {
+         continue;
+      }
+
+      auto time = GetTimePointFromKey(volumeId);
+
+      // A default date scans all volume scans
+      if (date != std::chrono::system_clock::time_point {} &&
+          std::chrono::floor<std::chrono::days>(time) != day)
+      {
+         continue;
+      }
+
+      const std::string key =
+         std::filesystem::relative(file.path().parent_path(), directory_)
+            .generic_string() +
+         "/" + volumeId;
+
+      auto [it, inserted] = volumes_.try_emplace(time, key);
+      auto& volume        = it->second;
+
+      if (volume.key_ != key)
+      {
+         // A volume scan with the same start time was found in another
+         // volume directory
+         continue;
+      }
+
+      if (!volume.chunks_.contains(chunkNumber))
+      {
+         logger_->trace("Found chunk: {}", file.path().string());
+
+         std::filesystem::file_time_type lastWriteTime {};
+         try
+         {
+            lastWriteTime = std::filesystem::last_write_time(file);
+         }
+         catch (const std::exception&)
+         {
+            logger_->error("Error getting last write time of file: {}",
+                           file.path().string());
+         }
+
+         auto lastModified = std::chrono::time_point_cast<
+            std::chrono::system_clock::duration>(
+            systemNow + (lastWriteTime - fileNow));
+         volume.chunks_.emplace(chunkNumber,
+                                ChunkRecord {file.path(), lastModified});
+         volume.lastModified_ = std::max(volume.lastModified_, lastModified);
+
+         if (filename.back() == 'E')
+         {
+            volume.endChunkFound_ = true;
+         }
+
+         updatedVolumes.insert(time);
+      }
+   }
+
+   if (ec)
+   {
+      logger_->warn("Error scanning chunk directory: {}", ec.message());
+   }
+
+   std::size_t totalObjects = 0;
+   for (auto& volume : volumes_)
+   {
+      if (date == std::chrono::system_clock::time_point {} ||
+          std::chrono::floor<std::chrono::days>(volume.first) == day)
+      {
+         ++totalObjects;
+      }
+   }
+
+   lock.unlock();
+
+   // Append new chunks to volume scans which have already been loaded, so the
+   // loaded volume scan is updated in place
+   std::unique_lock loadLock(loadMutex_);
+
+   for (auto& time : updatedVolumes)
+   {
+      lock.lock();
+
+      auto&      volume     = volumes_.at(time);
+      auto       file       = volume.file_.lock();
+      const int  firstChunk = volume.nextChunk_;
+      const auto chunks =
+         (file != nullptr) ? PendingChunks(volume, firstChunk) : ChunkList {};
+
+      lock.unlock();
+
+      if (chunks.empty())
+      {
+         continue;
+      }
+
+      AppendChunks(chunks, file);
+
+      lock.lock();
+      volumes_.at(time).nextChunk_ =
+         firstChunk + static_cast<int>(chunks.size());
+      lock.unlock();
+   }
+
+   loadLock.unlock();
+
+   if (!updatedVolumes.empty())
+   {
+      UpdateMetadata();
+   }
+
+   return {true, updatedVolumes.size(), totalObjects};
+}
+
+LocalLevel2ChunkDataProvider::Impl::ChunkList
+LocalLevel2ChunkDataProvider::Impl::PendingChunks(const VolumeRecord& volume,
+                                                  int firstChunk)
+{
+   ChunkList chunks {};
+
+   // Chunks must be appended in order, stop at the first missing chunk
+   int nextChunk = firstChunk;
+   for (auto it = volume.chunks_.find(nextChunk);
+        it != volume.chunks_.cend() && it->first == nextChunk;
+        ++it, ++nextChunk)
+   {
+      chunks.emplace_back(it->first, it->second.path_);
+   }
+
+   return chunks;
+}
+
+bool LocalLevel2ChunkDataProvider::Impl::AppendChunks(
+   const ChunkList& chunks, const std::shared_ptr<wsr88d::Ar2vFile>& file)
+{
+   bool appended = false;
+
+   for (auto& [chunkNumber, path] : chunks)
+   {
+      if (file->AppendChunkFile(path.string()))
+      {
+         logger_->debug("Appended chunk {}, updated elevations: {}",
+                        chunkNumber,
+                        fmt::join(file->updated_elevations(), ", "));
+         appended = true;
+      }
+      else
+      {
+         logger_->warn("Could not append chunk: {}", path.string());
+      }
+   }
+
+   return appended;
+}
+
+void LocalLevel2ChunkDataProvider::Impl::UpdateMetadata()
+{
+   std::shared_lock lock(volumesMutex_);
+
+   if (!volumes_.empty())
+   {
+      lastModified_ = volumes_.crbegin()->second.lastModified_;
+   }
+
+   // Chunks of the volume scan in progress arrive more frequently than volume
+   // scans, so the update period is determined from the most recent chunks
+   if (!volumes_.empty() && volumes_.crbegin()->second.chunks_.size() >= 2)
+   {
+      auto& chunks       = volumes_.crbegin()->second.chunks_;
+      auto  it           = chunks.crbegin();
+      auto  lastModified = it->second.lastModified_;
+      auto  prevModified = (++it)->second.lastModified_;
+      auto  delta        = lastModified - prevModified;
+
+      updatePeriod_ = std::chrono::duration_cast<std::chrono::seconds>(delta);
+   }
+   else if (volumes_.size() >= 2)
+   {
+      auto it           = volumes_.crbegin();
+      auto lastModified = it->second.lastModified_;
+      auto prevModified = (++it)->second.lastModified_;
+      auto delta        = lastModified - prevModified;
+
+      updatePeriod_ = std::chrono::duration_cast<std::chrono::seconds>(delta);
+   }
+}
+
+} // namespace provider
+} // namespace scwx
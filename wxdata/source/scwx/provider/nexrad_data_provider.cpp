@@ -22,6 +22,11 @@ NexradDataProvider::NexradDataProvider(NexradDataProvider&&) noexcept = default;
 NexradDataProvider&
 NexradDataProvider::operator=(NexradDataProvider&&) noexcept = default;
 
+bool NexradDataProvider::IsObjectComplete(const std::string& /* key */) const
+{
+   return true;
+}
+
 void NexradDataProvider::RequestAvailableProducts() {}
 
 std::vector<std::string> NexradDataProvider::GetAvailableProducts()
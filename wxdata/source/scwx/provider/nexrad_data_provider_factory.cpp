@@ -1,6 +1,7 @@
 #include <scwx/provider/nexrad_data_provider_factory.hpp>
 #include <scwx/provider/aws_level2_data_provider.hpp>
 #include <scwx/provider/aws_level3_data_provider.hpp>
+#include <scwx/provider/local_level2_chunk_data_provider.hpp>
 
 namespace scwx
 {
@@ -12,8 +13,14 @@ static const std::string logPrefix_ =
 
 std::shared_ptr<NexradDataProvider>
 NexradDataProviderFactory::CreateLevel2DataProvider(
-   const std::string& radarSite)
+   const std::string& radarSite, const std::string& chunkPath)
 {
+   if (!chunkPath.empty())
+   {
+      return std::make_unique<LocalLevel2ChunkDataProvider>(radarSite,
+                                                            chunkPath);
+   }
+
    return std::make_unique<AwsLevel2DataProvider>(radarSite);
 }
 
@@ -0,0 +1,303 @@
+#include <scwx/util/byte_swap.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+// The scalar kernel is independent of host byte order. The SIMD kernels assume
+// a little-endian host.
+#if defined(__x86_64__) || defined(_M_X64)
+#   define SCWX_BYTE_SWAP_X86
+#   include <immintrin.h>
+#   if defined(_MSC_VER)
+#      include <intrin.h>
+#   endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#   define SCWX_BYTE_SWAP_NEON
+#   include <arm_neon.h>
+#endif
+
+#if defined(SCWX_BYTE_SWAP_X86) && defined(__GNUC__)
+#   define SCWX_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#   define SCWX_TARGET_AVX2
+#endif
+
+namespace scwx
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::util::byte_swap";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+typedef GateStatistics (*SwapBytes16Function)(const std::uint8_t* src,
+                                              std::uint16_t*      dst,
+                                              std::size_t         count,
+                                              std::uint16_t       threshold);
+
+template<bool Statistics>
+static GateStatistics SwapBytes16Scalar(const std::uint8_t* src,
+                                        std::uint16_t*      dst,
+                                        std::size_t         count,
+                                        std::uint16_t       threshold)
+{
+   GateStatistics statistics {};
+
+   for (std::size_t i = 0; i < count; ++i)
+   {
+      std::uint16_t value = static_cast<std::uint16_t>(
+         (static_cast<std::uint16_t>(src[i * 2]) << 8) | src[i * 2 + 1]);
+      dst[i] = value;
+
+      if constexpr (Statistics)
+      {
+         statistics.maxValue_ = std::max(statistics.maxValue_, value);
+         statistics.validGates_ += (value >= threshold) ? 1u : 0u;
+      }
+   }
+
+   return statistics;
+}
+
+template<bool Statistics>
+static GateStatistics MergeTail(GateStatistics      statistics,
+                                const std::uint8_t* src,
+                                std::uint16_t*      dst,
+                                std::size_t         count,
+                                std::uint16_t       threshold)
+{
+   GateStatistics tail =
+      SwapBytes16Scalar<Statistics>(src, dst, count, threshold);
+
+   if constexpr (Statistics)
+   {
+      statistics.maxValue_ = std::max(statistics.maxValue_, tail.maxValue_);
+      statistics.validGates_ += tail.validGates_;
+   }
+
+   return statistics;
+}
+
+#if defined(SCWX_BYTE_SWAP_X86)
+
+template<bool Statistics>
+static GateStatistics SwapBytes16Sse2(const std::uint8_t* src,
+                                      std::uint16_t*      dst,
+                                      std::size_t         count,
+                                      std::uint16_t       threshold)
+{
+   static constexpr std::size_t kLanes = 8u;
+
+   // SSE2 has no unsigned 16-bit compare, so values are biased into the signed
+   // range for the statistics
+   const __m128i bias = _mm_set1_epi16(static_cast<short>(0x8000));
+   const __m128i biasedThreshold =
+      _mm_xor_si128(_mm_set1_epi16(static_cast<short>(threshold)), bias);
+   __m128i     biasedMax    = _mm_xor_si128(_mm_setzero_si128(), bias);
+   std::size_t invalidGates = 0;
+
+   std::size_t i = 0;
+   for (; i + kLanes <= count; i += kLanes)
+   {
+      __m128i v =
+         _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 2));
+      v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+
+      if constexpr (Statistics)
+      {
+         __m128i biased = _mm_xor_si128(v, bias);
+         biasedMax      = _mm_max_epi16(biasedMax, biased);
+         invalidGates +=
+            std::popcount(static_cast<unsigned>(_mm_movemask_epi8(
+               _mm_cmplt_epi16(biased, biasedThreshold)))) /
+            2u;
+      }
+   }
+
+   GateStatistics statistics {};
+
+   if constexpr (Statistics)
+   {
+      alignas(16) std::uint16_t lanes[kLanes];
+      _mm_store_si128(reinterpret_cast<__m128i*>(lanes),
+                      _mm_xor_si128(biasedMax, bias));
+
+      statistics.maxValue_   = *std::max_element(lanes, lanes + kLanes);
+      statistics.validGates_ = i - invalidGates;
+   }
+
+   return MergeTail<Statistics>(
+      statistics, src + i * 2, dst + i, count - i, threshold);
+}
+
+template<bool Statistics>
+SCWX_TARGET_AVX2 static GateStatistics
+SwapBytes16Avx2(const std::uint8_t* src,
+                std::uint16_t*      dst,
+                std::size_t         count,
+                std::uint16_t       threshold)
+{
+   static constexpr std::size_t kLanes = 16u;
+
+   alignas(32) static constexpr std::uint8_t kShuffle[32] = {
+      1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+      1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14};
+
+   const __m256i shuffle =
+      _mm256_load_si256(reinterpret_cast<const __m256i*>(kShuffle));
+   const __m256i thresholds =
+      _mm256_set1_epi16(static_cast<short>(threshold));
+   __m256i     max        = _mm256_setzero_si256();
+   std::size_t validGates = 0;
+
+   std::size_t i = 0;
+   for (; i + kLanes <= count; i += kLanes)
+   {
+      __m256i v =
+         _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * 2));
+      v = _mm256_shuffle_epi8(v, shuffle);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), v);
+
+      if constexpr (Statistics)
+      {
+         max = _mm256_max_epu16(max, v);
+         validGates +=
+            std::popcount(static_cast<unsigned>(_mm256_movemask_epi8(
+               _mm256_cmpeq_epi16(_mm256_max_epu16(v, thresholds), v)))) /
+            2u;
+      }
+   }
+
+   GateStatistics statistics {};
+
+   if constexpr (Statistics)
+   {
+      alignas(32) std::uint16_t lanes[kLanes];
+      _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), max);
+
+      statistics.maxValue_   = *std::max_element(lanes, lanes + kLanes);
+      statistics.validGates_ = validGates;
+   }
+
+   return MergeTail<Statistics>(
+      statistics, src + i * 2, dst + i, count - i, threshold);
+}
+
+static bool SupportsAvx2()
+{
+#   if defined(_MSC_VER)
+   int info[4];
+
+   __cpuid(info, 0);
+   if (info[0] < 7)
+   {
+      return false;
+   }
+
+   // AVX and OS support for saving YMM registers
+   __cpuid(info, 1);
+   if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0 ||
+       (_xgetbv(0) & 0x6) != 0x6)
+   {
+      return false;
+   }
+
+   __cpuidex(info, 7, 0);
+   return (info[1] & (1 << 5)) != 0;
+#   else
+   return __builtin_cpu_supports("avx2");
+#   endif
+}
+
+#elif defined(SCWX_BYTE_SWAP_NEON)
+
+template<bool Statistics>
+static GateStatistics SwapBytes16Neon(const std::uint8_t* src,
+                                      std::uint16_t*      dst,
+                                      std::size_t         count,
+                                      std::uint16_t       threshold)
+{
+   static constexpr std::size_t kLanes = 8u;
+
+   const uint16x8_t thresholds = vdupq_n_u16(threshold);
+   uint16x8_t       max        = vdupq_n_u16(0);
+   std::size_t      validGates = 0;
+
+   std::size_t i = 0;
+   for (; i + kLanes <= count; i += kLanes)
+   {
+      uint16x8_t v = vreinterpretq_u16_u8(vrev16q_u8(vld1q_u8(src + i * 2)));
+      vst1q_u16(dst + i, v);
+
+      if constexpr (Statistics)
+      {
+         max = vmaxq_u16(max, v);
+         validGates +=
+            vaddvq_u16(vshrq_n_u16(vcgeq_u16(v, thresholds), 15));
+      }
+   }
+
+   GateStatistics statistics {};
+
+   if constexpr (Statistics)
+   {
+      statistics.maxValue_   = vmaxvq_u16(max);
+      statistics.validGates_ = validGates;
+   }
+
+   return MergeTail<Statistics>(
+      statistics, src + i * 2, dst + i, count - i, threshold);
+}
+
+#endif
+
+template<bool Statistics>
+static SwapBytes16Function SelectSwapBytes16()
+{
+#if defined(SCWX_BYTE_SWAP_X86)
+   if (SupportsAvx2())
+   {
+      logger_->debug("Using AVX2 byte swap");
+      return &SwapBytes16Avx2<Statistics>;
+   }
+
+   logger_->debug("Using SSE2 byte swap");
+   return &SwapBytes16Sse2<Statistics>;
+#elif defined(SCWX_BYTE_SWAP_NEON)
+   if constexpr (std::endian::native == std::endian::little)
+   {
+      logger_->debug("Using NEON byte swap");
+      return &SwapBytes16Neon<Statistics>;
+   }
+
+   logger_->debug("Using scalar byte swap");
+   return &SwapBytes16Scalar<Statistics>;
+#else
+   logger_->debug("Using scalar byte swap");
+   return &SwapBytes16Scalar<Statistics>;
+#endif
+}
+
+void SwapBytes16(const void* src, std::uint16_t* dst, std::size_t count)
+{
+   static const SwapBytes16Function swapBytes16 = SelectSwapBytes16<false>();
+
+   swapBytes16(static_cast<const std::uint8_t*>(src), dst, count, 0u);
+}
+
+GateStatistics SwapBytes16(const void*    src,
+                           std::uint16_t* dst,
+                           std::size_t    count,
+                           std::uint16_t  threshold)
+{
+   static const SwapBytes16Function swapBytes16 = SelectSwapBytes16<true>();
+
+   return swapBytes16(
+      static_cast<const std::uint8_t*>(src), dst, count, threshold);
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,319 @@
+#include <scwx/util/decompress.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <string_view>
+
+#include <bzlib.h>
+#include <zlib.h>
+
+namespace scwx
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::util::decompress";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+// Initial output size, as a multiple of the compressed size, when no size hint
+// is provided
+static constexpr std::size_t kDecompressedSizeEstimate_ = 8u;
+static constexpr std::size_t kMinOutputSize_            = 64u * 1024u;
+
+// Pool limits
+static constexpr std::size_t kMaxPoolBuffers_    = 64u;
+static constexpr std::size_t kMaxPoolSize_       = 256u * 1024u * 1024u;
+static constexpr std::size_t kMaxPoolBufferSize_ = 64u * 1024u * 1024u;
+
+class DecompressBufferPool::Impl
+{
+public:
+   explicit Impl() {}
+   ~Impl() = default;
+
+   std::mutex                     mutex_ {};
+   std::vector<std::vector<char>> buffers_ {};
+   std::size_t                    poolSize_ {0};
+};
+
+DecompressBufferPool::DecompressBufferPool() : p(std::make_unique<Impl>()) {}
+DecompressBufferPool::~DecompressBufferPool() = default;
+
+DecompressBufferPool::DecompressBufferPool(DecompressBufferPool&&) noexcept =
+   default;
+DecompressBufferPool&
+DecompressBufferPool::operator=(DecompressBufferPool&&) noexcept = default;
+
+std::vector<char> DecompressBufferPool::Acquire(std::size_t sizeHint)
+{
+   std::vector<char> buffer {};
+
+   {
+      std::unique_lock lock {p->mutex_};
+
+      // Select the smallest buffer with sufficient capacity
+      auto it = p->buffers_.end();
+      for (auto candidate = p->buffers_.begin();
+           candidate != p->buffers_.end();
+           ++candidate)
+      {
+         if (candidate->capacity() >= sizeHint &&
+             (it == p->buffers_.end() ||
+              candidate->capacity() < it->capacity()))
+         {
+            it = candidate;
+         }
+      }
+
+      if (it != p->buffers_.end())
+      {
+         p->poolSize_ -= it->capacity();
+         buffer = std::move(*it);
+         p->buffers_.erase(it);
+      }
+   }
+
+   buffer.clear();
+   buffer.reserve(sizeHint);
+
+   return buffer;
+}
+
+void DecompressBufferPool::Release(std::vector<char>&& buffer)
+{
+   const std::size_t capacity = buffer.capacity();
+
+   if (capacity == 0 || capacity > kMaxPoolBufferSize_)
+   {
+      return;
+   }
+
+   std::unique_lock lock {p->mutex_};
+
+   if (p->buffers_.size() < kMaxPoolBuffers_ &&
+       p->poolSize_ + capacity <= kMaxPoolSize_)
+   {
+      p->poolSize_ += capacity;
+      p->buffers_.push_back(std::move(buffer));
+   }
+}
+
+std::shared_ptr<std::vector<char>>
+DecompressBufferPool::MakeShared(std::vector<char>&& buffer)
+{
+   std::weak_ptr<DecompressBufferPool> pool = weak_from_this();
+
+   return std::shared_ptr<std::vector<char>>(
+      new std::vector<char>(std::move(buffer)),
+      [pool](std::vector<char>* buffer)
+      {
+         // The pool may have been destroyed before the buffer
+         if (auto lockedPool = pool.lock(); lockedPool != nullptr)
+         {
+            lockedPool->Release(std::move(*buffer));
+         }
+         delete buffer;
+      });
+}
+
+std::shared_ptr<DecompressBufferPool> DecompressBufferPool::Instance()
+{
+   static std::shared_ptr<DecompressBufferPool> instance_ =
+      std::make_shared<DecompressBufferPool>();
+
+   return instance_;
+}
+
+static std::size_t
+InitialOutputSize(std::size_t inputSize, std::size_t sizeHint)
+{
+   return (sizeHint > 0) ?
+             sizeHint :
+             std::max(inputSize * kDecompressedSizeEstimate_, kMinOutputSize_);
+}
+
+static void GrowOutput(std::vector<char>& output)
+{
+   output.resize(std::max(output.size() * 2, kMinOutputSize_));
+}
+
+static unsigned int ClampAvailable(std::size_t size)
+{
+   return static_cast<unsigned int>(
+      std::min<std::size_t>(size, std::numeric_limits<unsigned int>::max()));
+}
+
+bool DecompressBzip2(std::span<const char> input,
+                     std::vector<char>&    output,
+                     std::size_t           sizeHint)
+{
+   const std::size_t initialSize = output.size();
+   std::size_t       outputSize  = initialSize;
+   std::size_t       inputOffset = 0;
+   bool              dataValid   = true;
+
+   output.resize(initialSize + InitialOutputSize(input.size(), sizeHint));
+
+   // Decompress each concatenated stream, ignoring any trailing data
+   while (dataValid && inputOffset < input.size() &&
+          std::string_view(input.data() + inputOffset,
+                           input.size() - inputOffset)
+             .starts_with("BZh"))
+   {
+      bz_stream stream {};
+
+      int result = BZ2_bzDecompressInit(&stream, 0, 0);
+      if (result != BZ_OK)
+      {
+         logger_->warn("Error initializing bzip2 decompressor: {}", result);
+         dataValid = false;
+         break;
+      }
+
+      while (result == BZ_OK)
+      {
+         if (outputSize == output.size())
+         {
+            GrowOutput(output);
+         }
+
+         char* nextIn  = const_cast<char*>(input.data() + inputOffset);
+         char* nextOut = output.data() + outputSize;
+
+         stream.next_in   = nextIn;
+         stream.avail_in  = ClampAvailable(input.size() - inputOffset);
+         stream.next_out  = nextOut;
+         stream.avail_out = ClampAvailable(output.size() - outputSize);
+
+         result = BZ2_bzDecompress(&stream);
+
+         inputOffset += static_cast<std::size_t>(stream.next_in - nextIn);
+         outputSize += static_cast<std::size_t>(stream.next_out - nextOut);
+
+         if (result == BZ_OK && stream.avail_in == 0 && stream.avail_out > 0)
+         {
+            // No further input is available
+            result = BZ_UNEXPECTED_EOF;
+         }
+      }
+
+      BZ2_bzDecompressEnd(&stream);
+
+      if (result != BZ_STREAM_END)
+      {
+         logger_->warn("Error decompressing bzip2 stream: {}", result);
+         dataValid = false;
+      }
+   }
+
+   if (inputOffset == 0)
+   {
+      logger_->warn("Input is not a bzip2 stream");
+      dataValid = false;
+   }
+
+   output.resize(dataValid ? outputSize : initialSize);
+
+   return dataValid;
+}
+
+bool DecompressZlib(std::span<const char> input,
+                    std::vector<char>&    output,
+                    ZlibFormat            format,
+                    std::size_t           sizeHint,
+                    std::size_t*          bytesConsumed)
+{
+   static constexpr std::size_t kGzipTrailerSize = 8u;
+   static constexpr int         kWindowBits      = 15;
+   static constexpr int         kGzipWindowBits  = kWindowBits + 16;
+
+   const std::size_t initialSize = output.size();
+   std::size_t       outputSize  = initialSize;
+   std::size_t       inputOffset = 0;
+   bool              dataValid   = true;
+
+   if (sizeHint == 0 && format == ZlibFormat::Gzip &&
+       input.size() > kGzipTrailerSize)
+   {
+      // The gzip trailer records the uncompressed size (modulo 2^32) in
+      // little-endian order
+      const auto* trailer =
+         reinterpret_cast<const std::uint8_t*>(input.data() + input.size());
+      sizeHint = static_cast<std::size_t>(trailer[-4]) |
+                 static_cast<std::size_t>(trailer[-3]) << 8 |
+                 static_cast<std::size_t>(trailer[-2]) << 16 |
+                 static_cast<std::size_t>(trailer[-1]) << 24;
+   }
+
+   output.resize(initialSize + InitialOutputSize(input.size(), sizeHint));
+
+   do
+   {
+      z_stream stream {};
+
+      int result = inflateInit2(
+         &stream, (format == ZlibFormat::Gzip) ? kGzipWindowBits : kWindowBits);
+      if (result != Z_OK)
+      {
+         logger_->warn("Error initializing zlib decompressor: {}", result);
+         dataValid = false;
+         break;
+      }
+
+      while (result == Z_OK)
+      {
+         if (outputSize == output.size())
+         {
+            GrowOutput(output);
+         }
+
+         auto* nextIn = reinterpret_cast<Bytef*>(
+            const_cast<char*>(input.data() + inputOffset));
+         auto* nextOut = reinterpret_cast<Bytef*>(output.data() + outputSize);
+
+         stream.next_in   = nextIn;
+         stream.avail_in  = ClampAvailable(input.size() - inputOffset);
+         stream.next_out  = nextOut;
+         stream.avail_out = ClampAvailable(output.size() - outputSize);
+
+         result = inflate(&stream, Z_NO_FLUSH);
+
+         inputOffset += static_cast<std::size_t>(stream.next_in - nextIn);
+         outputSize += static_cast<std::size_t>(stream.next_out - nextOut);
+
+         if (result == Z_BUF_ERROR && stream.avail_out == 0)
+         {
+            // The output buffer is full, continue after growing
+            result = Z_OK;
+         }
+      }
+
+      inflateEnd(&stream);
+
+      if (result != Z_STREAM_END)
+      {
+         logger_->warn("Error decompressing zlib stream: {}", result);
+         dataValid = false;
+      }
+
+      // Continue with the next gzip member, if present
+   } while (dataValid && format == ZlibFormat::Gzip &&
+            inputOffset + 1 < input.size() &&
+            static_cast<std::uint8_t>(input[inputOffset]) == 0x1f &&
+            static_cast<std::uint8_t>(input[inputOffset + 1]) == 0x8b);
+
+   output.resize(dataValid ? outputSize : initialSize);
+
+   if (bytesConsumed != nullptr)
+   {
+      *bytesConsumed = inputOffset;
+   }
+
+   return dataValid;
+}
+
+} // namespace util
+} // namespace scwx
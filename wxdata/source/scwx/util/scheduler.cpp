@@ -0,0 +1,388 @@
+#include <scwx/util/scheduler.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+
+namespace scwx
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::util::scheduler";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+static constexpr std::size_t kPriorityCount_ =
+   static_cast<std::size_t>(TaskPriority::Background) + 1u;
+static constexpr std::size_t kMinThreadCount_ = 4u;
+
+/**
+ * @brief Process-wide scheduler, running the tasks of every task group on a
+ * shared pool of threads. Tasks are held in a queue per priority, guarded by a
+ * single mutex. Each submitted task posts a token to the pool, and each token
+ * runs the oldest eligible task of the highest priority. Decode tasks are
+ * limited to three quarters of the threads, so that a volume decode cannot
+ * hold interactive tasks until it completes. Network and background tasks are
+ * limited to a smaller share of the threads, so that tasks waiting on them
+ * cannot starve the threads needed to complete them. A task of a serial group
+ * is not eligible while another task of the group is running.
+ */
+class Scheduler
+{
+public:
+   explicit Scheduler() :
+       threadCount_ {std::max<std::size_t>(std::thread::hardware_concurrency(),
+                                           kMinThreadCount_)},
+       limits_ {threadCount_,
+                std::max<std::size_t>(threadCount_ * 3u / 4u, 1u),
+                std::max<std::size_t>(threadCount_ / 2u, 2u),
+                std::max<std::size_t>(threadCount_ / 4u, 1u)},
+       pool_ {threadCount_}
+   {
+      logger_->debug("Scheduling tasks on {} threads", threadCount_);
+   }
+   ~Scheduler() { pool_.join(); }
+
+   Scheduler(const Scheduler&)            = delete;
+   Scheduler& operator=(const Scheduler&) = delete;
+
+   static Scheduler& Instance();
+
+   boost::asio::execution_context& context() { return pool_; }
+
+   void Submit(const std::shared_ptr<detail::TaskState>& state,
+               std::unique_ptr<detail::Task>             task);
+
+private:
+   struct QueuedTask
+   {
+      std::shared_ptr<detail::TaskState> state_;
+      std::unique_ptr<detail::Task>      task_;
+   };
+
+   void PostToken();
+   void RunNext();
+
+   const std::size_t                              threadCount_;
+   const std::array<std::size_t, kPriorityCount_> limits_;
+
+   std::mutex                                          mutex_ {};
+   std::array<std::deque<QueuedTask>, kPriorityCount_> queues_ {};
+   std::array<std::size_t, kPriorityCount_>            running_ {};
+   std::unordered_set<const detail::TaskState*>        runningSerial_ {};
+
+   boost::asio::thread_pool pool_;
+};
+
+class detail::TaskState::Impl
+{
+public:
+   explicit Impl(TaskPriority priority, bool serial) :
+       priority_ {priority}, serial_ {serial}
+   {
+   }
+   ~Impl() = default;
+
+   Impl(const Impl&)            = delete;
+   Impl& operator=(const Impl&) = delete;
+
+   const TaskPriority priority_;
+   const bool         serial_;
+   std::atomic<bool>  stopped_ {false};
+
+   std::mutex              mutex_ {};
+   std::condition_variable condition_ {};
+   std::size_t             outstandingWork_ {0u};
+};
+
+Scheduler& Scheduler::Instance()
+{
+   static Scheduler scheduler_ {};
+   return scheduler_;
+}
+
+void Scheduler::Submit(const std::shared_ptr<detail::TaskState>& state,
+                       std::unique_ptr<detail::Task>             task)
+{
+   const auto priority = static_cast<std::size_t>(state->priority());
+
+   state->WorkStarted();
+
+   {
+      std::unique_lock lock {mutex_};
+      queues_[priority].push_back({state, std::move(task)});
+   }
+
+   PostToken();
+}
+
+void Scheduler::PostToken()
+{
+   boost::asio::post(pool_, [this]() { RunNext(); });
+}
+
+void Scheduler::RunNext()
+{
+   std::size_t priority = 0u;
+   QueuedTask  next {};
+
+   {
+      std::unique_lock lock {mutex_};
+
+      // Select the oldest eligible task of the highest priority below its
+      // thread limit
+      std::deque<QueuedTask>::iterator it {};
+      for (; priority < kPriorityCount_; ++priority)
+      {
+         auto& queue = queues_[priority];
+         if (running_[priority] >= limits_[priority])
+         {
+            continue;
+         }
+
+         it = std::find_if(queue.begin(),
+                           queue.end(),
+                           [this](const QueuedTask& task)
+                           {
+                              const detail::TaskState* state =
+                                 task.state_.get();
+                              return !state->serial() ||
+                                     !runningSerial_.contains(state);
+                           });
+         if (it != queue.end())
+         {
+            break;
+         }
+      }
+
+      if (priority == kPriorityCount_)
+      {
+         // Another token has taken the task, or the task will be scheduled
+         // when a task of the same priority (or the same serial group)
+         // completes
+         return;
+      }
+
+      next = std::move(*it);
+      queues_[priority].erase(it);
+      ++running_[priority];
+
+      if (next.state_->serial())
+      {
+         runningSerial_.insert(next.state_.get());
+      }
+   }
+
+   if (!next.state_->stopped())
+   {
+      try
+      {
+         next.task_->Run();
+      }
+      catch (const std::exception& ex)
+      {
+         logger_->error("Uncaught exception in task: {}", ex.what());
+      }
+   }
+
+   // Destroy the task before completing its work, releasing any resources or
+   // outstanding work it holds
+   next.task_.reset();
+
+   bool pending = false;
+
+   {
+      std::unique_lock lock {mutex_};
+      --running_[priority];
+      runningSerial_.erase(next.state_.get());
+      pending = !queues_[priority].empty();
+   }
+
+   if (pending)
+   {
+      // A task of the same priority may have been held at the thread limit,
+      // or behind the completed task of a serial group
+      PostToken();
+   }
+
+   next.state_->WorkFinished();
+}
+
+detail::TaskState::TaskState(TaskPriority priority, bool serial) :
+    p(std::make_unique<Impl>(priority, serial))
+{
+}
+
+detail::TaskState::~TaskState() = default;
+
+TaskPriority detail::TaskState::priority() const
+{
+   return p->priority_;
+}
+
+bool detail::TaskState::serial() const
+{
+   return p->serial_;
+}
+
+bool detail::TaskState::stopped() const
+{
+   return p->stopped_;
+}
+
+void detail::TaskState::Stop()
+{
+   p->stopped_ = true;
+}
+
+void detail::TaskState::Wait()
+{
+   std::unique_lock lock {p->mutex_};
+   p->condition_.wait(lock, [this]() { return p->outstandingWork_ == 0u; });
+}
+
+void detail::TaskState::WorkStarted()
+{
+   std::unique_lock lock {p->mutex_};
+   ++p->outstandingWork_;
+}
+
+void detail::TaskState::WorkFinished()
+{
+   std::unique_lock lock {p->mutex_};
+   if (--p->outstandingWork_ == 0u)
+   {
+      p->condition_.notify_all();
+   }
+}
+
+void detail::Submit(const std::shared_ptr<TaskState>& state,
+                    std::unique_ptr<Task>             task)
+{
+   Scheduler::Instance().Submit(state, std::move(task));
+}
+
+boost::asio::execution_context& detail::SchedulerContext()
+{
+   return Scheduler::Instance().context();
+}
+
+TaskExecutor::TaskExecutor(std::shared_ptr<detail::TaskState> state,
+                           bool tracked) noexcept :
+    state_ {std::move(state)}, tracked_ {tracked}
+{
+   if (tracked_ && state_ != nullptr)
+   {
+      state_->WorkStarted();
+   }
+}
+
+TaskExecutor::~TaskExecutor()
+{
+   if (tracked_ && state_ != nullptr)
+   {
+      state_->WorkFinished();
+   }
+}
+
+TaskExecutor::TaskExecutor(const TaskExecutor& other) noexcept :
+    TaskExecutor(other.state_, other.tracked_)
+{
+}
+
+TaskExecutor::TaskExecutor(TaskExecutor&& other) noexcept :
+    state_ {std::move(other.state_)}, tracked_ {other.tracked_}
+{
+}
+
+TaskExecutor& TaskExecutor::operator=(const TaskExecutor& other) noexcept
+{
+   if (this != &other)
+   {
+      *this = TaskExecutor {other};
+   }
+   return *this;
+}
+
+TaskExecutor& TaskExecutor::operator=(TaskExecutor&& other) noexcept
+{
+   if (this != &other)
+   {
+      if (tracked_ && state_ != nullptr)
+      {
+         state_->WorkFinished();
+      }
+
+      state_   = std::move(other.state_);
+      tracked_ = other.tracked_;
+   }
+   return *this;
+}
+
+boost::asio::execution_context&
+TaskExecutor::query(boost::asio::execution::context_t) const noexcept
+{
+   return detail::SchedulerContext();
+}
+
+TaskGroup::TaskGroup(TaskPriority priority) :
+    state_ {std::make_shared<detail::TaskState>(priority, false)}
+{
+}
+
+TaskGroup::~TaskGroup()
+{
+   join();
+}
+
+TaskGroup::executor_type TaskGroup::get_executor() const noexcept
+{
+   return TaskExecutor {state_, false};
+}
+
+void TaskGroup::join()
+{
+   state_->Wait();
+}
+
+void TaskGroup::stop()
+{
+   state_->Stop();
+}
+
+TaskQueue::TaskQueue(TaskPriority priority) :
+    state_ {std::make_shared<detail::TaskState>(priority, true)}
+{
+}
+
+TaskQueue::~TaskQueue()
+{
+   join();
+}
+
+TaskQueue::executor_type TaskQueue::get_executor() const noexcept
+{
+   return TaskExecutor {state_, false};
+}
+
+void TaskQueue::join()
+{
+   state_->Wait();
+}
+
+void TaskQueue::stop()
+{
+   state_->Stop();
+}
+
+} // namespace util
+} // namespace scwx
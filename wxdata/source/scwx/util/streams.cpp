@@ -1,5 +1,7 @@
 #include <scwx/util/streams.hpp>
 
+#include <string>
+
 namespace scwx
 {
 namespace util
@@ -42,5 +44,46 @@ std::istream& getline(std::istream& is, std::string& t)
    }
 }
 
+std::size_t ReadRemaining(std::istream& is, std::vector<char>& buffer)
+{
+   static constexpr std::size_t kChunkSize = 64u * 1024u;
+
+   const std::size_t initialSize = buffer.size();
+   std::size_t       size        = initialSize;
+   std::size_t       readSize    = kChunkSize;
+
+   // Determine the remaining length, if the stream is seekable
+   const std::streampos position = is.tellg();
+   if (position != std::streampos {-1})
+   {
+      is.seekg(0, std::ios_base::end);
+      const std::streampos end = is.tellg();
+      is.seekg(position, std::ios_base::beg);
+
+      if (end != std::streampos {-1} && end > position)
+      {
+         readSize = static_cast<std::size_t>(end - position);
+      }
+   }
+
+   while (is.good())
+   {
+      buffer.resize(size + readSize);
+      is.read(buffer.data() + size, static_cast<std::streamsize>(readSize));
+      size += static_cast<std::size_t>(is.gcount());
+
+      if (is.good() && is.peek() == std::istream::traits_type::eof())
+      {
+         break;
+      }
+
+      readSize = kChunkSize;
+   }
+
+   buffer.resize(size);
+
+   return size - initialSize;
+}
+
 } // namespace util
 } // namespace scwx
@@ -1,13 +1,28 @@
 #include <scwx/wsr88d/ar2v_file.hpp>
+#include <scwx/wsr88d/detail/elevation_scan_index.hpp>
 #include <scwx/wsr88d/rda/digital_radar_data.hpp>
 #include <scwx/wsr88d/rda/level2_message_factory.hpp>
+#include <scwx/wsr88d/rda/packed_elevation_scan.hpp>
 #include <scwx/wsr88d/rda/rda_types.hpp>
+#include <scwx/util/byte_cursor.hpp>
+#include <scwx/util/decompress.hpp>
 #include <scwx/util/logger.hpp>
-#include <scwx/util/rangebuf.hpp>
 #include <scwx/util/time.hpp>
 
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <execution>
+#include <filesystem>
 #include <fstream>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <shared_mutex>
+#include <span>
 #include <sstream>
+#include <unordered_map>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -20,9 +35,9 @@
 #endif
 
 #include <boost/algorithm/string/trim.hpp>
-#include <boost/iostreams/copy.hpp>
-#include <boost/iostreams/filtering_streambuf.hpp>
-#include <boost/iostreams/filter/bzip2.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <boost/uuid/uuid_generators.hpp>
+#include <boost/uuid/uuid_io.hpp>
 #include <fmt/chrono.h>
 
 #if defined(__GNUC__)
@@ -41,19 +56,90 @@ namespace wsr88d
 static const std::string logPrefix_ = "scwx::wsr88d::ar2v_file";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
+// Initial decompressed buffer size, as a multiple of the compressed record
+// size. Radial records typically decompress to 5-10x their compressed size.
+static constexpr std::size_t kDecompressedSizeEstimate_ = 8u;
+
+// Decoded volume cache format. The version is incremented whenever the layout
+// of the cache, or of a packed elevation scan, changes.
+static const std::string      kCacheMagic_ {"SCWXAR2C"};
+static constexpr std::uint32_t kCacheVersion_          = 1u;
+static constexpr std::uint32_t kCacheFlagCompressed_   = 0x1u;
+static constexpr std::uint32_t kCacheFlagLittleEndian_ = 0x2u;
+
+// Coded elevation angles are in units of 0.043945 / 8 degrees
+static constexpr float kElevationScaleFactor_ = 8.0f / 0.043945f;
+
+static std::vector<char>
+DecompressLDMRecord(const std::vector<char>& compressedRecord);
+
+static bool IsMetadataMessage(std::uint8_t messageType);
+
+/**
+ * Retains the compressed LDM records, so moment data can be decompressed on
+ * demand after the decompressed records have been released. Records may be
+ * added while moments are being decoded.
+ */
+class LdmRecordSource : public rda::PackedElevationScan::RecordSource
+{
+public:
+   explicit LdmRecordSource() = default;
+   ~LdmRecordSource()         = default;
+
+   std::optional<rda::PackedElevationScan::MomentLocation>
+   Locate(const void* data, std::size_t size) const override;
+   std::vector<char> Decode(std::size_t recordIndex) const override;
+
+   void AddRecords(
+      std::vector<std::vector<char>>&&                       compressedRecords,
+      const std::vector<std::shared_ptr<std::vector<char>>>& records);
+   void PruneDecompressedRecords();
+
+private:
+   struct RecordRange
+   {
+      std::uintptr_t                         begin;
+      std::size_t                            size;
+      std::size_t                            recordIndex;
+      std::weak_ptr<const std::vector<char>> record;
+   };
+
+   mutable std::shared_mutex mutex_ {};
+
+   std::vector<std::vector<char>> compressedRecords_ {};
+   std::vector<RecordRange>       decompressedRecords_ {};
+};
+
 class Ar2vFileImpl
 {
 public:
    explicit Ar2vFileImpl() {};
    ~Ar2vFileImpl() = default;
 
+   struct ParsedRecord
+   {
+      std::vector<std::shared_ptr<rda::Level2Message>> messages_ {};
+      std::vector<char>                                vcpMessage_ {};
+      std::size_t                                      skippedMessages_ {0};
+   };
+
    std::size_t DecompressLDMRecords(std::istream& is);
    void        HandleMessage(std::shared_ptr<rda::Level2Message>& message);
+   void        HandleRecord(ParsedRecord& parsedRecord);
    void        IndexFile();
+   void        BuildScanIndex();
    void        ParseLDMRecords();
-   void        ParseLDMRecord(std::istream& is);
+   bool        ReadVolumeHeader(std::istream& is);
+   void        SetDecodeFilter(const Ar2vDecodeFilter& filter);
+
+   static ParsedRecord
+   ParseLDMRecord(std::span<const std::byte>         record,
+                  const std::shared_ptr<const void>& buffer,
+                  const Ar2vDecodeFilter&            filter);
    void ProcessRadarData(const std::shared_ptr<rda::GenericRadarData>& message);
 
+   Ar2vDecodeFilter filter_ {};
+
    std::string   tapeFilename_ {};
    std::string   extensionNumber_ {};
    std::uint32_t julianDate_ {0};
@@ -63,15 +149,50 @@ public:
    std::size_t messageCount_ {0};
 
    std::shared_ptr<rda::VolumeCoveragePatternData>              vcpData_ {};
+   std::vector<char>                                            vcpMessage_ {};
    std::map<std::uint16_t, std::shared_ptr<rda::ElevationScan>> radarData_ {};
+   std::map<std::uint16_t, std::shared_ptr<rda::PackedElevationScan>>
+      packedData_ {};
 
    std::map<rda::DataBlockType,
             std::map<std::uint16_t,
                      std::map<std::chrono::system_clock::time_point,
-                              std::shared_ptr<rda::ElevationScan>>>>
+                              std::shared_ptr<rda::PackedElevationScan>>>>
       index_ {};
 
-   std::list<std::stringstream> rawRecords_ {};
+   /**
+    * Sorted view of the index for a single moment, rebuilt whenever the index
+    * changes. Scans are located by binary search rather than by walking the
+    * index maps.
+    */
+   struct MomentScanIndex
+   {
+      // Coded elevation angles, in ascending order, with the corresponding
+      // elevation cuts in degrees
+      std::vector<std::uint16_t> codedElevations_ {};
+      std::vector<float>         elevationCuts_ {};
+
+      // Scans of each elevation, in ascending time order, with scan times
+      // floored to seconds
+      std::vector<std::vector<std::chrono::system_clock::time_point>>
+         scanTimes_ {};
+      std::vector<std::vector<std::shared_ptr<rda::PackedElevationScan>>>
+         scans_ {};
+   };
+
+   std::unordered_map<rda::DataBlockType, MomentScanIndex> scanIndex_ {};
+
+   std::vector<std::shared_ptr<std::vector<char>>> rawRecords_ {};
+   std::shared_ptr<LdmRecordSource>                recordSource_ {};
+
+   // Elevations receiving radials since the last index, and since the last
+   // append
+   std::set<std::uint16_t>    dirtyElevations_ {};
+   std::vector<std::uint16_t> updatedElevations_ {};
+   bool                       appendingChunks_ {false};
+
+   // Guards the indexed data against concurrent appends
+   mutable std::shared_mutex dataMutex_ {};
 };
 
 Ar2vFile::Ar2vFile() : p(std::make_unique<Ar2vFileImpl>()) {}
@@ -109,13 +230,18 @@ std::chrono::system_clock::time_point Ar2vFile::end_time() const
 {
    std::chrono::system_clock::time_point endTime {};
 
-   if (p->radarData_.size() > 0)
+   std::shared_lock lock {p->dataMutex_};
+
+   if (p->packedData_.size() > 0)
    {
-      std::shared_ptr<rda::GenericRadarData> lastRadial =
-         p->radarData_.crbegin()->second->crbegin()->second;
+      const rda::PackedElevationScan::RadialHeader* lastRadial =
+         p->packedData_.crbegin()->second->last_radial_header();
 
-      endTime = util::TimePoint(lastRadial->modified_julian_date(),
-                                lastRadial->collection_time());
+      if (lastRadial != nullptr)
+      {
+         endTime = util::TimePoint(lastRadial->modifiedJulianDate,
+                                   lastRadial->collectionTime);
+      }
    }
 
    return endTime;
@@ -124,80 +250,104 @@ std::chrono::system_clock::time_point Ar2vFile::end_time() const
 std::map<std::uint16_t, std::shared_ptr<rda::ElevationScan>>
 Ar2vFile::radar_data() const
 {
-   return p->radarData_;
+   std::map<std::uint16_t, std::shared_ptr<rda::ElevationScan>> radarData {};
+
+   std::set<rda::DataBlockType> dataBlockTypes {};
+   for (rda::DataBlockType dataBlockType : rda::MomentDataBlockTypeIterator())
+   {
+      dataBlockTypes.insert(dataBlockType);
+   }
+
+   std::shared_lock lock {p->dataMutex_};
+
+   for (auto& [elevationIndex, packedScan] : p->packedData_)
+   {
+      packedScan->LoadMoments(dataBlockTypes);
+
+      radarData.emplace(elevationIndex, packedScan->CreateElevationScan());
+   }
+
+   return radarData;
 }
 
 std::shared_ptr<const rda::VolumeCoveragePatternData> Ar2vFile::vcp_data() const
 {
+   std::shared_lock lock {p->dataMutex_};
    return p->vcpData_;
 }
 
+std::vector<std::uint16_t> Ar2vFile::updated_elevations() const
+{
+   std::shared_lock lock {p->dataMutex_};
+   return p->updatedElevations_;
+}
+
 std::tuple<std::shared_ptr<rda::ElevationScan>, float, std::vector<float>>
 Ar2vFile::GetElevationScan(rda::DataBlockType                    dataBlockType,
                            float                                 elevation,
                            std::chrono::system_clock::time_point time) const
 {
-   logger_->debug("GetElevationScan: {} degrees", elevation);
-
-   constexpr float scaleFactor = 8.0f / 0.043945f;
-
    std::shared_ptr<rda::ElevationScan> elevationScan = nullptr;
-   float                               elevationCut  = 0.0f;
-   std::vector<float>                  elevationCuts;
 
-   std::uint16_t codedElevation =
-      static_cast<std::uint16_t>(std::lroundf(elevation * scaleFactor));
+   auto [packedScan, elevationCut, elevationCuts] =
+      GetPackedElevationScan(dataBlockType, elevation, time);
 
-   if (p->index_.contains(dataBlockType))
+   if (packedScan != nullptr)
    {
-      auto& scans = p->index_.at(dataBlockType);
+      elevationScan = packedScan->CreateElevationScan();
+   }
 
-      std::uint16_t lowerBound = scans.cbegin()->first;
-      std::uint16_t upperBound = scans.crbegin()->first;
+   return {elevationScan, elevationCut, elevationCuts};
+}
 
-      // Find closest elevation match
-      for (auto& scan : scans)
-      {
-         if (scan.first > lowerBound && scan.first <= codedElevation)
-         {
-            lowerBound = scan.first;
-         }
-         if (scan.first < upperBound && scan.first >= codedElevation)
-         {
-            upperBound = scan.first;
-         }
+std::tuple<std::shared_ptr<const rda::PackedElevationScan>,
+           float,
+           std::vector<float>>
+Ar2vFile::GetPackedElevationScan(
+   rda::DataBlockType                    dataBlockType,
+   float                                 elevation,
+   std::chrono::system_clock::time_point time) const
+{
+   logger_->debug("GetPackedElevationScan: {} degrees", elevation);
 
-         elevationCuts.push_back(scan.first / scaleFactor);
-      }
+   constexpr float scaleFactor = kElevationScaleFactor_;
+
+   std::shared_ptr<rda::PackedElevationScan> elevationScan = nullptr;
+   float                                     elevationCut  = 0.0f;
+   std::vector<float>                        elevationCuts;
+
+   std::uint16_t codedElevation =
+      static_cast<std::uint16_t>(std::lroundf(elevation * scaleFactor));
 
-      std::int32_t lowerDelta =
-         std::abs(static_cast<std::int32_t>(codedElevation) -
-                  static_cast<std::int32_t>(lowerBound));
-      std::int32_t upperDelta =
-         std::abs(static_cast<std::int32_t>(codedElevation) -
-                  static_cast<std::int32_t>(upperBound));
+   std::shared_lock lock {p->dataMutex_};
 
-      // Select closest elevation match
-      std::uint16_t elevationIndex =
-         (lowerDelta < upperDelta) ? lowerBound : upperBound;
-      elevationCut = elevationIndex / scaleFactor;
+   auto momentIt = p->scanIndex_.find(dataBlockType);
+   if (momentIt != p->scanIndex_.cend())
+   {
+      const auto& moment = momentIt->second;
 
-      // Select closest time match, not newer than the selected time
-      std::chrono::system_clock::time_point foundTime {};
-      auto& elevationScans = scans.at(elevationIndex);
+      const auto [i, j] = detail::SelectElevationScan(
+         moment.codedElevations_, moment.scanTimes_, codedElevation, time);
 
-      for (auto& scan : elevationScans)
-      {
-         auto scanTime = std::chrono::floor<std::chrono::seconds>(scan.first);
+      elevationCuts = moment.elevationCuts_;
+      elevationCut  = moment.codedElevations_[i] / scaleFactor;
+      elevationScan = moment.scans_[i][j];
+   }
 
-         if (elevationScan == nullptr ||
-             ((scanTime <= time ||
-               time == std::chrono::system_clock::time_point {}) &&
-              scanTime > foundTime))
-         {
-            elevationScan = scan.second;
-            foundTime     = scanTime;
-         }
+   lock.unlock();
+
+   if (elevationScan != nullptr)
+   {
+      // Moment data is decoded on first use. Reflectivity is displayed along
+      // with clutter filter power removed.
+      if (dataBlockType == rda::DataBlockType::MomentRef)
+      {
+         elevationScan->LoadMoments(
+            {dataBlockType, rda::DataBlockType::MomentCfp});
+      }
+      else
+      {
+         elevationScan->LoadMoment(dataBlockType);
       }
    }
 
@@ -205,6 +355,12 @@ Ar2vFile::GetElevationScan(rda::DataBlockType                    dataBlockType,
 }
 
 bool Ar2vFile::LoadFile(const std::string& filename)
+{
+   return LoadFile(filename, {});
+}
+
+bool Ar2vFile::LoadFile(const std::string&      filename,
+                        const Ar2vDecodeFilter& filter)
 {
    logger_->debug("LoadFile: {}", filename);
    bool fileValid = true;
@@ -218,57 +374,93 @@ bool Ar2vFile::LoadFile(const std::string& filename)
 
    if (fileValid)
    {
-      fileValid = LoadData(f);
+      fileValid = LoadData(f, filter);
    }
 
    return fileValid;
 }
 
 bool Ar2vFile::LoadData(std::istream& is)
+{
+   return LoadData(is, {});
+}
+
+bool Ar2vFile::LoadData(std::istream& is, const Ar2vDecodeFilter& filter)
 {
    logger_->debug("Loading Data");
 
-   bool dataValid = true;
+   p->SetDecodeFilter(filter);
 
-   // Read Volume Header Record
-   p->tapeFilename_.resize(9, ' ');
-   p->extensionNumber_.resize(3, ' ');
-   p->icao_.resize(4, ' ');
+   bool dataValid = p->ReadVolumeHeader(is);
 
-   is.read(&p->tapeFilename_[0], 9);
-   is.read(&p->extensionNumber_[0], 3);
-   is.read(reinterpret_cast<char*>(&p->julianDate_), 4);
-   is.read(reinterpret_cast<char*>(&p->milliseconds_), 4);
-   is.read(&p->icao_[0], 4);
+   if (dataValid)
+   {
+      size_t decompressedRecords = p->DecompressLDMRecords(is);
+      if (decompressedRecords == 0)
+      {
+         // The remainder of the file is uncompressed message data
+         auto record = std::make_shared<std::vector<char>>(
+            std::istreambuf_iterator<char>(is),
+            std::istreambuf_iterator<char>());
+
+         auto parsedRecord = p->ParseLDMRecord(
+            std::as_bytes(std::span(*record)), record, p->filter_);
+         p->HandleRecord(parsedRecord);
+      }
+      else
+      {
+         p->ParseLDMRecords();
+      }
+   }
 
-   p->julianDate_   = ntohl(p->julianDate_);
-   p->milliseconds_ = ntohl(p->milliseconds_);
+   p->IndexFile();
 
-   if (is.eof())
+   return dataValid;
+}
+
+bool Ar2vFile::AppendChunkFile(const std::string& filename)
+{
+   logger_->debug("AppendChunkFile: {}", filename);
+   bool fileValid = true;
+
+   std::ifstream f(filename, std::ios_base::in | std::ios_base::binary);
+   if (!f.good())
    {
-      logger_->warn("Could not read Volume Header Record");
-      dataValid = false;
+      logger_->warn("Could not open file for reading: {}", filename);
+      fileValid = false;
    }
 
-   // Trim spaces and null characters from the end of the ICAO
-   boost::trim_right_if(p->icao_,
-                        [](char x) { return std::isspace(x) || x == '\0'; });
-
-   if (dataValid)
+   if (fileValid)
    {
-      auto timePoint = util::TimePoint(p->julianDate_, p->milliseconds_);
+      fileValid = AppendChunk(f);
+   }
 
-      logger_->debug("Filename:  {}", p->tapeFilename_);
-      logger_->debug("Extension: {}", p->extensionNumber_);
-      logger_->debug("Date:      {} ({:%Y-%m-%d})", p->julianDate_, timePoint);
-      logger_->debug(
-         "Time:      {} ({:%H:%M:%S})", p->milliseconds_, timePoint);
-      logger_->debug("ICAO:      {}", p->icao_);
+   return fileValid;
+}
 
-      size_t decompressedRecords = p->DecompressLDMRecords(is);
+bool Ar2vFile::AppendChunk(std::istream& is)
+{
+   logger_->debug("Appending chunk");
+
+   bool dataValid = true;
+
+   p->appendingChunks_ = true;
+
+   // Only the start chunk begins with the Volume Header Record ("AR2V...").
+   // Other chunks begin with the control word of an LDM record, whose most
+   // significant byte is never 'A' for a valid record size.
+   if (is.peek() == 'A')
+   {
+      dataValid = p->ReadVolumeHeader(is);
+   }
+
+   if (dataValid)
+   {
+      std::size_t decompressedRecords = p->DecompressLDMRecords(is);
       if (decompressedRecords == 0)
       {
-         p->ParseLDMRecord(is);
+         logger_->warn("No LDM records found in chunk");
+         dataValid = false;
       }
       else
       {
@@ -281,11 +473,466 @@ bool Ar2vFile::LoadData(std::istream& is)
    return dataValid;
 }
 
+bool Ar2vFile::SaveCacheFile(const std::string& filename, bool compress) const
+{
+   logger_->debug("SaveCacheFile: {}", filename);
+
+   // Write to a temporary file unique to this save, so a partially written
+   // cache is never read, and concurrent saves do not share a file
+   const boost::uuids::uuid uuid = boost::uuids::random_generator()();
+   const std::string        tempFilename =
+      filename + "." + boost::uuids::to_string(uuid) + ".tmp";
+   bool              cacheValid   = false;
+
+   {
+      std::ofstream f(tempFilename, std::ios_base::out | std::ios_base::binary);
+      if (!f.good())
+      {
+         logger_->warn("Could not open file for writing: {}", tempFilename);
+         return false;
+      }
+
+      cacheValid = SaveCache(f, compress);
+   }
+
+   std::error_code ec;
+   if (cacheValid)
+   {
+      std::filesystem::rename(tempFilename, filename, ec);
+      if (ec)
+      {
+         logger_->warn("Could not rename cache file: {}", ec.message());
+         cacheValid = false;
+      }
+   }
+
+   if (!cacheValid)
+   {
+      std::filesystem::remove(tempFilename, ec);
+   }
+
+   return cacheValid;
+}
+
+bool Ar2vFile::SaveCache(std::ostream& os, bool compress) const
+{
+   std::shared_lock lock {p->dataMutex_};
+
+   // Elevation numbers of each packed scan, used to reference the scans from
+   // the index
+   std::unordered_map<const rda::PackedElevationScan*, std::uint16_t>
+      elevationIndices {};
+   for (auto& [elevationIndex, packedScan] : p->packedData_)
+   {
+      elevationIndices.emplace(packedScan.get(), elevationIndex);
+   }
+
+   std::uint32_t flags = 0u;
+   if (compress)
+   {
+      flags |= kCacheFlagCompressed_;
+   }
+   if constexpr (std::endian::native == std::endian::little)
+   {
+      flags |= kCacheFlagLittleEndian_;
+   }
+
+   // Header
+   os.write(kCacheMagic_.data(), kCacheMagic_.size());
+   util::WriteBytes(os, kCacheVersion_);
+   util::WriteBytes(os, flags);
+
+   // Volume Header Record
+   std::string icao {p->icao_};
+   icao.resize(4, ' ');
+   os.write(p->tapeFilename_.data(), 9);
+   os.write(p->extensionNumber_.data(), 3);
+   util::WriteBytes(os, p->julianDate_);
+   util::WriteBytes(os, p->milliseconds_);
+   os.write(icao.data(), 4);
+   util::WriteBytes(os, static_cast<std::uint64_t>(p->messageCount_));
+
+   // Volume Coverage Pattern Data
+   util::WriteBytes(os, static_cast<std::uint32_t>(p->vcpMessage_.size()));
+   os.write(p->vcpMessage_.data(),
+            static_cast<std::streamsize>(p->vcpMessage_.size()));
+
+   // Elevation scans
+   util::WriteBytes(os, static_cast<std::uint32_t>(p->packedData_.size()));
+   for (auto& [elevationIndex, packedScan] : p->packedData_)
+   {
+      util::WriteBytes(os, elevationIndex);
+      if (!packedScan->Write(os, compress))
+      {
+         logger_->warn("Could not write elevation scan: {}", elevationIndex);
+         return false;
+      }
+   }
+
+   // Index
+   std::uint32_t indexCount = 0u;
+   for (auto& scans : p->index_)
+   {
+      for (auto& elevationScans : scans.second)
+      {
+         indexCount += static_cast<std::uint32_t>(elevationScans.second.size());
+      }
+   }
+
+   util::WriteBytes(os, indexCount);
+   for (auto& [dataBlockType, scans] : p->index_)
+   {
+      for (auto& [elevationAngle, elevationScans] : scans)
+      {
+         for (auto& [time, packedScan] : elevationScans)
+         {
+            util::WriteBytes(os, static_cast<std::uint8_t>(dataBlockType));
+            util::WriteBytes(os, elevationAngle);
+            util::WriteBytes(
+               os,
+               static_cast<std::int64_t>(
+                  std::chrono::duration_cast<std::chrono::milliseconds>(
+                     time.time_since_epoch())
+                     .count()));
+            util::WriteBytes(os, elevationIndices.at(packedScan.get()));
+         }
+      }
+   }
+
+   return os.good();
+}
+
+bool Ar2vFile::LoadCacheFile(const std::string& filename)
+{
+   logger_->debug("LoadCacheFile: {}", filename);
+
+   boost::iostreams::mapped_file_source file {};
+
+   try
+   {
+      // Map read-only, the cache file is never modified
+      file.open(filename);
+   }
+   catch (const std::exception& ex)
+   {
+      logger_->warn("Could not map cache file: {}, {}", filename, ex.what());
+      return false;
+   }
+
+   return LoadCache(std::as_bytes(std::span(file.data(), file.size())));
+}
+
+bool Ar2vFile::LoadCache(std::span<const std::byte> data)
+{
+   util::ByteCursor cursor {data};
+
+   if (cursor.ReadString(kCacheMagic_.size()) != kCacheMagic_ ||
+       cursor.Read<std::uint32_t>() != kCacheVersion_)
+   {
+      logger_->warn("Unsupported cache format");
+      return false;
+   }
+
+   const std::uint32_t flags      = cursor.Read<std::uint32_t>();
+   const bool          compressed = (flags & kCacheFlagCompressed_) != 0;
+   const bool littleEndian        = (flags & kCacheFlagLittleEndian_) != 0;
+
+   if (littleEndian != (std::endian::native == std::endian::little))
+   {
+      logger_->warn("Cache byte order does not match");
+      return false;
+   }
+
+   // Volume Header Record
+   std::string   tapeFilename    = cursor.ReadString(9);
+   std::string   extensionNumber = cursor.ReadString(3);
+   std::uint32_t julianDate      = cursor.Read<std::uint32_t>();
+   std::uint32_t milliseconds    = cursor.Read<std::uint32_t>();
+   std::string   icao            = cursor.ReadString(4);
+   std::size_t   messageCount    = cursor.Read<std::uint64_t>();
+
+   boost::trim_right_if(icao,
+                        [](char x) { return std::isspace(x) || x == '\0'; });
+
+   // Volume Coverage Pattern Data
+   std::shared_ptr<rda::VolumeCoveragePatternData> vcpData {};
+   std::vector<char>                               vcpMessage {};
+
+   std::span<const std::byte> vcpBytes =
+      cursor.ReadBytes(cursor.Read<std::uint32_t>());
+   if (!vcpBytes.empty())
+   {
+      auto vcpBuffer = std::make_shared<std::vector<char>>(
+         reinterpret_cast<const char*>(vcpBytes.data()),
+         reinterpret_cast<const char*>(vcpBytes.data()) + vcpBytes.size());
+      auto ctx = rda::Level2MessageFactory::CreateContext();
+
+      rda::Level2MessageInfo msgInfo = rda::Level2MessageFactory::Create(
+         std::as_bytes(std::span(*vcpBuffer)), vcpBuffer, ctx);
+
+      vcpData = std::dynamic_pointer_cast<rda::VolumeCoveragePatternData>(
+         msgInfo.message);
+      if (vcpData == nullptr)
+      {
+         logger_->warn("Invalid cached VCP data");
+      }
+
+      vcpMessage = *vcpBuffer;
+   }
+
+   // Elevation scans
+   std::map<std::uint16_t, std::shared_ptr<rda::PackedElevationScan>>
+      packedData {};
+
+   const std::uint32_t scanCount = cursor.Read<std::uint32_t>();
+   for (std::uint32_t i = 0; i < scanCount && !cursor.fail(); ++i)
+   {
+      const std::uint16_t elevationIndex = cursor.Read<std::uint16_t>();
+
+      auto packedScan = rda::PackedElevationScan::Read(cursor, compressed);
+      if (packedScan == nullptr)
+      {
+         logger_->warn("Invalid cached elevation scan: {}", elevationIndex);
+         return false;
+      }
+
+      packedData[elevationIndex] = packedScan;
+   }
+
+   // Index
+   decltype(p->index_) index {};
+
+   const std::uint32_t indexCount = cursor.Read<std::uint32_t>();
+   for (std::uint32_t i = 0; i < indexCount && !cursor.fail(); ++i)
+   {
+      const auto dataBlockType =
+         static_cast<rda::DataBlockType>(cursor.Read<std::uint8_t>());
+      const std::uint16_t elevationAngle = cursor.Read<std::uint16_t>();
+      const std::chrono::system_clock::time_point time {
+         std::chrono::milliseconds {cursor.Read<std::int64_t>()}};
+      const std::uint16_t elevationIndex = cursor.Read<std::uint16_t>();
+
+      auto it = packedData.find(elevationIndex);
+      if (it == packedData.cend())
+      {
+         logger_->warn("Invalid cached index entry: {}", elevationIndex);
+         return false;
+      }
+
+      index[dataBlockType][elevationAngle][time] = it->second;
+   }
+
+   if (cursor.fail())
+   {
+      logger_->warn("Truncated cache data");
+      return false;
+   }
+
+   std::unique_lock lock {p->dataMutex_};
+
+   p->tapeFilename_    = std::move(tapeFilename);
+   p->extensionNumber_ = std::move(extensionNumber);
+   p->julianDate_      = julianDate;
+   p->milliseconds_    = milliseconds;
+   p->icao_            = std::move(icao);
+   p->messageCount_    = messageCount;
+   p->vcpData_         = std::move(vcpData);
+   p->vcpMessage_      = std::move(vcpMessage);
+   p->packedData_      = std::move(packedData);
+   p->index_           = std::move(index);
+
+   p->BuildScanIndex();
+
+   return true;
+}
+
+std::optional<NexradFileMetadata> Ar2vFile::ScanMetadata(std::istream& is)
+{
+   logger_->debug("Scanning metadata");
+
+   Ar2vFileImpl header {};
+   if (!header.ReadVolumeHeader(is))
+   {
+      return std::nullopt;
+   }
+
+   NexradFileMetadata metadata {};
+   metadata.group_ = common::RadarProductGroup::Level2;
+   metadata.icao_  = header.icao_;
+   metadata.startTime_ =
+      util::TimePoint(header.julianDate_, header.milliseconds_);
+   metadata.endTime_ = metadata.startTime_;
+
+   std::vector<std::shared_ptr<rda::Level2Message>> messages {};
+
+   auto parseRecord = [&messages](std::vector<char>&& data)
+   {
+      auto record =
+         util::DecompressBufferPool::Instance()->MakeShared(std::move(data));
+      auto parsedRecord = Ar2vFileImpl::ParseLDMRecord(
+         std::as_bytes(std::span(*record)), record, {});
+      messages.insert(messages.end(),
+                      std::make_move_iterator(parsedRecord.messages_.begin()),
+                      std::make_move_iterator(parsedRecord.messages_.end()));
+   };
+
+   auto readControlWord = [&is]() -> std::size_t
+   {
+      std::int32_t controlWord = 0;
+      is.read(reinterpret_cast<char*>(&controlWord), 4);
+
+      controlWord = ntohl(controlWord);
+      return is.good() ? static_cast<std::size_t>(std::abs(controlWord)) : 0u;
+   };
+
+   const std::streampos dataStart  = is.tellg();
+   std::size_t          recordSize = readControlWord();
+
+   if (recordSize == 0)
+   {
+      // The remainder of the file is uncompressed message data
+      is.clear();
+      is.seekg(dataStart, std::ios_base::beg);
+      parseRecord(std::vector<char>(std::istreambuf_iterator<char>(is),
+                                    std::istreambuf_iterator<char>()));
+   }
+   else
+   {
+      // The first LDM record contains the metadata messages
+      std::vector<char> compressedRecord(recordSize);
+      is.read(compressedRecord.data(),
+              static_cast<std::streamsize>(recordSize));
+      compressedRecord.resize(static_cast<std::size_t>(is.gcount()));
+      parseRecord(DecompressLDMRecord(compressedRecord));
+
+      // Find the last LDM record, skipping over the records in between
+      std::streampos lastRecordStart {-1};
+      std::size_t    lastRecordSize = 0;
+
+      while (is.peek() != EOF)
+      {
+         const std::streampos recordStart = is.tellg();
+         if (recordStart == std::streampos {-1})
+         {
+            // The stream is not seekable
+            break;
+         }
+
+         recordSize = readControlWord();
+         if (recordSize == 0)
+         {
+            break;
+         }
+
+         lastRecordStart = recordStart;
+         lastRecordSize  = recordSize;
+
+         is.seekg(static_cast<std::streamoff>(recordSize), std::ios_base::cur);
+      }
+
+      if (lastRecordStart != std::streampos {-1})
+      {
+         is.clear();
+         is.seekg(lastRecordStart + std::streamoff {4}, std::ios_base::beg);
+
+         compressedRecord.resize(lastRecordSize);
+         is.read(compressedRecord.data(),
+                 static_cast<std::streamsize>(lastRecordSize));
+         compressedRecord.resize(static_cast<std::size_t>(is.gcount()));
+         parseRecord(DecompressLDMRecord(compressedRecord));
+      }
+   }
+
+   for (auto& message : messages)
+   {
+      if (auto vcpData =
+             std::dynamic_pointer_cast<rda::VolumeCoveragePatternData>(message);
+          vcpData != nullptr)
+      {
+         metadata.vcpData_ = vcpData;
+      }
+      else if (auto radarData =
+                  std::dynamic_pointer_cast<rda::GenericRadarData>(message);
+               radarData != nullptr)
+      {
+         metadata.endTime_ =
+            std::max(metadata.endTime_,
+                     util::TimePoint(radarData->modified_julian_date(),
+                                     radarData->collection_time()));
+      }
+   }
+
+   if (metadata.vcpData_ != nullptr)
+   {
+      std::set<std::uint16_t> codedElevations {};
+      for (std::uint16_t e = 0;
+           e < metadata.vcpData_->number_of_elevation_cuts();
+           ++e)
+      {
+         codedElevations.insert(metadata.vcpData_->elevation_angle_raw(e));
+      }
+
+      metadata.volumeCoveragePattern_ = metadata.vcpData_->pattern_number();
+      for (std::uint16_t codedElevation : codedElevations)
+      {
+         metadata.elevationCuts_.push_back(codedElevation /
+                                           kElevationScaleFactor_);
+      }
+   }
+
+   return metadata;
+}
+
+bool Ar2vFileImpl::ReadVolumeHeader(std::istream& is)
+{
+   bool dataValid = true;
+
+   // Read Volume Header Record
+   tapeFilename_.resize(9, ' ');
+   extensionNumber_.resize(3, ' ');
+   icao_.resize(4, ' ');
+
+   is.read(&tapeFilename_[0], 9);
+   is.read(&extensionNumber_[0], 3);
+   is.read(reinterpret_cast<char*>(&julianDate_), 4);
+   is.read(reinterpret_cast<char*>(&milliseconds_), 4);
+   is.read(&icao_[0], 4);
+
+   julianDate_   = ntohl(julianDate_);
+   milliseconds_ = ntohl(milliseconds_);
+
+   if (is.eof())
+   {
+      logger_->warn("Could not read Volume Header Record");
+      dataValid = false;
+   }
+
+   // Trim spaces and null characters from the end of the ICAO
+   boost::trim_right_if(icao_,
+                        [](char x) { return std::isspace(x) || x == '\0'; });
+
+   if (dataValid)
+   {
+      auto timePoint = util::TimePoint(julianDate_, milliseconds_);
+
+      logger_->debug("Filename:  {}", tapeFilename_);
+      logger_->debug("Extension: {}", extensionNumber_);
+      logger_->debug("Date:      {} ({:%Y-%m-%d})", julianDate_, timePoint);
+      logger_->debug("Time:      {} ({:%H:%M:%S})", milliseconds_, timePoint);
+      logger_->debug("ICAO:      {}", icao_);
+   }
+
+   return dataValid;
+}
+
 std::size_t Ar2vFileImpl::DecompressLDMRecords(std::istream& is)
 {
    logger_->debug("Decompressing LDM Records");
 
-   std::size_t numRecords = 0;
+   // Scan the control words serially, reading each compressed record into its
+   // own buffer. The records are independent bzip2 streams, and can be
+   // decompressed concurrently once their boundaries are known.
+   std::vector<std::vector<char>> compressedRecords {};
 
    while (is.peek() != EOF)
    {
@@ -306,78 +953,245 @@ std::size_t Ar2vFileImpl::DecompressLDMRecords(std::istream& is)
          break;
       }
 
-      boost::iostreams::filtering_streambuf<boost::iostreams::input> in;
-      util::rangebuf r(is.rdbuf(), recordSize);
-      in.push(boost::iostreams::bzip2_decompressor());
-      in.push(r);
+      std::vector<char>& record = compressedRecords.emplace_back(recordSize);
+      is.read(record.data(), static_cast<std::streamsize>(recordSize));
 
-      try
+      if (static_cast<std::size_t>(is.gcount()) != recordSize)
       {
-         std::stringstream ss;
-         std::streamsize   bytesCopied = boost::iostreams::copy(in, ss);
-         logger_->trace("Decompressed record size = {} bytes", bytesCopied);
-
-         rawRecords_.push_back(std::move(ss));
+         logger_->warn("Truncated LDM record {}: {} of {} bytes",
+                       compressedRecords.size() - 1,
+                       is.gcount(),
+                       recordSize);
+         record.resize(static_cast<std::size_t>(is.gcount()));
+         break;
       }
-      catch (const boost::iostreams::bzip2_error& ex)
-      {
-         logger_->warn(
-            "Error decompressing record {}: {}", numRecords, ex.what());
+   }
 
-         is.seekg(startPosition + std::streampos(recordSize),
-                  std::ios_base::beg);
-      }
+   const std::size_t numRecords = compressedRecords.size();
+   rawRecords_.resize(numRecords);
 
-      ++numRecords;
-   }
+   // Decompressed records are returned to the buffer pool once released
+   std::shared_ptr<util::DecompressBufferPool> bufferPool =
+      util::DecompressBufferPool::Instance();
+
+   std::transform(std::execution::par,
+                  compressedRecords.cbegin(),
+                  compressedRecords.cend(),
+                  rawRecords_.begin(),
+                  [&bufferPool](const std::vector<char>& compressedRecord)
+                  {
+                     return bufferPool->MakeShared(
+                        DecompressLDMRecord(compressedRecord));
+                  });
 
    logger_->debug("Decompressed {} LDM Records", numRecords);
 
+   // Retain the compressed records, so moment data can be decoded on demand.
+   // Records from appended chunks are added to the existing record source.
+   if (numRecords > 0)
+   {
+      if (recordSource_ == nullptr)
+      {
+         recordSource_ = std::make_shared<LdmRecordSource>();
+      }
+      recordSource_->AddRecords(std::move(compressedRecords), rawRecords_);
+   }
+
    return numRecords;
 }
 
+static std::vector<char>
+DecompressLDMRecord(const std::vector<char>& compressedRecord)
+{
+   const std::size_t sizeHint =
+      compressedRecord.size() * kDecompressedSizeEstimate_;
+
+   std::vector<char> record =
+      util::DecompressBufferPool::Instance()->Acquire(sizeHint);
+
+   if (util::DecompressBzip2(compressedRecord, record, sizeHint))
+   {
+      logger_->trace("Decompressed record size = {} bytes", record.size());
+   }
+   else
+   {
+      logger_->warn("Error decompressing record");
+      record.clear();
+   }
+
+   return record;
+}
+
+static bool IsMetadataMessage(std::uint8_t messageType)
+{
+   switch (static_cast<rda::MessageId>(messageType))
+   {
+   case rda::MessageId::RdaStatusData:
+   case rda::MessageId::PerformanceMaintenanceData:
+   case rda::MessageId::ClutterFilterBypassMap:
+   case rda::MessageId::ClutterFilterMap:
+   case rda::MessageId::RdaAdaptationData:
+      return true;
+
+   default:
+      return false;
+   }
+}
+
+std::optional<rda::PackedElevationScan::MomentLocation>
+LdmRecordSource::Locate(const void* data, std::size_t size) const
+{
+   const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(data);
+
+   std::shared_lock lock {mutex_};
+
+   // Find the last record beginning at or before the address
+   auto it = std::upper_bound(decompressedRecords_.cbegin(),
+                              decompressedRecords_.cend(),
+                              address,
+                              [](std::uintptr_t a, const RecordRange& range)
+                              { return a < range.begin; });
+
+   if (it == decompressedRecords_.cbegin())
+   {
+      return std::nullopt;
+   }
+
+   --it;
+
+   // A released record's address range may since have been reused
+   const std::size_t offset = address - it->begin;
+   if (offset + size > it->size || it->record.expired())
+   {
+      return std::nullopt;
+   }
+
+   return rda::PackedElevationScan::MomentLocation {it->recordIndex, offset};
+}
+
+std::vector<char> LdmRecordSource::Decode(std::size_t recordIndex) const
+{
+   std::shared_lock lock {mutex_};
+
+   if (recordIndex >= compressedRecords_.size())
+   {
+      logger_->warn("Invalid record index: {}", recordIndex);
+      return {};
+   }
+
+   return DecompressLDMRecord(compressedRecords_[recordIndex]);
+}
+
+void LdmRecordSource::AddRecords(
+   std::vector<std::vector<char>>&&                       compressedRecords,
+   const std::vector<std::shared_ptr<std::vector<char>>>& records)
+{
+   std::unique_lock lock {mutex_};
+
+   const std::size_t baseIndex = compressedRecords_.size();
+
+   compressedRecords_.insert(compressedRecords_.end(),
+                             std::make_move_iterator(compressedRecords.begin()),
+                             std::make_move_iterator(compressedRecords.end()));
+
+   decompressedRecords_.reserve(decompressedRecords_.size() + records.size());
+
+   for (std::size_t i = 0; i < records.size(); ++i)
+   {
+      if (!records[i]->empty())
+      {
+         decompressedRecords_.push_back(
+            {reinterpret_cast<std::uintptr_t>(records[i]->data()),
+             records[i]->size(),
+             baseIndex + i,
+             records[i]});
+      }
+   }
+
+   std::sort(decompressedRecords_.begin(),
+             decompressedRecords_.end(),
+             [](const RecordRange& a, const RecordRange& b)
+             { return a.begin < b.begin; });
+}
+
+void LdmRecordSource::PruneDecompressedRecords()
+{
+   std::unique_lock lock {mutex_};
+
+   // Remove records which are no longer referenced by any parsed message
+   std::erase_if(decompressedRecords_,
+                 [](const RecordRange& range)
+                 { return range.record.expired(); });
+
+   if (decompressedRecords_.empty())
+   {
+      decompressedRecords_.shrink_to_fit();
+   }
+}
+
 void Ar2vFileImpl::ParseLDMRecords()
 {
    logger_->debug("Parsing LDM Records");
 
+   // Parse each record independently, then merge the messages in record order.
+   // Messages reference the record buffers, which remain allocated as long as
+   // the messages do.
+   std::vector<ParsedRecord> parsedRecords(rawRecords_.size());
+
+   std::transform(std::execution::par,
+                  rawRecords_.cbegin(),
+                  rawRecords_.cend(),
+                  parsedRecords.begin(),
+                  [this](const std::shared_ptr<std::vector<char>>& record)
+                  {
+                     return ParseLDMRecord(
+                        std::as_bytes(std::span(*record)), record, filter_);
+                  });
+
    std::size_t count = 0;
 
-   for (auto it = rawRecords_.begin(); it != rawRecords_.end(); it++)
+   for (auto& parsedRecord : parsedRecords)
    {
-      std::stringstream& ss = *it;
-
       logger_->trace("Record {}", count++);
 
-      ParseLDMRecord(ss);
+      HandleRecord(parsedRecord);
    }
 
    rawRecords_.clear();
 }
 
-void Ar2vFileImpl::ParseLDMRecord(std::istream& is)
+Ar2vFileImpl::ParsedRecord
+Ar2vFileImpl::ParseLDMRecord(std::span<const std::byte>         record,
+                             const std::shared_ptr<const void>& buffer,
+                             const Ar2vDecodeFilter&            filter)
 {
    static constexpr std::size_t kDefaultSegmentSize = 2432;
    static constexpr std::size_t kCtmHeaderSize      = 12;
 
+   ParsedRecord parsedRecord {};
+
    auto ctx = rda::Level2MessageFactory::CreateContext();
 
-   while (!is.eof() && !is.fail())
+   std::size_t offset = 0;
+
+   while (offset + kCtmHeaderSize < record.size())
    {
       // The communications manager inserts an extra 12 bytes at the beginning
       // of each record
-      is.seekg(kCtmHeaderSize, std::ios_base::cur);
+      offset += kCtmHeaderSize;
 
       // Each message requires 2432 bytes of storage, with the exception of
       // Message Types 29 and 31.
       std::size_t messageSize = kDefaultSegmentSize - kCtmHeaderSize;
 
       // Mark current position
-      std::streampos messageStart = is.tellg();
+      const std::size_t          messageStart = offset;
+      std::span<const std::byte> messageData  = record.subspan(messageStart);
 
       // Parse the header
       rda::Level2MessageHeader messageHeader;
-      bool                     headerValid = messageHeader.Parse(is);
-      is.seekg(messageStart, std::ios_base::beg);
+      util::ByteCursor         cursor(messageData);
+      bool                     headerValid = messageHeader.Parse(cursor);
 
       if (headerValid)
       {
@@ -401,19 +1215,88 @@ void Ar2vFileImpl::ParseLDMRecord(std::istream& is)
             }
          }
 
+         if (!filter.includeMetadata_ && IsMetadataMessage(messageType))
+         {
+            // Count each skipped message once, at its last segment
+            if (messageHeader.message_segment_number() ==
+                messageHeader.number_of_message_segments())
+            {
+               ++parsedRecord.skippedMessages_;
+            }
+
+            offset = messageStart + messageSize;
+            continue;
+         }
+
          // Parse the current message
          rda::Level2MessageInfo msgInfo =
-            rda::Level2MessageFactory::Create(is, ctx);
+            rda::Level2MessageFactory::Create(messageData, buffer, ctx);
+
+         if (msgInfo.messageValid && !filter.elevationIndices_.empty())
+         {
+            // Only radar data messages are filtered by elevation, metadata
+            // messages may also be included
+            auto radarData = std::dynamic_pointer_cast<rda::GenericRadarData>(
+               msgInfo.message);
+
+            if (radarData != nullptr &&
+                !filter.elevationIndices_.contains(
+                   radarData->elevation_number() - 1))
+            {
+               ++parsedRecord.skippedMessages_;
+               msgInfo.messageValid = false;
+            }
+         }
 
          if (msgInfo.messageValid)
          {
-            HandleMessage(msgInfo.message);
+            parsedRecord.messages_.push_back(std::move(msgInfo.message));
+
+            // Retain the VCP message data, so it can be written to a cache
+            if (messageType == static_cast<std::uint8_t>(
+                                  rda::MessageId::VolumeCoveragePatternData))
+            {
+               auto vcpData = messageData.first(
+                  std::min(messageSize, messageData.size()));
+               parsedRecord.vcpMessage_.assign(
+                  reinterpret_cast<const char*>(vcpData.data()),
+                  reinterpret_cast<const char*>(vcpData.data()) +
+                     vcpData.size());
+            }
          }
       }
 
       // Skip to next message
-      is.seekg(messageStart + static_cast<std::streampos>(messageSize),
-               std::ios_base::beg);
+      offset = messageStart + messageSize;
+   }
+
+   return parsedRecord;
+}
+
+void Ar2vFileImpl::HandleRecord(ParsedRecord& parsedRecord)
+{
+   for (auto& message : parsedRecord.messages_)
+   {
+      HandleMessage(message);
+   }
+
+   if (!parsedRecord.vcpMessage_.empty())
+   {
+      vcpMessage_ = std::move(parsedRecord.vcpMessage_);
+   }
+
+   // Skipped messages are included in the message count
+   messageCount_ += parsedRecord.skippedMessages_;
+}
+
+void Ar2vFileImpl::SetDecodeFilter(const Ar2vDecodeFilter& filter)
+{
+   filter_ = filter;
+
+   // Clutter filter power removed is displayed along with reflectivity
+   if (filter_.dataBlockTypes_.contains(rda::DataBlockType::MomentRef))
+   {
+      filter_.dataBlockTypes_.insert(rda::DataBlockType::MomentCfp);
    }
 }
 
@@ -424,9 +1307,12 @@ void Ar2vFileImpl::HandleMessage(std::shared_ptr<rda::Level2Message>& message)
    switch (message->header().message_type())
    {
    case static_cast<std::uint8_t>(rda::MessageId::VolumeCoveragePatternData):
+   {
+      std::unique_lock lock {dataMutex_};
       vcpData_ =
          std::static_pointer_cast<rda::VolumeCoveragePatternData>(message);
       break;
+   }
 
    case static_cast<std::uint8_t>(rda::MessageId::DigitalRadarData):
    case static_cast<std::uint8_t>(rda::MessageId::DigitalRadarDataGeneric):
@@ -445,6 +1331,19 @@ void Ar2vFileImpl::ProcessRadarData(
    std::uint16_t azimuthIndex   = message->azimuth_number() - 1;
    std::uint16_t elevationIndex = message->elevation_number() - 1;
 
+   if (!radarData_.contains(elevationIndex) &&
+       packedData_.contains(elevationIndex))
+   {
+      // The messages of a completed elevation have been released, and a
+      // repacked scan would be missing the previous radials
+      logger_->warn("Ignoring radial {} for completed elevation {}",
+                    azimuthIndex,
+                    elevationIndex);
+      return;
+   }
+
+   dirtyElevations_.insert(elevationIndex);
+
    if (radarData_[elevationIndex] == nullptr)
    {
       radarData_[elevationIndex] = std::make_shared<rda::ElevationScan>();
@@ -457,20 +1356,68 @@ void Ar2vFileImpl::IndexFile()
 {
    logger_->debug("Indexing file");
 
-   for (auto& elevationCut : radarData_)
+   if (recordSource_ != nullptr)
+   {
+      // Only records referenced by parsed messages can be located
+      recordSource_->PruneDecompressedRecords();
+   }
+
+   // Pack each modified elevation scan into contiguous storage. Packed scans
+   // are replaced rather than modified, so previously returned scans remain
+   // valid while chunks are appended.
+   std::vector<std::pair<std::uint16_t, std::shared_ptr<rda::ElevationScan>>>
+      elevationScans {};
+   for (std::uint16_t elevationIndex : dirtyElevations_)
+   {
+      elevationScans.emplace_back(elevationIndex,
+                                  radarData_.at(elevationIndex));
+   }
+
+   std::vector<std::shared_ptr<rda::PackedElevationScan>> packedScans(
+      elevationScans.size());
+
+   std::transform(std::execution::par,
+                  elevationScans.cbegin(),
+                  elevationScans.cend(),
+                  packedScans.begin(),
+                  [this](const auto& elevationScan)
+                  {
+                     return rda::PackedElevationScan::Create(
+                        *elevationScan.second,
+                        recordSource_,
+                        filter_.dataBlockTypes_);
+                  });
+
+   std::unique_lock lock {dataMutex_};
+
+   for (std::size_t i = 0; i < elevationScans.size(); ++i)
+   {
+      packedData_[elevationScans[i].first] = packedScans[i];
+   }
+
+   updatedElevations_.assign(dirtyElevations_.cbegin(),
+                             dirtyElevations_.cend());
+   dirtyElevations_.clear();
+
+   for (auto& elevationCut : elevationScans)
    {
       std::uint16_t     elevationAngle {};
       rda::WaveformType waveformType = rda::WaveformType::Unknown;
 
-      std::shared_ptr<rda::GenericRadarData>& radial0 =
-         (*elevationCut.second)[0];
+      std::shared_ptr<rda::PackedElevationScan>& packedScan =
+         packedData_.at(elevationCut.first);
 
-      if (radial0 == nullptr)
+      auto radial0It = elevationCut.second->find(0);
+
+      if (radial0It == elevationCut.second->cend() ||
+          radial0It->second == nullptr)
       {
          logger_->warn("Empty radial data");
          continue;
       }
 
+      std::shared_ptr<rda::GenericRadarData>& radial0 = radial0It->second;
+
       std::shared_ptr<rda::DigitalRadarData> digitalRadarData0 = nullptr;
 
       if (vcpData_ != nullptr)
@@ -486,9 +1433,9 @@ void Ar2vFileImpl::IndexFile()
       }
       else
       {
-         // Return here, because we should only have a single message type
+         // Stop here, because we should only have a single message type
          logger_->warn("Cannot index file without VCP data");
-         return;
+         break;
       }
 
       for (rda::DataBlockType dataBlockType :
@@ -503,14 +1450,131 @@ void Ar2vFileImpl::IndexFile()
             continue;
          }
 
-         auto momentData = radial0->moment_data_block(dataBlockType);
+         auto momentData = packedScan->moment(dataBlockType);
 
-         if (momentData != nullptr)
+         if (momentData != nullptr &&
+             momentData->radials()[0].numberOfDataMomentGates > 0)
          {
             auto time = util::TimePoint(radial0->modified_julian_date(),
                                         radial0->collection_time());
 
-            index_[dataBlockType][elevationAngle][time] = elevationCut.second;
+            index_[dataBlockType][elevationAngle][time] = packedScan;
+         }
+      }
+   }
+
+   BuildScanIndex();
+
+   lock.unlock();
+
+   // Once packed, the parsed messages (and the record buffers they reference)
+   // are released. While chunks are being appended, the most recent elevation
+   // may still receive radials, so its messages are retained.
+   if (appendingChunks_ && !radarData_.empty())
+   {
+      radarData_.erase(radarData_.cbegin(), std::prev(radarData_.cend()));
+   }
+   else
+   {
+      radarData_.clear();
+   }
+
+   if (recordSource_ != nullptr)
+   {
+      // The decompressed records are released along with the messages
+      recordSource_->PruneDecompressedRecords();
+   }
+}
+
+namespace detail
+{
+
+std::pair<std::size_t, std::size_t> SelectElevationScan(
+   const std::vector<std::uint16_t>& codedElevations,
+   const std::vector<std::vector<std::chrono::system_clock::time_point>>&
+                                         scanTimes,
+   std::uint16_t                         codedElevation,
+   std::chrono::system_clock::time_point time)
+{
+   // Find closest elevation match. If the elevation is out of range, the
+   // nearest bound is used.
+   auto upperIt = std::lower_bound(
+      codedElevations.cbegin(), codedElevations.cend(), codedElevation);
+   if (upperIt == codedElevations.cend())
+   {
+      upperIt = std::prev(upperIt);
+   }
+   auto lowerIt =
+      (*upperIt <= codedElevation || upperIt == codedElevations.cbegin()) ?
+         upperIt :
+         std::prev(upperIt);
+
+   std::int32_t lowerDelta =
+      std::abs(static_cast<std::int32_t>(codedElevation) -
+               static_cast<std::int32_t>(*lowerIt));
+   std::int32_t upperDelta =
+      std::abs(static_cast<std::int32_t>(codedElevation) -
+               static_cast<std::int32_t>(*upperIt));
+
+   // Select closest elevation match
+   auto elevationIt = (lowerDelta < upperDelta) ? lowerIt : upperIt;
+
+   const std::size_t i =
+      static_cast<std::size_t>(elevationIt - codedElevations.cbegin());
+   const auto& elevationScanTimes = scanTimes[i];
+
+   // Select closest time match, not newer than the selected time. If all scans
+   // are newer, the oldest scan is selected. Of scans sharing the same time,
+   // the first is selected.
+   auto timeIt =
+      (time == std::chrono::system_clock::time_point {}) ?
+         elevationScanTimes.cend() :
+         std::upper_bound(
+            elevationScanTimes.cbegin(), elevationScanTimes.cend(), time);
+   if (timeIt != elevationScanTimes.cbegin())
+   {
+      timeIt = std::lower_bound(
+         elevationScanTimes.cbegin(), std::prev(timeIt), *std::prev(timeIt));
+   }
+
+   const std::size_t j =
+      static_cast<std::size_t>(timeIt - elevationScanTimes.cbegin());
+
+   return {i, j};
+}
+
+} // namespace detail
+
+void Ar2vFileImpl::BuildScanIndex()
+{
+   // Called with the data mutex exclusively locked
+   scanIndex_.clear();
+
+   for (auto& [dataBlockType, scans] : index_)
+   {
+      MomentScanIndex& moment = scanIndex_[dataBlockType];
+
+      moment.codedElevations_.reserve(scans.size());
+      moment.elevationCuts_.reserve(scans.size());
+      moment.scanTimes_.reserve(scans.size());
+      moment.scans_.reserve(scans.size());
+
+      for (auto& [elevationAngle, elevationScans] : scans)
+      {
+         moment.codedElevations_.push_back(elevationAngle);
+         moment.elevationCuts_.push_back(elevationAngle /
+                                         kElevationScaleFactor_);
+
+         auto& scanTimes = moment.scanTimes_.emplace_back();
+         auto& scanData  = moment.scans_.emplace_back();
+
+         scanTimes.reserve(elevationScans.size());
+         scanData.reserve(elevationScans.size());
+
+         for (auto& [time, packedScan] : elevationScans)
+         {
+            scanTimes.push_back(std::chrono::floor<std::chrono::seconds>(time));
+            scanData.push_back(packedScan);
          }
       }
    }
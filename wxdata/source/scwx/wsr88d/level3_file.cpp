@@ -1,7 +1,12 @@
 #include <scwx/wsr88d/level3_file.hpp>
 #include <scwx/wsr88d/rpg/ccb_header.hpp>
 #include <scwx/wsr88d/rpg/level3_message_factory.hpp>
+#include <scwx/wsr88d/rpg/level3_message_header.hpp>
+#include <scwx/wsr88d/rpg/product_description_block.hpp>
+#include <scwx/util/decompress.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/streams.hpp>
+#include <scwx/util/time.hpp>
 
 #include <fstream>
 #include <sstream>
@@ -17,9 +22,10 @@
 #   pragma GCC diagnostic ignored "-Wdeprecated-copy"
 #endif
 
-#include <boost/iostreams/copy.hpp>
-#include <boost/iostreams/filtering_streambuf.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
 #include <boost/iostreams/filter/zlib.hpp>
+#include <boost/iostreams/stream.hpp>
 
 #if defined(__GNUC__)
 #   pragma GCC diagnostic pop
@@ -37,6 +43,13 @@ namespace wsr88d
 static const std::string logPrefix_ = "scwx::wsr88d::level3_file";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
+// Decompressed size sufficient to contain the CCB header, inner WMO header,
+// message header and product description block
+static constexpr std::size_t kMetadataScanSize_ = 1024u;
+
+// Message codes below this value do not contain a product description block
+static constexpr std::int16_t kMinProductMessageCode_ = 16;
+
 class Level3FileImpl
 {
 public:
@@ -44,7 +57,8 @@ public:
        wmoHeader_ {}, ccbHeader_ {}, innerHeader_ {}, message_ {} {};
    ~Level3FileImpl() = default;
 
-   bool DecompressFile(std::istream& is, std::stringstream& ss);
+   bool DecompressFile(std::istream& is, std::vector<char>& data);
+   bool LoadCompressedFileData(std::istream& is);
    bool LoadFileData(std::istream& is);
 
    std::shared_ptr<awips::WmoHeader>   wmoHeader_;
@@ -108,14 +122,20 @@ bool Level3File::LoadData(std::istream& is)
       // If the header is compressed
       if (is.peek() == 0x78)
       {
-         std::stringstream ss;
+         std::shared_ptr<util::DecompressBufferPool> bufferPool =
+            util::DecompressBufferPool::Instance();
+         std::vector<char> data = bufferPool->Acquire();
 
-         dataValid = p->DecompressFile(is, ss);
+         dataValid = p->DecompressFile(is, data);
 
          if (dataValid)
          {
-            dataValid = p->LoadFileData(ss);
+            boost::iostreams::stream<boost::iostreams::array_source> ds(
+               data.data(), data.size());
+            dataValid = p->LoadCompressedFileData(ds);
          }
+
+         bufferPool->Release(std::move(data));
       }
       else
       {
@@ -126,57 +146,151 @@ bool Level3File::LoadData(std::istream& is)
    return dataValid;
 }
 
-bool Level3FileImpl::DecompressFile(std::istream& is, std::stringstream& ss)
+std::optional<NexradFileMetadata> Level3File::ScanMetadata(std::istream& is)
 {
-   bool dataValid = true;
+   logger_->debug("Scanning metadata");
 
-   std::streampos  dataStart          = is.tellg();
-   std::streamsize totalBytesCopied   = 0;
-   int             totalBytesConsumed = 0;
+   awips::WmoHeader wmoHeader;
+   if (!wmoHeader.Parse(is))
+   {
+      return std::nullopt;
+   }
+
+   std::stringstream ss;
+   std::istream*     pis = &is;
+
+   // If the header is compressed, decompress only the beginning of the data
+   if (is.peek() == 0x78)
+   {
+      std::string buffer(kMetadataScanSize_, '\0');
 
-   while (dataValid && is.peek() == 0x78)
       try
       {
-         boost::iostreams::filtering_streambuf<boost::iostreams::input> in;
-         boost::iostreams::zlib_decompressor zlibDecompressor;
-         in.push(zlibDecompressor);
+         boost::iostreams::filtering_istream in;
+         in.push(boost::iostreams::zlib_decompressor());
          in.push(is);
 
-         std::streamsize bytesCopied   = boost::iostreams::copy(in, ss);
-         int             bytesConsumed = zlibDecompressor.filter().total_in();
-
-         totalBytesCopied += bytesCopied;
-         totalBytesConsumed += bytesConsumed;
-
-         is.seekg(dataStart + static_cast<std::streamoff>(totalBytesConsumed),
-                  std::ios_base::beg);
-
-         if (bytesConsumed <= 0)
-         {
-            // Not sure this will ever occur, but will prevent an infinite loop
-            break;
-         }
+         in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+         buffer.resize(static_cast<std::size_t>(in.gcount()));
       }
       catch (const boost::iostreams::zlib_error& ex)
       {
          logger_->warn("Error decompressing data: {}", ex.what());
+         return std::nullopt;
+      }
+
+      ss.str(buffer);
+      pis = &ss;
 
-         dataValid = false;
+      rpg::CcbHeader   ccbHeader;
+      awips::WmoHeader innerHeader;
+      if (!ccbHeader.Parse(ss) || !innerHeader.Parse(ss))
+      {
+         return std::nullopt;
       }
+   }
 
-   if (dataValid)
+   rpg::Level3MessageHeader header;
+   if (!header.Parse(*pis))
+   {
+      return std::nullopt;
+   }
+
+   NexradFileMetadata metadata {};
+   metadata.group_       = common::RadarProductGroup::Level3;
+   metadata.icao_        = wmoHeader.icao();
+   metadata.siteId_      = wmoHeader.product_designator();
+   metadata.product_     = wmoHeader.product_category();
+   metadata.productCode_ = header.message_code();
+   metadata.startTime_   = util::TimePoint(header.date_of_message(),
+                                         header.time_of_message() * 1000u);
+   metadata.endTime_     = metadata.startTime_;
+
+   rpg::ProductDescriptionBlock descriptionBlock;
+   if (header.message_code() >= kMinProductMessageCode_ &&
+       descriptionBlock.Parse(*pis))
+   {
+      metadata.startTime_ =
+         util::TimePoint(descriptionBlock.volume_scan_date(),
+                         descriptionBlock.volume_scan_start_time() * 1000u);
+      metadata.endTime_ = util::TimePoint(
+         descriptionBlock.generation_date_of_product(),
+         descriptionBlock.generation_time_of_product() * 1000u);
+      metadata.volumeCoveragePattern_ =
+         descriptionBlock.volume_coverage_pattern();
+
+      if (descriptionBlock.elevation_number() > 0)
+      {
+         metadata.elevationCuts_.push_back(
+            static_cast<float>(descriptionBlock.elevation().value()));
+      }
+   }
+
+   return metadata;
+}
+
+bool Level3FileImpl::DecompressFile(std::istream& is, std::vector<char>& data)
+{
+   std::shared_ptr<util::DecompressBufferPool> bufferPool =
+      util::DecompressBufferPool::Instance();
+
+   std::vector<char> compressedData = bufferPool->Acquire();
+   util::ReadRemaining(is, compressedData);
+
+   bool        dataValid          = true;
+   std::size_t totalBytesConsumed = 0;
+
+   // The data may consist of multiple consecutive zlib streams
+   while (dataValid && totalBytesConsumed < compressedData.size() &&
+          compressedData[totalBytesConsumed] == 0x78)
    {
-      logger_->trace("Input data consumed = {} bytes", totalBytesCopied);
-      logger_->trace("Decompressed data size = {} bytes", totalBytesConsumed);
+      std::size_t bytesConsumed = 0;
+
+      dataValid = util::DecompressZlib(
+         std::span<const char>(compressedData).subspan(totalBytesConsumed),
+         data,
+         util::ZlibFormat::Zlib,
+         0,
+         &bytesConsumed);
+
+      totalBytesConsumed += bytesConsumed;
+
+      if (bytesConsumed == 0)
+      {
+         // Not sure this will ever occur, but will prevent an infinite loop
+         break;
+      }
+   }
+
+   bufferPool->Release(std::move(compressedData));
 
-      ccbHeader_ = std::make_shared<rpg::CcbHeader>();
-      dataValid  = ccbHeader_->Parse(ss);
+   if (dataValid)
+   {
+      logger_->trace("Input data consumed = {} bytes", totalBytesConsumed);
+      logger_->trace("Decompressed data size = {} bytes", data.size());
+   }
+   else
+   {
+      logger_->warn("Error decompressing data");
    }
 
+   return dataValid;
+}
+
+bool Level3FileImpl::LoadCompressedFileData(std::istream& is)
+{
+   ccbHeader_     = std::make_shared<rpg::CcbHeader>();
+   bool dataValid = ccbHeader_->Parse(is);
+
    if (dataValid)
    {
       innerHeader_ = std::make_shared<awips::WmoHeader>();
-      dataValid    = innerHeader_->Parse(ss);
+      dataValid    = innerHeader_->Parse(is);
+   }
+
+   if (dataValid)
+   {
+      dataValid = LoadFileData(is);
    }
 
    return dataValid;
@@ -1,10 +1,12 @@
 #include <scwx/wsr88d/nexrad_file_factory.hpp>
 #include <scwx/wsr88d/ar2v_file.hpp>
 #include <scwx/wsr88d/level3_file.hpp>
+#include <scwx/util/decompress.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/streams.hpp>
 
 #include <fstream>
-#include <sstream>
+#include <vector>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -17,9 +19,8 @@
 #   pragma GCC diagnostic ignored "-Wdeprecated-copy"
 #endif
 
-#include <boost/iostreams/copy.hpp>
-#include <boost/iostreams/filtering_streambuf.hpp>
-#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/stream.hpp>
 
 #if defined(__GNUC__)
 #   pragma GCC diagnostic pop
@@ -37,8 +38,17 @@ namespace wsr88d
 static const std::string logPrefix_ = "scwx::wsr88d::nexrad_file_factory";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
+static bool DecompressGzip(std::istream& is, std::vector<char>& data);
+
 std::shared_ptr<NexradFile>
 NexradFileFactory::Create(const std::string& filename)
+{
+   return Create(filename, {});
+}
+
+std::shared_ptr<NexradFile>
+NexradFileFactory::Create(const std::string&      filename,
+                          const Ar2vDecodeFilter& filter)
 {
    logger_->debug("Create: {}", filename);
 
@@ -54,21 +64,104 @@ NexradFileFactory::Create(const std::string& filename)
 
    if (fileValid)
    {
-      nexradFile = Create(f);
+      nexradFile = Create(f, filter);
    }
 
    return nexradFile;
 }
 
+std::optional<NexradFileMetadata>
+NexradFileFactory::ScanMetadata(const std::string& filename)
+{
+   logger_->debug("ScanMetadata: {}", filename);
+
+   std::ifstream f(filename, std::ios_base::in | std::ios_base::binary);
+   if (!f.good())
+   {
+      logger_->warn("Could not open file for reading: {}", filename);
+      return std::nullopt;
+   }
+
+   return ScanMetadata(f);
+}
+
+std::optional<NexradFileMetadata>
+NexradFileFactory::ScanMetadata(std::istream& is)
+{
+   std::istream*  pis      = &is;
+   std::streampos pisBegin = is.tellg();
+   std::string    buffer(8, '\0');
+
+   std::shared_ptr<util::DecompressBufferPool> bufferPool =
+      util::DecompressBufferPool::Instance();
+   std::vector<char>                                        data {};
+   boost::iostreams::stream<boost::iostreams::array_source> ds {};
+
+   is.read(buffer.data(), 8);
+   bool dataValid = is.good();
+   is.seekg(pisBegin, std::ios_base::beg);
+
+   if (dataValid && buffer.starts_with("\x1f\x8b"))
+   {
+      // The gzip stream is decompressed in full, as the Level 2 scan seeks
+      // within the data
+      data      = bufferPool->Acquire();
+      dataValid = DecompressGzip(is, data);
+
+      if (dataValid)
+      {
+         ds.open(boost::iostreams::array_source(data.data(), data.size()));
+
+         pis = &ds;
+         ds.read(buffer.data(), 8);
+         dataValid = ds.good();
+         ds.seekg(0, std::ios_base::beg);
+      }
+   }
+   else if (!dataValid)
+   {
+      logger_->warn("Error reading file");
+   }
+
+   std::optional<NexradFileMetadata> metadata = std::nullopt;
+
+   if (dataValid)
+   {
+      if (buffer.starts_with("AR2V") || buffer.starts_with("ARCHIVE2"))
+      {
+         metadata = Ar2vFile::ScanMetadata(*pis);
+      }
+      else
+      {
+         metadata = Level3File::ScanMetadata(*pis);
+      }
+   }
+
+   bufferPool->Release(std::move(data));
+
+   return metadata;
+}
+
 std::shared_ptr<NexradFile> NexradFileFactory::Create(std::istream& is)
 {
-   std::shared_ptr<NexradFile> message = nullptr;
+   return Create(is, {});
+}
 
-   std::istream*     pis      = &is;
-   std::streampos    pisBegin = is.tellg();
-   std::stringstream ss;
-   std::string       buffer;
-   bool              dataValid;
+std::shared_ptr<NexradFile>
+NexradFileFactory::Create(std::istream& is, const Ar2vDecodeFilter& filter)
+{
+   std::shared_ptr<NexradFile> message  = nullptr;
+   std::shared_ptr<Ar2vFile>   ar2vFile = nullptr;
+
+   std::istream*  pis      = &is;
+   std::streampos pisBegin = is.tellg();
+   std::string    buffer;
+   bool           dataValid;
+
+   std::shared_ptr<util::DecompressBufferPool> bufferPool =
+      util::DecompressBufferPool::Instance();
+   std::vector<char>                                        data {};
+   boost::iostreams::stream<boost::iostreams::array_source> ds {};
 
    buffer.resize(8);
 
@@ -78,34 +171,25 @@ std::shared_ptr<NexradFile> NexradFileFactory::Create(std::istream& is)
 
    if (dataValid && buffer.starts_with("\x1f\x8b"))
    {
-      boost::iostreams::filtering_streambuf<boost::iostreams::input> in;
-      in.push(boost::iostreams::gzip_decompressor());
-      in.push(is);
+      data      = bufferPool->Acquire();
+      dataValid = DecompressGzip(is, data);
 
-      try
+      if (dataValid)
       {
-         std::streamsize bytesCopied = boost::iostreams::copy(in, ss);
-
-         pis      = &ss;
-         pisBegin = ss.tellg();
+         ds.open(boost::iostreams::array_source(data.data(), data.size()));
 
-         ss.read(buffer.data(), 8);
-         dataValid = ss.good();
-         ss.seekg(pisBegin, std::ios_base::beg);
+         pis      = &ds;
+         pisBegin = ds.tellg();
 
-         logger_->trace("Decompressed file = {} bytes", bytesCopied);
+         ds.read(buffer.data(), 8);
+         dataValid = ds.good();
+         ds.seekg(pisBegin, std::ios_base::beg);
 
          if (!dataValid)
          {
             logger_->warn("Error reading decompressed stream");
          }
       }
-      catch (const boost::iostreams::gzip_error& ex)
-      {
-         logger_->warn("Error decompressing file: {}", ex.what());
-
-         dataValid = false;
-      }
    }
    else if (!dataValid)
    {
@@ -116,7 +200,8 @@ std::shared_ptr<NexradFile> NexradFileFactory::Create(std::istream& is)
    {
       if (buffer.starts_with("AR2V") || buffer.starts_with("ARCHIVE2"))
       {
-         message = std::make_shared<Ar2vFile>();
+         ar2vFile = std::make_shared<Ar2vFile>();
+         message  = ar2vFile;
       }
       else
       {
@@ -126,7 +211,8 @@ std::shared_ptr<NexradFile> NexradFileFactory::Create(std::istream& is)
 
    if (message != nullptr)
    {
-      dataValid = message->LoadData(*pis);
+      dataValid = (ar2vFile != nullptr) ? ar2vFile->LoadData(*pis, filter) :
+                                          message->LoadData(*pis);
 
       if (!dataValid)
       {
@@ -134,8 +220,36 @@ std::shared_ptr<NexradFile> NexradFileFactory::Create(std::istream& is)
       }
    }
 
+   // Parsed files do not reference the decompressed data
+   bufferPool->Release(std::move(data));
+
    return message;
 }
 
+static bool DecompressGzip(std::istream& is, std::vector<char>& data)
+{
+   std::shared_ptr<util::DecompressBufferPool> bufferPool =
+      util::DecompressBufferPool::Instance();
+
+   std::vector<char> compressedData = bufferPool->Acquire();
+   util::ReadRemaining(is, compressedData);
+
+   bool dataValid =
+      util::DecompressZlib(compressedData, data, util::ZlibFormat::Gzip);
+
+   if (dataValid)
+   {
+      logger_->trace("Decompressed file = {} bytes", data.size());
+   }
+   else
+   {
+      logger_->warn("Error decompressing file");
+   }
+
+   bufferPool->Release(std::move(compressedData));
+
+   return dataValid;
+}
+
 } // namespace wsr88d
 } // namespace scwx
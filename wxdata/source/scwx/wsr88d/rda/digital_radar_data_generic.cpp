@@ -1,6 +1,10 @@
 #include <scwx/wsr88d/rda/digital_radar_data_generic.hpp>
+#include <scwx/util/byte_swap.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <algorithm>
+#include <cstring>
+
 namespace scwx
 {
 namespace wsr88d
@@ -24,22 +28,12 @@ static const std::unordered_map<std::string, DataBlockType> strToDataBlock_ {
    {"RHO", DataBlockType::MomentRho},
    {"CFP", DataBlockType::MomentCfp}};
 
-class DigitalRadarDataGeneric::DataBlock::Impl
-{
-public:
-   explicit Impl(const std::string& dataBlockType,
-                 const std::string& dataName) :
-       dataBlockType_ {dataBlockType}, dataName_ {dataName}
-   {
-   }
-
-   std::string dataBlockType_;
-   std::string dataName_;
-};
+static constexpr std::size_t kMomentDataBlockCount_ =
+   static_cast<std::size_t>(DataBlockType::MomentCfp) -
+   static_cast<std::size_t>(DataBlockType::MomentRef) + 1u;
 
-DigitalRadarDataGeneric::DataBlock::DataBlock(const std::string& dataBlockType,
-                                              const std::string& dataName) :
-    p(std::make_unique<Impl>(dataBlockType, dataName))
+DigitalRadarDataGeneric::DataBlock::DataBlock(DataBlockType dataBlockType) :
+    dataBlockType_ {dataBlockType}
 {
 }
 DigitalRadarDataGeneric::DataBlock::~DataBlock() = default;
@@ -48,6 +42,11 @@ DigitalRadarDataGeneric::DataBlock::DataBlock(DataBlock&&) noexcept = default;
 DigitalRadarDataGeneric::DataBlock&
 DigitalRadarDataGeneric::DataBlock::operator=(DataBlock&&) noexcept = default;
 
+DataBlockType DigitalRadarDataGeneric::DataBlock::data_block_type() const
+{
+   return dataBlockType_;
+}
+
 class DigitalRadarDataGeneric::MomentDataBlock::Impl
 {
 public:
@@ -63,13 +62,19 @@ public:
    float         scale_ {0.0f};
    float         offset_ {0.0f};
 
-   std::vector<std::uint8_t>  momentGates8_ {};
+   // 8-bit gates are a view into the message data. 16-bit gates are copied
+   // in host byte order, leaving the message data unmodified. The copy is
+   // allocated from the arena if one is provided, otherwise momentGates16_ is
+   // used.
+   const void*                 dataMoments_ {nullptr};
+   std::shared_ptr<const void> buffer_ {};
+
    std::vector<std::uint16_t> momentGates16_ {};
 };
 
 DigitalRadarDataGeneric::MomentDataBlock::MomentDataBlock(
-   const std::string& dataBlockType, const std::string& dataName) :
-    DataBlock(dataBlockType, dataName), p(std::make_unique<Impl>())
+   DataBlockType dataBlockType) :
+    DataBlock(dataBlockType), p(std::make_unique<Impl>())
 {
 }
 DigitalRadarDataGeneric::MomentDataBlock::~MomentDataBlock() = default;
@@ -138,34 +143,20 @@ float DigitalRadarDataGeneric::MomentDataBlock::offset() const
 
 const void* DigitalRadarDataGeneric::MomentDataBlock::data_moments() const
 {
-   const void* dataMoments;
-
-   switch (p->dataWordSize_)
-   {
-   case 8:
-      dataMoments = p->momentGates8_.data();
-      break;
-   case 16:
-      dataMoments = p->momentGates16_.data();
-      break;
-   default:
-      dataMoments = nullptr;
-      break;
-   }
-
-   return dataMoments;
+   return p->dataMoments_;
 }
 
 std::shared_ptr<DigitalRadarDataGeneric::MomentDataBlock>
 DigitalRadarDataGeneric::MomentDataBlock::Create(
-   const std::string& dataBlockType,
-   const std::string& dataName,
-   std::istream&      is)
+   DataBlockType                       dataBlockType,
+   util::ByteCursor&                   cursor,
+   const std::shared_ptr<const void>&  buffer,
+   const std::shared_ptr<util::Arena>& arena)
 {
    std::shared_ptr<MomentDataBlock> p =
-      std::make_shared<MomentDataBlock>(dataBlockType, dataName);
+      util::AllocateShared<MomentDataBlock>(arena, dataBlockType);
 
-   if (!p->Parse(is))
+   if (!p->Parse(cursor, buffer, arena))
    {
       p.reset();
    }
@@ -173,44 +164,57 @@ DigitalRadarDataGeneric::MomentDataBlock::Create(
    return p;
 }
 
-bool DigitalRadarDataGeneric::MomentDataBlock::Parse(std::istream& is)
+bool DigitalRadarDataGeneric::MomentDataBlock::Parse(
+   util::ByteCursor&                   cursor,
+   const std::shared_ptr<const void>&  buffer,
+   const std::shared_ptr<util::Arena>& arena)
 {
    bool dataBlockValid = true;
 
-   is.seekg(4, std::ios_base::cur);                                   // 4-7
-   is.read(reinterpret_cast<char*>(&p->numberOfDataMomentGates_), 2); // 8-9
-   is.read(reinterpret_cast<char*>(&p->dataMomentRange_), 2);         // 10-11
-   is.read(reinterpret_cast<char*>(&p->dataMomentRangeSampleInterval_),
-           2);                                             // 12-13
-   is.read(reinterpret_cast<char*>(&p->tover_), 2);        // 14-15
-   is.read(reinterpret_cast<char*>(&p->snrThreshold_), 2); // 16-17
-   is.read(reinterpret_cast<char*>(&p->controlFlags_), 1); // 18
-   is.read(reinterpret_cast<char*>(&p->dataWordSize_), 1); // 19
-   is.read(reinterpret_cast<char*>(&p->scale_), 4);        // 20-23
-   is.read(reinterpret_cast<char*>(&p->offset_), 4);       // 24-27
-
-   p->numberOfDataMomentGates_       = ntohs(p->numberOfDataMomentGates_);
-   p->dataMomentRange_               = ntohs(p->dataMomentRange_);
-   p->dataMomentRangeSampleInterval_ = ntohs(p->dataMomentRangeSampleInterval_);
-   p->tover_                         = ntohs(p->tover_);
-   p->snrThreshold_                  = ntohs(p->snrThreshold_);
-   p->scale_                         = awips::Message::SwapFloat(p->scale_);
-   p->offset_                        = awips::Message::SwapFloat(p->offset_);
+   cursor.Skip(4);                                                   // 4-7
+   p->numberOfDataMomentGates_       = cursor.Read<std::uint16_t>(); // 8-9
+   p->dataMomentRange_               = cursor.Read<std::int16_t>();  // 10-11
+   p->dataMomentRangeSampleInterval_ = cursor.Read<std::uint16_t>(); // 12-13
+   p->tover_                         = cursor.Read<std::uint16_t>(); // 14-15
+   p->snrThreshold_                  = cursor.Read<std::int16_t>();  // 16-17
+   p->controlFlags_                  = cursor.Read<std::uint8_t>();  // 18
+   p->dataWordSize_                  = cursor.Read<std::uint8_t>();  // 19
+   p->scale_                         = cursor.Read<float>();         // 20-23
+   p->offset_                        = cursor.Read<float>();         // 24-27
 
    if (p->numberOfDataMomentGates_ <= 1840)
    {
       if (p->dataWordSize_ == 8)
       {
-         p->momentGates8_.resize(p->numberOfDataMomentGates_);
-         is.read(reinterpret_cast<char*>(p->momentGates8_.data()),
-                 p->numberOfDataMomentGates_);
+         std::span<const std::byte> gates =
+            cursor.ReadBytes(p->numberOfDataMomentGates_);
+
+         p->dataMoments_ = gates.data();
+         p->buffer_      = buffer;
       }
       else if (p->dataWordSize_ == 16)
       {
-         p->momentGates16_.resize(p->numberOfDataMomentGates_);
-         is.read(reinterpret_cast<char*>(p->momentGates16_.data()),
-                 p->numberOfDataMomentGates_ * 2);
-         awips::Message::SwapVector(p->momentGates16_);
+         std::span<const std::byte> gates =
+            cursor.ReadBytes(p->numberOfDataMomentGates_ * 2u);
+
+         if (arena != nullptr)
+         {
+            std::uint16_t* gates16 = static_cast<std::uint16_t*>(
+               arena->allocate(gates.size(), alignof(std::uint16_t)));
+            util::SwapBytes16(gates.data(), gates16, gates.size() / 2);
+
+            // The copy remains valid for the lifetime of the arena
+            p->dataMoments_ = gates16;
+            p->buffer_      = arena;
+         }
+         else
+         {
+            p->momentGates16_.resize(gates.size() / 2);
+            util::SwapBytes16(
+               gates.data(), p->momentGates16_.data(), gates.size() / 2);
+
+            p->dataMoments_ = p->momentGates16_.data();
+         }
       }
       else
       {
@@ -225,6 +229,12 @@ bool DigitalRadarDataGeneric::MomentDataBlock::Parse(std::istream& is)
       dataBlockValid = false;
    }
 
+   if (cursor.fail())
+   {
+      logger_->warn("Moment data block exceeds message size");
+      dataBlockValid = false;
+   }
+
    return dataBlockValid;
 }
 
@@ -250,8 +260,8 @@ public:
 };
 
 DigitalRadarDataGeneric::VolumeDataBlock::VolumeDataBlock(
-   const std::string& dataBlockType, const std::string& dataName) :
-    DataBlock(dataBlockType, dataName), p(std::make_unique<Impl>())
+   DataBlockType dataBlockType) :
+    DataBlock(dataBlockType), p(std::make_unique<Impl>())
 {
 }
 DigitalRadarDataGeneric::VolumeDataBlock::~VolumeDataBlock() = default;
@@ -280,14 +290,14 @@ DigitalRadarDataGeneric::VolumeDataBlock::volume_coverage_pattern_number() const
 
 std::shared_ptr<DigitalRadarDataGeneric::VolumeDataBlock>
 DigitalRadarDataGeneric::VolumeDataBlock::Create(
-   const std::string& dataBlockType,
-   const std::string& dataName,
-   std::istream&      is)
+   DataBlockType                       dataBlockType,
+   util::ByteCursor&                   cursor,
+   const std::shared_ptr<util::Arena>& arena)
 {
    std::shared_ptr<VolumeDataBlock> p =
-      std::make_shared<VolumeDataBlock>(dataBlockType, dataName);
+      util::AllocateShared<VolumeDataBlock>(arena, dataBlockType);
 
-   if (!p->Parse(is))
+   if (!p->Parse(cursor))
    {
       p.reset();
    }
@@ -295,42 +305,24 @@ DigitalRadarDataGeneric::VolumeDataBlock::Create(
    return p;
 }
 
-bool DigitalRadarDataGeneric::VolumeDataBlock::Parse(std::istream& is)
+bool DigitalRadarDataGeneric::VolumeDataBlock::Parse(util::ByteCursor& cursor)
 {
    bool dataBlockValid = true;
 
-   is.read(reinterpret_cast<char*>(&p->lrtup_), 2);               // 4-5
-   is.read(reinterpret_cast<char*>(&p->versionNumberMajor_), 1);  // 6
-   is.read(reinterpret_cast<char*>(&p->versionNumberMinor_), 1);  // 7
-   is.read(reinterpret_cast<char*>(&p->latitude_), 4);            // 8-11
-   is.read(reinterpret_cast<char*>(&p->longitude_), 4);           // 12-15
-   is.read(reinterpret_cast<char*>(&p->siteHeight_), 2);          // 16-17
-   is.read(reinterpret_cast<char*>(&p->feedhornHeight_), 2);      // 18-19
-   is.read(reinterpret_cast<char*>(&p->calibrationConstant_), 4); // 20-23
-   is.read(reinterpret_cast<char*>(&p->horizontaShvTxPower_), 4); // 24-27
-   is.read(reinterpret_cast<char*>(&p->verticalShvTxPower_), 4);  // 28-31
-   is.read(reinterpret_cast<char*>(&p->systemDifferentialReflectivity_),
-           4); // 32-35
-   is.read(reinterpret_cast<char*>(&p->initialSystemDifferentialPhase_),
-           4); // 36-39
-   is.read(reinterpret_cast<char*>(&p->volumeCoveragePatternNumber_),
-           2);                                                 // 40-41
-   is.read(reinterpret_cast<char*>(&p->processingStatus_), 2); // 42-43
-
-   p->lrtup_               = ntohs(p->lrtup_);
-   p->latitude_            = awips::Message::SwapFloat(p->latitude_);
-   p->longitude_           = awips::Message::SwapFloat(p->longitude_);
-   p->siteHeight_          = ntohs(p->siteHeight_);
-   p->feedhornHeight_      = ntohs(p->feedhornHeight_);
-   p->calibrationConstant_ = awips::Message::SwapFloat(p->calibrationConstant_);
-   p->horizontaShvTxPower_ = awips::Message::SwapFloat(p->horizontaShvTxPower_);
-   p->verticalShvTxPower_  = awips::Message::SwapFloat(p->verticalShvTxPower_);
-   p->systemDifferentialReflectivity_ =
-      awips::Message::SwapFloat(p->systemDifferentialReflectivity_);
-   p->initialSystemDifferentialPhase_ =
-      awips::Message::SwapFloat(p->initialSystemDifferentialPhase_);
-   p->volumeCoveragePatternNumber_ = ntohs(p->volumeCoveragePatternNumber_);
-   p->processingStatus_            = ntohs(p->processingStatus_);
+   p->lrtup_                          = cursor.Read<std::uint16_t>(); // 4-5
+   p->versionNumberMajor_             = cursor.Read<std::uint8_t>();  // 6
+   p->versionNumberMinor_             = cursor.Read<std::uint8_t>();  // 7
+   p->latitude_                       = cursor.Read<float>();         // 8-11
+   p->longitude_                      = cursor.Read<float>();         // 12-15
+   p->siteHeight_                     = cursor.Read<std::int16_t>();  // 16-17
+   p->feedhornHeight_                 = cursor.Read<std::uint16_t>(); // 18-19
+   p->calibrationConstant_            = cursor.Read<float>();         // 20-23
+   p->horizontaShvTxPower_            = cursor.Read<float>();         // 24-27
+   p->verticalShvTxPower_             = cursor.Read<float>();         // 28-31
+   p->systemDifferentialReflectivity_ = cursor.Read<float>();         // 32-35
+   p->initialSystemDifferentialPhase_ = cursor.Read<float>();         // 36-39
+   p->volumeCoveragePatternNumber_    = cursor.Read<std::uint16_t>(); // 40-41
+   p->processingStatus_               = cursor.Read<std::uint16_t>(); // 42-43
 
    return dataBlockValid;
 }
@@ -346,8 +338,8 @@ public:
 };
 
 DigitalRadarDataGeneric::ElevationDataBlock::ElevationDataBlock(
-   const std::string& dataBlockType, const std::string& dataName) :
-    DataBlock(dataBlockType, dataName), p(std::make_unique<Impl>())
+   DataBlockType dataBlockType) :
+    DataBlock(dataBlockType), p(std::make_unique<Impl>())
 {
 }
 DigitalRadarDataGeneric::ElevationDataBlock::~ElevationDataBlock() = default;
@@ -360,14 +352,14 @@ DigitalRadarDataGeneric::ElevationDataBlock::operator=(
 
 std::shared_ptr<DigitalRadarDataGeneric::ElevationDataBlock>
 DigitalRadarDataGeneric::ElevationDataBlock::Create(
-   const std::string& dataBlockType,
-   const std::string& dataName,
-   std::istream&      is)
+   DataBlockType                       dataBlockType,
+   util::ByteCursor&                   cursor,
+   const std::shared_ptr<util::Arena>& arena)
 {
    std::shared_ptr<ElevationDataBlock> p =
-      std::make_shared<ElevationDataBlock>(dataBlockType, dataName);
+      util::AllocateShared<ElevationDataBlock>(arena, dataBlockType);
 
-   if (!p->Parse(is))
+   if (!p->Parse(cursor))
    {
       p.reset();
    }
@@ -375,17 +367,14 @@ DigitalRadarDataGeneric::ElevationDataBlock::Create(
    return p;
 }
 
-bool DigitalRadarDataGeneric::ElevationDataBlock::Parse(std::istream& is)
+bool DigitalRadarDataGeneric::ElevationDataBlock::Parse(
+   util::ByteCursor& cursor)
 {
    bool dataBlockValid = true;
 
-   is.read(reinterpret_cast<char*>(&p->lrtup_), 2);               // 4-5
-   is.read(reinterpret_cast<char*>(&p->atmos_), 2);               // 6-7
-   is.read(reinterpret_cast<char*>(&p->calibrationConstant_), 4); // 8-11
-
-   p->lrtup_               = ntohs(p->lrtup_);
-   p->atmos_               = ntohs(p->atmos_);
-   p->calibrationConstant_ = awips::Message::SwapFloat(p->calibrationConstant_);
+   p->lrtup_               = cursor.Read<std::uint16_t>(); // 4-5
+   p->atmos_               = cursor.Read<std::int16_t>();  // 6-7
+   p->calibrationConstant_ = cursor.Read<float>();         // 8-11
 
    return dataBlockValid;
 }
@@ -406,8 +395,8 @@ public:
 };
 
 DigitalRadarDataGeneric::RadialDataBlock::RadialDataBlock(
-   const std::string& dataBlockType, const std::string& dataName) :
-    DataBlock(dataBlockType, dataName), p(std::make_unique<Impl>())
+   DataBlockType dataBlockType) :
+    DataBlock(dataBlockType), p(std::make_unique<Impl>())
 {
 }
 DigitalRadarDataGeneric::RadialDataBlock::~RadialDataBlock() = default;
@@ -425,14 +414,14 @@ float DigitalRadarDataGeneric::RadialDataBlock::unambiguous_range() const
 
 std::shared_ptr<DigitalRadarDataGeneric::RadialDataBlock>
 DigitalRadarDataGeneric::RadialDataBlock::Create(
-   const std::string& dataBlockType,
-   const std::string& dataName,
-   std::istream&      is)
+   DataBlockType                       dataBlockType,
+   util::ByteCursor&                   cursor,
+   const std::shared_ptr<util::Arena>& arena)
 {
    std::shared_ptr<RadialDataBlock> p =
-      std::make_shared<RadialDataBlock>(dataBlockType, dataName);
+      util::AllocateShared<RadialDataBlock>(arena, dataBlockType);
 
-   if (!p->Parse(is))
+   if (!p->Parse(cursor))
    {
       p.reset();
    }
@@ -440,32 +429,18 @@ DigitalRadarDataGeneric::RadialDataBlock::Create(
    return p;
 }
 
-bool DigitalRadarDataGeneric::RadialDataBlock::Parse(std::istream& is)
+bool DigitalRadarDataGeneric::RadialDataBlock::Parse(util::ByteCursor& cursor)
 {
    bool dataBlockValid = true;
 
-   is.read(reinterpret_cast<char*>(&p->lrtup_), 2);                // 4-5
-   is.read(reinterpret_cast<char*>(&p->unambigiousRange_), 2);     // 6-7
-   is.read(reinterpret_cast<char*>(&p->noiseLevelHorizontal_), 4); // 8-11
-   is.read(reinterpret_cast<char*>(&p->noiseLevelVertical_), 4);   // 12-15
-   is.read(reinterpret_cast<char*>(&p->nyquistVelocity_), 2);      // 16-17
-   is.read(reinterpret_cast<char*>(&p->radialFlags_), 2);          // 18-19
-   is.read(reinterpret_cast<char*>(&p->calibrationConstantHorizontal_),
-           4); // 20-23
-   is.read(reinterpret_cast<char*>(&p->calibrationConstantVertical_),
-           4); // 24-27
-
-   p->lrtup_            = ntohs(p->lrtup_);
-   p->unambigiousRange_ = ntohs(p->unambigiousRange_);
-   p->noiseLevelHorizontal_ =
-      awips::Message::SwapFloat(p->noiseLevelHorizontal_);
-   p->noiseLevelVertical_ = awips::Message::SwapFloat(p->noiseLevelVertical_);
-   p->nyquistVelocity_    = ntohs(p->nyquistVelocity_);
-   p->radialFlags_        = ntohs(p->radialFlags_);
-   p->calibrationConstantHorizontal_ =
-      awips::Message::SwapFloat(p->calibrationConstantHorizontal_);
-   p->calibrationConstantVertical_ =
-      awips::Message::SwapFloat(p->calibrationConstantVertical_);
+   p->lrtup_                         = cursor.Read<std::uint16_t>(); // 4-5
+   p->unambigiousRange_              = cursor.Read<std::uint16_t>(); // 6-7
+   p->noiseLevelHorizontal_          = cursor.Read<float>();         // 8-11
+   p->noiseLevelVertical_            = cursor.Read<float>();         // 12-15
+   p->nyquistVelocity_               = cursor.Read<std::uint16_t>(); // 16-17
+   p->radialFlags_                   = cursor.Read<std::uint16_t>(); // 18-19
+   p->calibrationConstantHorizontal_ = cursor.Read<float>();         // 20-23
+   p->calibrationConstantVertical_   = cursor.Read<float>();         // 24-27
 
    return dataBlockValid;
 }
@@ -496,7 +471,7 @@ public:
    std::shared_ptr<VolumeDataBlock>    volumeDataBlock_ {nullptr};
    std::shared_ptr<ElevationDataBlock> elevationDataBlock_ {nullptr};
    std::shared_ptr<RadialDataBlock>    radialDataBlock_ {nullptr};
-   std::unordered_map<DataBlockType, std::shared_ptr<MomentDataBlock>>
+   std::array<std::shared_ptr<MomentDataBlock>, kMomentDataBlockCount_>
       momentDataBlock_ {};
 };
 
@@ -621,50 +596,66 @@ DigitalRadarDataGeneric::moment_data_block(DataBlockType type) const
 {
    std::shared_ptr<MomentDataBlock> momentDataBlock = nullptr;
 
-   auto it = p->momentDataBlock_.find(type);
-   if (it != p->momentDataBlock_.end())
+   if (type >= DataBlockType::MomentRef && type <= DataBlockType::MomentCfp)
    {
-      momentDataBlock = it->second;
+      momentDataBlock = p->momentDataBlock_[static_cast<std::size_t>(type) -
+                                            static_cast<std::size_t>(
+                                               DataBlockType::MomentRef)];
    }
 
    return momentDataBlock;
 }
 
 bool DigitalRadarDataGeneric::Parse(std::istream& is)
+{
+   // Copy the message into an owned buffer, and parse it in place
+   const std::size_t dataSize =
+      (header().message_size() == 65535) ?
+         (static_cast<std::size_t>(header().number_of_message_segments())
+          << 16) +
+            header().message_segment_number() :
+         data_size();
+
+   auto buffer = std::make_shared<std::vector<std::byte>>(dataSize);
+
+   is.read(reinterpret_cast<char*>(buffer->data()),
+           static_cast<std::streamsize>(dataSize));
+
+   if (is.eof() || is.fail())
+   {
+      logger_->warn("Reached end of data stream");
+      return false;
+   }
+
+   return Parse(*buffer, buffer);
+}
+
+bool DigitalRadarDataGeneric::Parse(std::span<const std::byte>          data,
+                                    const std::shared_ptr<const void>&  buffer,
+                                    const std::shared_ptr<util::Arena>& arena)
 {
    logger_->trace("Parsing Digital Radar Data (Message Type 31)");
 
-   bool        messageValid = true;
-   std::size_t bytesRead    = 0;
-
-   std::streampos isBegin = is.tellg();
-
-   p->radarIdentifier_.resize(4);
-
-   is.read(&p->radarIdentifier_[0], 4);                                // 0-3
-   is.read(reinterpret_cast<char*>(&p->collectionTime_), 4);           // 4-7
-   is.read(reinterpret_cast<char*>(&p->modifiedJulianDate_), 2);       // 8-9
-   is.read(reinterpret_cast<char*>(&p->azimuthNumber_), 2);            // 10-11
-   is.read(reinterpret_cast<char*>(&p->azimuthAngle_), 4);             // 12-15
-   is.read(reinterpret_cast<char*>(&p->compressionIndicator_), 1);     // 16
-   is.seekg(1, std::ios_base::cur);                                    // 17
-   is.read(reinterpret_cast<char*>(&p->radialLength_), 2);             // 18-19
-   is.read(reinterpret_cast<char*>(&p->azimuthResolutionSpacing_), 1); // 20
-   is.read(reinterpret_cast<char*>(&p->radialStatus_), 1);             // 21
-   is.read(reinterpret_cast<char*>(&p->elevationNumber_), 1);          // 22
-   is.read(reinterpret_cast<char*>(&p->cutSectorNumber_), 1);          // 23
-   is.read(reinterpret_cast<char*>(&p->elevationAngle_), 4);           // 24-27
-   is.read(reinterpret_cast<char*>(&p->radialSpotBlankingStatus_), 1); // 28
-   is.read(reinterpret_cast<char*>(&p->azimuthIndexingMode_), 1);      // 29
-   is.read(reinterpret_cast<char*>(&p->dataBlockCount_), 2);           // 30-31
-
-   p->collectionTime_     = ntohl(p->collectionTime_);
-   p->modifiedJulianDate_ = ntohs(p->modifiedJulianDate_);
-   p->azimuthNumber_      = ntohs(p->azimuthNumber_);
-   p->azimuthAngle_       = SwapFloat(p->azimuthAngle_);
-   p->radialLength_       = ntohs(p->radialLength_);
-   p->elevationAngle_     = SwapFloat(p->elevationAngle_);
-   p->dataBlockCount_     = ntohs(p->dataBlockCount_);
+   bool messageValid = true;
+
+   util::ByteCursor cursor(data);
+
+   p->radarIdentifier_      = cursor.ReadString(4);             // 0-3
+   p->collectionTime_       = cursor.Read<std::uint32_t>();     // 4-7
+   p->modifiedJulianDate_   = cursor.Read<std::uint16_t>();     // 8-9
+   p->azimuthNumber_        = cursor.Read<std::uint16_t>();     // 10-11
+   p->azimuthAngle_         = cursor.Read<float>();             // 12-15
+   p->compressionIndicator_ = cursor.Read<std::uint8_t>();      // 16
+   cursor.Skip(1);                                              // 17
+   p->radialLength_             = cursor.Read<std::uint16_t>(); // 18-19
+   p->azimuthResolutionSpacing_ = cursor.Read<std::uint8_t>();  // 20
+   p->radialStatus_             = cursor.Read<std::uint8_t>();  // 21
+   p->elevationNumber_          = cursor.Read<std::uint8_t>();  // 22
+   p->cutSectorNumber_          = cursor.Read<std::uint8_t>();  // 23
+   p->elevationAngle_           = cursor.Read<float>();         // 24-27
+   p->radialSpotBlankingStatus_ = cursor.Read<std::uint8_t>();  // 28
+   p->azimuthIndexingMode_      = cursor.Read<std::uint8_t>();  // 29
+   p->dataBlockCount_           = cursor.Read<std::uint16_t>(); // 30-31
 
    if (p->azimuthNumber_ < 1 || p->azimuthNumber_ > 720)
    {
@@ -692,44 +683,37 @@ bool DigitalRadarDataGeneric::Parse(std::istream& is)
       p->dataBlockCount_ = 0;
    }
 
-   is.read(reinterpret_cast<char*>(&p->dataBlockPointer_),
-           p->dataBlockCount_ * 4);
-
-   SwapArray(p->dataBlockPointer_, p->dataBlockCount_);
-
-   for (uint16_t b = 0; b < p->dataBlockCount_; ++b)
+   for (std::uint16_t b = 0; b < p->dataBlockCount_; ++b)
    {
-      is.seekg(isBegin + std::streamoff(p->dataBlockPointer_[b]),
-               std::ios_base::beg);
+      p->dataBlockPointer_[b] = cursor.Read<std::uint32_t>();
+   }
 
-      std::string dataBlockType(1, 0);
-      std::string dataName(3, 0);
+   for (std::uint16_t b = 0; b < p->dataBlockCount_; ++b)
+   {
+      cursor.Seek(p->dataBlockPointer_[b]);
 
-      is.read(&dataBlockType[0], 1);
-      is.read(&dataName[0], 3);
+      // Data block type (1 byte), followed by the data name (3 bytes)
+      cursor.Skip(1);
+      std::string dataName = cursor.ReadString(3);
 
       DataBlockType dataBlock = DataBlockType::Unknown;
-      try
-      {
-         dataBlock = strToDataBlock_.at(dataName);
-      }
-      catch (const std::exception&)
+      auto          it        = strToDataBlock_.find(dataName);
+      if (it != strToDataBlock_.cend())
       {
+         dataBlock = it->second;
       }
 
       switch (dataBlock)
       {
       case DataBlockType::Volume:
-         p->volumeDataBlock_ =
-            VolumeDataBlock::Create(dataBlockType, dataName, is);
+         p->volumeDataBlock_ = VolumeDataBlock::Create(dataBlock, cursor, arena);
          break;
       case DataBlockType::Elevation:
          p->elevationDataBlock_ =
-            ElevationDataBlock::Create(dataBlockType, dataName, is);
+            ElevationDataBlock::Create(dataBlock, cursor, arena);
          break;
       case DataBlockType::Radial:
-         p->radialDataBlock_ =
-            RadialDataBlock::Create(dataBlockType, dataName, is);
+         p->radialDataBlock_ = RadialDataBlock::Create(dataBlock, cursor, arena);
          break;
       case DataBlockType::MomentRef:
       case DataBlockType::MomentVel:
@@ -738,8 +722,10 @@ bool DigitalRadarDataGeneric::Parse(std::istream& is)
       case DataBlockType::MomentPhi:
       case DataBlockType::MomentRho:
       case DataBlockType::MomentCfp:
-         p->momentDataBlock_[dataBlock] =
-            MomentDataBlock::Create(dataBlockType, dataName, is);
+         p->momentDataBlock_[static_cast<std::size_t>(dataBlock) -
+                             static_cast<std::size_t>(
+                                DataBlockType::MomentRef)] =
+            MomentDataBlock::Create(dataBlock, cursor, buffer, arena);
          break;
       default:
          logger_->warn("Unknown data name: {}", dataName);
@@ -747,9 +733,9 @@ bool DigitalRadarDataGeneric::Parse(std::istream& is)
       }
    }
 
-   is.seekg(isBegin, std::ios_base::beg);
-   if (!ValidateMessage(is, bytesRead))
+   if (cursor.fail())
    {
+      logger_->warn("Reached end of data");
       messageValid = false;
    }
 
@@ -771,6 +757,24 @@ DigitalRadarDataGeneric::Create(Level2MessageHeader&& header, std::istream& is)
    return message;
 }
 
+std::shared_ptr<DigitalRadarDataGeneric>
+DigitalRadarDataGeneric::Create(Level2MessageHeader&&               header,
+                                std::span<const std::byte>          data,
+                                const std::shared_ptr<const void>&  buffer,
+                                const std::shared_ptr<util::Arena>& arena)
+{
+   std::shared_ptr<DigitalRadarDataGeneric> message =
+      util::AllocateShared<DigitalRadarDataGeneric>(arena);
+   message->set_header(std::move(header));
+
+   if (!message->Parse(data, buffer, arena))
+   {
+      message.reset();
+   }
+
+   return message;
+}
+
 } // namespace rda
 } // namespace wsr88d
 } // namespace scwx
@@ -1,5 +1,6 @@
 #include <scwx/wsr88d/rda/level2_message_factory.hpp>
 
+#include <scwx/util/arena.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/vectorbuf.hpp>
 #include <scwx/wsr88d/rda/clutter_filter_bypass_map.hpp>
@@ -9,8 +10,11 @@
 #include <scwx/wsr88d/rda/performance_maintenance_data.hpp>
 #include <scwx/wsr88d/rda/rda_adaptation_data.hpp>
 #include <scwx/wsr88d/rda/rda_status_data.hpp>
+#include <scwx/wsr88d/rda/rda_types.hpp>
 #include <scwx/wsr88d/rda/volume_coverage_pattern_data.hpp>
 
+#include <algorithm>
+#include <cstring>
 #include <unordered_map>
 #include <vector>
 
@@ -25,6 +29,9 @@ static const std::string logPrefix_ =
    "scwx::wsr88d::rda::level2_message_factory";
 static const auto logger_ = util::Logger::Create(logPrefix_);
 
+// Initial arena size, sufficient for the radials in a typical LDM record
+static constexpr std::size_t kArenaInitialSize_ = 256u * 1024u;
+
 typedef std::function<std::shared_ptr<Level2Message>(Level2MessageHeader&&,
                                                      std::istream&)>
    CreateLevel2MessageFunction;
@@ -37,7 +44,11 @@ static const std::unordered_map<unsigned int, CreateLevel2MessageFunction>
             {13, ClutterFilterBypassMap::Create},
             {15, ClutterFilterMap::Create},
             {18, RdaAdaptationData::Create},
-            {31, DigitalRadarDataGeneric::Create}};
+            {31,
+             [](Level2MessageHeader&& header, std::istream& is)
+             {
+                return DigitalRadarDataGeneric::Create(std::move(header), is);
+             }}};
 
 struct Level2MessageFactory::Context
 {
@@ -49,19 +60,48 @@ struct Level2MessageFactory::Context
    {
    }
 
+   void Reset();
+
    std::vector<char> messageData_;
    size_t            bufferedSize_;
    util::vectorbuf   messageBuffer_;
    std::istream      messageBufferStream_;
    bool              bufferingData_ {false};
+
+   // Arena for messages parsed in place. A context is used by a single
+   // thread, so the arena is never allocated from concurrently.
+   std::shared_ptr<util::Arena> arena_ {};
 };
 
+struct SegmentInfo
+{
+   std::uint16_t segment_ {0};
+   std::uint16_t totalSegments_ {0};
+   std::size_t   dataSize_ {0};
+};
+
+static SegmentInfo GetSegmentInfo(const Level2MessageHeader& header);
+static std::shared_ptr<Level2Message>
+BufferSegment(Level2MessageFactory::Context&    ctx,
+              Level2MessageHeader&&             header,
+              const SegmentInfo&                segmentInfo,
+              const std::function<bool(char*)>& readSegment);
+
 std::shared_ptr<Level2MessageFactory::Context>
 Level2MessageFactory::CreateContext()
 {
    return std::make_shared<Context>();
 }
 
+void Level2MessageFactory::Context::Reset()
+{
+   messageData_.resize(0);
+   messageData_.shrink_to_fit();
+   messageBufferStream_.clear();
+   bufferedSize_  = 0;
+   bufferingData_ = false;
+}
+
 Level2MessageInfo Level2MessageFactory::Create(std::istream&             is,
                                                std::shared_ptr<Context>& ctx)
 {
@@ -70,28 +110,11 @@ Level2MessageInfo Level2MessageFactory::Create(std::istream&             is,
    info.headerValid  = header.Parse(is);
    info.messageValid = info.headerValid;
 
-   std::uint16_t segment       = 0;
-   std::uint16_t totalSegments = 0;
-   std::size_t   dataSize      = 0;
+   SegmentInfo segmentInfo {};
 
    if (info.headerValid)
    {
-      if (header.message_size() == 65535)
-      {
-         segment       = 1;
-         totalSegments = 1;
-         dataSize =
-            (static_cast<std::size_t>(header.number_of_message_segments())
-             << 16) +
-            header.message_segment_number();
-      }
-      else
-      {
-         segment       = header.message_segment_number();
-         totalSegments = header.number_of_message_segments();
-         dataSize      = static_cast<std::size_t>(header.message_size()) * 2 -
-                    Level2MessageHeader::SIZE;
-      }
+      segmentInfo = GetSegmentInfo(header);
    }
 
    if (info.headerValid && create_.find(header.message_type()) == create_.end())
@@ -105,89 +128,106 @@ Level2MessageInfo Level2MessageFactory::Create(std::istream&             is,
    {
       std::uint8_t messageType = header.message_type();
 
-      std::istream* messageStream = nullptr;
-
-      if (totalSegments == 1)
+      if (segmentInfo.totalSegments_ == 1)
       {
          logger_->trace("Found Message {}", static_cast<unsigned>(messageType));
-         messageStream = &is;
+
+         info.message = create_.at(messageType)(std::move(header), is);
+         ctx->Reset();
       }
       else
       {
-         logger_->trace("Found Message {} Segment {}/{}",
-                        static_cast<unsigned>(messageType),
-                        segment,
-                        totalSegments);
+         info.message = BufferSegment(
+            *ctx,
+            std::move(header),
+            segmentInfo,
+            [&is, &segmentInfo](char* data)
+            {
+               is.read(data,
+                       static_cast<std::streamsize>(segmentInfo.dataSize_));
+               return !is.eof();
+            });
+      }
+   }
+   else if (info.headerValid)
+   {
+      // Seek to the end of the current message
+      is.seekg(segmentInfo.dataSize_, std::ios_base::cur);
+   }
 
-         if (segment == 1)
-         {
-            // Estimate total message size
-            ctx->messageData_.resize(dataSize * totalSegments);
-            ctx->messageBufferStream_.clear();
-            ctx->bufferedSize_  = 0;
-            ctx->bufferingData_ = true;
-         }
-         else if (!ctx->bufferingData_)
-         {
-            // Segment number did not start at 1
-            logger_->trace("Ignoring Segment {}/{}, did not start at 1",
-                           segment,
-                           totalSegments);
-            info.messageValid = false;
-         }
+   if (info.message == nullptr)
+   {
+      info.messageValid = false;
+   }
 
-         if (ctx->bufferingData_)
-         {
-            if (ctx->messageData_.capacity() < ctx->bufferedSize_ + dataSize)
-            {
-               logger_->debug("Bad size estimate, increasing size");
+   return info;
+}
+
+Level2MessageInfo
+Level2MessageFactory::Create(std::span<const std::byte>         data,
+                             const std::shared_ptr<const void>& buffer,
+                             std::shared_ptr<Context>&          ctx)
+{
+   Level2MessageInfo   info;
+   Level2MessageHeader header;
+   util::ByteCursor    cursor(data);
+   info.headerValid  = header.Parse(cursor);
+   info.messageValid = info.headerValid;
 
-               // Estimate remaining size
-               uint16_t remainingSegments =
-                  std::max<uint16_t>(totalSegments - segment + 1, 100u);
-               size_t remainingSize = remainingSegments * dataSize;
+   SegmentInfo segmentInfo {};
 
-               ctx->messageData_.resize(ctx->bufferedSize_ + remainingSize);
-            }
+   if (info.headerValid)
+   {
+      segmentInfo = GetSegmentInfo(header);
 
-            is.read(ctx->messageData_.data() + ctx->bufferedSize_, dataSize);
-            ctx->bufferedSize_ += dataSize;
+      // Do not read beyond the end of the provided data
+      segmentInfo.dataSize_ =
+         std::min(segmentInfo.dataSize_, cursor.remaining());
+   }
 
-            if (is.eof())
-            {
-               logger_->warn("End of file reached trying to buffer message");
-               info.messageValid = false;
-               ctx->messageData_.shrink_to_fit();
-               ctx->bufferedSize_  = 0;
-               ctx->bufferingData_ = false;
-            }
-            else if (segment == totalSegments)
-            {
-               ctx->messageBuffer_.update_read_pointers(ctx->bufferedSize_);
-               header.set_message_size(static_cast<uint16_t>(
-                  ctx->bufferedSize_ / 2 + Level2MessageHeader::SIZE));
+   if (info.headerValid && create_.find(header.message_type()) == create_.end())
+   {
+      logger_->warn("Unknown message type: {}",
+                    static_cast<unsigned>(header.message_type()));
+      info.messageValid = false;
+   }
+
+   if (info.messageValid)
+   {
+      std::uint8_t               messageType = header.message_type();
+      std::span<const std::byte> messageData =
+         cursor.ReadBytes(segmentInfo.dataSize_);
 
-               messageStream = &ctx->messageBufferStream_;
-            }
+      if (segmentInfo.totalSegments_ == 1 &&
+          messageType ==
+             static_cast<std::uint8_t>(MessageId::DigitalRadarDataGeneric))
+      {
+         logger_->trace("Found Message {}", static_cast<unsigned>(messageType));
+
+         if (ctx->arena_ == nullptr)
+         {
+            ctx->arena_ = std::make_shared<util::Arena>(kArenaInitialSize_);
          }
-      }
 
-      if (messageStream != nullptr)
+         // Parse in place
+         info.message = DigitalRadarDataGeneric::Create(
+            std::move(header), messageData, buffer, ctx->arena_);
+      }
+      else
       {
-         info.message =
-            create_.at(messageType)(std::move(header), *messageStream);
-         ctx->messageData_.resize(0);
-         ctx->messageData_.shrink_to_fit();
-         ctx->messageBufferStream_.clear();
-         ctx->bufferedSize_  = 0;
-         ctx->bufferingData_ = false;
+         // Other message types are buffered, and parsed from the buffer
+         info.message = BufferSegment(*ctx,
+                                      std::move(header),
+                                      segmentInfo,
+                                      [&messageData](char* data)
+                                      {
+                                         std::memcpy(data,
+                                                     messageData.data(),
+                                                     messageData.size());
+                                         return true;
+                                      });
       }
    }
-   else if (info.headerValid)
-   {
-      // Seek to the end of the current message
-      is.seekg(dataSize, std::ios_base::cur);
-   }
 
    if (info.message == nullptr)
    {
@@ -197,6 +237,123 @@ Level2MessageInfo Level2MessageFactory::Create(std::istream&             is,
    return info;
 }
 
+static SegmentInfo GetSegmentInfo(const Level2MessageHeader& header)
+{
+   SegmentInfo segmentInfo {};
+
+   if (header.message_size() == 65535)
+   {
+      segmentInfo.segment_       = 1;
+      segmentInfo.totalSegments_ = 1;
+      segmentInfo.dataSize_ =
+         (static_cast<std::size_t>(header.number_of_message_segments())
+          << 16) +
+         header.message_segment_number();
+   }
+   else
+   {
+      segmentInfo.segment_       = header.message_segment_number();
+      segmentInfo.totalSegments_ = header.number_of_message_segments();
+      segmentInfo.dataSize_ =
+         static_cast<std::size_t>(header.message_size()) * 2 -
+         Level2MessageHeader::SIZE;
+   }
+
+   return segmentInfo;
+}
+
+/**
+ * Buffers a message segment, and creates the message once its final segment
+ * has been buffered. A message with a single segment is created immediately.
+ *
+ * @param ctx Message factory context
+ * @param header Message header of the segment
+ * @param segmentInfo Segment number, total segments and segment data size
+ * @param readSegment Reads the segment data into the provided destination,
+ * returning false if the data could not be read
+ *
+ * @return Message, or nullptr if the message is incomplete or invalid
+ */
+static std::shared_ptr<Level2Message>
+BufferSegment(Level2MessageFactory::Context&    ctx,
+              Level2MessageHeader&&             header,
+              const SegmentInfo&                segmentInfo,
+              const std::function<bool(char*)>& readSegment)
+{
+   const std::uint8_t  messageType   = header.message_type();
+   const std::uint16_t segment       = segmentInfo.segment_;
+   const std::uint16_t totalSegments = segmentInfo.totalSegments_;
+   const std::size_t   dataSize      = segmentInfo.dataSize_;
+
+   std::shared_ptr<Level2Message> message = nullptr;
+
+   if (totalSegments == 1)
+   {
+      logger_->trace("Found Message {}", static_cast<unsigned>(messageType));
+   }
+   else
+   {
+      logger_->trace("Found Message {} Segment {}/{}",
+                     static_cast<unsigned>(messageType),
+                     segment,
+                     totalSegments);
+   }
+
+   if (segment == 1)
+   {
+      // Estimate total message size
+      ctx.messageData_.resize(dataSize * totalSegments);
+      ctx.messageBufferStream_.clear();
+      ctx.bufferedSize_  = 0;
+      ctx.bufferingData_ = true;
+   }
+   else if (!ctx.bufferingData_)
+   {
+      // Segment number did not start at 1
+      logger_->trace(
+         "Ignoring Segment {}/{}, did not start at 1", segment, totalSegments);
+      return message;
+   }
+
+   if (ctx.messageData_.size() < ctx.bufferedSize_ + dataSize)
+   {
+      logger_->debug("Bad size estimate, increasing size");
+
+      // Estimate remaining size
+      uint16_t remainingSegments =
+         std::max<uint16_t>(totalSegments - segment + 1, 100u);
+      size_t remainingSize = remainingSegments * dataSize;
+
+      ctx.messageData_.resize(ctx.bufferedSize_ + remainingSize);
+   }
+
+   if (!readSegment(ctx.messageData_.data() + ctx.bufferedSize_))
+   {
+      logger_->warn("End of file reached trying to buffer message");
+      ctx.Reset();
+      return message;
+   }
+
+   ctx.bufferedSize_ += dataSize;
+
+   if (segment == totalSegments)
+   {
+      ctx.messageBuffer_.update_read_pointers(ctx.bufferedSize_);
+
+      if (totalSegments > 1)
+      {
+         header.set_message_size(static_cast<uint16_t>(
+            ctx.bufferedSize_ / 2 + Level2MessageHeader::SIZE));
+      }
+
+      message =
+         create_.at(messageType)(std::move(header), ctx.messageBufferStream_);
+      ctx.Reset();
+   }
+
+   return message;
+}
+
 } // namespace rda
 } // namespace wsr88d
 } // namespace scwx
@@ -1,15 +1,10 @@
 #include <scwx/wsr88d/rda/level2_message_header.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <array>
 #include <istream>
 #include <string>
 
-#ifdef _WIN32
-#   include <WinSock2.h>
-#else
-#   include <arpa/inet.h>
-#endif
-
 namespace scwx
 {
 namespace wsr88d
@@ -103,27 +98,36 @@ void Level2MessageHeader::set_message_size(uint16_t messageSize)
 
 bool Level2MessageHeader::Parse(std::istream& is)
 {
-   bool headerValid = true;
+   std::array<std::byte, SIZE> data;
 
-   is.read(reinterpret_cast<char*>(&p->messageSize_), 2);
-   is.read(reinterpret_cast<char*>(&p->rdaRedundantChannel_), 1);
-   is.read(reinterpret_cast<char*>(&p->messageType_), 1);
-   is.read(reinterpret_cast<char*>(&p->idSequenceNumber_), 2);
-   is.read(reinterpret_cast<char*>(&p->julianDate_), 2);
-   is.read(reinterpret_cast<char*>(&p->millisecondsOfDay_), 4);
-   is.read(reinterpret_cast<char*>(&p->numberOfMessageSegments_), 2);
-   is.read(reinterpret_cast<char*>(&p->messageSegmentNumber_), 2);
-
-   p->messageSize_             = ntohs(p->messageSize_);
-   p->idSequenceNumber_        = ntohs(p->idSequenceNumber_);
-   p->julianDate_              = ntohs(p->julianDate_);
-   p->millisecondsOfDay_       = ntohl(p->millisecondsOfDay_);
-   p->numberOfMessageSegments_ = ntohs(p->numberOfMessageSegments_);
-   p->messageSegmentNumber_    = ntohs(p->messageSegmentNumber_);
+   is.read(reinterpret_cast<char*>(data.data()), SIZE);
 
    if (is.eof())
    {
       logger_->debug("Reached end of file");
+      return false;
+   }
+
+   util::ByteCursor cursor(data);
+   return Parse(cursor);
+}
+
+bool Level2MessageHeader::Parse(util::ByteCursor& cursor)
+{
+   bool headerValid = true;
+
+   p->messageSize_             = cursor.Read<std::uint16_t>();
+   p->rdaRedundantChannel_     = cursor.Read<std::uint8_t>();
+   p->messageType_             = cursor.Read<std::uint8_t>();
+   p->idSequenceNumber_        = cursor.Read<std::uint16_t>();
+   p->julianDate_              = cursor.Read<std::uint16_t>();
+   p->millisecondsOfDay_       = cursor.Read<std::uint32_t>();
+   p->numberOfMessageSegments_ = cursor.Read<std::uint16_t>();
+   p->messageSegmentNumber_    = cursor.Read<std::uint16_t>();
+
+   if (cursor.fail())
+   {
+      logger_->debug("Reached end of data");
       headerValid = false;
    }
    else
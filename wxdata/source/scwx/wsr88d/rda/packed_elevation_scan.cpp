@@ -0,0 +1,767 @@
+#include <scwx/wsr88d/rda/packed_elevation_scan.hpp>
+#include <scwx/util/byte_swap.hpp>
+#include <scwx/util/decompress.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <execution>
+
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+static const std::string logPrefix_ =
+   "scwx::wsr88d::rda::packed_elevation_scan";
+static const auto logger_ = util::Logger::Create(logPrefix_);
+
+class PackedMomentDataBlock : public GenericRadarData::MomentDataBlock
+{
+public:
+   explicit PackedMomentDataBlock(
+      std::shared_ptr<const PackedElevationScan> elevationScan,
+      const PackedElevationScan::Moment*         moment,
+      std::size_t                                radial) :
+       elevationScan_ {std::move(elevationScan)},
+       moment_ {moment},
+       radialIndex_ {radial},
+       radial_ {moment->radials()[radial]},
+       dataMoments_ {moment->data_moments(radial)}
+   {
+   }
+   ~PackedMomentDataBlock() = default;
+
+   std::uint16_t number_of_data_moment_gates() const override
+   {
+      return radial_.numberOfDataMomentGates;
+   }
+   units::kilometers<float> data_moment_range() const override
+   {
+      return moment_->data_moment_range(radialIndex_);
+   }
+   std::int16_t data_moment_range_raw() const override
+   {
+      return radial_.dataMomentRangeRaw;
+   }
+   units::kilometers<float> data_moment_range_sample_interval() const override
+   {
+      return moment_->data_moment_range_sample_interval(radialIndex_);
+   }
+   std::uint16_t data_moment_range_sample_interval_raw() const override
+   {
+      return radial_.dataMomentRangeSampleIntervalRaw;
+   }
+   std::int16_t snr_threshold_raw() const override
+   {
+      return moment_->snr_threshold_raw();
+   }
+   std::uint8_t data_word_size() const override
+   {
+      return moment_->data_word_size();
+   }
+   float       scale() const override { return moment_->scale(); }
+   float       offset() const override { return moment_->offset(); }
+   const void* data_moments() const override { return dataMoments_; }
+
+private:
+   std::shared_ptr<const PackedElevationScan> elevationScan_;
+   const PackedElevationScan::Moment*         moment_;
+   std::size_t                                radialIndex_;
+   PackedElevationScan::MomentRadial          radial_;
+   const void*                                dataMoments_;
+};
+
+class PackedRadarData : public GenericRadarData
+{
+public:
+   explicit PackedRadarData(
+      std::shared_ptr<const PackedElevationScan> elevationScan,
+      std::size_t                                radial) :
+       elevationScan_ {std::move(elevationScan)},
+       header_ {elevationScan_->radial_headers()[radial]},
+       azimuthAngle_ {elevationScan_->azimuth_angles()[radial]},
+       radial_ {radial}
+   {
+   }
+   ~PackedRadarData() = default;
+
+   std::uint32_t collection_time() const override
+   {
+      return header_.collectionTime;
+   }
+   std::uint16_t modified_julian_date() const override
+   {
+      return header_.modifiedJulianDate;
+   }
+   units::degrees<float> azimuth_angle() const override
+   {
+      return units::degrees<float> {azimuthAngle_};
+   }
+   std::uint16_t azimuth_number() const override
+   {
+      return header_.azimuthNumber;
+   }
+   std::uint16_t elevation_number() const override
+   {
+      return header_.elevationNumber;
+   }
+   std::uint16_t volume_coverage_pattern_number() const override
+   {
+      return header_.volumeCoveragePatternNumber;
+   }
+
+   std::shared_ptr<MomentDataBlock>
+   moment_data_block(DataBlockType type) const override
+   {
+      const PackedElevationScan::Moment* moment = elevationScan_->moment(type);
+
+      if (moment == nullptr || moment->data_moments(radial_) == nullptr)
+      {
+         return nullptr;
+      }
+
+      return std::make_shared<PackedMomentDataBlock>(
+         elevationScan_, moment, radial_);
+   }
+
+   bool Parse(std::istream& /* is */) override { return false; }
+
+private:
+   std::shared_ptr<const PackedElevationScan> elevationScan_;
+   PackedElevationScan::RadialHeader          header_;
+   float                                      azimuthAngle_;
+   std::size_t                                radial_;
+};
+
+PackedElevationScan::PackedElevationScan()  = default;
+PackedElevationScan::~PackedElevationScan() = default;
+
+const PackedElevationScan::RadialHeader*
+PackedElevationScan::first_radial_header() const
+{
+   auto it = std::find_if(radialHeaders_.cbegin(),
+                          radialHeaders_.cend(),
+                          [](const RadialHeader& header)
+                          { return header.valid; });
+
+   return (it != radialHeaders_.cend()) ? &*it : nullptr;
+}
+
+const PackedElevationScan::RadialHeader*
+PackedElevationScan::last_radial_header() const
+{
+   auto it = std::find_if(radialHeaders_.crbegin(),
+                          radialHeaders_.crend(),
+                          [](const RadialHeader& header)
+                          { return header.valid; });
+
+   return (it != radialHeaders_.crend()) ? &*it : nullptr;
+}
+
+const PackedElevationScan::Moment*
+PackedElevationScan::moment(DataBlockType dataBlockType) const
+{
+   auto it = moments_.find(dataBlockType);
+   return (it != moments_.cend()) ? it->second.get() : nullptr;
+}
+
+std::shared_ptr<ElevationScan> PackedElevationScan::CreateElevationScan() const
+{
+   auto elevationScan = std::make_shared<ElevationScan>();
+   auto self          = shared_from_this();
+
+   for (std::size_t radial = 0; radial < radialHeaders_.size(); ++radial)
+   {
+      if (radialHeaders_[radial].valid)
+      {
+         elevationScan->emplace_hint(
+            elevationScan->end(),
+            static_cast<std::uint16_t>(radial),
+            std::make_shared<PackedRadarData>(self, radial));
+      }
+   }
+
+   return elevationScan;
+}
+
+void PackedElevationScan::DecodeMoments(
+   std::span<const Moment* const>          moments,
+   std::vector<std::vector<std::uint8_t>>& gates) const
+{
+   // Determine the records containing the moment gates. Moments share
+   // records, so each record is decoded once for all moments.
+   std::vector<std::size_t> recordIndices {};
+   for (const Moment* moment : moments)
+   {
+      for (std::size_t radial = 0; radial < moment->radials_.size(); ++radial)
+      {
+         if (moment->radials_[radial].numberOfDataMomentGates > 0)
+         {
+            recordIndices.push_back(moment->locations_[radial].recordIndex);
+         }
+      }
+   }
+
+   std::sort(recordIndices.begin(), recordIndices.end());
+   recordIndices.erase(std::unique(recordIndices.begin(), recordIndices.end()),
+                       recordIndices.end());
+
+   // Decode the records concurrently
+   std::vector<std::vector<char>> records(recordIndices.size());
+   std::transform(std::execution::par,
+                  recordIndices.cbegin(),
+                  recordIndices.cend(),
+                  records.begin(),
+                  [this](std::size_t recordIndex)
+                  { return recordSource_->Decode(recordIndex); });
+
+   gates.resize(moments.size());
+
+   std::size_t invalidRadials = 0;
+
+   for (std::size_t i = 0; i < moments.size(); ++i)
+   {
+      const Moment&             moment      = *moments[i];
+      std::vector<std::uint8_t>& momentGates = gates[i];
+
+      const std::size_t wordSize    = moment.dataWordSize_ / 8u;
+      const std::size_t radialCount = moment.radials_.size();
+
+      momentGates.assign(radialCount * moment.gateStride_ * wordSize, 0u);
+
+      for (std::size_t radial = 0; radial < radialCount; ++radial)
+      {
+         const MomentRadial& momentRadial = moment.radials_[radial];
+         if (momentRadial.numberOfDataMomentGates == 0)
+         {
+            continue;
+         }
+
+         const std::size_t size =
+            momentRadial.numberOfDataMomentGates * wordSize;
+
+         const MomentLocation& location = moment.locations_[radial];
+
+         auto recordIt = std::lower_bound(recordIndices.cbegin(),
+                                          recordIndices.cend(),
+                                          location.recordIndex);
+         const std::vector<char>& record =
+            records[std::distance(recordIndices.cbegin(), recordIt)];
+
+         if (location.offset + size > record.size())
+         {
+            // Gates which cannot be decoded are left zero (below threshold)
+            ++invalidRadials;
+            continue;
+         }
+
+         std::uint8_t* radialGates =
+            momentGates.data() + radial * moment.gateStride_ * wordSize;
+
+         if (wordSize == 2u)
+         {
+            // Copy and convert to host byte order in a single pass
+            util::SwapBytes16(record.data() + location.offset,
+                              reinterpret_cast<std::uint16_t*>(radialGates),
+                              momentRadial.numberOfDataMomentGates);
+         }
+         else
+         {
+            std::memcpy(radialGates, record.data() + location.offset, size);
+         }
+      }
+   }
+
+   // Return the decoded records to the buffer pool for reuse
+   std::shared_ptr<util::DecompressBufferPool> bufferPool =
+      util::DecompressBufferPool::Instance();
+   for (std::vector<char>& record : records)
+   {
+      bufferPool->Release(std::move(record));
+   }
+
+   if (invalidRadials > 0)
+   {
+      logger_->warn("Could not decode moment data for {} radials",
+                    invalidRadials);
+   }
+}
+
+bool PackedElevationScan::LoadMoment(DataBlockType dataBlockType)
+{
+   return LoadMoments({dataBlockType});
+}
+
+bool PackedElevationScan::LoadMoments(
+   const std::set<DataBlockType>& dataBlockTypes)
+{
+   std::vector<Moment*> unloadedMoments {};
+   bool                 found = false;
+
+   for (DataBlockType dataBlockType : dataBlockTypes)
+   {
+      auto it = moments_.find(dataBlockType);
+      if (it != moments_.end())
+      {
+         found = true;
+
+         if (!it->second->loaded())
+         {
+            unloadedMoments.push_back(it->second.get());
+         }
+      }
+   }
+
+   if (unloadedMoments.empty())
+   {
+      return found;
+   }
+
+   std::unique_lock lock {loadMutex_};
+
+   // Skip moments loaded by another thread
+   std::erase_if(unloadedMoments,
+                 [](const Moment* moment) { return moment->loaded(); });
+
+   if (unloadedMoments.empty())
+   {
+      return true;
+   }
+
+   if (recordSource_ == nullptr)
+   {
+      logger_->warn("No record source for moment data");
+      return false;
+   }
+
+   std::vector<std::vector<std::uint8_t>> gates {};
+   DecodeMoments(std::vector<const Moment*> {unloadedMoments.cbegin(),
+                                             unloadedMoments.cend()},
+                 gates);
+
+   // Publish the gates before marking the moment loaded, readers do not
+   // access the gates until loaded() returns true
+   for (std::size_t i = 0; i < unloadedMoments.size(); ++i)
+   {
+      Moment& moment = *unloadedMoments[i];
+
+      moment.gates_ = std::move(gates[i]);
+      moment.locations_.clear();
+      moment.locations_.shrink_to_fit();
+      moment.loaded_.store(true, std::memory_order_release);
+   }
+
+   return true;
+}
+
+bool PackedElevationScan::Write(std::ostream& os, bool compress)
+{
+   std::vector<DataBlockType> dataBlockTypes {};
+
+   for (auto& [dataBlockType, moment] : moments_)
+   {
+      if (moment->loaded() || recordSource_ != nullptr)
+      {
+         dataBlockTypes.push_back(dataBlockType);
+      }
+   }
+
+   util::WriteBytes(os, static_cast<std::uint32_t>(radialHeaders_.size()));
+
+   for (std::size_t radial = 0; radial < radialHeaders_.size(); ++radial)
+   {
+      const RadialHeader& header = radialHeaders_[radial];
+
+      util::WriteBytes(os, static_cast<std::uint8_t>(header.valid));
+      util::WriteBytes(os, header.collectionTime);
+      util::WriteBytes(os, header.modifiedJulianDate);
+      util::WriteBytes(os, header.azimuthNumber);
+      util::WriteBytes(os, header.elevationNumber);
+      util::WriteBytes(os, header.volumeCoveragePatternNumber);
+      util::WriteBytes(os, azimuthAngles_[radial]);
+   }
+
+   // Moments which have not been loaded are decoded together into temporary
+   // gates, which are released once written, so that writing the cache does
+   // not leave each moment resident
+   std::vector<const Moment*>             unloadedMoments {};
+   std::vector<std::vector<std::uint8_t>> decodedGates {};
+   std::unique_lock                       lock {loadMutex_};
+
+   for (DataBlockType dataBlockType : dataBlockTypes)
+   {
+      const Moment* moment = moments_.at(dataBlockType).get();
+      if (!moment->loaded())
+      {
+         unloadedMoments.push_back(moment);
+      }
+   }
+
+   if (!unloadedMoments.empty())
+   {
+      DecodeMoments(unloadedMoments, decodedGates);
+   }
+
+   lock.unlock();
+
+   util::WriteBytes(os, static_cast<std::uint32_t>(dataBlockTypes.size()));
+
+   for (DataBlockType dataBlockType : dataBlockTypes)
+   {
+      const Moment& moment = *moments_.at(dataBlockType);
+
+      // The gates of a loaded moment are not modified
+      auto unloadedIt = std::find(
+         unloadedMoments.cbegin(), unloadedMoments.cend(), &moment);
+      const std::span<const std::uint8_t> gates =
+         (unloadedIt == unloadedMoments.cend()) ?
+            std::span<const std::uint8_t> {moment.gates_} :
+            std::span<const std::uint8_t> {decodedGates[std::distance(
+               unloadedMoments.cbegin(), unloadedIt)]};
+      const std::span<const MomentRadial> radials {moment.radials_};
+
+      util::WriteBytes(os, static_cast<std::uint8_t>(dataBlockType));
+      util::WriteBytes(os, moment.dataWordSize_);
+      util::WriteBytes(os, moment.gateStride_);
+      util::WriteBytes(os, moment.snrThresholdRaw_);
+      util::WriteBytes(os, moment.scale_);
+      util::WriteBytes(os, moment.offset_);
+
+      for (const MomentRadial& momentRadial : radials)
+      {
+         util::WriteBytes(os, momentRadial.numberOfDataMomentGates);
+         util::WriteBytes(os, momentRadial.dataMomentRangeRaw);
+         util::WriteBytes(os, momentRadial.dataMomentRangeSampleIntervalRaw);
+      }
+
+      util::WriteBytes(os, static_cast<std::uint64_t>(gates.size()));
+
+      if (compress)
+      {
+         std::vector<char> compressedGates {};
+
+         {
+            boost::iostreams::filtering_ostream out;
+            out.push(boost::iostreams::zlib_compressor(
+               boost::iostreams::zlib::best_speed));
+            out.push(boost::iostreams::back_inserter(compressedGates));
+            out.write(reinterpret_cast<const char*>(gates.data()),
+                      static_cast<std::streamsize>(gates.size()));
+         }
+
+         util::WriteBytes(os,
+                          static_cast<std::uint64_t>(compressedGates.size()));
+         os.write(compressedGates.data(),
+                  static_cast<std::streamsize>(compressedGates.size()));
+      }
+      else
+      {
+         util::WriteBytes(os, static_cast<std::uint64_t>(gates.size()));
+         os.write(reinterpret_cast<const char*>(gates.data()),
+                  static_cast<std::streamsize>(gates.size()));
+      }
+   }
+
+   return os.good();
+}
+
+std::shared_ptr<PackedElevationScan>
+PackedElevationScan::Read(util::ByteCursor& cursor, bool compressed)
+{
+   auto packedScan = std::make_shared<PackedElevationScan>();
+
+   const std::size_t radialCount = cursor.Read<std::uint32_t>();
+
+   // Each radial requires at least 17 bytes, don't allocate for invalid data
+   if (radialCount > cursor.remaining())
+   {
+      return nullptr;
+   }
+
+   packedScan->radialHeaders_.resize(radialCount);
+   packedScan->azimuthAngles_.resize(radialCount);
+
+   for (std::size_t radial = 0; radial < radialCount; ++radial)
+   {
+      RadialHeader& header = packedScan->radialHeaders_[radial];
+
+      header.valid              = cursor.Read<std::uint8_t>() != 0;
+      header.collectionTime     = cursor.Read<std::uint32_t>();
+      header.modifiedJulianDate = cursor.Read<std::uint16_t>();
+      header.azimuthNumber      = cursor.Read<std::uint16_t>();
+      header.elevationNumber    = cursor.Read<std::uint16_t>();
+      header.volumeCoveragePatternNumber = cursor.Read<std::uint16_t>();
+      packedScan->azimuthAngles_[radial] = cursor.Read<float>();
+   }
+
+   const std::uint32_t momentCount = cursor.Read<std::uint32_t>();
+
+   for (std::uint32_t i = 0; i < momentCount && !cursor.fail(); ++i)
+   {
+      const auto dataBlockType =
+         static_cast<DataBlockType>(cursor.Read<std::uint8_t>());
+
+      if (dataBlockType < DataBlockType::MomentRef ||
+          dataBlockType > DataBlockType::MomentCfp)
+      {
+         logger_->warn("Invalid data block type: {}",
+                       static_cast<int>(dataBlockType));
+         return nullptr;
+      }
+
+      auto& moment = packedScan->moments_[dataBlockType];
+      moment       = std::make_unique<Moment>();
+
+      moment->dataWordSize_    = cursor.Read<std::uint8_t>();
+      moment->gateStride_      = cursor.Read<std::uint16_t>();
+      moment->snrThresholdRaw_ = cursor.Read<std::int16_t>();
+      moment->scale_           = cursor.Read<float>();
+      moment->offset_          = cursor.Read<float>();
+
+      moment->radials_.resize(radialCount);
+
+      for (MomentRadial& momentRadial : moment->radials_)
+      {
+         momentRadial.numberOfDataMomentGates = cursor.Read<std::uint16_t>();
+         momentRadial.dataMomentRangeRaw      = cursor.Read<std::int16_t>();
+         momentRadial.dataMomentRangeSampleIntervalRaw =
+            cursor.Read<std::uint16_t>();
+      }
+
+      const std::size_t          gatesSize   = cursor.Read<std::uint64_t>();
+      const std::size_t          storedSize  = cursor.Read<std::uint64_t>();
+      std::span<const std::byte> storedGates = cursor.ReadBytes(storedSize);
+
+      if (cursor.fail() || (moment->dataWordSize_ != 8 &&
+                            moment->dataWordSize_ != 16) ||
+          gatesSize != radialCount * moment->gateStride_ *
+                          (moment->dataWordSize_ / 8u))
+      {
+         logger_->warn("Invalid moment data");
+         return nullptr;
+      }
+
+      if (compressed)
+      {
+         // Decompress directly into the pre-sized moment matrix
+         moment->gates_.resize(gatesSize);
+
+         boost::iostreams::filtering_istream in;
+         in.push(boost::iostreams::zlib_decompressor());
+         in.push(boost::iostreams::array_source(
+            reinterpret_cast<const char*>(storedGates.data()),
+            storedGates.size()));
+
+         in.read(reinterpret_cast<char*>(moment->gates_.data()),
+                 static_cast<std::streamsize>(gatesSize));
+
+         if (static_cast<std::size_t>(in.gcount()) != gatesSize)
+         {
+            logger_->warn("Error decompressing moment data: {} of {} bytes",
+                          in.gcount(),
+                          gatesSize);
+            return nullptr;
+         }
+      }
+      else
+      {
+         if (storedSize != gatesSize)
+         {
+            logger_->warn("Invalid moment data size: {} != {}",
+                          storedSize,
+                          gatesSize);
+            return nullptr;
+         }
+
+         const auto* gates =
+            reinterpret_cast<const std::uint8_t*>(storedGates.data());
+         moment->gates_.assign(gates, gates + storedGates.size());
+      }
+
+      moment->loaded_ = true;
+   }
+
+   if (cursor.fail())
+   {
+      return nullptr;
+   }
+
+   return packedScan;
+}
+
+std::shared_ptr<PackedElevationScan>
+PackedElevationScan::Create(const ElevationScan&                elevationScan,
+                            std::shared_ptr<const RecordSource> recordSource,
+                            const std::set<DataBlockType>&      dataBlockTypes)
+{
+   auto packedScan = std::make_shared<PackedElevationScan>();
+
+   if (elevationScan.empty())
+   {
+      return packedScan;
+   }
+
+   const std::size_t radialCount =
+      static_cast<std::size_t>(elevationScan.crbegin()->first) + 1;
+
+   packedScan->radialHeaders_.resize(radialCount);
+   packedScan->azimuthAngles_.resize(radialCount, 0.0f);
+
+   // First pass: radial headers, and the extent of each moment
+   for (auto& [index, radarData] : elevationScan)
+   {
+      RadialHeader& header = packedScan->radialHeaders_[index];
+
+      header.valid              = true;
+      header.collectionTime     = radarData->collection_time();
+      header.modifiedJulianDate = radarData->modified_julian_date();
+      header.azimuthNumber      = radarData->azimuth_number();
+      header.elevationNumber    = radarData->elevation_number();
+      header.volumeCoveragePatternNumber =
+         radarData->volume_coverage_pattern_number();
+
+      packedScan->azimuthAngles_[index] = radarData->azimuth_angle().value();
+
+      for (auto dataBlockType : MomentDataBlockTypeIterator())
+      {
+         if (!dataBlockTypes.empty() && !dataBlockTypes.contains(dataBlockType))
+         {
+            continue;
+         }
+
+         auto momentDataBlock = radarData->moment_data_block(dataBlockType);
+         if (momentDataBlock == nullptr)
+         {
+            continue;
+         }
+
+         auto& moment = packedScan->moments_[dataBlockType];
+         if (moment == nullptr)
+         {
+            // Sweep-level fields are taken from the first radial
+            moment                   = std::make_unique<Moment>();
+            moment->dataWordSize_    = momentDataBlock->data_word_size();
+            moment->snrThresholdRaw_ = momentDataBlock->snr_threshold_raw();
+            moment->scale_           = momentDataBlock->scale();
+            moment->offset_          = momentDataBlock->offset();
+            moment->radials_.resize(radialCount);
+         }
+
+         moment->gateStride_ =
+            std::max(moment->gateStride_,
+                     momentDataBlock->number_of_data_moment_gates());
+      }
+   }
+
+   // Second pass: locate or copy gates into the moment matrices
+   std::vector<const void*> dataMoments(radialCount);
+
+   for (auto& [dataBlockType, moment] : packedScan->moments_)
+   {
+      if (moment->dataWordSize_ != 8 && moment->dataWordSize_ != 16)
+      {
+         logger_->warn("Unsupported data word size: {}",
+                       moment->dataWordSize_);
+         moment->dataWordSize_ = 8;
+         moment->gateStride_   = 0;
+         moment->loaded_       = true;
+         continue;
+      }
+
+      const std::size_t wordSize = moment->dataWordSize_ / 8u;
+
+      bool deferred = (recordSource != nullptr);
+      if (deferred)
+      {
+         moment->locations_.resize(radialCount);
+      }
+
+      std::fill(dataMoments.begin(), dataMoments.end(), nullptr);
+
+      for (auto& [index, radarData] : elevationScan)
+      {
+         auto momentDataBlock = radarData->moment_data_block(dataBlockType);
+         if (momentDataBlock == nullptr ||
+             momentDataBlock->data_moments() == nullptr)
+         {
+            continue;
+         }
+
+         if (momentDataBlock->data_word_size() != moment->dataWordSize_)
+         {
+            logger_->warn("Data word size mismatch in radial {}: {} != {}",
+                          index,
+                          momentDataBlock->data_word_size(),
+                          moment->dataWordSize_);
+            continue;
+         }
+
+         MomentRadial& momentRadial = moment->radials_[index];
+
+         momentRadial.numberOfDataMomentGates =
+            momentDataBlock->number_of_data_moment_gates();
+         momentRadial.dataMomentRangeRaw =
+            momentDataBlock->data_moment_range_raw();
+         momentRadial.dataMomentRangeSampleIntervalRaw =
+            momentDataBlock->data_moment_range_sample_interval_raw();
+
+         dataMoments[index] = momentDataBlock->data_moments();
+
+         if (deferred)
+         {
+            auto location = recordSource->Locate(
+               dataMoments[index],
+               momentRadial.numberOfDataMomentGates * wordSize);
+
+            if (location.has_value())
+            {
+               moment->locations_[index] = *location;
+            }
+            else
+            {
+               // Gates which were copied out of the record (e.g., segmented
+               // messages) cannot be decoded later
+               deferred = false;
+            }
+         }
+      }
+
+      if (deferred)
+      {
+         packedScan->recordSource_ = recordSource;
+         continue;
+      }
+
+      moment->locations_.clear();
+      moment->locations_.shrink_to_fit();
+      moment->gates_.resize(radialCount * moment->gateStride_ * wordSize, 0u);
+
+      for (std::size_t radial = 0; radial < radialCount; ++radial)
+      {
+         if (dataMoments[radial] != nullptr)
+         {
+            std::memcpy(moment->gates_.data() +
+                           radial * moment->gateStride_ * wordSize,
+                        dataMoments[radial],
+                        moment->radials_[radial].numberOfDataMomentGates *
+                           wordSize);
+         }
+      }
+
+      moment->loaded_ = true;
+   }
+
+   return packedScan;
+}
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
@@ -1,10 +1,10 @@
 #include <scwx/wsr88d/rpg/graphic_product_message.hpp>
+#include <scwx/util/decompress.hpp>
 #include <scwx/util/logger.hpp>
-#include <scwx/util/rangebuf.hpp>
 
 #include <istream>
-#include <sstream>
 #include <string>
+#include <vector>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -16,9 +16,8 @@
 #   pragma GCC diagnostic ignored "-Wdeprecated-copy"
 #endif
 
-#include <boost/iostreams/copy.hpp>
-#include <boost/iostreams/filtering_streambuf.hpp>
-#include <boost/iostreams/filter/bzip2.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/stream.hpp>
 
 #if defined(__GNUC__)
 #   pragma GCC diagnostic pop
@@ -113,25 +112,34 @@ bool GraphicProductMessage::Parse(std::istream& is)
          size_t recordSize =
             (messageLength > prefixLength) ? messageLength - prefixLength : 0;
 
-         boost::iostreams::filtering_streambuf<boost::iostreams::input> in;
-         util::rangebuf r(is.rdbuf(), recordSize);
-         in.push(boost::iostreams::bzip2_decompressor());
-         in.push(r);
+         std::shared_ptr<util::DecompressBufferPool> bufferPool =
+            util::DecompressBufferPool::Instance();
 
-         try
+         std::vector<char> compressedData = bufferPool->Acquire(recordSize);
+         compressedData.resize(recordSize);
+         is.read(compressedData.data(),
+                 static_cast<std::streamsize>(recordSize));
+         compressedData.resize(static_cast<std::size_t>(is.gcount()));
+
+         std::vector<char> data = bufferPool->Acquire();
+
+         if (util::DecompressBzip2(compressedData, data))
          {
-            std::stringstream ss;
-            std::streamsize   bytesCopied = boost::iostreams::copy(in, ss);
-            logger_->trace("Decompressed data size = {} bytes", bytesCopied);
+            logger_->trace("Decompressed data size = {} bytes", data.size());
 
-            dataValid = p->LoadBlocks(ss);
+            boost::iostreams::stream<boost::iostreams::array_source> ds(
+               data.data(), data.size());
+            dataValid = p->LoadBlocks(ds);
          }
-         catch (const boost::iostreams::bzip2_error& ex)
+         else
          {
-            logger_->warn("Error decompressing data: {}", ex.what());
+            logger_->warn("Error decompressing data");
 
             dataValid = false;
          }
+
+         bufferPool->Release(std::move(compressedData));
+         bufferPool->Release(std::move(data));
       }
       else
       {
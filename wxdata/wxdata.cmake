@@ -3,11 +3,13 @@ cmake_minimum_required(VERSION 3.24)
 project(scwx-data)
 
 find_package(Boost)
+find_package(BZip2)
 find_package(cpr)
 find_package(LibXml2)
 find_package(OpenSSL)
 find_package(re2)
 find_package(spdlog)
+find_package(ZLIB)
 
 if (NOT MSVC)
     find_package(TBB)
@@ -61,35 +63,46 @@ set(SRC_NETWORK source/scwx/network/cpr.cpp
 set(HDR_PROVIDER include/scwx/provider/aws_level2_data_provider.hpp
                  include/scwx/provider/aws_level3_data_provider.hpp
                  include/scwx/provider/aws_nexrad_data_provider.hpp
+                 include/scwx/provider/local_level2_chunk_data_provider.hpp
                  include/scwx/provider/nexrad_data_provider.hpp
                  include/scwx/provider/nexrad_data_provider_factory.hpp
                  include/scwx/provider/warnings_provider.hpp)
 set(SRC_PROVIDER source/scwx/provider/aws_level2_data_provider.cpp
                  source/scwx/provider/aws_level3_data_provider.cpp
                  source/scwx/provider/aws_nexrad_data_provider.cpp
+                 source/scwx/provider/local_level2_chunk_data_provider.cpp
                  source/scwx/provider/nexrad_data_provider.cpp
                  source/scwx/provider/nexrad_data_provider_factory.cpp
                  source/scwx/provider/warnings_provider.cpp)
-set(HDR_UTIL include/scwx/util/digest.hpp
+set(HDR_UTIL include/scwx/util/arena.hpp
+             include/scwx/util/byte_cursor.hpp
+             include/scwx/util/byte_swap.hpp
+             include/scwx/util/decompress.hpp
+             include/scwx/util/digest.hpp
              include/scwx/util/enum.hpp
              include/scwx/util/environment.hpp
              include/scwx/util/float.hpp
              include/scwx/util/hash.hpp
              include/scwx/util/iterator.hpp
              include/scwx/util/logger.hpp
+             include/scwx/util/lru_cache.hpp
              include/scwx/util/map.hpp
              include/scwx/util/rangebuf.hpp
+             include/scwx/util/scheduler.hpp
              include/scwx/util/streams.hpp
              include/scwx/util/strings.hpp
              include/scwx/util/threads.hpp
              include/scwx/util/time.hpp
              include/scwx/util/vectorbuf.hpp)
-set(SRC_UTIL source/scwx/util/digest.cpp
+set(SRC_UTIL source/scwx/util/byte_swap.cpp
+             source/scwx/util/decompress.cpp
+             source/scwx/util/digest.cpp
              source/scwx/util/environment.cpp
              source/scwx/util/float.cpp
              source/scwx/util/hash.cpp
              source/scwx/util/logger.cpp
              source/scwx/util/rangebuf.cpp
+             source/scwx/util/scheduler.cpp
              source/scwx/util/streams.cpp
              source/scwx/util/strings.cpp
              source/scwx/util/time.cpp
@@ -99,7 +112,9 @@ set(HDR_WSR88D include/scwx/wsr88d/ar2v_file.hpp
                include/scwx/wsr88d/level3_file.hpp
                include/scwx/wsr88d/nexrad_file.hpp
                include/scwx/wsr88d/nexrad_file_factory.hpp
-               include/scwx/wsr88d/wsr88d_types.hpp)
+               include/scwx/wsr88d/nexrad_file_metadata.hpp
+               include/scwx/wsr88d/wsr88d_types.hpp
+               include/scwx/wsr88d/detail/elevation_scan_index.hpp)
 set(SRC_WSR88D source/scwx/wsr88d/ar2v_file.cpp
                source/scwx/wsr88d/level3_file.cpp
                source/scwx/wsr88d/nexrad_file.cpp
@@ -113,6 +128,7 @@ set(HDR_WSR88D_RDA include/scwx/wsr88d/rda/clutter_filter_bypass_map.hpp
                    include/scwx/wsr88d/rda/level2_message.hpp
                    include/scwx/wsr88d/rda/level2_message_factory.hpp
                    include/scwx/wsr88d/rda/level2_message_header.hpp
+                   include/scwx/wsr88d/rda/packed_elevation_scan.hpp
                    include/scwx/wsr88d/rda/performance_maintenance_data.hpp
                    include/scwx/wsr88d/rda/rda_adaptation_data.hpp
                    include/scwx/wsr88d/rda/rda_status_data.hpp
@@ -126,6 +142,7 @@ set(SRC_WSR88D_RDA source/scwx/wsr88d/rda/clutter_filter_bypass_map.cpp
                    source/scwx/wsr88d/rda/level2_message.cpp
                    source/scwx/wsr88d/rda/level2_message_factory.cpp
                    source/scwx/wsr88d/rda/level2_message_header.cpp
+                   source/scwx/wsr88d/rda/packed_elevation_scan.cpp
                    source/scwx/wsr88d/rda/performance_maintenance_data.cpp
                    source/scwx/wsr88d/rda/rda_adaptation_data.cpp
                    source/scwx/wsr88d/rda/rda_status_data.cpp
@@ -290,14 +307,15 @@ endif()
 
 target_link_libraries(wxdata PUBLIC aws-cpp-sdk-core
                                     aws-cpp-sdk-s3
+                                    BZip2::BZip2
                                     cpr::cpr
                                     LibXml2::LibXml2
                                     OpenSSL::Crypto
                                     re2::re2
                                     spdlog::spdlog
-                                    units::units)
+                                    units::units
+                                    ZLIB::ZLIB)
 target_link_libraries(wxdata INTERFACE Boost::iostreams
-                                       BZip2::BZip2
                                        hsluv-c)
 
 if (WIN32)